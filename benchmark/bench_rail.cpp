@@ -0,0 +1,403 @@
+#include "Definitions.hpp"
+#include "EOMHelper.hpp"
+#include "datastructure/RailwayNetwork.hpp"
+#include "probleminstances/GeneralPerformanceOptimizationInstance.hpp"
+#include "probleminstances/VSSGenerationTimetable.hpp"
+#include "rail_bench.hpp"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Benchmarks of the main building blocks on the bundled example networks.
+// By default, the results are written to rail_bench.json so that runs on
+// different commits can be compared, e.g., using compare.py of Google
+// Benchmark. Pass --benchmark_out=<file> to choose another file.
+
+#ifndef RAIL_BENCH_GIT_COMMIT
+#define RAIL_BENCH_GIT_COMMIT "unknown"
+#endif
+
+namespace {
+using cda_rail::V_MIN;
+using cda_rail::bench::GEN_PO_INSTANCES;
+using cda_rail::bench::instance_path;
+using cda_rail::bench::scratch_path;
+using cda_rail::bench::set_network_info;
+using cda_rail::bench::VSS_INSTANCES;
+using VSSInstance = cda_rail::instances::VSSGenerationTimetable;
+using GenPOInstance =
+    cda_rail::instances::GeneralPerformanceOptimizationInstance;
+
+// Instance load
+
+void BM_ImportVSSInstance(benchmark::State& state) {
+  const auto& instance = VSS_INSTANCES.at(state.range(0));
+  for (auto _ : state) {
+    auto vss_instance = VSSInstance::import_instance(instance_path(instance));
+    benchmark::DoNotOptimize(vss_instance);
+  }
+  set_network_info(
+      state, instance,
+      VSSInstance::import_instance(instance_path(instance)).const_n());
+}
+
+void BM_ImportVSSInstanceBinary(benchmark::State& state) {
+  const auto& instance = VSS_INSTANCES.at(state.range(0));
+  const auto  file     = scratch_path("vss_instance.bin");
+  const auto  vss_instance =
+      VSSInstance::import_instance(instance_path(instance));
+  vss_instance.export_instance_binary(file);
+  for (auto _ : state) {
+    auto imported_instance = VSSInstance::import_instance_binary(file);
+    benchmark::DoNotOptimize(imported_instance);
+  }
+  std::filesystem::remove(file);
+  set_network_info(state, instance, vss_instance.const_n());
+}
+
+void BM_ImportGenPOInstance(benchmark::State& state) {
+  const auto& instance = GEN_PO_INSTANCES.at(state.range(0));
+  for (auto _ : state) {
+    auto gen_po_instance = GenPOInstance(instance_path(instance));
+    benchmark::DoNotOptimize(gen_po_instance);
+  }
+  set_network_info(state, instance,
+                   GenPOInstance(instance_path(instance)).const_n());
+}
+
+void BM_ImportGenPOInstanceBinary(benchmark::State& state) {
+  const auto& instance        = GEN_PO_INSTANCES.at(state.range(0));
+  const auto  file            = scratch_path("gen_po_instance.bin");
+  const auto  gen_po_instance = GenPOInstance(instance_path(instance));
+  gen_po_instance.export_instance_binary(file);
+  for (auto _ : state) {
+    auto imported_instance = GenPOInstance::import_instance_binary(file);
+    benchmark::DoNotOptimize(imported_instance);
+  }
+  std::filesystem::remove(file);
+  set_network_info(state, instance, gen_po_instance.const_n());
+}
+
+// Network transformations
+
+void BM_Discretize(benchmark::State& state) {
+  const auto& instance = VSS_INSTANCES.at(state.range(0));
+  const auto  network =
+      cda_rail::Network::import_network(instance_path(instance) / "network");
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto discretized_network = network;
+    state.ResumeTiming();
+    auto new_edges = discretized_network.discretize();
+    benchmark::DoNotOptimize(new_edges);
+  }
+  set_network_info(state, instance, network);
+}
+
+void BM_SeparateStopEdges(benchmark::State& state) {
+  const auto& instance        = GEN_PO_INSTANCES.at(state.range(0));
+  const auto  gen_po_instance = GenPOInstance(instance_path(instance));
+  std::vector<size_t> stop_edges;
+  for (const auto& station_name :
+       gen_po_instance.get_station_list().get_station_names()) {
+    const auto& tracks =
+        gen_po_instance.get_station_list().get_station(station_name).tracks;
+    stop_edges.insert(stop_edges.end(), tracks.begin(), tracks.end());
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto network = gen_po_instance.const_n();
+    state.ResumeTiming();
+    auto new_edges = network.separate_stop_edges(stop_edges);
+    benchmark::DoNotOptimize(new_edges);
+  }
+  state.counters["stop_edges"] = static_cast<double>(stop_edges.size());
+  set_network_info(state, instance, gen_po_instance.const_n());
+}
+
+// All edge pairs shortest paths, additionally on a network with many parallel
+// tracks
+
+const std::vector<std::string> SHORTEST_PATH_INSTANCES = {
+    "example-networks/SimpleStation",
+    "example-networks/Overtake",
+    "example-networks/SimpleNetwork",
+    "example-networks/Stammstrecke16Trains",
+    "example-networks-gen-po/GeneralSimpleNetwork30Trains",
+};
+
+cda_rail::Network shortest_path_network(size_t instance_index) {
+  auto network = cda_rail::Network::import_network(
+      instance_path(SHORTEST_PATH_INSTANCES.at(instance_index)) / "network");
+  network.discretize();
+  return network;
+}
+
+std::vector<std::vector<double>>
+floyd_warshall(const cda_rail::Network& network) {
+  // Dense reference implementation on the successor graph
+  const auto                       n = network.number_of_edges();
+  std::vector<std::vector<double>> ret_val(
+      n, std::vector<double>(n, cda_rail::INF));
+
+  for (size_t u = 0; u < n; ++u) {
+    for (size_t v = 0; v < n; ++v) {
+      if (u == v) {
+        ret_val[u][v] = 0;
+      } else if (network.is_valid_successor(u, v)) {
+        ret_val[u][v] = network.get_edge(v).length;
+      }
+    }
+  }
+
+  for (size_t k = 0; k < n; ++k) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        ret_val[i][j] = std::min(ret_val[i][j], ret_val[i][k] + ret_val[k][j]);
+      }
+    }
+  }
+
+  return ret_val;
+}
+
+void BM_AllEdgePairsShortestPathsFloydWarshall(benchmark::State& state) {
+  const auto network = shortest_path_network(state.range(0));
+  for (auto _ : state) {
+    auto distances = floyd_warshall(network);
+    benchmark::DoNotOptimize(distances.data());
+  }
+  set_network_info(state, SHORTEST_PATH_INSTANCES.at(state.range(0)),
+                   network);
+}
+
+void BM_AllEdgePairsShortestPaths(benchmark::State& state) {
+  const auto network     = shortest_path_network(state.range(0));
+  const auto num_threads = static_cast<size_t>(state.range(1));
+  for (auto _ : state) {
+    auto distances = network.all_edge_pairs_shortest_paths_matrix(num_threads);
+    benchmark::DoNotOptimize(distances(0, 0));
+  }
+  set_network_info(state, SHORTEST_PATH_INSTANCES.at(state.range(0)),
+                   network);
+}
+
+void BM_AllEdgePairsShortestPathsCompact(benchmark::State& state) {
+  const auto network     = shortest_path_network(state.range(0));
+  const auto num_threads = static_cast<size_t>(state.range(1));
+  for (auto _ : state) {
+    auto distances =
+        network.all_edge_pairs_shortest_paths_matrix_compact(num_threads);
+    benchmark::DoNotOptimize(distances(0, 0));
+  }
+  set_network_info(state, SHORTEST_PATH_INSTANCES.at(state.range(0)),
+                   network);
+}
+
+// EOM kernels
+
+struct EOMInput {
+  double v_1;
+  double v_2;
+  double v_min;
+  double v_max;
+  double a;
+  double d;
+  double s;
+  double obd;
+};
+
+using EOMKernel = double (*)(const EOMInput&);
+
+std::vector<EOMInput> eom_inputs(EOMKernel kernel) {
+  // Grid of typical train parameters, restricted to inputs the kernel accepts
+  std::vector<EOMInput> ret_val;
+  for (const double v_1 : {0.0, 5.0, 10.0, 20.0, 30.0}) {
+    for (const double v_2 : {0.0, 5.0, 10.0, 20.0, 30.0}) {
+      for (const double a : {0.5, 1.0, 2.0}) {
+        for (const double d : {0.5, 1.0, 2.0}) {
+          for (const double s : {50.0, 500.0, 5000.0}) {
+            // The point at distance obd before the final moving authority
+            // has to lie beyond the initial moving authority
+            const double obd = s / 2;
+            if (!cda_rail::possible_by_eom(v_1, v_2, a, d, s) ||
+                v_1 * v_1 / (2 * d) + obd >= s + v_2 * v_2 / (2 * d)) {
+              continue;
+            }
+            const auto input = EOMInput{v_1, v_2, V_MIN, 40, a, d, s, obd};
+            try {
+              benchmark::DoNotOptimize(kernel(input));
+              ret_val.push_back(input);
+            } catch (const std::exception&) {
+              // Input not reachable by the equations of motion
+            }
+          }
+        }
+      }
+    }
+  }
+  return ret_val;
+}
+
+double eom_min_travel_time(const EOMInput& in) {
+  return cda_rail::min_travel_time(in.v_1, in.v_2, in.v_max, in.a, in.d, in.s);
+}
+
+double eom_max_travel_time_no_stopping(const EOMInput& in) {
+  return cda_rail::max_travel_time(in.v_1, in.v_2, in.v_min, in.a, in.d, in.s,
+                                   false);
+}
+
+double eom_max_travel_time_stopping_allowed(const EOMInput& in) {
+  return cda_rail::max_travel_time(in.v_1, in.v_2, in.v_min, in.a, in.d, in.s,
+                                   true);
+}
+
+double eom_min_time_from_rear_to_ma_point(const EOMInput& in) {
+  return cda_rail::min_time_from_rear_to_ma_point(
+      in.v_1, in.v_2, in.v_min, in.v_max, in.a, in.d, in.s, in.obd);
+}
+
+double eom_max_time_from_front_to_ma_point(const EOMInput& in) {
+  return cda_rail::max_time_from_front_to_ma_point(
+      in.v_1, in.v_2, in.v_min, in.a, in.d, in.s, in.obd, true);
+}
+
+void BM_EOMKernel(benchmark::State& state, EOMKernel kernel) {
+  const auto inputs = eom_inputs(kernel);
+  for (auto _ : state) {
+    for (const auto& input : inputs) {
+      benchmark::DoNotOptimize(kernel(input));
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(inputs.size()));
+}
+
+using EOMBatchKernel = std::vector<double> (*)(const cda_rail::EOMBatch&);
+
+std::vector<double> eom_batch_min_travel_time(const cda_rail::EOMBatch& in) {
+  return in.min_travel_time_from_start();
+}
+
+std::vector<double>
+eom_batch_max_travel_time_no_stopping(const cda_rail::EOMBatch& in) {
+  return in.max_travel_time_from_start(false);
+}
+
+std::vector<double>
+eom_batch_max_travel_time_stopping_allowed(const cda_rail::EOMBatch& in) {
+  return in.max_travel_time_from_start(true);
+}
+
+void BM_EOMBatchKernel(benchmark::State& state, EOMKernel kernel,
+                       EOMBatchKernel batch_kernel, bool v_m_is_maximal) {
+  // Same inputs as the respective scalar kernel, so that the throughput is
+  // comparable
+  const auto         inputs = eom_inputs(kernel);
+  cda_rail::EOMBatch batch;
+  batch.reserve(inputs.size());
+  for (const auto& in : inputs) {
+    batch.add(in.v_1, in.v_2, v_m_is_maximal ? in.v_max : in.v_min, in.a,
+              in.d, in.s);
+  }
+  for (auto _ : state) {
+    auto results = batch_kernel(batch);
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(inputs.size()));
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+
+BENCHMARK(BM_ImportVSSInstance)
+    ->DenseRange(0, static_cast<int>(VSS_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImportVSSInstanceBinary)
+    ->DenseRange(0, static_cast<int>(VSS_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImportGenPOInstance)
+    ->DenseRange(0, static_cast<int>(GEN_PO_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImportGenPOInstanceBinary)
+    ->DenseRange(0, static_cast<int>(GEN_PO_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_Discretize)
+    ->DenseRange(0, static_cast<int>(VSS_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SeparateStopEdges)
+    ->DenseRange(0, static_cast<int>(GEN_PO_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AllEdgePairsShortestPathsFloydWarshall)
+    ->DenseRange(0, static_cast<int>(SHORTEST_PATH_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AllEdgePairsShortestPaths)
+    ->ArgsProduct({benchmark::CreateDenseRange(
+                       0, static_cast<int>(SHORTEST_PATH_INSTANCES.size()) - 1,
+                       1),
+                   {1, 0}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_AllEdgePairsShortestPathsCompact)
+    ->ArgsProduct({benchmark::CreateDenseRange(
+                       0, static_cast<int>(SHORTEST_PATH_INSTANCES.size()) - 1,
+                       1),
+                   {1, 0}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BM_EOMKernel, min_travel_time, &eom_min_travel_time);
+BENCHMARK_CAPTURE(BM_EOMKernel, max_travel_time_no_stopping,
+                  &eom_max_travel_time_no_stopping);
+BENCHMARK_CAPTURE(BM_EOMKernel, max_travel_time_stopping_allowed,
+                  &eom_max_travel_time_stopping_allowed);
+BENCHMARK_CAPTURE(BM_EOMKernel, min_time_from_rear_to_ma_point,
+                  &eom_min_time_from_rear_to_ma_point);
+BENCHMARK_CAPTURE(BM_EOMKernel, max_time_from_front_to_ma_point,
+                  &eom_max_time_from_front_to_ma_point);
+BENCHMARK_CAPTURE(BM_EOMBatchKernel, min_travel_time, &eom_min_travel_time,
+                  &eom_batch_min_travel_time, true);
+BENCHMARK_CAPTURE(BM_EOMBatchKernel, max_travel_time_no_stopping,
+                  &eom_max_travel_time_no_stopping,
+                  &eom_batch_max_travel_time_no_stopping, false);
+BENCHMARK_CAPTURE(BM_EOMBatchKernel, max_travel_time_stopping_allowed,
+                  &eom_max_travel_time_stopping_allowed,
+                  &eom_batch_max_travel_time_stopping_allowed, false);
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+
+int main(int argc, char** argv) {
+  // Write json results to rail_bench.json unless another file is requested
+  std::vector<char*> args(argv, argv + argc);
+  bool               has_out = false;
+  for (const auto* arg : args) {
+    has_out = has_out || std::string(arg).rfind("--benchmark_out=", 0) == 0;
+  }
+  std::string out_arg        = "--benchmark_out=rail_bench.json";
+  std::string out_format_arg = "--benchmark_out_format=json";
+  if (!has_out) {
+    args.push_back(out_arg.data());
+    args.push_back(out_format_arg.data());
+  }
+  int num_args = static_cast<int>(args.size());
+
+  benchmark::Initialize(&num_args, args.data());
+  if (benchmark::ReportUnrecognizedArguments(num_args, args.data())) {
+    return 1;
+  }
+  benchmark::AddCustomContext("git_commit", RAIL_BENCH_GIT_COMMIT);
+  std::filesystem::create_directories(scratch_path(""));
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  std::filesystem::remove_all(scratch_path(""));
+  return 0;
+}
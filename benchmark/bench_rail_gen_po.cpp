@@ -0,0 +1,99 @@
+#include "probleminstances/GeneralPerformanceOptimizationInstance.hpp"
+#include "rail_bench.hpp"
+#include "solver/mip-based/GenPOMovingBlockMIPSolver.hpp"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <optional>
+
+namespace {
+using cda_rail::bench::GEN_PO_INSTANCES;
+using cda_rail::bench::instance_path;
+using cda_rail::bench::model_build_seconds;
+using cda_rail::bench::scratch_path;
+using cda_rail::bench::set_model_build_memory;
+using cda_rail::bench::set_network_info;
+using cda_rail::bench::SOLUTION_TIME_LIMIT;
+using GenPOInstance =
+    cda_rail::instances::GeneralPerformanceOptimizationInstance;
+using GenPOSolution =
+    cda_rail::instances::SolGeneralPerformanceOptimizationInstance<
+        GenPOInstance>;
+
+// Model build
+
+void BM_BuildGenPOModel(benchmark::State& state) {
+  // Only the time until the model is passed to Gurobi is reported, together
+  // with the memory used to build it
+  const auto& instance        = GEN_PO_INSTANCES.at(state.range(0));
+  const auto  gen_po_instance = GenPOInstance(instance_path(instance));
+  for (auto _ : state) {
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(
+        gen_po_instance);
+    solver.set_use_shared_environment(true);
+    const auto sol = solver.solve(1, false);
+    benchmark::DoNotOptimize(sol);
+    state.SetIterationTime(model_build_seconds(solver.get_telemetry()));
+    set_model_build_memory(state, solver.get_telemetry());
+  }
+  set_network_info(state, instance, gen_po_instance.const_n());
+}
+
+// Solution export and import
+
+const std::optional<GenPOSolution>& gen_po_solution() {
+  static const auto sol = []() -> std::optional<GenPOSolution> {
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(
+        instance_path(GEN_PO_INSTANCES.front()));
+    auto ret_val = solver.solve(SOLUTION_TIME_LIMIT, false);
+    if (!ret_val.has_solution()) {
+      return {};
+    }
+    return ret_val;
+  }();
+  return sol;
+}
+
+void BM_ExportGenPOSolution(benchmark::State& state) {
+  const auto& sol = gen_po_solution();
+  if (!sol.has_value()) {
+    state.SkipWithError("No solution found");
+    return;
+  }
+  const auto p = scratch_path("gen_po_solution");
+  for (auto _ : state) {
+    sol->export_solution(p, true);
+  }
+  std::filesystem::remove_all(p);
+  state.SetLabel(GEN_PO_INSTANCES.front());
+}
+
+void BM_ImportGenPOSolution(benchmark::State& state) {
+  const auto& sol = gen_po_solution();
+  if (!sol.has_value()) {
+    state.SkipWithError("No solution found");
+    return;
+  }
+  const auto p = scratch_path("gen_po_solution");
+  sol->export_solution(p, true);
+  for (auto _ : state) {
+    auto imported_sol = GenPOSolution::import_solution(p);
+    benchmark::DoNotOptimize(imported_sol);
+  }
+  std::filesystem::remove_all(p);
+  state.SetLabel(GEN_PO_INSTANCES.front());
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+
+BENCHMARK(BM_BuildGenPOModel)
+    ->DenseRange(0, static_cast<int>(GEN_PO_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->Iterations(3);
+
+BENCHMARK(BM_ExportGenPOSolution)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImportGenPOSolution)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
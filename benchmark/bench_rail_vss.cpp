@@ -0,0 +1,138 @@
+#include "probleminstances/VSSGenerationTimetable.hpp"
+#include "rail_bench.hpp"
+#include "gurobi_c++.h"
+#include "solver/mip-based/VSSGenTimetableSolver.hpp"
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace {
+using cda_rail::bench::instance_path;
+using cda_rail::bench::model_build_seconds;
+using cda_rail::bench::scratch_path;
+using cda_rail::bench::set_model_build_memory;
+using cda_rail::bench::set_network_info;
+using cda_rail::bench::SOLUTION_TIME_LIMIT;
+using cda_rail::bench::VSS_INSTANCES;
+using VSSInstance = cda_rail::instances::VSSGenerationTimetable;
+using VSSSolution = cda_rail::instances::SolVSSGenerationTimetable;
+
+// Model build
+
+void BM_BuildVSSModel(benchmark::State& state) {
+  // Only the time until the model is passed to Gurobi is reported, together
+  // with the memory used to build it
+  const auto& instance = VSS_INSTANCES.at(state.range(0));
+  const auto  vss_instance =
+      VSSInstance::import_instance(instance_path(instance));
+  for (auto _ : state) {
+    cda_rail::solver::mip_based::VSSGenTimetableSolver solver(vss_instance);
+    solver.set_use_shared_environment(true);
+    const auto sol = solver.solve(1, false);
+    benchmark::DoNotOptimize(sol);
+    state.SetIterationTime(model_build_seconds(solver.get_telemetry()));
+    set_model_build_memory(state, solver.get_telemetry());
+  }
+  set_network_info(state, instance, vss_instance.const_n());
+}
+
+void BM_BuildVSSModelFreeRoutes(benchmark::State& state) {
+  // Free routes with and without reachability pruning. The size of the
+  // resulting model is reported as counters.
+  const auto& instance = VSS_INSTANCES.at(state.range(0));
+  const bool  pruning  = state.range(1) != 0;
+  const auto  vss_instance =
+      VSSInstance::import_instance(instance_path(instance));
+  const auto p = scratch_path("vss_model");
+  for (auto _ : state) {
+    cda_rail::solver::mip_based::VSSGenTimetableSolver solver(vss_instance);
+    solver.set_use_shared_environment(true);
+    const auto sol = solver.solve(
+        {15, false, true, false},
+        {cda_rail::vss::Model(), false, true, pruning}, {},
+        {false, cda_rail::ExportOption::ExportLP, "model", p.string()}, 1,
+        false);
+    benchmark::DoNotOptimize(sol);
+    state.SetIterationTime(model_build_seconds(solver.get_telemetry()));
+  }
+
+  GRBEnv env(true);
+  env.set(GRB_IntParam_OutputFlag, 0);
+  env.start();
+  GRBModel model(env, (p / "model.mps").string());
+  state.counters["variables"] =
+      static_cast<double>(model.get(GRB_IntAttr_NumVars));
+  state.counters["constraints"] =
+      static_cast<double>(model.get(GRB_IntAttr_NumConstrs));
+  std::filesystem::remove_all(p);
+  set_network_info(state, instance, vss_instance.const_n());
+}
+
+// Solution export and import
+
+const std::optional<VSSSolution>& vss_solution() {
+  static const auto sol = []() -> std::optional<VSSSolution> {
+    cda_rail::solver::mip_based::VSSGenTimetableSolver solver(
+        instance_path(VSS_INSTANCES.front()));
+    auto ret_val = solver.solve(SOLUTION_TIME_LIMIT, false);
+    if (!ret_val.has_solution()) {
+      return {};
+    }
+    return ret_val;
+  }();
+  return sol;
+}
+
+void BM_ExportVSSSolution(benchmark::State& state) {
+  const auto& sol = vss_solution();
+  if (!sol.has_value()) {
+    state.SkipWithError("No solution found");
+    return;
+  }
+  const auto p = scratch_path("vss_solution");
+  for (auto _ : state) {
+    sol->export_solution(p, true);
+  }
+  std::filesystem::remove_all(p);
+  state.SetLabel(VSS_INSTANCES.front());
+}
+
+void BM_ImportVSSSolution(benchmark::State& state) {
+  const auto& sol = vss_solution();
+  if (!sol.has_value()) {
+    state.SkipWithError("No solution found");
+    return;
+  }
+  const auto p = scratch_path("vss_solution");
+  sol->export_solution(p, true);
+  for (auto _ : state) {
+    auto imported_sol = VSSSolution::import_solution(p);
+    benchmark::DoNotOptimize(imported_sol);
+  }
+  std::filesystem::remove_all(p);
+  state.SetLabel(VSS_INSTANCES.front());
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+
+BENCHMARK(BM_BuildVSSModel)
+    ->DenseRange(0, static_cast<int>(VSS_INSTANCES.size()) - 1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->Iterations(3);
+
+BENCHMARK(BM_BuildVSSModelFreeRoutes)
+    ->ArgsProduct({benchmark::CreateDenseRange(
+                       0, static_cast<int>(VSS_INSTANCES.size()) - 1, 1),
+                   {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime()
+    ->Iterations(1);
+
+BENCHMARK(BM_ExportVSSSolution)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ImportVSSSolution)->Unit(benchmark::kMillisecond);
+
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
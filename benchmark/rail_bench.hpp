@@ -0,0 +1,88 @@
+#pragma once
+
+#include "SolverTelemetry.hpp"
+#include "datastructure/RailwayNetwork.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Shared by the translation units of rail_bench. The solver benchmarks live in
+// separate files because the headers of both solver families cannot be
+// included together.
+
+namespace cda_rail::bench {
+
+inline const std::vector<std::string> VSS_INSTANCES = {
+    "example-networks/SimpleStation",
+    "example-networks/Overtake",
+    "example-networks/SimpleNetwork",
+    "example-networks/Stammstrecke16Trains",
+};
+
+inline const std::vector<std::string> GEN_PO_INSTANCES = {
+    "example-networks-gen-po/GeneralSimpleNetwork5Trains",
+    "example-networks-gen-po/GeneralSimpleNetwork30Trains",
+    "example-networks-gen-po/GeneralStammstrecke10Trains",
+};
+
+// Time limit in seconds used to obtain solutions for the export benchmarks
+constexpr int SOLUTION_TIME_LIMIT = 30;
+
+inline std::filesystem::path instance_path(const std::string& instance) {
+  return std::filesystem::path(EXAMPLE_NETWORKS_DIR) / instance;
+}
+
+inline std::filesystem::path scratch_path(const std::string& name) {
+  return std::filesystem::temp_directory_path() / "rail_bench" / name;
+}
+
+inline void set_network_info(benchmark::State& state,
+                             const std::string& instance,
+                             const Network&     network) {
+  state.SetLabel(instance);
+  state.counters["vertices"] =
+      static_cast<double>(network.number_of_vertices());
+  state.counters["edges"] = static_cast<double>(network.number_of_edges());
+}
+
+inline bool is_model_build_phase(const SolverTelemetry::Phase& phase) {
+  // Everything recorded before the model is passed to the solver
+  return phase.name != "optimize" && phase.name != "extract_solution";
+}
+
+inline double model_build_seconds(const SolverTelemetry& telemetry) {
+  double ret_val = 0;
+  for (const auto& phase : telemetry.get_phases()) {
+    if (is_model_build_phase(phase)) {
+      ret_val += phase.wall_seconds;
+    }
+  }
+  return ret_val;
+}
+
+inline void set_model_build_memory(benchmark::State&      state,
+                                   const SolverTelemetry& telemetry) {
+  // Change of resident memory during the last model build and largest
+  // resident memory of the process so far. The latter includes all previous
+  // benchmarks, hence, it is only comparable if a single benchmark is run per
+  // process, e.g., using --benchmark_filter.
+  int64_t rss_delta_bytes = 0;
+  for (const auto& phase : telemetry.get_phases()) {
+    if (is_model_build_phase(phase)) {
+      rss_delta_bytes += phase.rss_delta_bytes;
+    }
+  }
+  state.counters["build_rss_delta"] =
+      benchmark::Counter(static_cast<double>(rss_delta_bytes),
+                         benchmark::Counter::kDefaults,
+                         benchmark::Counter::kIs1024);
+  state.counters["peak_rss"] =
+      benchmark::Counter(static_cast<double>(process_peak_rss_bytes()),
+                         benchmark::Counter::kDefaults,
+                         benchmark::Counter::kIs1024);
+}
+
+} // namespace cda_rail::bench
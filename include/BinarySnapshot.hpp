@@ -0,0 +1,156 @@
+#pragma once
+#include "CustomExceptions.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <gsl/span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Versioned and checksummed binary snapshots of problem instances. A snapshot
+// consists of a fixed size header followed by the payload written by the
+// respective export_binary functions. All values are stored in native byte
+// order, indices are stored as 64 bit unsigned integers.
+
+namespace cda_rail::snapshot {
+constexpr uint32_t FORMAT_VERSION = 2;
+
+enum class InstanceType : uint32_t {
+  VSSGenerationTimetable                 = 1,
+  GeneralPerformanceOptimizationInstance = 2
+};
+
+struct Header {
+  char     magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint32_t instance_type;
+  uint32_t reserved;
+  uint64_t payload_size;
+  uint64_t checksum;
+};
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 40,
+              "Unexpected layout of snapshot header");
+
+[[nodiscard]] uint64_t checksum(gsl::span<const char> data);
+
+class BinaryWriter {
+  /**
+   * Appends values to an in-memory buffer, which can then be written to a
+   * snapshot file.
+   */
+  std::vector<char> buffer;
+
+public:
+  template <typename T> void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "T must be trivially copyable");
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  };
+  void write_index(size_t value) { write(static_cast<uint64_t>(value)); };
+  void write_string(const std::string& value) {
+    write_index(value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+  };
+  void write_indices(const std::vector<size_t>& values) {
+    write_index(values.size());
+    for (const auto& value : values) {
+      write_index(value);
+    }
+  };
+
+  [[nodiscard]] gsl::span<const char> data() const { return buffer; };
+
+  void write_to_file(const std::filesystem::path& p,
+                     InstanceType                 instance_type) const;
+};
+
+class BinaryReader {
+  /**
+   * Reads values sequentially from a memory region, usually a memory mapped
+   * snapshot file. Every read is bounds checked.
+   */
+  gsl::span<const char> data;
+  size_t                offset = 0;
+
+  void require(size_t count, size_t element_size = 1) const {
+    if (count > (data.size() - offset) / element_size) {
+      throw exceptions::ImportException("binary snapshot (unexpected end)");
+    }
+  };
+
+public:
+  explicit BinaryReader(gsl::span<const char> data) : data(data) {};
+
+  template <typename T> [[nodiscard]] T read() {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "T must be trivially copyable");
+    require(1, sizeof(T));
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+  };
+  [[nodiscard]] size_t read_index() {
+    return static_cast<size_t>(read<uint64_t>());
+  };
+  [[nodiscard]] std::string read_string() {
+    const auto size = read_index();
+    require(size);
+    std::string value(data.data() + offset, size);
+    offset += size;
+    return value;
+  };
+  [[nodiscard]] std::vector<size_t> read_indices() {
+    const auto size = read_index();
+    require(size, sizeof(uint64_t));
+    std::vector<size_t> values(size);
+    for (auto& value : values) {
+      value = read_index();
+    }
+    return values;
+  };
+
+  [[nodiscard]] bool at_end() const { return offset == data.size(); };
+};
+
+class MappedFile {
+  /**
+   * Read-only memory mapping of a file. Falls back to reading the file into
+   * memory on platforms without mmap.
+   */
+  const char*       mapped_data = nullptr;
+  size_t            mapped_size = 0;
+  std::vector<char> fallback_buffer;
+
+public:
+  explicit MappedFile(const std::filesystem::path& p);
+
+  MappedFile(const MappedFile& other)            = delete;
+  MappedFile(MappedFile&& other)                 = delete;
+  MappedFile& operator=(const MappedFile& other) = delete;
+  MappedFile& operator=(MappedFile&& other)      = delete;
+  ~MappedFile();
+
+  [[nodiscard]] gsl::span<const char> data() const {
+    return {mapped_data, mapped_size};
+  };
+};
+
+class SnapshotFile {
+  /**
+   * Maps a snapshot file and validates its header and checksum. The payload
+   * remains valid as long as this object exists.
+   */
+  MappedFile            file;
+  gsl::span<const char> payload;
+
+public:
+  SnapshotFile(const std::filesystem::path& p, InstanceType instance_type);
+
+  [[nodiscard]] BinaryReader reader() const { return BinaryReader(payload); };
+};
+} // namespace cda_rail::snapshot
@@ -0,0 +1,59 @@
+#pragma once
+#include <memory>
+#include <utility>
+
+namespace cda_rail {
+template <typename T> class CopyOnWrite {
+  /**
+   * Value of type T that is shared between all copies of this object as long
+   * as none of them is modified. Copying is cheap. Only the first modification
+   * of a shared value creates a private deep copy, so that large objects, e.g.,
+   * problem instances, can be passed to solvers and solution objects without
+   * duplicating them.
+   * Reading and copying are thread-safe, modifying the same object from
+   * multiple threads is not.
+   */
+  std::shared_ptr<const T> value;
+  // Points to the same object as value if it may be modified in place, i.e.,
+  // if it has been created by this class as non-const object
+  T* editable = nullptr;
+
+public:
+  CopyOnWrite() : CopyOnWrite(T()) {};
+  explicit CopyOnWrite(const T& value_input) {
+    auto new_value = std::make_shared<T>(value_input);
+    editable       = new_value.get();
+    value          = std::move(new_value);
+  };
+  explicit CopyOnWrite(T&& value_input) {
+    auto new_value = std::make_shared<T>(std::move(value_input));
+    editable       = new_value.get();
+    value          = std::move(new_value);
+  };
+  explicit CopyOnWrite(std::shared_ptr<const T> value_input)
+      : value(std::move(value_input)) {};
+
+  [[nodiscard]] const T& get() const { return *value; };
+  [[nodiscard]] const T& operator*() const { return *value; };
+  [[nodiscard]] const T* operator->() const { return value.get(); };
+
+  [[nodiscard]] T& edit() {
+    /**
+     * Returns a modifiable reference to the value. If the value is shared with
+     * other objects, it is copied first, so that the others are not affected.
+     */
+    if (editable == nullptr || value.use_count() > 1) {
+      auto new_value = std::make_shared<T>(*value);
+      editable       = new_value.get();
+      value          = std::move(new_value);
+    }
+    return *editable;
+  };
+
+  [[nodiscard]] std::shared_ptr<const T> share() const { return value; };
+  [[nodiscard]] bool shares_with(const CopyOnWrite<T>& other) const {
+    return value == other.value;
+  };
+  [[nodiscard]] long use_count() const { return value.use_count(); };
+};
+} // namespace cda_rail
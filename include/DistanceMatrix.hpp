@@ -0,0 +1,116 @@
+#pragma once
+#include <cstddef>
+#include <gsl/span>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace cda_rail {
+template <typename T, size_t Alignment> struct AlignedAllocator {
+  /**
+   * Minimal allocator returning memory aligned to Alignment bytes.
+   */
+  static_assert(Alignment >= alignof(T), "Alignment too small for T");
+
+  using value_type = T;
+  template <typename U> struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() noexcept = default;
+  template <typename U>
+  explicit AlignedAllocator(
+      const AlignedAllocator<U, Alignment>& /*other*/) noexcept {};
+
+  [[nodiscard]] T* allocate(size_t n) {
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(
+        ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  };
+  void deallocate(T* p, size_t /*n*/) noexcept {
+    ::operator delete(p, std::align_val_t(Alignment));
+  };
+
+  template <typename U>
+  bool operator==(const AlignedAllocator<U, Alignment>& /*other*/) const {
+    return true;
+  };
+  template <typename U>
+  bool operator!=(const AlignedAllocator<U, Alignment>& /*other*/) const {
+    return false;
+  };
+};
+
+template <typename T> class DistanceMatrix {
+  /**
+   * Square matrix of distances stored in a single contiguous buffer. Every row
+   * starts at a cache line boundary, hence, different rows can be written by
+   * different threads without false sharing.
+   * Use T = float for a compact representation of large matrices.
+   */
+  static_assert(std::is_floating_point_v<T>, "T must be a floating point type");
+
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+  static constexpr size_t ROW_ALIGNMENT   = CACHE_LINE_SIZE / sizeof(T);
+
+  size_t n          = 0;
+  size_t row_stride = 0;
+  std::vector<T, AlignedAllocator<T, CACHE_LINE_SIZE>> data;
+
+public:
+  // Value representing that no path exists. Coincides with INF for doubles.
+  static constexpr T unreachable() {
+    return std::numeric_limits<T>::max() / 3;
+  };
+
+  DistanceMatrix() = default;
+  explicit DistanceMatrix(size_t n)
+      : n(n), row_stride((n + ROW_ALIGNMENT - 1) / ROW_ALIGNMENT *
+                         ROW_ALIGNMENT),
+        data(n * row_stride, unreachable()) {};
+
+  [[nodiscard]] T& operator()(size_t i, size_t j) {
+    return data[i * row_stride + j];
+  };
+  [[nodiscard]] const T& operator()(size_t i, size_t j) const {
+    return data[i * row_stride + j];
+  };
+
+  [[nodiscard]] T at(size_t i, size_t j) const {
+    if (i >= n || j >= n) {
+      std::stringstream ss;
+      ss << "Index (" << i << ", " << j << ") is too large for matrix of size "
+         << n;
+      throw std::out_of_range(ss.str());
+    }
+    return (*this)(i, j);
+  };
+
+  [[nodiscard]] gsl::span<T> row(size_t i) {
+    return {data.data() + i * row_stride, n};
+  };
+  [[nodiscard]] gsl::span<const T> row(size_t i) const {
+    return {data.data() + i * row_stride, n};
+  };
+
+  [[nodiscard]] size_t size() const { return n; };
+
+  [[nodiscard]] std::vector<std::vector<double>> to_nested_vector() const {
+    std::vector<std::vector<double>> ret_val(n, std::vector<double>(n));
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        const auto val = (*this)(i, j);
+        ret_val[i][j]  = val >= unreachable()
+                             ? DistanceMatrix<double>::unreachable()
+                             : static_cast<double>(val);
+      }
+    }
+    return ret_val;
+  };
+};
+} // namespace cda_rail
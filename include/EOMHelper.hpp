@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
+#include <vector>
 
 // EOM = Equations of Motion
 
@@ -97,4 +99,45 @@ double vel_on_edge_at_time(double v_1, double v_2, double v_line, double a,
                            double d, double s, double t);
 double get_line_speed(double v_1, double v_2, double v_min, double v_max,
                       double a, double d, double s, double t);
+
+class EOMBatch {
+  /**
+   * Inputs of the equations of motion stored as structure of arrays, e.g., all
+   * velocity combinations of a train on an edge. Every input is validated
+   * once when it is added. Hence, the travel time functions below evaluate
+   * the whole batch in tight loops without any further checks except for the
+   * respective speed bound v_m. Their results equal those of the scalar
+   * functions of the same name.
+   */
+  std::vector<double> v_1;
+  std::vector<double> v_2;
+  std::vector<double> v_m;
+  std::vector<double> a;
+  std::vector<double> d;
+  std::vector<double> s;
+  std::vector<double> x;
+
+  void check_maximal_speeds() const;
+  void check_minimal_speeds() const;
+
+public:
+  void add(double v_1_input, double v_2_input, double v_m_input,
+           double a_input, double d_input, double s_input, double x_input);
+  void add(double v_1_input, double v_2_input, double v_m_input,
+           double a_input, double d_input, double s_input) {
+    add(v_1_input, v_2_input, v_m_input, a_input, d_input, s_input, s_input);
+  };
+  void reserve(size_t n);
+  void clear();
+
+  [[nodiscard]] size_t size() const { return v_1.size(); };
+  [[nodiscard]] bool   empty() const { return v_1.empty(); };
+
+  [[nodiscard]] std::vector<double> min_travel_time_from_start() const;
+  [[nodiscard]] std::vector<double> min_travel_time_to_end() const;
+  [[nodiscard]] std::vector<double>
+  max_travel_time_from_start(bool stopping_allowed) const;
+  [[nodiscard]] std::vector<double>
+  max_travel_time_to_end(bool stopping_allowed) const;
+};
 } // namespace cda_rail
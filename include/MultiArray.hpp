@@ -1,43 +1,237 @@
 #pragma once
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 namespace cda_rail {
+namespace detail {
+template <typename T> class MultiArrayStorage {
+  /**
+   * Storage of the elements of a multi-dimensional array addressed by their
+   * linear index. Dense storage allocates all elements upfront. Sparse storage
+   * only holds the elements that have been accessed by the non-const get,
+   * which creates missing elements. Hence, reads that must not create
+   * elements have to use the const get, which returns a default constructed
+   * element instead.
+   */
+  bool                          sparse = false;
+  std::vector<T>                dense_data;
+  std::unordered_map<size_t, T> sparse_data;
+
+public:
+  MultiArrayStorage() = default;
+  MultiArrayStorage(size_t cap, bool sparse) : sparse(sparse) {
+    if (!sparse) {
+      dense_data = std::vector<T>(cap);
+    }
+  };
+
+  [[nodiscard]] bool   is_sparse() const { return sparse; };
+  [[nodiscard]] size_t stored_elements() const {
+    return sparse ? sparse_data.size() : dense_data.size();
+  };
+
+  T& get(size_t index) {
+    return sparse ? sparse_data[index] : dense_data[index];
+  };
+  [[nodiscard]] T get(size_t index) const {
+    if (!sparse) {
+      return dense_data[index];
+    }
+    const auto it = sparse_data.find(index);
+    return it == sparse_data.end() ? T() : it->second;
+  };
+  [[nodiscard]] bool contains(size_t index) const {
+    return !sparse || sparse_data.find(index) != sparse_data.end();
+  };
+
+  template <typename U, typename F>
+  [[nodiscard]] MultiArrayStorage<U> transform(F f) const {
+    // Same layout, only stored elements are mapped
+    MultiArrayStorage<U> ret;
+    ret.sparse = sparse;
+    ret.dense_data.reserve(dense_data.size());
+    for (const auto& element : dense_data) {
+      ret.dense_data.push_back(f(element));
+    }
+    for (const auto& [index, element] : sparse_data) {
+      ret.sparse_data.emplace(index, f(element));
+    }
+    return ret;
+  };
+
+  template <typename U> friend class MultiArrayStorage;
+};
+
+inline void throw_index_out_of_range(size_t index, size_t dimension) {
+  std::stringstream ss;
+  ss << "Index " << index << " is too large for dimension " << dimension;
+  throw std::out_of_range(ss.str());
+}
+} // namespace detail
+
+template <typename T, size_t N> class FixedRankMultiArray;
+
 template <typename T> class MultiArray {
 private:
-  std::vector<size_t> shape;
-  std::vector<T>      data;
+  std::vector<size_t>          shape;
+  detail::MultiArrayStorage<T> storage;
+
+  template <typename... Args> size_t linear_index(Args... args) const;
 
 public:
   // Constructor with arbitrary number of size_t parameters
   template <typename... Args> explicit MultiArray(Args... args);
 
-  // getter with arbitrary number of size_t parameters
+  // Sparse array, only elements accessed via operator() are stored
+  template <typename... Args> static MultiArray sparse(Args... args);
+
+  // getter with arbitrary number of size_t parameters, creates missing
+  // elements of sparse arrays
   template <typename... Args> T& operator()(Args... args);
 
+  // Read-only getter, never creates elements
   template <typename... Args> T at(Args... args) const;
 
   // Function to obtain shape, size and dimensions
   [[nodiscard]] const std::vector<size_t>& get_shape() const { return shape; };
-  [[nodiscard]] size_t                     size() const { return data.size(); };
+  [[nodiscard]] size_t                     size() const;
   [[nodiscard]] size_t dimensions() const { return shape.size(); };
+  [[nodiscard]] bool   is_sparse() const { return storage.is_sparse(); };
+  [[nodiscard]] size_t stored_elements() const {
+    return storage.stored_elements();
+  };
+  template <typename... Args> [[nodiscard]] bool contains(Args... args) const {
+    return storage.contains(linear_index(args...));
+  };
+
+  // Array of the same shape containing f applied to every element
+  template <typename U, typename F>
+  [[nodiscard]] MultiArray<U> transform(F f) const;
+
+  template <typename U> friend class MultiArray;
+  template <typename U, size_t N> friend class FixedRankMultiArray;
+};
+
+template <typename T, size_t N> class FixedRankMultiArray {
+  /**
+   * Multi-dimensional array whose number of dimensions is a template
+   * parameter. In contrast to MultiArray, the number of indices is checked at
+   * compile time and the strides are precomputed, so that indexing is a loop
+   * of fixed length without any runtime rank check.
+   */
+  static_assert(N > 0, "FixedRankMultiArray needs at least one dimension");
+
+  std::array<size_t, N>        shape{};
+  std::array<size_t, N>        strides{};
+  detail::MultiArrayStorage<T> storage;
+
+  struct SparseTag {};
+
+  template <typename... Args>
+  FixedRankMultiArray(bool sparse, SparseTag /*tag*/, Args... args)
+      : shape({static_cast<size_t>(args)...}) {
+    static_assert(sizeof...(Args) == N,
+                  "Number of dimensions and number of arguments must coincide");
+    size_t cap = 1;
+    for (size_t i = 0; i < N; ++i) {
+      strides[i] = cap;
+      cap *= shape[i];
+    }
+    storage = detail::MultiArrayStorage<T>(cap, sparse);
+  };
+
+  template <typename... Args>
+  [[nodiscard]] size_t linear_index(Args... args) const {
+    // The loop has a compile-time bound and is unrolled by the compiler
+    static_assert(sizeof...(Args) == N,
+                  "Number of dimensions and number of arguments must coincide");
+    const std::array<size_t, N> arg_tuple = {static_cast<size_t>(args)...};
+    size_t                      index     = 0;
+    for (size_t i = 0; i < N; ++i) {
+      if (arg_tuple[i] >= shape[i]) {
+        detail::throw_index_out_of_range(arg_tuple[i], i);
+      }
+      index += arg_tuple[i] * strides[i];
+    }
+    return index;
+  };
+
+public:
+  FixedRankMultiArray() = default;
+  template <typename... Args>
+  explicit FixedRankMultiArray(Args... args)
+      : FixedRankMultiArray(false, SparseTag(), args...) {};
+
+  // Sparse array, only elements accessed via operator() are stored
+  template <typename... Args> static FixedRankMultiArray sparse(Args... args) {
+    return FixedRankMultiArray(true, SparseTag(), args...);
+  };
+
+  // Creates missing elements of sparse arrays
+  template <typename... Args> T& operator()(Args... args) {
+    return storage.get(linear_index(args...));
+  };
+  // Read-only getter, never creates elements
+  template <typename... Args> [[nodiscard]] T at(Args... args) const {
+    return storage.get(linear_index(args...));
+  };
+  template <typename... Args> [[nodiscard]] bool contains(Args... args) const {
+    return storage.contains(linear_index(args...));
+  };
+
+  [[nodiscard]] const std::array<size_t, N>& get_shape() const {
+    return shape;
+  };
+  [[nodiscard]] size_t size() const {
+    size_t cap = 1;
+    for (const auto& shape_dim : shape) {
+      cap *= shape_dim;
+    }
+    return cap;
+  };
+  [[nodiscard]] static constexpr size_t dimensions() { return N; };
+  [[nodiscard]] bool is_sparse() const { return storage.is_sparse(); };
+  [[nodiscard]] size_t stored_elements() const {
+    return storage.stored_elements();
+  };
+
+  // Array of the same shape containing f applied to every element
+  template <typename U, typename F>
+  [[nodiscard]] FixedRankMultiArray<U, N> transform(F f) const {
+    FixedRankMultiArray<U, N> ret;
+    ret.shape   = shape;
+    ret.strides = strides;
+    ret.storage = storage.template transform<U>(f);
+    return ret;
+  };
+
+  // Same array with the number of dimensions only known at runtime. Both use
+  // the same layout, hence, the elements are copied as they are.
+  [[nodiscard]] MultiArray<T> to_multi_array() const {
+    MultiArray<T> ret;
+    ret.shape   = std::vector<size_t>(shape.begin(), shape.end());
+    ret.storage = storage;
+    return ret;
+  };
+
+  template <typename U, size_t M> friend class FixedRankMultiArray;
 };
 
 template <typename T>
 template <typename... Args>
-T& MultiArray<T>::operator()(Args... args) {
+size_t MultiArray<T>::linear_index(Args... args) const {
   /**
-   * Getter for an arbitrary number of dimensions.
-   * The first parameter is the index of the first dimension.
-   * The remaining parameters are the indices of the remaining dimensions.
+   * Computes the position of an element in the data.
    * The number of parameters must coincide with the number of dimensions
    * specified in shape. The value of each parameter must be smaller than the
    * size of the corresponding dimension.
    *
-   * @param first Index of the first dimension
-   * @param args Indices of the remaining dimensions
+   * @param args Indices of the dimensions
    */
 
   // If the number of dimensions and number of arguments does not coincide throw
@@ -46,25 +240,41 @@ T& MultiArray<T>::operator()(Args... args) {
     throw std::invalid_argument(
         "Number of dimensions and number of arguments do not coincide.");
   }
-  // If the value of any argument is too large throw an error
-  std::vector<size_t> arg_tuple = {static_cast<size_t>(args)...};
-  for (size_t i = 0; i < sizeof...(args); ++i) {
-    if (arg_tuple[i] >= shape[i]) {
-      std::stringstream ss;
-      ss << "Index " << arg_tuple[i] << " is too large for dimension " << i;
-      throw std::out_of_range(ss.str());
-    }
-  }
 
-  // Get the index of the element in the data respecting the row-major order
+  // Get the index of the element in the data, the first dimension is
+  // contiguous. If the value of any argument is too large throw an error.
+  const std::array<size_t, sizeof...(args)> arg_tuple = {
+      static_cast<size_t>(args)...};
   size_t index      = 0;
   size_t multiplier = 1;
   for (size_t i = 0; i < sizeof...(args); ++i) {
+    if (arg_tuple[i] >= shape[i]) {
+      detail::throw_index_out_of_range(arg_tuple[i], i);
+    }
     index += arg_tuple[i] * multiplier;
     multiplier *= shape[i];
   }
 
-  return data[index];
+  return index;
+}
+
+template <typename T>
+template <typename... Args>
+T& MultiArray<T>::operator()(Args... args) {
+  /**
+   * Getter for an arbitrary number of dimensions.
+   * The first parameter is the index of the first dimension.
+   * The remaining parameters are the indices of the remaining dimensions.
+   * The number of parameters must coincide with the number of dimensions
+   * specified in shape. The value of each parameter must be smaller than the
+   * size of the corresponding dimension.
+   * For sparse arrays, the element is created if it does not exist yet.
+   *
+   * @param first Index of the first dimension
+   * @param args Indices of the remaining dimensions
+   */
+
+  return storage.get(linear_index(args...));
 }
 
 template <typename T>
@@ -77,42 +287,47 @@ T MultiArray<T>::at(Args... args) const {
    * The number of parameters must coincide with the number of dimensions
    * specified in shape. The value of each parameter must be smaller than the
    * size of the corresponding dimension.
+   * For sparse arrays, a default constructed element is returned if it does
+   * not exist.
    *
    * @param first Index of the first dimension
    * @param args Indices of the remaining dimensions
    */
 
-  // If the number of dimensions and number of arguments does not coincide throw
-  // an error
-  if (shape.size() != sizeof...(args)) {
-    throw std::invalid_argument(
-        "Number of dimensions and number of arguments do not coincide.");
-  }
-  // If the value of any argument is too large throw an error
-  std::vector<size_t> arg_tuple = {static_cast<size_t>(args)...};
-  for (size_t i = 0; i < sizeof...(args); ++i) {
-    if (arg_tuple[i] >= shape[i]) {
-      std::stringstream ss;
-      ss << "Index " << arg_tuple[i] << " is too large for dimension " << i;
-      throw std::out_of_range(ss.str());
-    }
-  }
+  return storage.get(linear_index(args...));
+}
 
-  // Get the index of the element in the data respecting the row-major order
-  size_t index      = 0;
-  size_t multiplier = 1;
-  for (size_t i = 0; i < sizeof...(args); ++i) {
-    index += arg_tuple[i] * multiplier;
-    multiplier *= shape[i];
-  }
+template <typename T>
+template <typename U, typename F>
+MultiArray<U> MultiArray<T>::transform(F f) const {
+  /**
+   * Creates an array of the same shape and storage type, whose elements are
+   * obtained by applying f to the elements of this array. For sparse arrays,
+   * only the stored elements are mapped, hence, the result stores the same
+   * elements.
+   *
+   * @param f Function mapping an element of type T to an element of type U
+   */
+
+  MultiArray<U> ret;
+  ret.shape   = shape;
+  ret.storage = storage.template transform<U>(f);
+  return ret;
+}
 
-  return data[index];
+template <typename T> size_t MultiArray<T>::size() const {
+  // The overall size of the array is the product of all elements in shape.
+  size_t cap = 1;
+  for (const auto& shape_dim : shape) {
+    cap *= shape_dim;
+  }
+  return cap;
 }
 
 template <typename T>
 template <typename... Args>
 MultiArray<T>::MultiArray(Args... args)
-    : shape({static_cast<size_t>(args)...}) {
+    : shape({static_cast<size_t>(args)...}), storage(size(), false) {
   /**
    * Constructor for an arbitrary number of dimensions.
    * The first parameter is the size of the first dimension.
@@ -121,13 +336,22 @@ MultiArray<T>::MultiArray(Args... args)
    * @param first Size of the first dimension
    * @param args Sizes of the remaining dimensions
    */
+}
 
-  // If shape has only one element, allocate data
-  // The overall size of the array is the product of all elements in shape.
-  size_t cap = 1;
-  for (auto& shape_dim : shape) {
-    cap *= shape_dim;
-  }
-  data = std::vector<T>(cap);
+template <typename T>
+template <typename... Args>
+MultiArray<T> MultiArray<T>::sparse(Args... args) {
+  /**
+   * Creates a sparse array for an arbitrary number of dimensions. Only the
+   * elements that are accessed via operator() are stored, hence, the memory
+   * consumption does not depend on the product of the dimension sizes.
+   *
+   * @param args Sizes of the dimensions
+   */
+
+  MultiArray<T> ret;
+  ret.shape   = {static_cast<size_t>(args)...};
+  ret.storage = detail::MultiArrayStorage<T>(ret.size(), true);
+  return ret;
 }
 } // namespace cda_rail
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "nlohmann/json.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cda_rail {
+
+// Resources used by the current process, used to measure solver phases
+[[nodiscard]] double  process_cpu_seconds();
+[[nodiscard]] int64_t process_rss_bytes();
+[[nodiscard]] int64_t process_peak_rss_bytes();
+
+class SolverTelemetry {
+  /**
+   * Resources used by the phases of a solver run, e.g., building the model,
+   * optimizing and extracting the solution. Every phase records its wall time,
+   * CPU time of the process and change of resident memory. Phases are kept in
+   * the order they are first recorded. Recording a phase again accumulates
+   * the values.
+   */
+public:
+  struct Phase {
+    std::string name;
+    size_t      calls           = 0;
+    double      wall_seconds    = 0;
+    double      cpu_seconds     = 0;
+    int64_t     rss_delta_bytes = 0;
+  };
+
+private:
+  std::vector<Phase> phases;
+
+public:
+  SolverTelemetry() = default;
+
+  void record(const std::string& name, double wall_seconds, double cpu_seconds,
+              int64_t rss_delta_bytes);
+
+  template <typename F> decltype(auto) measure(const std::string& name, F f) {
+    /**
+     * Calls f and records the resources it used as phase name.
+     *
+     * @return Result of f
+     */
+    const auto wall_start = std::chrono::steady_clock::now();
+    const auto cpu_start  = process_cpu_seconds();
+    const auto rss_start  = process_rss_bytes();
+    const auto stop       = [&]() {
+      record(name,
+             std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                           wall_start)
+                 .count(),
+             process_cpu_seconds() - cpu_start,
+             process_rss_bytes() - rss_start);
+    };
+    if constexpr (std::is_void_v<decltype(f())>) {
+      f();
+      stop();
+    } else {
+      decltype(auto) result = f();
+      stop();
+      return result;
+    }
+  };
+
+  [[nodiscard]] const std::vector<Phase>& get_phases() const {
+    return phases;
+  };
+  [[nodiscard]] bool         has_phase(const std::string& name) const;
+  [[nodiscard]] const Phase& get_phase(const std::string& name) const;
+  [[nodiscard]] double       total_wall_seconds() const;
+  [[nodiscard]] bool         empty() const { return phases.empty(); };
+  void                       clear() { phases.clear(); };
+
+  [[nodiscard]] nlohmann::json to_json() const;
+  void export_telemetry(const std::filesystem::path& p) const;
+};
+
+} // namespace cda_rail
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cda_rail {
+
+// Loop body of a parallel loop, called with the index and the id of the
+// executing worker, which is smaller than the number of threads
+using ParallelLoopBody = std::function<void(size_t, size_t)>;
+
+class ThreadPool {
+  /**
+   * Worker threads that are kept alive between parallel loops, so that
+   * frequently executed loops do not spawn threads every time. Indices are
+   * distributed dynamically among the workers. The calling thread takes part
+   * in every loop as worker 0. If a loop body throws, the remaining indices
+   * are still processed and the exception of the smallest index is rethrown.
+   */
+private:
+  std::vector<std::thread> threads;
+
+  std::mutex              mutex;
+  std::condition_variable loop_started;
+  std::condition_variable loop_finished;
+  const ParallelLoopBody* body           = nullptr;
+  size_t                  loop_size      = 0;
+  size_t                  loop_count     = 0;
+  size_t                  active_threads = 0;
+  bool                    stopped        = false;
+  std::atomic<size_t>     next_index{0};
+  std::exception_ptr      error;
+  size_t                  error_index = 0;
+
+  void run_loop(size_t worker);
+  void work(size_t worker);
+
+public:
+  explicit ThreadPool(size_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&)            = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&)                 = delete;
+  ThreadPool& operator=(ThreadPool&&)      = delete;
+
+  [[nodiscard]] size_t size() const { return threads.size() + 1; };
+
+  void parallel_for(size_t n, const ParallelLoopBody& f);
+};
+
+[[nodiscard]] size_t resolve_num_threads(size_t num_threads, size_t n);
+void parallel_for(size_t n, size_t num_threads, const ParallelLoopBody& f);
+
+} // namespace cda_rail
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "RailwayNetwork.hpp"
 #include "Station.hpp"
@@ -7,6 +8,7 @@
 #include "nlohmann/json.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <string>
@@ -279,6 +281,17 @@ class GeneralTimetable : BaseTimetable {
       std::is_base_of_v<GeneralSchedule<stop_type>, T>,
       "T must be derived from GeneralSchedule with suitable stop type");
 
+  static void write_binary_range(snapshot::BinaryWriter&    writer,
+                                 const std::pair<int, int>& range) {
+    writer.write(static_cast<int32_t>(range.first));
+    writer.write(static_cast<int32_t>(range.second));
+  }
+  static std::pair<int, int> read_binary_range(snapshot::BinaryReader& reader) {
+    const auto first  = reader.read<int32_t>();
+    const auto second = reader.read<int32_t>();
+    return {first, second};
+  }
+
   template <typename U, std::enable_if_t<std::is_same_v<U, int>, int> = 0>
   void add_json_data(json& j, const int i, const Network& network) const {
     const auto& schedule = schedules.at(i);
@@ -351,6 +364,21 @@ class GeneralTimetable : BaseTimetable {
     }
   }
 
+  template <typename U, std::enable_if_t<std::is_same_v<U, int>, int> = 0>
+  void add_binary_stop(size_t i, const std::string& station,
+                       const std::pair<int, int>& begin,
+                       const std::pair<int, int>& end,
+                       int /*min_stopping_time*/) {
+    this->add_stop(i, station, false, begin.first, end.first);
+  }
+  template <typename U,
+            std::enable_if_t<std::is_same_v<U, std::pair<int, int>>, int> = 0>
+  void add_binary_stop(size_t i, const std::string& station,
+                       const std::pair<int, int>& begin,
+                       const std::pair<int, int>& end, int min_stopping_time) {
+    this->add_stop(i, station, false, begin, end, min_stopping_time);
+  }
+
 protected:
   StationList    station_list;
   TrainList      train_list;
@@ -421,6 +449,45 @@ public:
       : GeneralTimetable(std::filesystem::path(path), network) {};
   GeneralTimetable(const char* path, const Network& network)
       : GeneralTimetable(std::filesystem::path(path), network) {};
+  GeneralTimetable(snapshot::BinaryReader& reader, const Network& network)
+      : BaseTimetable() {
+    /**
+     * This method constructs the object and reads a timetable from a binary
+     * snapshot written by export_binary.
+     *
+     * @param reader The reader positioned at the beginning of the timetable.
+     * @param network The network to which the timetable belongs.
+     */
+
+    this->set_train_list(TrainList(reader));
+    this->station_list = StationList(reader, network);
+
+    for (size_t i = 0; i < this->train_list.size(); i++) {
+      auto& schedule = this->schedules.at(i);
+      schedule.set_t_0_range(read_binary_range(reader));
+      schedule.set_v_0(reader.read<double>());
+      schedule.set_entry(reader.read_index());
+      schedule.set_t_n_range(read_binary_range(reader));
+      schedule.set_v_n(reader.read<double>());
+      schedule.set_exit(reader.read_index());
+      if (!network.has_vertex(schedule.get_entry()) ||
+          !network.has_vertex(schedule.get_exit())) {
+        throw exceptions::ImportException("binary snapshot (invalid schedule)");
+      }
+
+      const auto num_stops = reader.read_index();
+      for (size_t j = 0; j < num_stops; ++j) {
+        const auto station           = reader.read_string();
+        const auto begin             = read_binary_range(reader);
+        const auto end               = read_binary_range(reader);
+        const auto min_stopping_time = reader.read<int32_t>();
+        add_binary_stop<decltype(T::time_type())>(i, station, begin, end,
+                                                  min_stopping_time);
+      }
+    }
+
+    this->sort_stops();
+  };
   GeneralTimetable(StationList station_list, TrainList train_list,
                    const std::vector<T>& schedules)
       : station_list(std::move(station_list)),
@@ -467,10 +534,49 @@ public:
     file << j << std::endl;
   };
 
+  void export_binary(snapshot::BinaryWriter& writer) const {
+    /**
+     * This method appends the general timetable to a binary snapshot, i.e.,
+     * the trains, the stations and the schedules in train order. Times are
+     * always stored as ranges, vertices by their index.
+     *
+     * @param writer The writer to append the data to.
+     */
+
+    train_list.export_binary(writer);
+    station_list.export_binary(writer);
+
+    for (const auto& schedule : schedules) {
+      write_binary_range(writer, schedule.get_t_0_range());
+      writer.write(schedule.get_v_0());
+      writer.write_index(schedule.get_entry());
+      write_binary_range(writer, schedule.get_t_n_range());
+      writer.write(schedule.get_v_n());
+      writer.write_index(schedule.get_exit());
+
+      writer.write_index(schedule.get_stops().size());
+      for (const auto& stop : schedule.get_stops()) {
+        writer.write_string(stop.get_station_name());
+        write_binary_range(writer, stop.get_begin_range());
+        write_binary_range(writer, stop.get_end_range());
+        writer.write(static_cast<int32_t>(stop.get_min_stopping_time()));
+      }
+    }
+  };
+
   Train& editable_tr(size_t index) { return train_list.editable_tr(index); };
   Train& editable_tr(const std::string& name) {
     return train_list.editable_tr(name);
   };
+  [[nodiscard]] T& editable_schedule(size_t index) {
+    if (!train_list.has_train(index)) {
+      throw exceptions::TrainNotExistentException(index);
+    }
+    return schedules.at(index);
+  };
+  [[nodiscard]] T& editable_schedule(const std::string& train_name) {
+    return editable_schedule(train_list.get_train_index(train_name));
+  };
 
   void add_station(const std::string& name) { station_list.add_station(name); };
 
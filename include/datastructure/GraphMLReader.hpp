@@ -0,0 +1,56 @@
+#pragma once
+#include "BinarySnapshot.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cda_rail {
+class GraphMLReader {
+  /**
+   * Streaming (SAX-style) reader for GraphML files. The file is memory mapped
+   * and scanned once, no document tree is built. For every key, node and edge
+   * element the respective handler is called with the element's attributes
+   * and data entries.
+   * Only the subset of XML used by GraphML files is supported, i.e., no
+   * document type declarations.
+   */
+public:
+  struct Key {
+    std::string id;
+    std::string domain; // value of the "for" attribute
+    std::string attr_name;
+  };
+
+  struct Element {
+    // id is set for nodes, source and target for edges
+    std::string                                      id;
+    std::string                                      source;
+    std::string                                      target;
+    std::vector<std::pair<std::string, std::string>> data; // (key, value)
+  };
+
+  using KeyHandler     = std::function<void(const Key&)>;
+  using ElementHandler = std::function<void(const Element&)>;
+
+  explicit GraphMLReader(const std::filesystem::path& p) : file(p) {};
+
+  // Upper bounds on the number of nodes and edges, used to reserve capacity
+  struct ElementCounts {
+    size_t nodes = 0;
+    size_t edges = 0;
+  };
+  [[nodiscard]] ElementCounts count_elements() const;
+
+  [[nodiscard]] bool parse(const KeyHandler&     on_key,
+                           const ElementHandler& on_node,
+                           const ElementHandler& on_edge) const;
+
+private:
+  snapshot::MappedFile file;
+};
+} // namespace cda_rail
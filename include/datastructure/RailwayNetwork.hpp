@@ -1,11 +1,18 @@
 #pragma once
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
+#include "DistanceMatrix.hpp"
 #include "MultiArray.hpp"
 #include "VSSModel.hpp"
 
 #include <algorithm>
 #include <filesystem>
+#include <functional>
+#include <gsl/span>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <sstream>
@@ -73,10 +80,124 @@ private:
   std::vector<std::vector<size_t>>        successors;
   std::unordered_map<std::string, size_t> vertex_name_to_index;
 
+  // Adjacency index, i.e., out_adjacency[v] (in_adjacency[v]) lists the
+  // indices of all edges leaving (entering) vertex v in ascending order
+  std::vector<std::vector<size_t>> out_adjacency;
+  std::vector<std::vector<size_t>> in_adjacency;
+
+  // Maps (source, target) vertex indices to the index of the respective edge
+  struct VertexPairHash {
+    size_t operator()(const std::pair<size_t, size_t>& p) const noexcept {
+      const auto h1 = std::hash<size_t>{}(p.first);
+      const auto h2 = std::hash<size_t>{}(p.second);
+      return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2));
+    }
+  };
+  std::unordered_map<std::pair<size_t, size_t>, size_t, VertexPairHash>
+      vertices_to_edge_index;
+
+  // Cache for all_routes_of_given_length. Queries are grouped by buckets of
+  // ROUTE_LENGTH_BUCKET, the cache stores the routes of the bucket's upper
+  // bound including routes ending early, from which the routes of every
+  // length within the bucket are derived. It holds at most
+  // ROUTE_CACHE_CAPACITY entries and evicts the least recently used one.
+  // The cache is cleared by every modification affecting routes, copies of a
+  // network start with an empty cache.
+  static constexpr double ROUTE_LENGTH_BUCKET  = 50;
+  static constexpr size_t ROUTE_CACHE_CAPACITY = 4096;
+  struct RouteQuery {
+    std::optional<size_t> v_0;
+    std::optional<size_t> e_0;
+    double                bucket_length;
+    bool                  reverse_direction;
+    std::optional<size_t> exit_node;
+    std::vector<size_t>   edges_used_by_train; // sorted and unique
+
+    bool operator==(const RouteQuery& other) const {
+      return v_0 == other.v_0 && e_0 == other.e_0 &&
+             bucket_length == other.bucket_length &&
+             reverse_direction == other.reverse_direction &&
+             exit_node == other.exit_node &&
+             edges_used_by_train == other.edges_used_by_train;
+    };
+  };
+  struct RouteQueryHash {
+    size_t operator()(const RouteQuery& query) const noexcept;
+  };
+  using CachedRoutes = std::shared_ptr<const std::vector<std::vector<size_t>>>;
+  class RouteCache {
+    using Entry = std::pair<RouteQuery, CachedRoutes>;
+
+    mutable std::mutex mutex;
+    // Most recently used entry first
+    std::list<Entry> entries;
+    std::unordered_map<RouteQuery, std::list<Entry>::iterator, RouteQueryHash>
+        index;
+
+  public:
+    RouteCache() = default;
+    RouteCache(const RouteCache& /*other*/) {};
+    RouteCache(RouteCache&& /*other*/) noexcept {};
+    RouteCache& operator=(const RouteCache& other) {
+      if (this != &other) {
+        clear();
+      }
+      return *this;
+    };
+    RouteCache& operator=(RouteCache&& other) noexcept {
+      if (this != &other) {
+        clear();
+      }
+      return *this;
+    };
+    ~RouteCache() = default;
+
+    [[nodiscard]] CachedRoutes find(const RouteQuery& query) {
+      const std::lock_guard<std::mutex> lock(mutex);
+      const auto                        it = index.find(query);
+      if (it == index.end()) {
+        return nullptr;
+      }
+      entries.splice(entries.begin(), entries, it->second);
+      return it->second->second;
+    };
+    void insert(const RouteQuery& query, CachedRoutes routes) {
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (const auto it = index.find(query); it != index.end()) {
+        // Inserted concurrently by another thread
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+      }
+      if (entries.size() >= ROUTE_CACHE_CAPACITY) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+      }
+      entries.emplace_front(query, std::move(routes));
+      index.emplace(query, entries.begin());
+    };
+    [[nodiscard]] size_t size() const {
+      const std::lock_guard<std::mutex> lock(mutex);
+      return entries.size();
+    };
+    void clear() noexcept {
+      const std::lock_guard<std::mutex> lock(mutex);
+      index.clear();
+      entries.clear();
+    };
+  };
+  mutable RouteCache route_cache;
+
   std::unordered_map<std::size_t, std::pair<size_t, double>>
       new_edge_to_old_edge_after_transform;
 
-  void        read_graphml(const std::filesystem::path& p);
+  void read_graphml(const std::filesystem::path& p);
+  void read_successors(const std::filesystem::path& p);
+
+  // Streaming import, the network is unchanged if the file is not supported
+  [[nodiscard]] bool read_graphml_streaming(const std::filesystem::path& p);
+
+  // Import using a tinyxml2 document, used as fallback
+  void        read_graphml_dom(const std::filesystem::path& p);
   static void get_keys(tinyxml2::XMLElement* graphml_body,
                        std::string& breakable, std::string& length,
                        std::string& max_speed, std::string& min_block_length,
@@ -91,7 +212,11 @@ private:
                               const std::string&          max_speed,
                               const std::string&          min_block_length,
                               const std::string& min_stop_block_length);
-  void read_successors(const std::filesystem::path& p);
+
+  // Insert many vertices (edges) at once, validating the whole batch instead
+  // of every single insertion
+  void add_vertices_bulk(std::vector<Vertex> new_vertices);
+  void add_edges_bulk(std::vector<Edge> new_edges);
 
   void export_graphml(const std::filesystem::path& p) const;
   void export_successors_python(const std::filesystem::path& p) const;
@@ -99,6 +224,7 @@ private:
   void write_successor_set_to_file(std::ofstream& file, size_t i) const;
 
   void update_new_old_edge(size_t new_edge, size_t old_edge, double position);
+  void change_edge_source(size_t edge_index, size_t new_source);
 
   std::pair<std::vector<size_t>, std::vector<size_t>>
   separate_edge_private_helper(
@@ -126,11 +252,22 @@ private:
       std::vector<std::pair<std::optional<size_t>, std::optional<size_t>>>&
           edge_pairs) const;
 
-  [[nodiscard]] std::vector<std::vector<size_t>> all_routes_of_given_length(
+  [[nodiscard]] std::vector<std::vector<size_t>>
+  all_routes_of_given_length(
       std::optional<size_t> v_0, std::optional<size_t> e_0,
       double desired_length, bool reverse_direction,
       std::optional<size_t> exit_node           = {},
       std::vector<size_t>   edges_used_by_train = {}) const;
+  [[nodiscard]] std::vector<std::vector<size_t>>
+  enumerate_routes_of_given_length(const RouteQuery& query) const;
+  [[nodiscard]] std::vector<std::vector<size_t>>
+  routes_of_given_length(const std::vector<std::vector<size_t>>& bucket_routes,
+                         double                                  desired_length,
+                         std::optional<size_t> exit_node) const;
+
+  template <typename T>
+  [[nodiscard]] DistanceMatrix<T>
+  all_edge_pairs_shortest_paths_dijkstra(size_t num_threads) const;
 
   [[nodiscard]] size_t other_vertex(size_t e, size_t v) const {
     return get_edge(e).source == v ? get_edge(e).target : get_edge(e).source;
@@ -144,6 +281,7 @@ public:
   explicit Network(const std::string& path)
       : Network(std::filesystem::path(path)) {};
   explicit Network(const char* path) : Network(std::filesystem::path(path)) {};
+  explicit Network(snapshot::BinaryReader& reader);
 
   // Rule of 5
   Network(const Network& other)                = default;
@@ -404,7 +542,9 @@ public:
   [[nodiscard]] std::vector<size_t> in_edges(const std::string& name) const {
     return in_edges(get_vertex_index(name));
   };
-  [[nodiscard]] std::vector<size_t> neighboring_edges(size_t index) const;
+  [[nodiscard]] gsl::span<const size_t> out_edges_span(size_t index) const;
+  [[nodiscard]] gsl::span<const size_t> in_edges_span(size_t index) const;
+  [[nodiscard]] std::vector<size_t>     neighboring_edges(size_t index) const;
   [[nodiscard]] std::vector<size_t>
   neighboring_edges(const std::string& name) const {
     return neighboring_edges(get_vertex_index(name));
@@ -433,6 +573,9 @@ public:
 
   [[nodiscard]] size_t number_of_vertices() const { return vertices.size(); };
   [[nodiscard]] size_t number_of_edges() const { return edges.size(); };
+  [[nodiscard]] size_t number_of_cached_route_queries() const {
+    return route_cache.size();
+  };
 
   [[nodiscard]] int max_vss_on_edge(size_t index) const;
   [[nodiscard]] int max_vss_on_edge(size_t source, size_t target) const {
@@ -459,6 +602,7 @@ public:
     export_network(std::filesystem::path(path));
   };
   void export_network(const std::filesystem::path& p) const;
+  void export_binary(snapshot::BinaryWriter& writer) const;
 
   [[nodiscard]] bool is_valid_successor(size_t e0, size_t e1) const;
 
@@ -545,6 +689,10 @@ public:
 
   [[nodiscard]] std::vector<std::vector<double>>
   all_edge_pairs_shortest_paths() const;
+  [[nodiscard]] DistanceMatrix<double>
+  all_edge_pairs_shortest_paths_matrix(size_t num_threads = 0) const;
+  [[nodiscard]] DistanceMatrix<float>
+  all_edge_pairs_shortest_paths_matrix_compact(size_t num_threads = 0) const;
 
   [[nodiscard]] std::optional<double>
   shortest_path(size_t source_edge_id, size_t target_vertex_id) const;
@@ -1,4 +1,5 @@
 #pragma once
+#include "BinarySnapshot.hpp"
 #include "datastructure/RailwayNetwork.hpp"
 #include "datastructure/Train.hpp"
 
@@ -88,6 +89,7 @@ public:
       : RouteMap(std::filesystem::path(path), network) {};
   RouteMap(const char* path, const Network& network)
       : RouteMap(std::filesystem::path(path), network) {};
+  RouteMap(snapshot::BinaryReader& reader, const Network& network);
 
   // Rule of 5
   RouteMap(const RouteMap& other)            = default;
@@ -165,6 +167,7 @@ public:
   void export_routes(const char* path, const Network& network) const {
     export_routes(std::filesystem::path(path), network);
   };
+  void export_binary(snapshot::BinaryWriter& writer) const;
 
   [[nodiscard]] static RouteMap import_routes(const std::filesystem::path& p,
                                               const Network& network) {
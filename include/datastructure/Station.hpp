@@ -1,4 +1,5 @@
 #pragma once
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "datastructure/RailwayNetwork.hpp"
 
@@ -33,6 +34,7 @@ public:
       : StationList(std::filesystem::path(path), network) {};
   StationList(const char* path, const Network& network)
       : StationList(std::filesystem::path(path), network) {};
+  StationList(snapshot::BinaryReader& reader, const Network& network);
 
   // Rule of 5
   StationList(const StationList& other)            = default;
@@ -82,6 +84,7 @@ public:
   };
   void export_stations(const std::filesystem::path& p,
                        const Network&               network) const;
+  void export_binary(snapshot::BinaryWriter& writer) const;
   [[nodiscard]] static StationList import_stations(const std::string& path,
                                                    const Network&     network) {
     return {path, network};
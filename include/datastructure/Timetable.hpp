@@ -118,6 +118,8 @@ public:
       : Timetable(std::filesystem::path(path), network) {};
   Timetable(const char* path, const Network& network)
       : Timetable(std::filesystem::path(path), network) {};
+  Timetable(snapshot::BinaryReader& reader, const Network& network)
+      : GeneralTimetable(reader, network) {};
   Timetable(const StationList& station_list, const TrainList& train_list,
             const std::vector<Schedule>& schedules)
       : GeneralTimetable(station_list, train_list, schedules) {};
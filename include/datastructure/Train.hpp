@@ -1,4 +1,6 @@
 #pragma once
+#include "BinarySnapshot.hpp"
+
 #include <filesystem>
 #include <string>
 #include <unordered_map>
@@ -47,6 +49,7 @@ public:
       : TrainList(std::filesystem::path(path)) {};
   explicit TrainList(const char* path)
       : TrainList(std::filesystem::path(path)) {};
+  explicit TrainList(snapshot::BinaryReader& reader);
 
   // Rule of 5
   TrainList(const TrainList& other)                = default;
@@ -91,6 +94,7 @@ public:
     export_trains(std::filesystem::path(path));
   };
   void export_trains(const std::filesystem::path& p) const;
+  void export_binary(snapshot::BinaryWriter& writer) const;
   [[nodiscard]] static TrainList import_trains(const std::string& path) {
     return TrainList(path);
   };
@@ -10,6 +10,7 @@
 #include "nlohmann/json.hpp"
 
 #include <cassert>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <map>
@@ -42,6 +43,30 @@ class GeneralPerformanceOptimizationInstance
   double lambda = 1; // Minutes of delay (of a weight one train) that are
                      // "equal" to scheduling another weight one train
 
+protected:
+  [[nodiscard]] snapshot::InstanceType binary_instance_type() const override {
+    return snapshot::InstanceType::GeneralPerformanceOptimizationInstance;
+  };
+  void export_binary_data(snapshot::BinaryWriter& writer) const override {
+    GeneralProblemInstanceWithScheduleAndRoutes<GeneralTimetable<
+        GeneralSchedule<GeneralScheduledStop>>>::export_binary_data(writer);
+    for (size_t i = 0; i < train_weights.size(); ++i) {
+      writer.write(train_weights[i]);
+      writer.write(static_cast<uint8_t>(train_optional[i]));
+    }
+    writer.write(lambda);
+  };
+  void import_binary_data(snapshot::BinaryReader& reader) override {
+    GeneralProblemInstanceWithScheduleAndRoutes<GeneralTimetable<
+        GeneralSchedule<GeneralScheduledStop>>>::import_binary_data(reader);
+    initialize_vectors();
+    for (size_t i = 0; i < train_weights.size(); ++i) {
+      train_weights[i]  = reader.read<double>();
+      train_optional[i] = reader.read<uint8_t>() != 0;
+    }
+    lambda = reader.read<double>();
+  };
+
 public:
   GeneralPerformanceOptimizationInstance() = default;
   explicit GeneralPerformanceOptimizationInstance(const Network& network)
@@ -75,6 +100,32 @@ public:
     lambda = static_cast<double>(j["lambda"]);
   };
 
+  [[nodiscard]] static GeneralPerformanceOptimizationInstance
+  import_instance_binary(const std::filesystem::path& p) {
+    /**
+     * Imports an instance from a binary snapshot created by
+     * export_instance_binary. The file is memory mapped and its checksum is
+     * verified before reading.
+     */
+    const snapshot::SnapshotFile file(
+        p, snapshot::InstanceType::GeneralPerformanceOptimizationInstance);
+    auto                                   reader = file.reader();
+    GeneralPerformanceOptimizationInstance return_instance;
+    return_instance.import_binary_data(reader);
+    if (!reader.at_end()) {
+      throw exceptions::ImportException("binary snapshot (trailing data)");
+    }
+    return return_instance;
+  };
+  [[nodiscard]] static GeneralPerformanceOptimizationInstance
+  import_instance_binary(const std::string& path) {
+    return import_instance_binary(std::filesystem::path(path));
+  };
+  [[nodiscard]] static GeneralPerformanceOptimizationInstance
+  import_instance_binary(const char* path) {
+    return import_instance_binary(std::filesystem::path(path));
+  };
+
   static GeneralPerformanceOptimizationInstance
   cast_from_vss_generation(const VSSGenerationTimetable& vss_gen);
   [[nodiscard]] VSSGenerationTimetable
@@ -103,32 +154,32 @@ public:
   };
   [[nodiscard]] double get_lambda() const { return lambda; };
 
-  [[nodiscard]] double get_train_weight(size_t train_index) {
+  [[nodiscard]] double get_train_weight(size_t train_index) const {
     if (!this->get_timetable().get_train_list().has_train(train_index)) {
       throw std::invalid_argument("Train index out of bounds");
     }
     return train_weights.at(train_index);
   }
-  [[nodiscard]] double get_train_weight(const std::string& train_name) {
+  [[nodiscard]] double get_train_weight(const std::string& train_name) const {
     return get_train_weight(
         this->get_timetable().get_train_list().get_train_index(train_name));
   }
-  [[nodiscard]] double get_train_weight(const char* train_name) {
+  [[nodiscard]] double get_train_weight(const char* train_name) const {
     return get_train_weight(
         this->get_timetable().get_train_list().get_train_index(train_name));
   }
 
-  [[nodiscard]] bool get_train_optional(size_t train_index) {
+  [[nodiscard]] bool get_train_optional(size_t train_index) const {
     if (!this->get_timetable().get_train_list().has_train(train_index)) {
       throw std::invalid_argument("Train index out of bounds");
     }
     return train_optional.at(train_index);
   }
-  [[nodiscard]] bool get_train_optional(const std::string& train_name) {
+  [[nodiscard]] bool get_train_optional(const std::string& train_name) const {
     return get_train_optional(
         this->get_timetable().get_train_list().get_train_index(train_name));
   }
-  [[nodiscard]] bool get_train_optional(const char* train_name) {
+  [[nodiscard]] bool get_train_optional(const char* train_name) const {
     return get_train_optional(
         this->get_timetable().get_train_list().get_train_index(train_name));
   }
@@ -270,11 +321,12 @@ class SolGeneralPerformanceOptimizationInstance
   std::vector<bool>                     train_routed;
 
   void initialize_vectors() {
-    train_pos.reserve(this->instance.get_timetable().get_train_list().size());
-    train_speed.reserve(this->instance.get_timetable().get_train_list().size());
+    train_pos.reserve(this->instance->get_timetable().get_train_list().size());
+    train_speed.reserve(
+        this->instance->get_timetable().get_train_list().size());
     train_routed = std::vector<bool>(
-        this->instance.get_timetable().get_train_list().size(), false);
-    for (size_t tr = 0; tr < this->instance.get_train_list().size(); ++tr) {
+        this->instance->get_timetable().get_train_list().size(), false);
+    for (size_t tr = 0; tr < this->instance->get_train_list().size(); ++tr) {
       train_pos.emplace_back();
       train_speed.emplace_back();
     }
@@ -286,6 +338,10 @@ public:
       : SolGeneralProblemInstanceWithScheduleAndRoutes<T>(instance) {
     this->initialize_vectors();
   };
+  explicit SolGeneralPerformanceOptimizationInstance(CopyOnWrite<T> instance)
+      : SolGeneralProblemInstanceWithScheduleAndRoutes<T>(std::move(instance)) {
+    this->initialize_vectors();
+  };
   SolGeneralPerformanceOptimizationInstance(const T&       instance,
                                             SolutionStatus status, double obj,
                                             bool has_sol)
@@ -305,14 +361,14 @@ public:
 
     bool const import_routes = instance.has_value();
     if (instance.has_value()) {
-      this->instance = instance.value();
+      this->instance = CopyOnWrite<T>(instance.value());
     } else {
-      this->instance = GeneralPerformanceOptimizationInstance(p / "instance");
+      this->instance = CopyOnWrite<T>(T(p / "instance"));
     }
 
     if (import_routes) {
-      this->instance.editable_routes() =
-          RouteMap(p / "instance" / "routes", this->instance.const_n());
+      this->instance.edit().editable_routes() =
+          RouteMap(p / "instance" / "routes", this->instance->const_n());
     }
 
     std::ifstream data_file(p / "solution" / "data.json");
@@ -349,17 +405,18 @@ public:
     std::ifstream train_routed_file(p / "solution" / "train_routed.json");
     json          train_routed_json = json::parse(train_routed_file);
     for (const auto& [tr_name, routed] : train_routed_json.items()) {
-      this->train_routed[this->instance.get_train_list().get_train_index(
+      this->train_routed[this->instance->get_train_list().get_train_index(
           tr_name)] = routed.template get<bool>();
     }
   };
 
   [[nodiscard]] double get_train_pos(const std::string& tr_name,
                                      double             t) const {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
-    const auto tr_id = this->instance.get_train_list().get_train_index(tr_name);
+    const auto tr_id =
+        this->instance->get_train_list().get_train_index(tr_name);
     if (train_pos.at(tr_id).count(t) > 0) {
       return train_pos.at(tr_id).at(t);
     }
@@ -368,10 +425,11 @@ public:
   };
   [[nodiscard]] std::tuple<size_t, double, double>
   get_edge_and_time_bounds(const std::string& tr_name, double t) const {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
-    const auto tr_id = this->instance.get_train_list().get_train_index(tr_name);
+    const auto tr_id =
+        this->instance->get_train_list().get_train_index(tr_name);
     const auto& tr_pos = train_pos.at(tr_id);
 
     double t0 = -1;
@@ -417,8 +475,8 @@ public:
     const auto pos1 = get_train_pos(tr_name, t1);
     const auto pos2 = get_train_pos(tr_name, t2);
 
-    const Route& tr_route         = this->instance.get_route(tr_name);
-    const auto&  r_len            = tr_route.length(this->instance.const_n());
+    const Route& tr_route         = this->instance->get_route(tr_name);
+    const auto&  r_len            = tr_route.length(this->instance->const_n());
     const bool   tr_leaving_route = pos2 >= r_len + GRB_EPS;
 
     if (std::abs(pos2 - pos1) < GRB_EPS) {
@@ -426,8 +484,8 @@ public:
               std::max(v1, v2)};
     }
 
-    const auto& edge_obj = this->instance.const_n().get_edge(edge);
-    const auto& tr_obj   = this->instance.get_train_list().get_train(tr_name);
+    const auto& edge_obj = this->instance->const_n().get_edge(edge);
+    const auto& tr_obj   = this->instance->get_train_list().get_train(tr_name);
 
     const auto max_speed = tr_leaving_route
                                ? tr_obj.max_speed
@@ -487,8 +545,8 @@ public:
     const auto pos_2 = get_train_pos(tr_name, t2);
     const auto v2    = get_train_speed(tr_name, t2);
 
-    const auto& edge_obj  = this->instance.const_n().get_edge(edge);
-    const auto& tr_obj    = this->instance.get_train_list().get_train(tr_name);
+    const auto& edge_obj  = this->instance->const_n().get_edge(edge);
+    const auto& tr_obj    = this->instance->get_train_list().get_train(tr_name);
     const auto  max_speed = std::min(tr_obj.max_speed, edge_obj.max_speed);
     const auto  dist_travelled = pos_2 - pos_1;
 
@@ -516,10 +574,11 @@ public:
   };
   [[nodiscard]] double get_train_speed(const std::string& tr_name,
                                        double             t) const {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
-    const auto tr_id = this->instance.get_train_list().get_train_index(tr_name);
+    const auto tr_id =
+        this->instance->get_train_list().get_train_index(tr_name);
     if (train_speed.at(tr_id).count(t) > 0) {
       return train_speed.at(tr_id).at(t);
     }
@@ -527,18 +586,19 @@ public:
                                            " at time " + std::to_string(t));
   };
   [[nodiscard]] bool get_train_routed(const std::string& tr_name) const {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
     return train_routed.at(
-        this->instance.get_train_list().get_train_index(tr_name));
+        this->instance->get_train_list().get_train_index(tr_name));
   };
   [[nodiscard]] std::vector<double>
   get_train_times(const std::string& tr_name) const {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
-    const auto tr_id = this->instance.get_train_list().get_train_index(tr_name);
+    const auto tr_id =
+        this->instance->get_train_list().get_train_index(tr_name);
     const auto& tr_speed_map = train_speed.at(tr_id);
     // Return keys of the map
     std::vector<double> times;
@@ -605,7 +665,7 @@ public:
   }
   [[nodiscard]] double get_time_at_pos(const std::string& tr_name,
                                        double             pos) const {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
     const auto tr_times = get_train_times(tr_name);
@@ -619,7 +679,7 @@ public:
   };
 
   void add_train_pos(const std::string& tr_name, double t, double pos) {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
     if (pos + EPS < 0) {
@@ -629,7 +689,8 @@ public:
       throw exceptions::ConsistencyException("Time must be non-negative");
     }
 
-    const auto tr_id = this->instance.get_train_list().get_train_index(tr_name);
+    const auto tr_id =
+        this->instance->get_train_list().get_train_index(tr_name);
     if (train_pos.at(tr_id).count(t) > 0) {
       train_pos.at(tr_id).at(t) = pos;
     } else {
@@ -637,7 +698,7 @@ public:
     }
   };
   void add_train_speed(const std::string& tr_name, double t, double speed) {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
     if (speed + EPS < 0) {
@@ -647,7 +708,8 @@ public:
       throw exceptions::ConsistencyException("Time must be non-negative");
     }
 
-    const auto tr_id = this->instance.get_train_list().get_train_index(tr_name);
+    const auto tr_id =
+        this->instance->get_train_list().get_train_index(tr_name);
     if (train_speed.at(tr_id).count(t) > 0) {
       train_speed.at(tr_id).at(t) = speed;
     } else {
@@ -661,10 +723,10 @@ public:
     set_train_routed_value(tr_name, false);
   };
   void set_train_routed_value(const std::string& tr_name, bool val) {
-    if (!this->instance.get_train_list().has_train(tr_name)) {
+    if (!this->instance->get_train_list().has_train(tr_name)) {
       throw exceptions::TrainNotExistentException(tr_name);
     }
-    train_routed.at(this->instance.get_train_list().get_train_index(tr_name)) =
+    train_routed.at(this->instance->get_train_list().get_train_index(tr_name)) =
         val;
   };
 
@@ -703,9 +765,9 @@ public:
     json train_pos_json;
     json train_speed_json;
     json train_routed_json;
-    for (size_t tr_id = 0; tr_id < this->instance.get_train_list().size();
+    for (size_t tr_id = 0; tr_id < this->instance->get_train_list().size();
          ++tr_id) {
-      const auto& train = this->instance.get_train_list().get_train(tr_id);
+      const auto& train = this->instance->get_train_list().get_train(tr_id);
       train_pos_json[train.name]    = train_pos.at(tr_id);
       train_speed_json[train.name]  = train_speed.at(tr_id);
       train_routed_json[train.name] = train_routed.at(tr_id);
@@ -728,7 +790,7 @@ public:
             T>::check_general_solution_data_consistency()) {
       return false;
     }
-    if (!this->instance.check_consistency(false)) {
+    if (!this->instance->check_consistency(false)) {
       return false;
     }
 
@@ -738,12 +800,12 @@ public:
 
     for (auto tr_id = 0; tr_id < train_routed.size(); tr_id++) {
       const auto& tr_name =
-          this->instance.get_train_list().get_train(tr_id).name;
-      if (train_routed.at(tr_id) && !this->instance.has_route(tr_name)) {
+          this->instance->get_train_list().get_train(tr_id).name;
+      if (train_routed.at(tr_id) && !this->instance->has_route(tr_name)) {
         return false;
       }
       if (!train_routed.at(tr_id) &&
-          !this->instance.get_train_optional().at(tr_id)) {
+          !this->instance->get_train_optional().at(tr_id)) {
         return false;
       }
       if (train_routed.at(tr_id) && train_pos.at(tr_id).size() < 2) {
@@ -770,7 +832,7 @@ public:
       }
     }
     for (size_t tr_id = 0; tr_id < train_speed.size(); ++tr_id) {
-      const auto& train = this->instance.get_train_list().get_train(tr_id);
+      const auto& train = this->instance->get_train_list().get_train(tr_id);
       for (const auto& [t, v] : train_speed.at(tr_id)) {
         if (v + EPS < 0 || v > train.max_speed + EPS) {
           return false;
@@ -817,7 +879,7 @@ public:
       const GeneralPerformanceOptimizationInstance& instance)
       : SolGeneralPerformanceOptimizationInstance<T>(instance) {
     vss_pos = std::vector<std::vector<double>>(
-        this->instance.const_n().number_of_edges());
+        this->instance->const_n().number_of_edges());
   };
   SolVSSGeneralPerformanceOptimizationInstance(
       const GeneralPerformanceOptimizationInstance& instance,
@@ -825,24 +887,24 @@ public:
       : SolGeneralPerformanceOptimizationInstance<T>(instance, status, obj,
                                                      has_sol) {
     vss_pos = std::vector<std::vector<double>>(
-        this->instance.const_n().number_of_edges());
+        this->instance->const_n().number_of_edges());
   };
   explicit SolVSSGeneralPerformanceOptimizationInstance(
       const std::filesystem::path& p,
       const std::optional<T>&      instance = std::optional<T>())
       : SolGeneralPerformanceOptimizationInstance<T>(p, instance) {
     vss_pos = std::vector<std::vector<double>>(
-        this->instance.const_n().number_of_edges());
+        this->instance->const_n().number_of_edges());
   };
 
   void add_vss_pos(size_t edge_id, double pos, bool reverse_edge = true) {
     // Add VSS position on edge. Also on reverse edge if true.
 
-    if (!this->instance.const_n().has_edge(edge_id)) {
+    if (!this->instance->const_n().has_edge(edge_id)) {
       throw exceptions::EdgeNotExistentException(edge_id);
     }
 
-    const auto& edge = this->instance.const_n().get_edge(edge_id);
+    const auto& edge = this->instance->const_n().get_edge(edge_id);
 
     if (pos <= EPS || pos + EPS >= edge.length) {
       throw exceptions::ConsistencyException(
@@ -855,7 +917,7 @@ public:
 
     if (reverse_edge) {
       const auto reverse_edge_index =
-          this->instance.const_n().get_reverse_edge_index(edge_id);
+          this->instance->const_n().get_reverse_edge_index(edge_id);
       if (reverse_edge_index.has_value()) {
         vss_pos.at(reverse_edge_index.value()).emplace_back(edge.length - pos);
         std::sort(vss_pos.at(reverse_edge_index.value()).begin(),
@@ -865,21 +927,21 @@ public:
   };
   void add_vss_pos(size_t source, size_t target, double pos,
                    bool reverse_edge = true) {
-    add_vss_pos(this->instance.const_n().get_edge_index(source, target), pos,
+    add_vss_pos(this->instance->const_n().get_edge_index(source, target), pos,
                 reverse_edge);
   };
   void add_vss_pos(const std::string& source, const std::string& target,
                    double pos, bool reverse_edge = true) {
-    add_vss_pos(this->instance.const_n().get_edge_index(source, target), pos,
+    add_vss_pos(this->instance->const_n().get_edge_index(source, target), pos,
                 reverse_edge);
   };
 
   void set_vss_pos(size_t edge_id, std::vector<double> pos) {
-    if (!this->instance.const_n().has_edge(edge_id)) {
+    if (!this->instance->const_n().has_edge(edge_id)) {
       throw exceptions::EdgeNotExistentException(edge_id);
     }
 
-    const auto& edge = this->instance.const_n().get_edge(edge_id);
+    const auto& edge = this->instance->const_n().get_edge(edge_id);
 
     for (const auto& p : pos) {
       if (p <= EPS || p + EPS >= edge.length) {
@@ -892,24 +954,24 @@ public:
     vss_pos.at(edge_id) = std::move(pos);
   };
   void set_vss_pos(size_t source, size_t target, std::vector<double> pos) {
-    set_vss_pos(this->instance.const_n().get_edge_index(source, target),
+    set_vss_pos(this->instance->const_n().get_edge_index(source, target),
                 std::move(pos));
   };
   void set_vss_pos(const std::string& source, const std::string& target,
                    std::vector<double> pos) {
-    set_vss_pos(this->instance.const_n().get_edge_index(source, target),
+    set_vss_pos(this->instance->const_n().get_edge_index(source, target),
                 std::move(pos));
   };
 
   void reset_vss_pos(size_t edge_id) {
-    if (!this->instance.const_n().has_edge(edge_id)) {
+    if (!this->instance->const_n().has_edge(edge_id)) {
       throw exceptions::EdgeNotExistentException(edge_id);
     }
 
     vss_pos.at(edge_id).clear();
   };
   void reset_vss_pos(size_t source, size_t target) {
-    reset_vss_pos(this->instance.const_n().get_edge_index(source, target));
+    reset_vss_pos(this->instance->const_n().get_edge_index(source, target));
   };
   void reset_vss_pos(const std::string& source, const std::string& target) {
     reset_vss_pos(this->const_n().get_edge_index(source, target));
@@ -922,10 +984,10 @@ public:
 
     json vss_pos_json;
     for (size_t edge_id = 0;
-         edge_id < this->instance.const_n().number_of_edges(); ++edge_id) {
-      const auto& edge = this->instance.const_n().get_edge(edge_id);
-      const auto& v0   = this->instance.const_n().get_vertex(edge.source).name;
-      const auto& v1   = this->instance.const_n().get_vertex(edge.target).name;
+         edge_id < this->instance->const_n().number_of_edges(); ++edge_id) {
+      const auto& edge = this->instance->const_n().get_edge(edge_id);
+      const auto& v0   = this->instance->const_n().get_vertex(edge.source).name;
+      const auto& v1   = this->instance->const_n().get_vertex(edge.target).name;
       vss_pos_json["('" + v0 + "', '" + v1 + "')"] = vss_pos.at(edge_id);
     }
 
@@ -938,7 +1000,7 @@ public:
       return false;
     }
     for (size_t edge_id = 0; edge_id < vss_pos.size(); ++edge_id) {
-      const auto& edge = this->instance.const_n().get_edge(edge_id);
+      const auto& edge = this->instance->const_n().get_edge(edge_id);
       if (!edge.breakable && !vss_pos.at(edge_id).empty()) {
         return false;
       }
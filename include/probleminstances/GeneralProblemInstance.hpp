@@ -1,6 +1,9 @@
 #pragma once
 
+#include "BinarySnapshot.hpp"
+#include "CopyOnWrite.hpp"
 #include "Definitions.hpp"
+#include "SolverTelemetry.hpp"
 #include "datastructure/GeneralTimetable.hpp"
 #include "datastructure/RailwayNetwork.hpp"
 #include "datastructure/Route.hpp"
@@ -38,6 +41,15 @@ protected:
     network.export_network(path / "network");
   }
 
+  // Binary snapshots, overridden by child classes to append their own data
+  [[nodiscard]] virtual snapshot::InstanceType binary_instance_type() const = 0;
+  virtual void export_binary_data(snapshot::BinaryWriter& writer) const {
+    network.export_binary(writer);
+  };
+  virtual void import_binary_data(snapshot::BinaryReader& reader) {
+    network = Network(reader);
+  };
+
 public:
   // Network functions, i.e., network is accessible via n() as a reference
   [[nodiscard]] Network&       n() { return network; };
@@ -52,6 +64,25 @@ public:
     export_instance(std::filesystem::path(path));
   };
 
+  void export_instance_binary(const std::filesystem::path& p) const {
+    /**
+     * Exports the instance to a single versioned and checksummed binary file,
+     * which can be loaded using import_instance_binary of the respective
+     * class.
+     *
+     * @param p Path of the file to create
+     */
+    snapshot::BinaryWriter writer;
+    export_binary_data(writer);
+    writer.write_to_file(p, binary_instance_type());
+  };
+  void export_instance_binary(const std::string& path) const {
+    export_instance_binary(std::filesystem::path(path));
+  };
+  void export_instance_binary(const char* path) const {
+    export_instance_binary(std::filesystem::path(path));
+  };
+
   [[nodiscard]] virtual bool check_consistency() const = 0;
 
   virtual ~GeneralProblemInstance() = default;
@@ -86,6 +117,17 @@ protected:
         timetable(T(path / "timetable", this->const_n())),
         routes(RouteMap(path / "routes", this->const_n())) {};
 
+  void export_binary_data(snapshot::BinaryWriter& writer) const override {
+    GeneralProblemInstance::export_binary_data(writer);
+    timetable.export_binary(writer);
+    routes.export_binary(writer);
+  };
+  void import_binary_data(snapshot::BinaryReader& reader) override {
+    GeneralProblemInstance::import_binary_data(reader);
+    timetable = T(reader, this->const_n());
+    routes    = RouteMap(reader, this->const_n());
+  };
+
   [[nodiscard]] T&              editable_timetable() { return timetable; };
   [[nodiscard]] RouteMap&       editable_routes() { return routes; };
   [[nodiscard]] const T&        const_timetable() const { return timetable; };
@@ -99,6 +141,12 @@ public:
   Train& editable_tr(const std::string& name) {
     return timetable.editable_tr(name);
   };
+  [[nodiscard]] auto& editable_schedule(size_t index) {
+    return timetable.editable_schedule(index);
+  };
+  [[nodiscard]] auto& editable_schedule(const std::string& train_name) {
+    return timetable.editable_schedule(train_name);
+  };
 
   [[nodiscard]] bool is_forced_to_stop(const std::string& train_name,
                                        int                time) const {
@@ -152,7 +200,8 @@ public:
 
   [[nodiscard]] std::vector<std::pair<size_t, std::vector<std::vector<size_t>>>>
   possible_stop_vertices(size_t tr, const std::string& station_name,
-                         const std::vector<size_t>& edges_to_consider = {}) {
+                         const std::vector<size_t>& edges_to_consider = {})
+      const {
     /**
      * This method returns the possible stop vertices for a train at a station
      * together with the respective stop edges
@@ -188,7 +237,7 @@ public:
     std::vector<std::pair<size_t, std::vector<std::vector<size_t>>>> ret_val;
 
     for (const auto& v : vertices_to_test) {
-      const auto potential_stop_paths =
+      const auto& potential_stop_paths =
           this->const_n().all_paths_of_length_ending_in_vertex(v, tr_length);
       std::vector<std::vector<size_t>> stop_paths;
       for (const auto& p : potential_stop_paths) {
@@ -212,7 +261,8 @@ public:
   [[nodiscard]] std::vector<std::pair<size_t, std::vector<std::vector<size_t>>>>
   possible_stop_vertices(const std::string&         train_name,
                          const std::string&         station_name,
-                         const std::vector<size_t>& edges_to_consider = {}) {
+                         const std::vector<size_t>& edges_to_consider = {})
+      const {
     return possible_stop_vertices(
         get_timetable().get_train_list().get_train_index(train_name),
         station_name, edges_to_consider);
@@ -548,13 +598,17 @@ template <typename T> class SolGeneralProblemInstance {
                 "T must be a child of GeneralProblemInstance");
 
 protected:
-  T              instance;
-  SolutionStatus status  = SolutionStatus::Unknown;
-  double         obj     = -1;
-  bool           has_sol = false;
+  // Shared with the solver and other solutions until it is modified
+  CopyOnWrite<T>  instance;
+  SolutionStatus  status  = SolutionStatus::Unknown;
+  double          obj     = -1;
+  bool            has_sol = false;
+  SolverTelemetry telemetry;
 
   SolGeneralProblemInstance() = default;
   explicit SolGeneralProblemInstance(const T& instance) : instance(instance) {};
+  explicit SolGeneralProblemInstance(CopyOnWrite<T> instance)
+      : instance(std::move(instance)) {};
   SolGeneralProblemInstance(const T& instance, SolutionStatus status,
                             double obj, bool has_sol)
       : instance(instance), status(status), obj(obj), has_sol(has_sol) {};
@@ -568,7 +622,7 @@ protected:
     }
 
     if (export_instance) {
-      instance.export_instance(p / "instance");
+      instance->export_instance(p / "instance");
     }
 
     if (export_data) {
@@ -580,6 +634,10 @@ protected:
       data_file << data << std::endl;
       data_file.close();
     }
+
+    if (!telemetry.empty()) {
+      telemetry.export_telemetry(p / "solution");
+    }
   };
 
   [[nodiscard]] json get_general_solution_data() const {
@@ -608,7 +666,7 @@ protected:
   }
 
 public:
-  [[nodiscard]] const T&       get_instance() const { return instance; };
+  [[nodiscard]] const T&       get_instance() const { return *instance; };
   [[nodiscard]] SolutionStatus get_status() const { return status; };
   [[nodiscard]] double         get_obj() const { return obj; };
   [[nodiscard]] bool           has_solution() const { return has_sol; };
@@ -617,6 +675,14 @@ public:
   void set_solution_found() { has_sol = true; };
   void set_solution_not_found() { has_sol = false; };
 
+  // Resources used by the solver run that produced this solution
+  [[nodiscard]] const SolverTelemetry& get_telemetry() const {
+    return telemetry;
+  };
+  void set_telemetry(const SolverTelemetry& new_telemetry) {
+    telemetry = new_telemetry;
+  };
+
   virtual void export_solution(const std::filesystem::path& p,
                                bool export_instance) const = 0;
 
@@ -665,6 +731,9 @@ public:
   SolGeneralProblemInstanceWithScheduleAndRoutes() = default;
   explicit SolGeneralProblemInstanceWithScheduleAndRoutes(const T& instance)
       : SolGeneralProblemInstance<T>(instance) {};
+  explicit SolGeneralProblemInstanceWithScheduleAndRoutes(
+      CopyOnWrite<T> instance)
+      : SolGeneralProblemInstance<T>(std::move(instance)) {};
   SolGeneralProblemInstanceWithScheduleAndRoutes(const T&       instance,
                                                  SolutionStatus status,
                                                  double obj, bool has_sol)
@@ -672,49 +741,61 @@ public:
 
   // RouteMap functions
   void reset_routes() {
-    for (const auto& tr : this->instance.get_train_list()) {
-      if (this->instance.has_route(tr.name)) {
-        this->instance.routes.remove_route(tr.name);
+    const auto& train_list = this->instance->get_train_list();
+    if (std::none_of(train_list.begin(), train_list.end(),
+                     [this](const auto& tr) {
+                       return this->instance->has_route(tr.name);
+                     })) {
+      return;
+    }
+    auto& editable_instance = this->instance.edit();
+    for (const auto& tr : editable_instance.get_train_list()) {
+      if (editable_instance.has_route(tr.name)) {
+        editable_instance.routes.remove_route(tr.name);
       }
     }
   }
   void add_empty_route(const std::string& train_name) {
-    this->instance.add_empty_route(train_name);
+    this->instance.edit().add_empty_route(train_name);
   };
 
   void push_back_edge_to_route(const std::string& train_name,
                                size_t             edge_index) {
-    this->instance.push_back_edge_to_route(train_name, edge_index);
+    this->instance.edit().push_back_edge_to_route(train_name, edge_index);
   };
   void push_back_edge_to_route(const std::string& train_name, size_t source,
                                size_t target) {
-    this->instance.push_back_edge_to_route(train_name, source, target);
+    this->instance.edit().push_back_edge_to_route(train_name, source,
+                                                  target);
   };
   void push_back_edge_to_route(const std::string& train_name,
                                const std::string& source,
                                const std::string& target) {
-    this->instance.push_back_edge_to_route(train_name, source, target);
+    this->instance.edit().push_back_edge_to_route(train_name, source,
+                                                  target);
   };
 
   void push_front_edge_to_route(const std::string& train_name,
                                 size_t             edge_index) {
-    this->instance.push_front_edge_to_route(train_name, edge_index);
+    this->instance.edit().push_front_edge_to_route(train_name, edge_index);
   };
   void push_front_edge_to_route(const std::string& train_name, size_t source,
                                 size_t target) {
-    this->instance.push_front_edge_to_route(train_name, source, target);
+    this->instance.edit().push_front_edge_to_route(train_name, source,
+                                                   target);
   };
   void push_front_edge_to_route(const std::string& train_name,
                                 const std::string& source,
                                 const std::string& target) {
-    this->instance.push_front_edge_to_route(train_name, source, target);
+    this->instance.edit().push_front_edge_to_route(train_name, source,
+                                                   target);
   };
 
   void remove_first_edge_from_route(const std::string& train_name) {
-    this->instance.remove_first_edge_from_route(train_name);
+    this->instance.edit().remove_first_edge_from_route(train_name);
   };
   void remove_last_edge_from_route(const std::string& train_name) {
-    this->instance.remove_last_edge_from_route(train_name);
+    this->instance.edit().remove_last_edge_from_route(train_name);
   };
 };
 } // namespace cda_rail::instances
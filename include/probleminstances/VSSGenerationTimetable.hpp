@@ -14,6 +14,11 @@ class VSSGenerationTimetable
     : public GeneralProblemInstanceWithScheduleAndRoutes<Timetable> {
   friend class SolVSSGenerationTimetable;
 
+protected:
+  [[nodiscard]] snapshot::InstanceType binary_instance_type() const override {
+    return snapshot::InstanceType::VSSGenerationTimetable;
+  };
+
 public:
   // Constructors
   VSSGenerationTimetable() = default;
@@ -66,6 +71,32 @@ public:
                            every_train_must_have_route);
   };
 
+  [[nodiscard]] static VSSGenerationTimetable
+  import_instance_binary(const std::filesystem::path& p) {
+    /**
+     * Imports an instance from a binary snapshot created by
+     * export_instance_binary. The file is memory mapped and its checksum is
+     * verified before reading.
+     */
+    const snapshot::SnapshotFile file(
+        p, snapshot::InstanceType::VSSGenerationTimetable);
+    auto                   reader = file.reader();
+    VSSGenerationTimetable return_instance;
+    return_instance.import_binary_data(reader);
+    if (!reader.at_end()) {
+      throw exceptions::ImportException("binary snapshot (trailing data)");
+    }
+    return return_instance;
+  };
+  [[nodiscard]] static VSSGenerationTimetable
+  import_instance_binary(const std::string& path) {
+    return import_instance_binary(std::filesystem::path(path));
+  };
+  [[nodiscard]] static VSSGenerationTimetable
+  import_instance_binary(const char* path) {
+    return import_instance_binary(std::filesystem::path(path));
+  };
+
   // Transformation functions
   void discretize(
       const vss::SeparationFunction& sep_func = &vss::functions::uniform);
@@ -96,6 +127,8 @@ public:
   // Constructor
   explicit SolVSSGenerationTimetable(const VSSGenerationTimetable& instance,
                                      int                           dt);
+  explicit SolVSSGenerationTimetable(
+      CopyOnWrite<VSSGenerationTimetable> instance, int dt);
   explicit SolVSSGenerationTimetable(
       const std::filesystem::path&                 p,
       const std::optional<VSSGenerationTimetable>& instance =
@@ -104,24 +137,24 @@ public:
 
   // Getter
   [[nodiscard]] const std::vector<double>& get_vss_pos(size_t edge_id) const {
-    if (!instance.const_n().has_edge(edge_id)) {
+    if (!instance->const_n().has_edge(edge_id)) {
       throw cda_rail::exceptions::EdgeNotExistentException(edge_id);
     }
     return vss_pos.at(edge_id);
   };
   [[nodiscard]] const std::vector<double>& get_vss_pos(size_t source,
                                                        size_t target) const {
-    return get_vss_pos(instance.const_n().get_edge_index(source, target));
+    return get_vss_pos(instance->const_n().get_edge_index(source, target));
   };
   [[nodiscard]] const std::vector<double>&
   get_vss_pos(const std::string& source, const std::string& target) const {
-    return get_vss_pos(instance.const_n().get_edge_index(source, target));
+    return get_vss_pos(instance->const_n().get_edge_index(source, target));
   };
 
   [[nodiscard]] double get_train_pos(size_t train_id, int time) const;
   [[nodiscard]] double get_train_pos(const std::string& train_name,
                                      int                time) const {
-    return get_train_pos(instance.get_train_list().get_train_index(train_name),
+    return get_train_pos(instance->get_train_list().get_train_index(train_name),
                          time);
   }
   [[nodiscard]] std::vector<double>
@@ -129,14 +162,14 @@ public:
   [[nodiscard]] std::vector<double>
   get_valid_border_stops(const std::string& train_name) const {
     return get_valid_border_stops(
-        instance.get_train_list().get_train_index(train_name));
+        instance->get_train_list().get_train_index(train_name));
   }
 
   [[nodiscard]] double get_train_speed(size_t train_id, int time) const;
   [[nodiscard]] double get_train_speed(const std::string& train_name,
                                        int                time) const {
     return get_train_speed(
-        instance.get_train_list().get_train_index(train_name), time);
+        instance->get_train_list().get_train_index(train_name), time);
   }
 
   [[nodiscard]] double get_mip_obj() const { return mip_obj; };
@@ -151,44 +184,44 @@ public:
   void add_vss_pos(size_t edge_id, double pos, bool reverse_edge = true);
   void add_vss_pos(size_t source, size_t target, double pos,
                    bool reverse_edge = true) {
-    add_vss_pos(instance.const_n().get_edge_index(source, target), pos,
+    add_vss_pos(instance->const_n().get_edge_index(source, target), pos,
                 reverse_edge);
   };
   void add_vss_pos(const std::string& source, const std::string& target,
                    double pos, bool reverse_edge = true) {
-    add_vss_pos(instance.const_n().get_edge_index(source, target), pos,
+    add_vss_pos(instance->const_n().get_edge_index(source, target), pos,
                 reverse_edge);
   };
 
   void set_vss_pos(size_t edge_id, std::vector<double> pos);
   void set_vss_pos(size_t source, size_t target, std::vector<double> pos) {
-    set_vss_pos(instance.const_n().get_edge_index(source, target),
+    set_vss_pos(instance->const_n().get_edge_index(source, target),
                 std::move(pos));
   };
   void set_vss_pos(const std::string& source, const std::string& target,
                    std::vector<double> pos) {
-    set_vss_pos(instance.const_n().get_edge_index(source, target),
+    set_vss_pos(instance->const_n().get_edge_index(source, target),
                 std::move(pos));
   };
 
   void reset_vss_pos(size_t edge_id);
   void reset_vss_pos(size_t source, size_t target) {
-    reset_vss_pos(instance.const_n().get_edge_index(source, target));
+    reset_vss_pos(instance->const_n().get_edge_index(source, target));
   };
   void reset_vss_pos(const std::string& source, const std::string& target) {
-    reset_vss_pos(instance.const_n().get_edge_index(source, target));
+    reset_vss_pos(instance->const_n().get_edge_index(source, target));
   };
 
   void add_train_pos(size_t train_id, int time, double pos);
   void add_train_pos(const std::string& train_name, int time, double pos) {
-    add_train_pos(instance.get_train_list().get_train_index(train_name), time,
+    add_train_pos(instance->get_train_list().get_train_index(train_name), time,
                   pos);
   };
 
   void add_train_speed(size_t train_id, int time, double speed);
   void add_train_speed(const std::string& train_name, int time, double speed) {
-    add_train_speed(instance.get_train_list().get_train_index(train_name), time,
-                    speed);
+    add_train_speed(instance->get_train_list().get_train_index(train_name),
+                    time, speed);
   };
 
   [[nodiscard]] bool check_consistency() const override;
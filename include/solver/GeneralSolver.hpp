@@ -1,13 +1,18 @@
 #pragma once
 
+#include "CopyOnWrite.hpp"
+#include "SolverTelemetry.hpp"
 #include "probleminstances/GeneralProblemInstance.hpp"
 
 #include <chrono>
+#include <optional>
 #include <plog/Appenders/ColorConsoleAppender.h>
 #include <plog/Formatters/TxtFormatter.h>
 #include <plog/Initializers/ConsoleInitializer.h>
 #include <plog/Log.h>
+#include <string>
 #include <type_traits>
+#include <utility>
 
 namespace cda_rail::solver {
 template <typename T, typename S> class GeneralSolver {
@@ -19,13 +24,68 @@ template <typename T, typename S> class GeneralSolver {
       "S must be a child of SolGeneralProblemInstance<T>");
 
 protected:
-  T                                                   instance;
+  // Shared with the solutions, copied only once it is modified
+  CopyOnWrite<T>                                      instance;
   decltype(std::chrono::high_resolution_clock::now()) start;
   decltype(std::chrono::high_resolution_clock::now()) model_created;
   decltype(std::chrono::high_resolution_clock::now()) model_solved;
   int64_t                                             create_time = 0;
   int64_t                                             solve_time  = 0;
 
+  // Resources used by the phases of the current solve
+  SolverTelemetry telemetry;
+
+  // Preprocessed instance of a previous solve and the instance it is based on
+  struct PreprocessedInstance {
+    std::string    key;
+    CopyOnWrite<T> source;
+    CopyOnWrite<T> result;
+  };
+  std::optional<PreprocessedInstance> preprocessed_instance;
+
+  template <typename F> void preprocess_instance(const std::string& key, F f) {
+    /**
+     * Applies f to the instance, e.g., to discretize it. Afterwards, instance
+     * refers to the preprocessed instance, the original one is not modified.
+     * If the same preprocessing has already been applied to the unmodified
+     * instance in a previous solve, the result is reused instead.
+     *
+     * @param key Identifies the preprocessing, empty if it cannot be reused
+     * @param f Function modifying the instance passed by reference
+     */
+    if (!key.empty() && preprocessed_instance.has_value() &&
+        preprocessed_instance->key == key &&
+        preprocessed_instance->source.shares_with(instance)) {
+      instance = preprocessed_instance->result;
+      return;
+    }
+    auto source = instance;
+    f(instance.edit());
+    if (key.empty()) {
+      preprocessed_instance.reset();
+    } else {
+      preprocessed_instance = {key, std::move(source), instance};
+    }
+  }
+
+  template <typename F> void modify_instance(F f) {
+    /**
+     * Applies f to the instance. If a preprocessed version of the instance is
+     * cached, f is applied to it as well, so that it does not have to be
+     * preprocessed again. Hence, f must not modify anything the preprocessing
+     * depends on, e.g., the network.
+     *
+     * @param f Function modifying the instance passed by reference
+     */
+    const bool cached = preprocessed_instance.has_value() &&
+                        preprocessed_instance->source.shares_with(instance);
+    f(instance.edit());
+    if (cached) {
+      f(preprocessed_instance->result.edit());
+      preprocessed_instance->source = instance;
+    }
+  }
+
   void solve_init_general(int time_limit, bool debug_input) {
     if (plog::get() == nullptr) {
       static plog::ColorConsoleAppender<plog::TxtFormatter> console_appender;
@@ -34,6 +94,8 @@ protected:
 
     plog::get()->setMaxSeverity(debug_input ? plog::debug : plog::info);
 
+    telemetry.clear();
+
     if (plog::get()->checkSeverity(plog::debug) || time_limit > 0) {
       start = std::chrono::high_resolution_clock::now();
     }
@@ -41,13 +103,16 @@ protected:
 
   GeneralSolver() = default;
   explicit GeneralSolver(const T& instance) : instance(instance) {};
-  explicit GeneralSolver(const std::filesystem::path& p) : instance(p) {};
-  explicit GeneralSolver(const std::string& path) : instance(path) {};
-  explicit GeneralSolver(const char* path) : instance(path) {};
+  explicit GeneralSolver(const std::filesystem::path& p) : instance(T(p)) {};
+  explicit GeneralSolver(const std::string& path) : instance(T(path)) {};
+  explicit GeneralSolver(const char* path) : instance(T(path)) {};
 
 public:
-  [[nodiscard]] const T& get_instance() const { return instance; }
-  [[nodiscard]] T&       editable_instance() { return instance; }
+  [[nodiscard]] const T& get_instance() const { return *instance; }
+  [[nodiscard]] T&       editable_instance() { return instance.edit(); }
+  [[nodiscard]] const SolverTelemetry& get_telemetry() const {
+    return telemetry;
+  }
 
   [[nodiscard]] S         solve() { return solve(-1, false); };
   [[nodiscard]] virtual S solve(int time_limit, bool debug_input) = 0;
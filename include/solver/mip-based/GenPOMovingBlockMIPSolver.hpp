@@ -1,16 +1,27 @@
 #pragma once
 
+#include "CopyOnWrite.hpp"
 #include "Definitions.hpp"
+#include "ThreadPool.hpp"
 #include "datastructure/GeneralTimetable.hpp"
 #include "probleminstances/GeneralPerformanceOptimizationInstance.hpp"
 #include "solver/GeneralSolver.hpp"
 #include "solver/mip-based/GeneralMIPSolver.hpp"
+#include "solver/mip-based/LazyCallbackProfile.hpp"
+#include "solver/mip-based/LazyCutPool.hpp"
+#include "solver/mip-based/VariableSnapshot.hpp"
 
 #include "gtest/gtest_prod.h"
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <gsl/span>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -40,6 +51,16 @@ struct ModelDetail {
       VelocityRefinementStrategy::MinOneStep;
   bool simplify_headway_constraints          = false;
   bool strengthen_vertex_headway_constraints = false;
+
+  bool operator==(const ModelDetail& other) const {
+    return fix_routes == other.fix_routes &&
+           max_velocity_delta == other.max_velocity_delta &&
+           velocity_refinement_strategy == other.velocity_refinement_strategy &&
+           simplify_headway_constraints == other.simplify_headway_constraints &&
+           strengthen_vertex_headway_constraints ==
+               other.strengthen_vertex_headway_constraints;
+  };
+  bool operator!=(const ModelDetail& other) const { return !(*this == other); };
 };
 
 enum class LazyConstraintSelectionStrategy : std::uint8_t {
@@ -63,14 +84,97 @@ struct SolverStrategyMovingBlock {
   LazyTrainSelectionStrategy lazy_train_selection_strategy =
       LazyTrainSelectionStrategy::OnlyAdjacent;
   double abs_mip_gap = 10;
+  // Skip lazy cuts that have already been submitted and keep them for
+  // subsequent solves of the same model
+  bool use_lazy_cut_pool = true;
+  // Pooled cuts submitted at least this often are added as static constraints
+  // when the same model is solved again, 0 disables promotion
+  size_t lazy_cut_promotion_threshold = 0;
+  // Number of threads separating lazy constraints of different trains, 0 uses
+  // the number of hardware threads. The threads run within Gurobi's callback
+  // and compete with the threads set by GRB_IntParam_Threads.
+  size_t lazy_separation_threads = 1;
+  // Number of threads filling the table of EOM values of different trains, 0
+  // uses the number of hardware threads
+  size_t eom_table_threads = 1;
+  // Keep the model after solving. If only train weights or time windows are
+  // changed using the respective functions of the solver, the next solve
+  // updates the model instead of rebuilding it and starts from the previous
+  // solution.
+  bool persistent_model = false;
+};
+
+// Variable families of GenPOMovingBlockMIPSolver
+enum class GenPOMovingBlockVariable : std::uint8_t {
+  TFrontArrival,
+  TFrontDeparture,
+  TRearDeparture,
+  TTtdDeparture,
+  X,
+  Order,
+  XTtd,
+  OrderTtd,
+  Y,
+  Stop,
+  ReverseOrder,
+  Count
 };
 
+[[nodiscard]] constexpr std::string_view
+variable_name(GenPOMovingBlockVariable family) {
+  switch (family) {
+  case GenPOMovingBlockVariable::TFrontArrival:
+    return "t_front_arrival";
+  case GenPOMovingBlockVariable::TFrontDeparture:
+    return "t_front_departure";
+  case GenPOMovingBlockVariable::TRearDeparture:
+    return "t_rear_departure";
+  case GenPOMovingBlockVariable::TTtdDeparture:
+    return "t_ttd_departure";
+  case GenPOMovingBlockVariable::X:
+    return "x";
+  case GenPOMovingBlockVariable::Order:
+    return "order";
+  case GenPOMovingBlockVariable::XTtd:
+    return "x_ttd";
+  case GenPOMovingBlockVariable::OrderTtd:
+    return "order_ttd";
+  case GenPOMovingBlockVariable::Y:
+    return "y";
+  case GenPOMovingBlockVariable::Stop:
+    return "stop";
+  case GenPOMovingBlockVariable::ReverseOrder:
+    return "reverse_order";
+  default:
+    return "";
+  }
+}
+
+// Number of dimensions of the dense families indexed by train and vertex,
+// edge or TTD section, 0 for all other families
+[[nodiscard]] constexpr size_t fixed_rank(GenPOMovingBlockVariable family) {
+  switch (family) {
+  case GenPOMovingBlockVariable::TFrontArrival:
+  case GenPOMovingBlockVariable::TFrontDeparture:
+  case GenPOMovingBlockVariable::TRearDeparture:
+  case GenPOMovingBlockVariable::TTtdDeparture:
+  case GenPOMovingBlockVariable::X:
+  case GenPOMovingBlockVariable::XTtd:
+    return 2;
+  default:
+    return 0;
+  }
+}
+
 class GenPOMovingBlockMIPSolver
     : public GeneralMIPSolver<
           instances::GeneralPerformanceOptimizationInstance,
           instances::SolGeneralPerformanceOptimizationInstance<
-              instances::GeneralPerformanceOptimizationInstance>> {
+              instances::GeneralPerformanceOptimizationInstance>,
+          GenPOMovingBlockVariable> {
 private:
+  using Var = GenPOMovingBlockVariable;
+
 #if TEST_FRIENDS
   FRIEND_TEST(::GenPOMovingBlockMIPSolver, PrivateFillFunctions);
 #endif
@@ -92,6 +196,71 @@ private:
                                                 tr_stop_data;
   std::vector<std::vector<std::vector<double>>> velocity_extensions;
   std::vector<std::pair<size_t, size_t>>        relevant_reverse_edges;
+  LazyCutPool                                   lazy_cut_pool;
+  LazyCallbackProfile                           lazy_callback_profile;
+
+  // Variables read by the lazy callback, whose values are extracted using a
+  // single query per callback
+  struct VelocitySlot {
+    size_t source_velocity_index;
+    size_t target_velocity_index;
+    size_t slot;
+  };
+  VariableSnapshot<GenPOMovingBlockVariable> callback_solution;
+  // Velocity extended variables of train tr on edge e are
+  // velocity_slots[velocity_slot_offsets[tr * num_edges + e], ...,
+  // velocity_slot_offsets[tr * num_edges + e + 1] - 1]
+  std::vector<size_t>       velocity_slot_offsets;
+  std::vector<VelocitySlot> velocity_slots;
+
+  // Values of the equations of motion of every velocity arc, i.e., train tr
+  // traversing edge e from velocity extension i to j, computed once per model.
+  // They are stored at eom_table[eom_table_offsets[tr * num_edges + e] + i * n
+  // + j], where n is the number of velocity extensions at the target of e.
+  struct EOMTableEntry {
+    // If false, the arc exceeds the maximal speed or is not possible by the
+    // equations of motion, and all values are 0
+    bool   possible        = false;
+    double min_travel_time = 0;
+    double max_travel_time = 0;
+    // Headway of the arc unless it starts at the entry of the train
+    double headway = 0;
+  };
+  std::vector<size_t>        eom_table_offsets;
+  std::vector<EOMTableEntry> eom_table;
+  // Minimal time to push the moving authority fully backward of every train at
+  // every vertex for every velocity extension
+  std::vector<std::vector<std::vector<double>>> ma_backward_times;
+
+  // Minimal travel time of every train on every edge, INF if not traversable
+  std::vector<std::vector<double>>                    min_edge_travel_times;
+  // Earliest arrival and latest departure of every train's front at every
+  // vertex, the window is empty if the vertex is not reachable in time
+  std::vector<std::vector<std::pair<double, double>>> time_windows;
+
+  // Model kept for subsequent solves if solver_strategy.persistent_model
+  struct PersistentModel {
+    // Instance the model represents, without preprocessing
+    CopyOnWrite<instances::GeneralPerformanceOptimizationInstance> source;
+    // Upper bounds on the timing variables the model was built with. They
+    // are used as big-M values, hence, they cannot be increased.
+    std::vector<int>  t_bounds;
+    bool              objective_changed = false;
+    std::vector<bool> time_window_changed;
+  };
+  std::optional<PersistentModel> persistent_model;
+  // Bounds on the entry and exit times of every train, i.e., t_0 lower and
+  // upper bound followed by t_n lower and upper bound
+  std::vector<std::array<GRBConstr, 4>> time_window_constrs;
+
+  // Instance, without preprocessing, and model detail the cuts of
+  // lazy_cut_pool have been separated on
+  std::optional<std::pair<
+      CopyOnWrite<instances::GeneralPerformanceOptimizationInstance>,
+      ModelDetail>>
+      lazy_cut_pool_source;
+  // Cuts of lazy_cut_pool added to the current model as static constraints
+  std::vector<GRBConstr> promoted_lazy_constrs;
 
   void initialize_variables(
       const SolutionSettingsMovingBlock& solution_settings_input,
@@ -100,18 +269,52 @@ private:
 
   double ub_timing_variable(size_t tr) const;
 
+  [[nodiscard]] bool can_reuse_model(
+      const ModelDetail&                 model_detail_input,
+      const SolverStrategyMovingBlock&   solver_strategy_input,
+      const SolutionSettingsMovingBlock& solution_settings_input) const;
+  void update_persistent_model();
+  void set_warm_start();
+
+  template <typename F> void modify_persistent_instance(F f) {
+    /**
+     * Applies f to the instance. If the persistent model represents the
+     * instance before, it still does afterwards as long as the changes are
+     * recorded in persistent_model.
+     */
+    const bool represented = persistent_model.has_value() &&
+                             persistent_model->source.shares_with(instance);
+    modify_instance(f);
+    if (represented) {
+      persistent_model->source = instance;
+    }
+  };
+
   void fill_tr_stop_data();
   void fill_relevant_reverse_edges();
   void fill_velocity_extensions();
   void fill_velocity_extensions_using_none_strategy();
   void fill_velocity_extensions_using_min_one_step_strategy();
+  void fill_eom_table();
+  void fill_time_windows();
 
   size_t get_maximal_velocity_extension_size() const;
 
+  [[nodiscard]] size_t velocity_index(size_t tr, size_t v, double vel) const;
+  [[nodiscard]] const EOMTableEntry&
+  eom_table_entry(size_t tr, size_t e, size_t i, size_t j) const;
+  [[nodiscard]] double edge_headway(size_t tr, size_t e, size_t i, size_t j,
+                                    bool entry_vertex) const;
+  [[nodiscard]] double ma_backward_time(size_t tr, size_t v, double vel) const {
+    return ma_backward_times.at(tr).at(v).at(velocity_index(tr, v, vel));
+  };
+
+  void fill_callback_solution();
+
   [[nodiscard]] std::tuple<double, GRBLinExpr, double, GRBLinExpr>
-  get_vertex_headway_expressions(size_t tr, size_t e);
+  get_vertex_headway_expressions(size_t tr, size_t e) const;
   [[nodiscard]] std::tuple<double, GRBLinExpr, double, GRBLinExpr>
-  get_edge_headway_expressions(size_t tr, size_t e);
+  get_edge_headway_expressions(size_t tr, size_t e) const;
 
   void create_variables();
   void create_timing_variables();
@@ -119,6 +322,7 @@ private:
   void create_stop_variables();
   void create_velocity_extended_variables();
   void create_reverse_edge_variables();
+  void set_time_window_bounds();
 
   void set_objective();
 
@@ -138,7 +342,7 @@ private:
   [[nodiscard]] GRBLinExpr
   get_edge_path_expr(size_t tr, const std::vector<size_t>& p,
                      double initial_velocity,
-                     bool   also_higher_velocities = false);
+                     bool   also_higher_velocities = false) const;
 
   void extract_solution(
       instances::SolGeneralPerformanceOptimizationInstance<
@@ -151,39 +355,114 @@ private:
   private:
     GenPOMovingBlockMIPSolver* solver;
 
+    struct PendingLazyCuts {
+      // Cuts found by a separation worker, cuts is empty if they are pooled
+      LazyCutSignature     signature;
+      bool                 violated;
+      std::vector<LazyCut> cuts;
+    };
+
+    using TrainSeparator =
+        std::function<bool(size_t, std::vector<PendingLazyCuts>&)>;
+
+    struct TrainOrdersOnEdges {
+      // Trains using an edge in either direction, stored in CSR layout, i.e.,
+      // the trains on edge e are at positions offsets[e] to offsets[e+1]-1.
+      // The flag is true if the train traverses e from source to target.
+      // by_source is ordered by the departure times at the source of e and
+      // by_target by the rear departure times at the target of e.
+      std::vector<size_t>                  offsets;
+      std::vector<std::pair<size_t, bool>> by_source;
+      std::vector<std::pair<size_t, bool>> by_target;
+
+      [[nodiscard]] gsl::span<const std::pair<size_t, bool>>
+      source_order(size_t edge_id) const {
+        return {by_source.data() + offsets.at(edge_id),
+                offsets.at(edge_id + 1) - offsets.at(edge_id)};
+      };
+      [[nodiscard]] gsl::span<const std::pair<size_t, bool>>
+      target_order(size_t edge_id) const {
+        return {by_target.data() + offsets.at(edge_id),
+                offsets.at(edge_id + 1) - offsets.at(edge_id)};
+      };
+    };
+
+    struct EdgeVisit {
+      size_t edge_id;
+      size_t tr;
+      bool   forward;
+      double source_time;
+      double target_time;
+    };
+
+    // Buffers of get_train_orders_on_edges, reused by every callback
+    TrainOrdersOnEdges     edge_orders;
+    std::vector<EdgeVisit> edge_visits;
+    std::vector<EdgeVisit> sorted_edge_visits;
+    std::vector<size_t>    edge_last_train;
+    std::vector<size_t>    edge_positions;
+    // Workers of separate_trains_in_parallel, started by the first callback
+    std::unique_ptr<ThreadPool> separation_pool;
+
     std::vector<std::vector<std::pair<size_t, double>>> get_routes();
     std::vector<std::unordered_map<size_t, double>>     get_train_velocities(
             const std::vector<std::vector<std::pair<size_t, double>>>& routes);
-    std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                          std::vector<std::pair<size_t, bool>>>>
-    get_train_orders_on_edges(
+    const TrainOrdersOnEdges& get_train_orders_on_edges(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes);
     std::vector<std::vector<size_t>> get_train_orders_on_ttd();
 
     bool create_lazy_edge_and_ttd_headway_constraints(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes,
         const std::vector<std::unordered_map<size_t, double>>& train_velocities,
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-                                                train_orders_on_edges,
-        const std::vector<std::vector<size_t>>& train_orders_on_ttd);
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution);
     bool create_lazy_simplified_edge_constraints(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes,
         const std::vector<std::unordered_map<size_t, double>>& train_velocities,
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-                                                train_orders_on_edges,
-        const std::vector<std::vector<size_t>>& train_orders_on_ttd);
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution);
     bool create_lazy_vertex_headway_constraints(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes,
         const std::vector<std::unordered_map<size_t, double>>& train_velocities,
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-            train_orders_on_edges);
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution);
     bool create_lazy_reverse_edge_constraints(
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-            train_orders_on_edges);
+        const TrainOrdersOnEdges& train_orders_on_edges);
+
+    // Separation of a single train, only reads shared data and is hence
+    // executed by worker threads
+    bool separate_edge_and_ttd_headway_constraints(
+        size_t                                                     tr,
+        const std::vector<std::vector<std::pair<size_t, double>>>& routes,
+        const std::vector<std::unordered_map<size_t, double>>& train_velocities,
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution,
+        std::vector<PendingLazyCuts>&                     pending_cuts) const;
+    bool separate_simplified_edge_constraints(
+        size_t                                                     tr,
+        const std::vector<std::vector<std::pair<size_t, double>>>& routes,
+        const std::vector<std::unordered_map<size_t, double>>& train_velocities,
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution,
+        std::vector<PendingLazyCuts>&                     pending_cuts) const;
+    bool separate_vertex_headway_constraints(
+        size_t                                                     tr,
+        const std::vector<std::vector<std::pair<size_t, double>>>& routes,
+        const std::vector<std::unordered_map<size_t, double>>& train_velocities,
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution,
+        std::vector<PendingLazyCuts>&                     pending_cuts) const;
+
+    bool separate_trains_in_parallel(const TrainSeparator& separate_train);
+    [[nodiscard]] bool is_pooled(const LazyCutSignature& signature) const;
+    bool submit_pooled_lazy_cuts(const LazyCutSignature& signature,
+                                 bool                    violated);
+    void submit_lazy_cuts(const LazyCutSignature& signature, bool violated,
+                          std::vector<LazyCut> cuts);
 
   public:
     explicit LazyCallback(GenPOMovingBlockMIPSolver* solver) : solver(solver) {}
@@ -203,26 +482,29 @@ public:
       : GeneralMIPSolver<
             instances::GeneralPerformanceOptimizationInstance,
             instances::SolGeneralPerformanceOptimizationInstance<
-                instances::GeneralPerformanceOptimizationInstance>>(instance) {
-        };
+                instances::GeneralPerformanceOptimizationInstance>,
+            GenPOMovingBlockVariable>(instance) {};
 
   explicit GenPOMovingBlockMIPSolver(const std::filesystem::path& p)
       : GeneralMIPSolver<
             instances::GeneralPerformanceOptimizationInstance,
             instances::SolGeneralPerformanceOptimizationInstance<
-                instances::GeneralPerformanceOptimizationInstance>>(p) {};
+                instances::GeneralPerformanceOptimizationInstance>,
+            GenPOMovingBlockVariable>(p) {};
 
   explicit GenPOMovingBlockMIPSolver(const std::string& path)
       : GeneralMIPSolver<
             instances::GeneralPerformanceOptimizationInstance,
             instances::SolGeneralPerformanceOptimizationInstance<
-                instances::GeneralPerformanceOptimizationInstance>>(path) {};
+                instances::GeneralPerformanceOptimizationInstance>,
+            GenPOMovingBlockVariable>(path) {};
 
   explicit GenPOMovingBlockMIPSolver(const char* path)
       : GeneralMIPSolver<
             instances::GeneralPerformanceOptimizationInstance,
             instances::SolGeneralPerformanceOptimizationInstance<
-                instances::GeneralPerformanceOptimizationInstance>>(path) {};
+                instances::GeneralPerformanceOptimizationInstance>,
+            GenPOMovingBlockVariable>(path) {};
 
   ~GenPOMovingBlockMIPSolver() = default;
 
@@ -239,6 +521,34 @@ public:
         const SolverStrategyMovingBlock&   solver_strategy_input,
         const SolutionSettingsMovingBlock& solution_settings_input,
         int time_limit = -1, bool debug_input = false);
+
+  [[nodiscard]] const LazyCallbackProfile& get_lazy_callback_profile() const {
+    return lazy_callback_profile;
+  };
+
+  // Changes that a persistent model is updated with instead of being rebuilt
+  void set_train_weight(size_t tr, double weight);
+  void set_train_weight(const std::string& train_name, double weight) {
+    set_train_weight(instance->get_train_list().get_train_index(train_name),
+                     weight);
+  };
+  void set_t_0_range(size_t tr, const std::pair<int, int>& t_0_range);
+  void set_t_0_range(const std::string&         train_name,
+                     const std::pair<int, int>& t_0_range) {
+    set_t_0_range(instance->get_train_list().get_train_index(train_name),
+                  t_0_range);
+  };
+  void set_t_n_range(size_t tr, const std::pair<int, int>& t_n_range);
+  void set_t_n_range(const std::string&         train_name,
+                     const std::pair<int, int>& t_n_range) {
+    set_t_n_range(instance->get_train_list().get_train_index(train_name),
+                  t_n_range);
+  };
+
+  [[nodiscard]] bool has_persistent_model() const {
+    return persistent_model.has_value();
+  };
+  void discard_persistent_model();
 };
 
 } // namespace cda_rail::solver::mip_based
@@ -3,7 +3,10 @@
 #include "MultiArray.hpp"
 #include "gurobi_c++.h"
 #include "solver/GeneralSolver.hpp"
+#include "solver/mip-based/GurobiEnvironmentPool.hpp"
+#include "solver/mip-based/VariableRegistry.hpp"
 
+#include <memory>
 #include <optional>
 #include <plog/Log.h>
 #include <string>
@@ -17,14 +20,27 @@ struct SolutionSettings {
   ExportOption export_option = ExportOption::NoExport;
   std::string  name          = "model";
   std::string  path;
+  // If true, variables and constraints are unnamed unless the LP is exported
+  bool anonymous_model = false;
 };
 
 struct SolutionSettingsMovingBlock {
   ExportOption export_option = ExportOption::NoExport;
   std::string  name          = "model";
   std::string  path;
+  // If true, variables and constraints are unnamed unless the LP is exported
+  bool anonymous_model = false;
+  // If true, the statistics of the lazy callback are exported to
+  // path / name / lazy_callback_profile.json
+  bool export_lazy_callback_profile = false;
 };
 
+[[nodiscard]] inline bool exports_lp(ExportOption export_option) {
+  return export_option == ExportOption::ExportLP ||
+         export_option == ExportOption::ExportSolutionAndLP ||
+         export_option == ExportOption::ExportSolutionWithInstanceAndLP;
+}
+
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
 
 class MessageCallback : public GRBCallback {
@@ -45,7 +61,7 @@ protected:
 
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
 
-template <typename T, typename S>
+template <typename T, typename S, typename V>
 class GeneralMIPSolver : public GeneralSolver<T, S> {
   static_assert(
       std::is_base_of_v<cda_rail::instances::GeneralProblemInstance, T>,
@@ -58,10 +74,46 @@ protected:
   std::vector<GRBTempConstr> lazy_constraints;
 
   // Gurobi variables
-  std::optional<GRBEnv>                               env;
-  std::optional<GRBModel>                             model;
-  std::unordered_map<std::string, MultiArray<GRBVar>> vars;
-  GRBLinExpr                                          objective_expr;
+  // V is the enum of variable families of the respective solver
+  std::shared_ptr<GRBEnv> env;
+  std::optional<GRBModel> model;
+  VariableRegistry<V>     vars;
+  GRBLinExpr              objective_expr;
+
+  // If false, name() returns empty strings, i.e., Gurobi elements are unnamed
+  bool use_names = true;
+  // If true, the environment is taken from GurobiEnvironmentPool instead of
+  // being started for every solve
+  bool use_shared_environment = false;
+
+  void set_use_names(bool anonymous_model, ExportOption export_option) {
+    use_names = !anonymous_model || exports_lp(export_option);
+  };
+
+  template <typename... Args>
+  [[nodiscard]] std::string name(const Args&... args) const {
+    /**
+     * Concatenates the arguments to the name of a variable or constraint.
+     * Arithmetic arguments are converted using std::to_string. If names are
+     * disabled, nothing is built and an empty string is returned.
+     */
+    std::string ret;
+    if (use_names) {
+      (append_to_name(ret, args), ...);
+    }
+    return ret;
+  };
+
+  template <typename A>
+  static void append_to_name(std::string& name_str, const A& arg) {
+    if constexpr (std::is_same_v<A, char>) {
+      name_str.push_back(arg);
+    } else if constexpr (std::is_arithmetic_v<A>) {
+      name_str += std::to_string(arg);
+    } else {
+      name_str += arg;
+    }
+  };
 
   virtual void cleanup() {
     objective_expr = 0;
@@ -72,23 +124,40 @@ protected:
     env.reset();
   };
 
+  [[nodiscard]] static GRBCallback* message_callback() {
+    static auto callback = MessageCallback();
+    return &callback;
+  };
+
   void solve_init_general_mip(int time_limit, bool debug_input) {
-    static auto message_callback = MessageCallback();
-    this->solve_init_general_mip(time_limit, debug_input, &message_callback);
+    this->solve_init_general_mip(time_limit, debug_input, message_callback());
   };
 
   void solve_init_general_mip(int time_limit, bool debug_input,
-                              GRBCallback* cb) {
+                              GRBCallback* cb, bool reuse_model = false) {
+    /**
+     * Initializes a solve. If reuse_model is true and a model exists from the
+     * previous solve, it is kept and only the callback is replaced.
+     * Otherwise, a new environment and model are created.
+     */
     this->solve_init_general(time_limit, debug_input);
 
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-    PLOGD << "Create Gurobi environment and model";
-    this->env.emplace(true);
-    this->env->start();
-    this->model.emplace(env.value());
+    if (reuse_model && this->model.has_value()) {
+      PLOGD << "Reuse Gurobi model of the previous solve";
+    } else {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      PLOGD << "Create Gurobi environment and model";
+      if (use_shared_environment) {
+        this->env = GurobiEnvironmentPool::get().acquire();
+      } else {
+        this->env = std::make_shared<GRBEnv>(true);
+        this->env->start();
+      }
+      this->model.emplace(*env);
+      this->model->set(GRB_IntParam_LogToConsole, 0);
+    }
 
     this->model->setCallback(cb);
-    this->model->set(GRB_IntParam_LogToConsole, 0);
   };
 
   GeneralMIPSolver() = default;
@@ -99,5 +168,15 @@ protected:
   explicit GeneralMIPSolver(const std::string& path)
       : GeneralSolver<T, S>(path) {};
   explicit GeneralMIPSolver(const char* path) : GeneralSolver<T, S>(path) {};
+
+public:
+  void set_use_shared_environment(bool use_shared_environment_input) {
+    /**
+     * If true, subsequent solves take their Gurobi environment from the
+     * process wide GurobiEnvironmentPool instead of starting a new one. This
+     * saves the startup costs when solving many instances.
+     */
+    use_shared_environment = use_shared_environment_input;
+  };
 };
 } // namespace cda_rail::solver::mip_based
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "gurobi_c++.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cda_rail::solver::mip_based {
+
+struct GurobiEnvironmentSettings {
+  // Number of threads used by Gurobi, 0 lets Gurobi decide
+  int threads = 0;
+  // Further parameters given by name and value, e.g., {"Seed", "42"}
+  std::vector<std::pair<std::string, std::string>> parameters;
+};
+
+class GurobiEnvironmentPool {
+  /**
+   * Process wide pool of started Gurobi environments. Starting an environment
+   * includes the license check and is, hence, a fixed cost of every solve.
+   * Environments are handed out as reference counted pointers and returned to
+   * the pool once the last reference is destroyed, so that the next solver
+   * reuses them. Since Gurobi environments are not thread-safe, an
+   * environment is never handed out twice at the same time.
+   */
+  struct State {
+    std::mutex                           mutex;
+    GurobiEnvironmentSettings            settings;
+    bool                                 settings_fixed   = false;
+    size_t                               num_environments = 0;
+    std::vector<std::unique_ptr<GRBEnv>> idle_environments;
+  };
+  // Shared with the environments handed out, so that they can be returned
+  // even if the pool is destroyed first at the end of the process
+  std::shared_ptr<State> state = std::make_shared<State>();
+
+  GurobiEnvironmentPool() = default;
+
+public:
+  GurobiEnvironmentPool(const GurobiEnvironmentPool&)            = delete;
+  GurobiEnvironmentPool& operator=(const GurobiEnvironmentPool&) = delete;
+  GurobiEnvironmentPool(GurobiEnvironmentPool&&)                 = delete;
+  GurobiEnvironmentPool& operator=(GurobiEnvironmentPool&&)      = delete;
+  ~GurobiEnvironmentPool()                                       = default;
+
+  [[nodiscard]] static GurobiEnvironmentPool& get();
+
+  void configure(const GurobiEnvironmentSettings& settings);
+  [[nodiscard]] std::shared_ptr<GRBEnv> acquire();
+
+  [[nodiscard]] size_t size() const;
+  [[nodiscard]] size_t idle() const;
+  void                 clear();
+};
+
+} // namespace cda_rail::solver::mip_based
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "nlohmann/json.hpp"
+#include "solver/mip-based/LazyCutPool.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cda_rail::solver::mip_based {
+
+enum class LazyCallbackPhase : std::uint8_t {
+  Callback              = 0, // complete handling of a new incumbent
+  SolutionQuery         = 1,
+  Routes                = 2,
+  Velocities            = 3,
+  EdgeOrders            = 4,
+  TtdOrders             = 5,
+  VertexHeadway         = 6,
+  EdgeAndTtdHeadway     = 7,
+  SimplifiedEdgeHeadway = 8,
+  ReverseEdge           = 9,
+  Count                 = 10
+};
+
+class LazyCallbackProfile {
+  /**
+   * Statistics of a lazy callback, i.e., how often and how long every phase
+   * runs and how productive the separation of every type of cuts is.
+   * All functions have to be called from the callback thread.
+   */
+public:
+  static constexpr size_t NUM_PHASES =
+      static_cast<size_t>(LazyCallbackPhase::Count);
+  static constexpr size_t NUM_CUT_TYPES =
+      static_cast<size_t>(LazyCutType::ReverseEdge) + 1;
+
+  struct PhaseStatistics {
+    size_t calls         = 0;
+    double total_seconds = 0;
+    double max_seconds   = 0;
+  };
+
+  struct CutStatistics {
+    size_t checked    = 0; // groups of cuts passed to the solver
+    size_t violated   = 0; // groups violated by the respective incumbent
+    size_t duplicates = 0; // groups that were already known to the cut pool
+    size_t cuts       = 0; // cuts submitted
+  };
+
+private:
+  std::array<PhaseStatistics, NUM_PHASES>     phases    = {};
+  std::array<CutStatistics, NUM_CUT_TYPES>    cut_types = {};
+  std::map<std::pair<size_t, size_t>, size_t> train_pair_violations;
+
+public:
+  LazyCallbackProfile() = default;
+
+  void record_phase(LazyCallbackPhase phase, double seconds);
+  void record_cuts(const LazyCutSignature& signature, bool violated,
+                   bool pooled, size_t num_cuts);
+
+  template <typename F> decltype(auto) measure(LazyCallbackPhase phase, F f) {
+    /**
+     * Calls f and records its wall time for the given phase.
+     *
+     * @return Result of f
+     */
+    const auto start   = std::chrono::steady_clock::now();
+    const auto elapsed = [&start]() {
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                           start)
+          .count();
+    };
+    if constexpr (std::is_void_v<decltype(f())>) {
+      f();
+      record_phase(phase, elapsed());
+    } else {
+      decltype(auto) result = f();
+      record_phase(phase, elapsed());
+      return result;
+    }
+  };
+
+  [[nodiscard]] const PhaseStatistics&
+  get_phase(LazyCallbackPhase phase) const {
+    return phases.at(static_cast<size_t>(phase));
+  };
+  [[nodiscard]] const CutStatistics& get_cut_type(LazyCutType type) const {
+    return cut_types.at(static_cast<size_t>(type));
+  };
+  [[nodiscard]] size_t get_train_pair_violations(size_t tr1, size_t tr2) const;
+
+  [[nodiscard]] nlohmann::json
+       to_json(const std::vector<std::string>& train_names) const;
+  void export_profile(const std::filesystem::path&    p,
+                      const std::vector<std::string>& train_names) const;
+  void log_summary() const;
+
+  void clear();
+};
+
+} // namespace cda_rail::solver::mip_based
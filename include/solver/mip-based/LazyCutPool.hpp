@@ -0,0 +1,98 @@
+#pragma once
+
+#include "gurobi_c++.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace cda_rail::solver::mip_based {
+
+enum class LazyCutType : std::uint8_t {
+  VertexHeadway         = 0,
+  EdgeHeadway           = 1,
+  TtdHeadway            = 2,
+  SimplifiedEdgeHeadway = 3,
+  SimplifiedTtdHeadway  = 4,
+  ReverseEdge           = 5
+};
+
+struct LazyCutSignature {
+  /**
+   * Canonical description of a group of lazy constraints. Two signatures are
+   * equal if and only if the respective constraints are identical, e.g., the
+   * trains, edges, path and velocities that define a headway cut.
+   */
+  LazyCutType         type;
+  std::vector<size_t> indices;
+  std::vector<double> values;
+
+  bool operator==(const LazyCutSignature& other) const {
+    return type == other.type && indices == other.indices &&
+           values == other.values;
+  };
+};
+
+struct LazyCutSignatureHash {
+  size_t operator()(const LazyCutSignature& signature) const noexcept;
+};
+
+struct LazyCut {
+  // expr sense rhs, all constants are moved to the right hand side
+  GRBLinExpr expr;
+  char       sense;
+  double     rhs;
+
+  // Model independent representation, i.e., variables are referenced by their
+  // index in the model. Only filled by LazyCutPool::detach.
+  std::vector<int>    var_indices;
+  std::vector<double> coeffs;
+
+  LazyCut(const GRBLinExpr& lhs, char sense, const GRBLinExpr& rhs);
+
+  [[nodiscard]] GRBTempConstr to_temp_constr() const;
+};
+
+class LazyCutPool {
+  /**
+   * Pool of lazy constraints separated by a callback. Every group of cuts is
+   * identified by its signature, so that duplicates are detected without
+   * rebuilding the respective expressions. Moreover, the pool counts how often
+   * every group was submitted. The pool survives the model it was filled on,
+   * hence, frequently submitted cuts can be added as static constraints when
+   * the same model is solved again.
+   */
+public:
+  struct Entry {
+    std::vector<LazyCut> cuts;
+    size_t               hits      = 0;
+    bool                 submitted = false; // within the current model
+    bool                 promoted  = false; // static within the current model
+  };
+
+private:
+  std::unordered_map<LazyCutSignature, Entry, LazyCutSignatureHash> entries;
+
+  // If the pool has not been detached from the previous model, the cuts
+  // cannot be transferred
+  bool detached = true;
+
+public:
+  LazyCutPool() = default;
+
+  [[nodiscard]] Entry* find(const LazyCutSignature& signature);
+  [[nodiscard]] bool   contains(const LazyCutSignature& signature) const {
+    return entries.find(signature) != entries.end();
+  };
+  Entry& insert(const LazyCutSignature& signature, std::vector<LazyCut> cuts);
+
+  void attach(GRBModel& model, bool same_problem, bool same_model);
+  void detach();
+  [[nodiscard]] std::vector<const LazyCut*> promote(size_t min_hits);
+
+  [[nodiscard]] size_t size() const { return entries.size(); };
+  void                 clear() { entries.clear(); };
+};
+
+} // namespace cda_rail::solver::mip_based
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "gurobi_c++.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cda_rail::solver::mip_based {
+
+class VariableBatch {
+  /**
+   * Collects variables in contiguous buffers and adds them to the model using
+   * a single array-based addVars call. The created variables are written to
+   * the registered targets, which must stay valid until the batch is
+   * submitted, e.g., elements of a MultiArray.
+   */
+  GRBModel*                model;
+  size_t                   flush_size;
+  std::vector<double>      lbs;
+  std::vector<double>      ubs;
+  std::vector<double>      objs;
+  std::vector<char>        types;
+  std::vector<std::string> names;
+  std::vector<GRBVar*>     targets;
+
+public:
+  explicit VariableBatch(GRBModel& model, size_t flush_size = 100000)
+      : model(&model), flush_size(flush_size) {};
+
+  void add(GRBVar& target, double lb, double ub, double obj, char type,
+           std::string name);
+  void submit();
+
+  [[nodiscard]] size_t size() const { return targets.size(); };
+};
+
+class ConstraintBatch {
+  /**
+   * Collects linear constraints as rows of a sparse matrix in compressed row
+   * format and adds them to the model using array-based addConstrs calls.
+   * Every constraint is stored as row sense rhs, where all constants are moved
+   * to the right hand side. Row i consists of the terms in positions
+   * row_begins[i] to row_begins[i+1] - 1 of row_vars and row_coeffs. Hence,
+   * collecting a constraint does not allocate an expression.
+   */
+  GRBModel*                model;
+  size_t                   flush_size;
+  std::vector<size_t>      row_begins = {0};
+  std::vector<GRBVar>      row_vars;
+  std::vector<double>      row_coeffs;
+  std::vector<char>        senses;
+  std::vector<double>      rhss;
+  std::vector<std::string> names;
+
+  // Number of expressions that are materialized at once on submission
+  static constexpr size_t SUBMIT_CHUNK_SIZE = 4096;
+
+  void add_terms(const GRBLinExpr& expr, double sign);
+
+public:
+  explicit ConstraintBatch(GRBModel& model, size_t flush_size = 100000)
+      : model(&model), flush_size(flush_size) {};
+
+  void add(const GRBLinExpr& lhs, char sense, const GRBLinExpr& rhs,
+           std::string name);
+  void submit();
+
+  [[nodiscard]] size_t size() const { return senses.size(); };
+  [[nodiscard]] size_t number_of_terms() const { return row_vars.size(); };
+};
+
+} // namespace cda_rail::solver::mip_based
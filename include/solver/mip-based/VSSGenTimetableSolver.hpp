@@ -7,11 +7,24 @@
 #include "probleminstances/VSSGenerationTimetable.hpp"
 #include "unordered_map"
 
+#include "gtest/gtest_prod.h"
+#include <cstdint>
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 
+// If TEST_FRIENDS has value true, the corresponding test is friended to
+// inspect the model between its construction and optimization, see
+// GenPOMovingBlockMIPSolver.hpp
+#ifndef TEST_FRIENDS
+#define TEST_FRIENDS false
+#endif
+#if TEST_FRIENDS
+class VSSGenMBInfoSolver_WarmStartHints_Test;
+#endif
+
 namespace cda_rail::solver::mip_based {
 
 enum class UpdateStrategy { Fixed = 0, Relative = 1 };
@@ -42,20 +55,143 @@ struct ModelDetailMBInformation {
   bool fix_exact_velocities       = true;
   bool hint_approximate_positions = true;
   bool fix_order_on_edges         = true;
+  // Use the information above only to compute a start solution, the model
+  // solved afterwards is not restricted by it
+  bool use_as_warm_start = false;
+  // Share of the time limit available for computing the start solution, at
+  // most warm_start_max_time seconds are used if there is no time limit
+  double warm_start_time_share = 0.25;
+  int    warm_start_max_time   = 60;
 };
 
 struct ModelSettings {
   vss::Model model_type        = vss::Model();
   bool       use_pwl           = false;
   bool       use_schedule_cuts = true;
+  // Only for free routes, variables of positions a train cannot occupy are
+  // not created
+  bool use_reachability_pruning = true;
+};
+
+// Variable families of VSSGenTimetableSolver
+enum class VSSGenTimetableVariable : std::uint8_t {
+  V,
+  X,
+  XSec,
+  YSecFwd,
+  YSecBwd,
+  Stopped,
+  B,
+  BPos,
+  BFront,
+  BRear,
+  BUsed,
+  BTight,
+  NumVssSegments,
+  TypeNumVssSegments,
+  FracVssSegments,
+  FracType,
+  EdgeType,
+  Lda,
+  Mu,
+  XLda,
+  XMu,
+  Overlap,
+  XV,
+  LenIn,
+  XIn,
+  LenOut,
+  XOut,
+  ELda,
+  EMu,
+  ETight,
+  Brakelen,
+  Count
 };
 
+[[nodiscard]] constexpr std::string_view
+variable_name(VSSGenTimetableVariable family) {
+  switch (family) {
+  case VSSGenTimetableVariable::V:
+    return "v";
+  case VSSGenTimetableVariable::X:
+    return "x";
+  case VSSGenTimetableVariable::XSec:
+    return "x_sec";
+  case VSSGenTimetableVariable::YSecFwd:
+    return "y_sec_fwd";
+  case VSSGenTimetableVariable::YSecBwd:
+    return "y_sec_bwd";
+  case VSSGenTimetableVariable::Stopped:
+    return "stopped";
+  case VSSGenTimetableVariable::B:
+    return "b";
+  case VSSGenTimetableVariable::BPos:
+    return "b_pos";
+  case VSSGenTimetableVariable::BFront:
+    return "b_front";
+  case VSSGenTimetableVariable::BRear:
+    return "b_rear";
+  case VSSGenTimetableVariable::BUsed:
+    return "b_used";
+  case VSSGenTimetableVariable::BTight:
+    return "b_tight";
+  case VSSGenTimetableVariable::NumVssSegments:
+    return "num_vss_segments";
+  case VSSGenTimetableVariable::TypeNumVssSegments:
+    return "type_num_vss_segments";
+  case VSSGenTimetableVariable::FracVssSegments:
+    return "frac_vss_segments";
+  case VSSGenTimetableVariable::FracType:
+    return "frac_type";
+  case VSSGenTimetableVariable::EdgeType:
+    return "edge_type";
+  case VSSGenTimetableVariable::Lda:
+    return "lda";
+  case VSSGenTimetableVariable::Mu:
+    return "mu";
+  case VSSGenTimetableVariable::XLda:
+    return "x_lda";
+  case VSSGenTimetableVariable::XMu:
+    return "x_mu";
+  case VSSGenTimetableVariable::Overlap:
+    return "overlap";
+  case VSSGenTimetableVariable::XV:
+    return "x_v";
+  case VSSGenTimetableVariable::LenIn:
+    return "len_in";
+  case VSSGenTimetableVariable::XIn:
+    return "x_in";
+  case VSSGenTimetableVariable::LenOut:
+    return "len_out";
+  case VSSGenTimetableVariable::XOut:
+    return "x_out";
+  case VSSGenTimetableVariable::ELda:
+    return "e_lda";
+  case VSSGenTimetableVariable::EMu:
+    return "e_mu";
+  case VSSGenTimetableVariable::ETight:
+    return "e_tight";
+  case VSSGenTimetableVariable::Brakelen:
+    return "brakelen";
+  default:
+    return "";
+  }
+}
+
 class VSSGenTimetableSolver
     : public GeneralMIPSolver<instances::VSSGenerationTimetable,
-                              instances::SolVSSGenerationTimetable> {
+                              instances::SolVSSGenerationTimetable,
+                              VSSGenTimetableVariable> {
   friend class VSSGenTimetableSolverWithMovingBlockInformation;
 
 private:
+  using Var = VSSGenTimetableVariable;
+
+#if TEST_FRIENDS
+  FRIEND_TEST(::VSSGenMBInfoSolver, WarmStartHints);
+#endif
+
   // Instance variables
   int                                    dt                     = -1;
   size_t                                 num_t                  = 0;
@@ -77,6 +213,7 @@ private:
   bool                include_braking_curves     = false;
   bool                use_pwl                    = false;
   bool                use_schedule_cuts          = false;
+  bool                use_reachability_pruning   = false;
   bool                iterative_vss              = false;
   OptimalityStrategy  optimality_strategy        = OptimalityStrategy::Optimal;
   UpdateStrategy      iterative_update_strategy  = UpdateStrategy::Fixed;
@@ -90,6 +227,9 @@ private:
   std::unordered_map<size_t, size_t> breakable_edge_indices;
   std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>>
       fwd_bwd_sections;
+  // Indexed by train, time and edge/vertex, empty if every edge is reachable
+  std::vector<std::vector<std::vector<bool>>> reachable_edges;
+  std::vector<std::vector<std::vector<bool>>> reachable_vertices;
 
   // Variable functions
   void create_variables();
@@ -150,8 +290,8 @@ private:
   // Helper functions
   void set_timeout(int time_limit);
   [[nodiscard]] std::optional<instances::SolVSSGenerationTimetable>
-  optimize(const std::optional<instances::VSSGenerationTimetable>& old_instance,
-           int                                                     time_limit);
+  optimize(const CopyOnWrite<instances::VSSGenerationTimetable>& old_instance,
+           int                                                   time_limit);
   void export_lp_if_applicable(const SolutionSettings& solution_settings);
   void export_solution_if_applicable(
       const std::optional<cda_rail::instances::SolVSSGenerationTimetable>&
@@ -163,6 +303,9 @@ private:
   void                 calculate_fwd_bwd_sections_discretized();
   void                 calculate_fwd_bwd_sections_non_discretized();
   [[nodiscard]] double get_max_brakelen(const size_t& tr) const;
+  void                 calculate_reachable_edges();
+  [[nodiscard]] bool   edge_reachable(size_t tr, size_t t, size_t e) const;
+  [[nodiscard]] bool   vertex_reachable(size_t tr, size_t t, size_t v) const;
 
   [[nodiscard]] std::pair<std::vector<std::vector<size_t>>,
                           std::vector<std::vector<size_t>>>
@@ -189,14 +332,14 @@ private:
 
   [[nodiscard]] instances::SolVSSGenerationTimetable
   extract_solution(bool postprocess, bool full_model,
-                   const std::optional<instances::VSSGenerationTimetable>&
+                   const CopyOnWrite<instances::VSSGenerationTimetable>&
                        old_instance) const;
 
   bool update_vss(size_t relevant_edge_index, double obj_ub,
                   GRBLinExpr& cut_expr);
   void update_max_vss_on_edge(size_t relevant_edge_index, size_t new_max_vss,
                               GRBLinExpr& cut_expr);
-  [[nodiscard]] std::optional<instances::VSSGenerationTimetable>
+  [[nodiscard]] CopyOnWrite<instances::VSSGenerationTimetable>
   initialize_variables(const ModelDetail&      model_detail,
                        const ModelSettings&    model_settings,
                        const SolverStrategy&   solver_strategy,
@@ -234,6 +377,10 @@ public:
 class VSSGenTimetableSolverWithMovingBlockInformation
     : public VSSGenTimetableSolver {
 private:
+#if TEST_FRIENDS
+  FRIEND_TEST(::VSSGenMBInfoSolver, WarmStartHints);
+#endif
+
   instances::SolGeneralPerformanceOptimizationInstance<
       instances::GeneralPerformanceOptimizationInstance>
        moving_block_solution;
@@ -242,13 +389,16 @@ private:
   bool fix_exact_positions        = true;
   bool fix_exact_velocities       = true;
   bool hint_approximate_positions = true;
+  bool use_as_warm_start          = false;
 
   // Additional functions
-  void include_additional_information();
-  void fix_oder_on_edges();
-  void fix_stop_positions_constraints();
-  void fix_exact_positions_and_velocities_constraints();
-  void hint_approximate_positions_constraints();
+  void               include_additional_information();
+  void               set_moving_block_start(double time_limit);
+  [[nodiscard]] bool is_feasible_start(const double* values);
+  void               fix_oder_on_edges();
+  void               fix_stop_positions_constraints();
+  void               fix_exact_positions_and_velocities_constraints();
+  void               hint_approximate_positions_constraints();
 
   virtual void cleanup() override;
 
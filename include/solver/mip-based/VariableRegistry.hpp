@@ -0,0 +1,159 @@
+#pragma once
+
+#include "MultiArray.hpp"
+#include "gurobi_c++.h"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace cda_rail::solver::mip_based {
+
+namespace detail {
+template <typename E, typename = void> struct HasFixedRank : std::false_type {};
+template <typename E>
+struct HasFixedRank<E, std::void_t<decltype(fixed_rank(std::declval<E>()))>>
+    : std::true_type {};
+
+template <typename E> constexpr size_t family_rank(E family) {
+  if constexpr (HasFixedRank<E>::value) {
+    return fixed_rank(family);
+  } else {
+    return 0;
+  }
+}
+
+template <typename E, size_t I> struct FamilyArray {
+  static constexpr size_t RANK = family_rank(static_cast<E>(I));
+  using type = std::conditional_t<RANK == 0, MultiArray<GRBVar>,
+                                  FixedRankMultiArray<GRBVar, RANK>>;
+};
+
+template <typename E, typename Indices> struct FamilyTuple;
+template <typename E, size_t... I>
+struct FamilyTuple<E, std::index_sequence<I...>> {
+  using type = std::tuple<typename FamilyArray<E, I>::type...>;
+};
+
+template <typename Families, size_t I>
+MultiArray<GRBVar>* dynamic_family(Families& families) {
+  // Pointer to the family if it is stored as MultiArray, nullptr otherwise
+  if constexpr (std::is_same_v<std::tuple_element_t<I, Families>,
+                               MultiArray<GRBVar>>) {
+    return &std::get<I>(families);
+  } else {
+    return nullptr;
+  }
+}
+
+template <typename Families, size_t... I>
+constexpr std::array<MultiArray<GRBVar>* (*)(Families&), sizeof...(I)>
+dynamic_accessors(std::index_sequence<I...> /*indices*/) {
+  return {&dynamic_family<Families, I>...};
+}
+} // namespace detail
+
+template <typename E> class VariableRegistry {
+  /**
+   * Storage of the Gurobi variable families of a solver. The families are
+   * addressed by an enum whose last enumerator is Count, hence, no string is
+   * hashed.
+   * Families are stored as MultiArray by default. If a constexpr function
+   * fixed_rank(E) is provided next to the enum, families for which it returns
+   * a positive number of dimensions are stored as FixedRankMultiArray of that
+   * rank. These families are accessed using get<family>(), which resolves the
+   * family at compile time. The remaining families can also be accessed by
+   * an enum value known at runtime.
+   * For debugging purposes, families can also be accessed by name. For this,
+   * a function variable_name(E) has to be provided next to the enum.
+   */
+  static_assert(std::is_enum_v<E>, "E must be an enum");
+
+  static constexpr size_t NUM_FAMILIES = static_cast<size_t>(E::Count);
+
+  using Families = typename detail::FamilyTuple<
+      E, std::make_index_sequence<NUM_FAMILIES>>::type;
+  Families families;
+
+  // Accessors of the families by their index, returning nullptr for families
+  // with a fixed rank
+  static constexpr auto DYNAMIC_ACCESSORS =
+      detail::dynamic_accessors<Families>(
+          std::make_index_sequence<NUM_FAMILIES>());
+
+  [[nodiscard]] MultiArray<GRBVar>& dynamic(size_t family) {
+    auto* ret = DYNAMIC_ACCESSORS.at(family)(families);
+    if (ret == nullptr) {
+      throw std::invalid_argument(
+          "Variable family " +
+          std::string(variable_name(static_cast<E>(family))) +
+          " has a fixed rank and is accessed using get");
+    }
+    return *ret;
+  };
+  [[nodiscard]] const MultiArray<GRBVar>& dynamic(size_t family) const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    return const_cast<VariableRegistry*>(this)->dynamic(family);
+  };
+
+  template <typename F, size_t... I>
+  void visit(size_t family, F& f,
+             std::index_sequence<I...> /*indices*/) const {
+    (void)((I == family && (f(std::get<I>(families)), true)) || ...);
+  };
+
+public:
+  template <E family> [[nodiscard]] auto& get() {
+    return std::get<static_cast<size_t>(family)>(families);
+  };
+  template <E family> [[nodiscard]] const auto& get() const {
+    return std::get<static_cast<size_t>(family)>(families);
+  };
+
+  // Families with a fixed rank throw std::invalid_argument
+  [[nodiscard]] MultiArray<GRBVar>& operator[](E family) {
+    return dynamic(static_cast<size_t>(family));
+  };
+  [[nodiscard]] MultiArray<GRBVar>& at(E family) {
+    return dynamic(static_cast<size_t>(family));
+  };
+  [[nodiscard]] const MultiArray<GRBVar>& at(E family) const {
+    return dynamic(static_cast<size_t>(family));
+  };
+
+  template <typename F> void visit(E family, F f) const {
+    /**
+     * Calls f with the array of a family known at runtime, regardless of how
+     * it is stored. Hence, f has to accept every array type, e.g., a generic
+     * lambda.
+     */
+    if (static_cast<size_t>(family) >= NUM_FAMILIES) {
+      throw std::out_of_range("Unknown variable family");
+    }
+    visit(static_cast<size_t>(family), f,
+          std::make_index_sequence<NUM_FAMILIES>());
+  };
+
+  [[nodiscard]] const MultiArray<GRBVar>& at(std::string_view name) const {
+    /**
+     * Name-based lookup of a variable family stored as MultiArray. This does a
+     * linear search and is only meant for debugging, use the enum-based access
+     * otherwise.
+     */
+    for (size_t i = 0; i < NUM_FAMILIES; ++i) {
+      if (variable_name(static_cast<E>(i)) == name) {
+        return dynamic(i);
+      }
+    }
+    throw std::out_of_range("Unknown variable family " + std::string(name));
+  };
+
+  void clear() { families = Families(); };
+};
+
+} // namespace cda_rail::solver::mip_based
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "MultiArray.hpp"
+#include "gurobi_c++.h"
+#include "solver/mip-based/VariableRegistry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cda_rail::solver::mip_based {
+
+template <typename E> class VariableSnapshot {
+  /**
+   * Values of selected variable families in a solution, e.g., the incumbent
+   * within a callback. The families are registered once after the model is
+   * built. Afterwards, the values of all registered variables are extracted
+   * using a single array-based query, so that reading a value is a plain array
+   * access.
+   * Every registered variable has a slot in the snapshot. Slot 0 is reserved
+   * for variables that do not exist and always has value 0, which coincides
+   * with the default element of sparse arrays.
+   */
+  static_assert(std::is_enum_v<E>, "E must be an enum");
+
+  static constexpr size_t NUM_FAMILIES = static_cast<size_t>(E::Count);
+
+  std::array<MultiArray<size_t>, NUM_FAMILIES> slots;
+  std::vector<GRBVar>                          vars;
+  std::vector<double>                          values = {0};
+
+public:
+  void add_family(const VariableRegistry<E>& registry, E family) {
+    const auto slot_of = [this](GRBVar var) {
+      if (var.sameAs(GRBVar())) {
+        return size_t(0);
+      }
+      vars.push_back(var);
+      return vars.size();
+    };
+    auto& family_slots = slots[static_cast<size_t>(family)];
+    registry.visit(family, [&](const auto& array) {
+      // Families of fixed rank are stored as FixedRankMultiArray
+      auto array_slots = array.template transform<size_t>(slot_of);
+      if constexpr (std::is_same_v<decltype(array_slots), MultiArray<size_t>>) {
+        family_slots = std::move(array_slots);
+      } else {
+        family_slots = array_slots.to_multi_array();
+      }
+    });
+    values.resize(vars.size() + 1, 0);
+  };
+
+  template <typename Query> void update(Query query) {
+    /**
+     * Extracts the values of all registered variables.
+     *
+     * @param query Returns the values of an array of variables as an array
+     * allocated with new[], e.g., GRBCallback::getSolution
+     */
+    if (vars.empty()) {
+      return;
+    }
+    const std::unique_ptr<double[]> new_values(
+        query(vars.data(), static_cast<int>(vars.size())));
+    std::copy(new_values.get(), new_values.get() + vars.size(),
+              values.begin() + 1);
+  };
+
+  template <typename... Args>
+  [[nodiscard]] size_t slot(E family, Args... args) const {
+    return slots[static_cast<size_t>(family)].at(args...);
+  };
+  [[nodiscard]] double value(size_t slot) const { return values[slot]; };
+  template <typename... Args>
+  [[nodiscard]] double value(E family, Args... args) const {
+    return values[slot(family, args...)];
+  };
+
+  [[nodiscard]] size_t size() const { return vars.size(); };
+  void                 clear() {
+    slots.fill(MultiArray<size_t>());
+    vars.clear();
+    values = {0};
+  };
+};
+
+} // namespace cda_rail::solver::mip_based
@@ -0,0 +1,158 @@
+#include "BinarySnapshot.hpp"
+
+#include "CustomExceptions.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr char     SNAPSHOT_MAGIC[8] = {'M', 'T', 'C', 'T', 'S', 'N', 'A', 'P'};
+constexpr uint32_t BYTE_ORDER_MARK   = 0x01020304;
+} // namespace
+
+uint64_t cda_rail::snapshot::checksum(gsl::span<const char> data) {
+  /**
+   * 64 bit FNV-1a hash of the given data.
+   */
+
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const auto byte : data) {
+    hash ^= static_cast<uint8_t>(byte);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+void cda_rail::snapshot::BinaryWriter::write_to_file(
+    const std::filesystem::path& p, InstanceType instance_type) const {
+  /**
+   * Writes the header followed by the buffered payload to the given file.
+   *
+   * @param p Path of the snapshot file
+   * @param instance_type Type of the instance stored in the payload
+   */
+
+  Header header{};
+  std::copy(std::begin(SNAPSHOT_MAGIC), std::end(SNAPSHOT_MAGIC),
+            std::begin(header.magic));
+  header.version       = FORMAT_VERSION;
+  header.byte_order    = BYTE_ORDER_MARK;
+  header.instance_type = static_cast<uint32_t>(instance_type);
+  header.payload_size  = buffer.size();
+  header.checksum      = checksum(buffer);
+
+  if (p.has_parent_path() && !std::filesystem::exists(p.parent_path())) {
+    std::error_code error_code;
+    std::filesystem::create_directories(p.parent_path(), error_code);
+    if (error_code) {
+      throw exceptions::ExportException("Could not create directory " +
+                                        p.parent_path().string());
+    }
+  }
+
+  std::ofstream file(p, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!file) {
+    throw exceptions::ExportException("Could not write snapshot " +
+                                      p.string());
+  }
+}
+
+cda_rail::snapshot::MappedFile::MappedFile(const std::filesystem::path& p) {
+  if (!std::filesystem::is_regular_file(p)) {
+    throw exceptions::ImportException(p.string());
+  }
+
+#ifndef _WIN32
+  const int fd = ::open(p.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw exceptions::ImportException(p.string());
+  }
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    throw exceptions::ImportException(p.string());
+  }
+  mapped_size = static_cast<size_t>(file_stat.st_size);
+  if (mapped_size > 0) {
+    void* addr = ::mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      ::close(fd);
+      throw exceptions::ImportException(p.string());
+    }
+    mapped_data = static_cast<const char*>(addr);
+  }
+  // The mapping stays valid after closing the file descriptor
+  ::close(fd);
+#else
+  std::ifstream file(p, std::ios::binary);
+  fallback_buffer.assign(std::istreambuf_iterator<char>(file),
+                         std::istreambuf_iterator<char>());
+  mapped_data = fallback_buffer.data();
+  mapped_size = fallback_buffer.size();
+#endif
+}
+
+cda_rail::snapshot::MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped_data != nullptr) {
+    ::munmap(const_cast<char*>(mapped_data), mapped_size);
+  }
+#endif
+}
+
+cda_rail::snapshot::SnapshotFile::SnapshotFile(const std::filesystem::path& p,
+                                               InstanceType instance_type)
+    : file(p) {
+  /**
+   * Maps the snapshot and checks magic number, format version, byte order,
+   * instance type, payload size and checksum.
+   *
+   * @param p Path of the snapshot file
+   * @param instance_type Expected type of the stored instance
+   */
+
+  const auto data = file.data();
+  if (data.size() < sizeof(Header)) {
+    throw exceptions::ImportException("binary snapshot (file too small)");
+  }
+
+  Header header{};
+  std::memcpy(&header, data.data(), sizeof(Header));
+  if (!std::equal(std::begin(SNAPSHOT_MAGIC), std::end(SNAPSHOT_MAGIC),
+                  std::begin(header.magic))) {
+    throw exceptions::ImportException("binary snapshot (invalid magic number)");
+  }
+  if (header.version != FORMAT_VERSION) {
+    throw exceptions::ImportException(
+        "binary snapshot (unsupported version " +
+        std::to_string(header.version) + ")");
+  }
+  if (header.byte_order != BYTE_ORDER_MARK) {
+    throw exceptions::ImportException("binary snapshot (wrong byte order)");
+  }
+  if (header.instance_type != static_cast<uint32_t>(instance_type)) {
+    throw exceptions::ImportException("binary snapshot (wrong instance type)");
+  }
+  if (header.payload_size != data.size() - sizeof(Header)) {
+    throw exceptions::ImportException("binary snapshot (wrong payload size)");
+  }
+
+  payload = data.subspan(sizeof(Header));
+  if (header.checksum != checksum(payload)) {
+    throw exceptions::ImportException("binary snapshot (checksum mismatch)");
+  }
+}
@@ -9,13 +9,88 @@
 #include <iostream>
 #include <limits>
 
-double cda_rail::min_travel_time_from_start(double v_1, double v_2, double v_m,
+namespace {
+// Kernels of the travel time functions below. They expect inputs that have
+// already been validated using check_consistency_of_eom_input and the
+// respective speed check, so that they can be used in tight loops over
+// batches of inputs.
+
+void check_maximal_speed(double v_1, double v_2, double v_m) {
+  if (v_m <= 0) {
+    throw cda_rail::exceptions::ConsistencyException(
+        "v_m must be greater than 0.");
+  }
+  if (v_1 > v_m || v_2 > v_m) {
+    throw cda_rail::exceptions::ConsistencyException(
+        "v_m must be greater than or equal to v_1 and v_2.");
+  }
+}
+
+void check_minimal_speed(double v_m) {
+  if (v_m < 0) {
+    throw cda_rail::exceptions::ConsistencyException(
+        "v_m must be greater than or equal 0.");
+  }
+}
+
+std::pair<double, double>
+min_travel_time_acceleration_change_points_unchecked(double v_1, double v_2,
+                                                     double v_m, double a,
+                                                     double d, double s) {
+  const double s_1 =
+      (v_m + v_1) * (v_m - v_1) / (2 * a); // Distance to reach maximal speed
+
+  const double s_2 = s - ((v_m + v_2) * (v_m - v_2) / (2 * d));
+
+  // Maximal speed is not reached
+  const double y = (2 * d * s + (v_2 + v_1) * (v_2 - v_1)) / (2 * (a + d));
+
+  return s_2 >= s_1 ? std::pair<double, double>(s_1, s_2)
+                    : std::pair<double, double>(y, y);
+}
+
+std::pair<double, double>
+max_travel_time_acceleration_change_points_unchecked(double v_1, double v_2,
+                                                     double v_m, double a,
+                                                     double d, double s) {
+  // v_m is minimal speed in this case
+
+  const bool v_1_below_minimal_speed = v_1 < v_m;
+  const bool v_2_below_minimal_speed = v_2 < v_m;
+
+  const double s_1 =
+      (v_1 + v_m) * (v_1 - v_m) /
+      (2 *
+       (v_1_below_minimal_speed ? -a : d)); // Distance to reach minimal speed
+
+  const double s_2 = s - ((v_2 + v_m) * (v_2 - v_m) /
+                          (2 * (v_2_below_minimal_speed ? -d : a)));
+
+  if (s_2 >= s_1) {
+    return {s_1, s_2};
+  }
+
+  if (v_1_below_minimal_speed && v_2_below_minimal_speed) {
+    // Very short distance, train cannot reach minimal speed, hence same as
+    // minimal time
+    return min_travel_time_acceleration_change_points_unchecked(v_1, v_2, v_m,
+                                                                a, d, s);
+  }
+
+  assert((!v_1_below_minimal_speed && !v_2_below_minimal_speed));
+
+  const double y = (2 * a * s + (v_1 + v_2) * (v_1 - v_2)) /
+                   (2 * (a + d)); // Distance at which accelerating starts if
+  // minimal speed is not reached
+
+  return {y, y};
+}
+
+double min_travel_time_from_start_unchecked(double v_1, double v_2, double v_m,
                                             double a, double d, double s,
                                             double x) {
-  check_consistency_of_eom_input(v_1, v_2, a, d, s, x);
-
-  const auto s_points =
-      get_min_travel_time_acceleration_change_points(v_1, v_2, v_m, a, d, s);
+  const auto s_points = min_travel_time_acceleration_change_points_unchecked(
+      v_1, v_2, v_m, a, d, s);
   const auto& s_1 = s_points.first;
   const auto& s_2 = s_points.second;
 
@@ -50,30 +125,17 @@ double cda_rail::min_travel_time_from_start(double v_1, double v_2, double v_m,
   return t_1 + t_2 + t_3;
 }
 
-double cda_rail::min_travel_time(double v_1, double v_2, double v_m, double a,
-                                 double d, double s) {
-  return min_travel_time_from_start(v_1, v_2, v_m, a, d, s, s);
-}
-
-bool cda_rail::possible_by_eom(double v_1, double v_2, double a, double d,
-                               double s) {
-  return v_1 <= v_2 ? (v_2 + v_1) * (v_2 - v_1) <= 2 * a * s
-                    : (v_1 + v_2) * (v_1 - v_2) <= 2 * d * s;
-}
-
-double cda_rail::max_travel_time_from_start_no_stopping(double v_1, double v_2,
+double max_travel_time_from_start_no_stopping_unchecked(double v_1, double v_2,
                                                         double v_m, double a,
                                                         double d, double s,
                                                         double x) {
   // v_m is minimal speed in this case
 
-  check_consistency_of_eom_input(v_1, v_2, a, d, s, x);
-
   const bool v_1_below_minimal_speed = v_1 < v_m;
   const bool v_2_below_minimal_speed = v_2 < v_m;
 
-  const auto s_points =
-      get_max_travel_time_acceleration_change_points(v_1, v_2, v_m, a, d, s);
+  const auto s_points = max_travel_time_acceleration_change_points_unchecked(
+      v_1, v_2, v_m, a, d, s);
   const auto& s_1 = s_points.first;
   const auto& s_2 = s_points.second;
 
@@ -113,6 +175,54 @@ double cda_rail::max_travel_time_from_start_no_stopping(double v_1, double v_2,
   return t_1 + t_2 + t_3;
 }
 
+double max_travel_time_from_start_stopping_allowed_unchecked(
+    double v_1, double v_2, double a, double d, double s, double x) {
+  const double s_1 = max_travel_time_acceleration_change_points_unchecked(
+                         v_1, v_2, 0, a, d, s)
+                         .first;
+
+  const double bd = v_1 * v_1 / (2 * d); // Distance to stop
+
+  // Infinite if the train could have stopped, otherwise it cannot stop,
+  // hence same as max_travel_time_from_start_no_stopping
+  return bd <= s_1 && x >= s_1
+             ? std::numeric_limits<double>::infinity()
+             : max_travel_time_from_start_no_stopping_unchecked(v_1, v_2, 0, a,
+                                                                d, s, x);
+}
+} // namespace
+
+double cda_rail::min_travel_time_from_start(double v_1, double v_2, double v_m,
+                                            double a, double d, double s,
+                                            double x) {
+  check_consistency_of_eom_input(v_1, v_2, a, d, s, x);
+  check_maximal_speed(v_1, v_2, v_m);
+  return min_travel_time_from_start_unchecked(v_1, v_2, v_m, a, d, s, x);
+}
+
+double cda_rail::min_travel_time(double v_1, double v_2, double v_m, double a,
+                                 double d, double s) {
+  return min_travel_time_from_start(v_1, v_2, v_m, a, d, s, s);
+}
+
+bool cda_rail::possible_by_eom(double v_1, double v_2, double a, double d,
+                               double s) {
+  return v_1 <= v_2 ? (v_2 + v_1) * (v_2 - v_1) <= 2 * a * s
+                    : (v_1 + v_2) * (v_1 - v_2) <= 2 * d * s;
+}
+
+double cda_rail::max_travel_time_from_start_no_stopping(double v_1, double v_2,
+                                                        double v_m, double a,
+                                                        double d, double s,
+                                                        double x) {
+  // v_m is minimal speed in this case
+
+  check_consistency_of_eom_input(v_1, v_2, a, d, s, x);
+  check_minimal_speed(v_m);
+  return max_travel_time_from_start_no_stopping_unchecked(v_1, v_2, v_m, a, d,
+                                                          s, x);
+}
+
 double cda_rail::max_travel_time_no_stopping(double v_1, double v_2, double v_m,
                                              double a, double d, double s) {
   return max_travel_time_from_start_no_stopping(v_1, v_2, v_m, a, d, s, s);
@@ -121,22 +231,8 @@ double cda_rail::max_travel_time_no_stopping(double v_1, double v_2, double v_m,
 double cda_rail::max_travel_time_from_start_stopping_allowed(
     double v_1, double v_2, double a, double d, double s, double x) {
   check_consistency_of_eom_input(v_1, v_2, a, d, s, x);
-
-  const auto s_points =
-      get_max_travel_time_acceleration_change_points(v_1, v_2, 0, a, d, s);
-  const auto& s_1 = s_points.first;
-
-  const double bd = v_1 * v_1 / (2 * d); // Distance to stop
-
-  if (bd <= s_1) {
-    if (x >= s_1) {
-      // Infinite, because train could have stopped
-      return std::numeric_limits<double>::infinity();
-    }
-  }
-
-  // Train cannot stop, hence same as max_travel_time_from_start_no_stopping
-  return max_travel_time_from_start_no_stopping(v_1, v_2, 0, a, d, s, x);
+  return max_travel_time_from_start_stopping_allowed_unchecked(v_1, v_2, a, d,
+                                                               s, x);
 }
 
 double cda_rail::max_travel_time_stopping_allowed(double v_1, double v_2,
@@ -333,25 +429,9 @@ cda_rail::get_min_travel_time_acceleration_change_points(double v_1, double v_2,
                                                          double v_m, double a,
                                                          double d, double s) {
   check_consistency_of_eom_input(v_1, v_2, a, d, s, s);
-  if (v_m <= 0) {
-    throw exceptions::ConsistencyException("v_m must be greater than 0.");
-  }
-  if (v_1 > v_m || v_2 > v_m) {
-    throw exceptions::ConsistencyException(
-        "v_m must be greater than or equal to v_1 and v_2.");
-  }
-
-  const double s_1 =
-      (v_m + v_1) * (v_m - v_1) / (2 * a); // Distance to reach maximal speed
-
-  const double s_2 = s - ((v_m + v_2) * (v_m - v_2) / (2 * d));
-
-  if (s_2 >= s_1) {
-    return {s_1, s_2};
-  }
-
-  const double y = (2 * d * s + (v_2 + v_1) * (v_2 - v_1)) / (2 * (a + d));
-  return {y, y};
+  check_maximal_speed(v_1, v_2, v_m);
+  return min_travel_time_acceleration_change_points_unchecked(v_1, v_2, v_m, a,
+                                                              d, s);
 }
 
 std::pair<double, double>
@@ -361,40 +441,9 @@ cda_rail::get_max_travel_time_acceleration_change_points(double v_1, double v_2,
   // v_m is minimal speed in this case
 
   check_consistency_of_eom_input(v_1, v_2, a, d, s, s);
-  if (v_m < 0) {
-    throw exceptions::ConsistencyException(
-        "v_m must be greater than or equal 0.");
-  }
-
-  const bool v_1_below_minimal_speed = v_1 < v_m;
-  const bool v_2_below_minimal_speed = v_2 < v_m;
-
-  const double s_1 =
-      (v_1 + v_m) * (v_1 - v_m) /
-      (2 *
-       (v_1_below_minimal_speed ? -a : d)); // Distance to reach minimal speed
-
-  const double s_2 = s - ((v_2 + v_m) * (v_2 - v_m) /
-                          (2 * (v_2_below_minimal_speed ? -d : a)));
-
-  if (s_2 >= s_1) {
-    return {s_1, s_2};
-  }
-
-  if (v_1_below_minimal_speed && v_2_below_minimal_speed) {
-    // Very short distance, train cannot reach minimal speed, hence same as
-    // minimal time
-    return get_min_travel_time_acceleration_change_points(v_1, v_2, v_m, a, d,
-                                                          s);
-  }
-
-  assert((!v_1_below_minimal_speed && !v_2_below_minimal_speed));
-
-  const double y = (2 * a * s + (v_1 + v_2) * (v_1 - v_2)) /
-                   (2 * (a + d)); // Distance at which accelerating starts if
-  // minimal speed is not reached
-
-  return {y, y};
+  check_minimal_speed(v_m);
+  return max_travel_time_acceleration_change_points_unchecked(v_1, v_2, v_m, a,
+                                                              d, s);
 }
 
 double cda_rail::min_time_from_front_to_ma_point(double v_1, double v_2,
@@ -748,3 +797,120 @@ double cda_rail::vel_on_edge_at_time(double v_1, double v_2, double v_line,
   }
   return v_2 - a2 * (total_time - t);
 }
+
+void cda_rail::EOMBatch::add(double v_1_input, double v_2_input,
+                             double v_m_input, double a_input, double d_input,
+                             double s_input, double x_input) {
+  /**
+   * Adds the input of a single evaluation after validating it, see
+   * check_consistency_of_eom_input. Small values are rounded to 0.
+   */
+
+  check_consistency_of_eom_input(v_1_input, v_2_input, a_input, d_input,
+                                 s_input, x_input);
+  v_1.push_back(v_1_input);
+  v_2.push_back(v_2_input);
+  v_m.push_back(v_m_input);
+  a.push_back(a_input);
+  d.push_back(d_input);
+  s.push_back(s_input);
+  x.push_back(x_input);
+}
+
+void cda_rail::EOMBatch::reserve(size_t n) {
+  for (auto* values : {&v_1, &v_2, &v_m, &a, &d, &s, &x}) {
+    values->reserve(n);
+  }
+}
+
+void cda_rail::EOMBatch::clear() {
+  for (auto* values : {&v_1, &v_2, &v_m, &a, &d, &s, &x}) {
+    values->clear();
+  }
+}
+
+void cda_rail::EOMBatch::check_maximal_speeds() const {
+  for (size_t i = 0; i < size(); i++) {
+    check_maximal_speed(v_1[i], v_2[i], v_m[i]);
+  }
+}
+
+void cda_rail::EOMBatch::check_minimal_speeds() const {
+  for (size_t i = 0; i < size(); i++) {
+    check_minimal_speed(v_m[i]);
+  }
+}
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+// Indices are bounded by the loops, which are kept free of checks so that
+// they can be vectorized
+
+std::vector<double> cda_rail::EOMBatch::min_travel_time_from_start() const {
+  check_maximal_speeds();
+  std::vector<double> ret_val(size());
+  for (size_t i = 0; i < ret_val.size(); i++) {
+    ret_val[i] = min_travel_time_from_start_unchecked(v_1[i], v_2[i], v_m[i],
+                                                      a[i], d[i], s[i], x[i]);
+  }
+  return ret_val;
+}
+
+std::vector<double> cda_rail::EOMBatch::min_travel_time_to_end() const {
+  // Reverse direction with acceleration and deceleration swapped, see the
+  // scalar version
+  check_maximal_speeds();
+  std::vector<double> ret_val(size());
+  for (size_t i = 0; i < ret_val.size(); i++) {
+    const double x_rev = s[i] - x[i] < GRB_EPS ? 0 : s[i] - x[i];
+    // NOLINTNEXTLINE(readability-suspicious-call-argument)
+    ret_val[i] = min_travel_time_from_start_unchecked(v_2[i], v_1[i], v_m[i],
+                                                      d[i], a[i], s[i], x_rev);
+  }
+  return ret_val;
+}
+
+std::vector<double>
+cda_rail::EOMBatch::max_travel_time_from_start(bool stopping_allowed) const {
+  std::vector<double> ret_val(size());
+  if (stopping_allowed) {
+    for (size_t i = 0; i < ret_val.size(); i++) {
+      ret_val[i] = max_travel_time_from_start_stopping_allowed_unchecked(
+          v_1[i], v_2[i], a[i], d[i], s[i], x[i]);
+    }
+    return ret_val;
+  }
+
+  check_minimal_speeds();
+  for (size_t i = 0; i < ret_val.size(); i++) {
+    ret_val[i] = max_travel_time_from_start_no_stopping_unchecked(
+        v_1[i], v_2[i], v_m[i], a[i], d[i], s[i], x[i]);
+  }
+  return ret_val;
+}
+
+std::vector<double>
+cda_rail::EOMBatch::max_travel_time_to_end(bool stopping_allowed) const {
+  // Reverse direction with acceleration and deceleration swapped, see the
+  // scalar version
+  std::vector<double> ret_val(size());
+  if (stopping_allowed) {
+    for (size_t i = 0; i < ret_val.size(); i++) {
+      const double x_rev = s[i] - x[i] < GRB_EPS ? 0 : s[i] - x[i];
+      // NOLINTNEXTLINE(readability-suspicious-call-argument)
+      ret_val[i] = max_travel_time_from_start_stopping_allowed_unchecked(
+          v_2[i], v_1[i], d[i], a[i], s[i], x_rev);
+    }
+    return ret_val;
+  }
+
+  check_minimal_speeds();
+  for (size_t i = 0; i < ret_val.size(); i++) {
+    const double x_rev = s[i] - x[i] < GRB_EPS ? 0 : s[i] - x[i];
+    // NOLINTNEXTLINE(readability-suspicious-call-argument)
+    ret_val[i] = max_travel_time_from_start_no_stopping_unchecked(
+        v_2[i], v_1[i], v_m[i], d[i], a[i], s[i], x_rev);
+  }
+  return ret_val;
+}
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
@@ -0,0 +1,211 @@
+#include "SolverTelemetry.hpp"
+
+#include "CustomExceptions.hpp"
+#include "Definitions.hpp"
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+// windows.h has to be included first
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <sys/resource.h>
+#else
+#include <unistd.h>
+#endif
+
+using json = nlohmann::json;
+
+double cda_rail::process_cpu_seconds() {
+  /**
+   * CPU time used by all threads of the current process so far.
+   */
+
+#if defined(_WIN32)
+  FILETIME creation_time;
+  FILETIME exit_time;
+  FILETIME kernel_time;
+  FILETIME user_time;
+  if (GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time,
+                      &kernel_time, &user_time) == 0) {
+    return 0;
+  }
+  const auto to_seconds = [](const FILETIME& file_time) {
+    // FILETIME counts intervals of 100 nanoseconds
+    return static_cast<double>(
+               (static_cast<uint64_t>(file_time.dwHighDateTime) << 32) |
+               file_time.dwLowDateTime) *
+           1e-7;
+  };
+  return to_seconds(kernel_time) + to_seconds(user_time);
+#else
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+}
+
+int64_t cda_rail::process_rss_bytes() {
+  /**
+   * Resident set size of the current process in bytes, 0 if it cannot be
+   * determined.
+   */
+
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ==
+      0) {
+    return 0;
+  }
+  return static_cast<int64_t>(counters.WorkingSetSize);
+#elif defined(__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t      count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info),
+                &count) != KERN_SUCCESS) {
+    return 0;
+  }
+  return static_cast<int64_t>(info.resident_size);
+#else
+  std::ifstream statm("/proc/self/statm");
+  int64_t       total_pages    = 0;
+  int64_t       resident_pages = 0;
+  if (!(statm >> total_pages >> resident_pages)) {
+    return 0;
+  }
+  return resident_pages * static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+int64_t cda_rail::process_peak_rss_bytes() {
+  /**
+   * Largest resident set size of the current process so far in bytes, 0 if it
+   * cannot be determined. The value never decreases during the lifetime of
+   * the process.
+   */
+
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ==
+      0) {
+    return 0;
+  }
+  return static_cast<int64_t>(counters.PeakWorkingSetSize);
+#elif defined(__APPLE__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  // Reported in bytes on macOS
+  return static_cast<int64_t>(usage.ru_maxrss);
+#else
+  // The line VmHWM of /proc/self/status is reported in kilobytes
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return std::stoll(line.substr(6)) * 1024;
+    }
+  }
+  return 0;
+#endif
+}
+
+void cda_rail::SolverTelemetry::record(const std::string& name,
+                                       double             wall_seconds,
+                                       double             cpu_seconds,
+                                       int64_t            rss_delta_bytes) {
+  /**
+   * Records the resources used by a phase. If the phase has been recorded
+   * before, the values are added.
+   *
+   * @param name Name of the phase
+   * @param wall_seconds Wall time in seconds
+   * @param cpu_seconds CPU time of the process in seconds
+   * @param rss_delta_bytes Change of the resident set size in bytes
+   */
+
+  auto it = std::find_if(phases.begin(), phases.end(),
+                         [&name](const Phase& phase) {
+                           return phase.name == name;
+                         });
+  if (it == phases.end()) {
+    phases.push_back({name});
+    it = phases.end() - 1;
+  }
+  it->calls++;
+  it->wall_seconds += wall_seconds;
+  it->cpu_seconds += cpu_seconds;
+  it->rss_delta_bytes += rss_delta_bytes;
+}
+
+bool cda_rail::SolverTelemetry::has_phase(const std::string& name) const {
+  return std::any_of(phases.begin(), phases.end(), [&name](const Phase& phase) {
+    return phase.name == name;
+  });
+}
+
+const cda_rail::SolverTelemetry::Phase&
+cda_rail::SolverTelemetry::get_phase(const std::string& name) const {
+  const auto it = std::find_if(phases.begin(), phases.end(),
+                               [&name](const Phase& phase) {
+                                 return phase.name == name;
+                               });
+  if (it == phases.end()) {
+    throw exceptions::InvalidInputException("Phase " + name +
+                                            " has not been recorded");
+  }
+  return *it;
+}
+
+double cda_rail::SolverTelemetry::total_wall_seconds() const {
+  double total = 0;
+  for (const auto& phase : phases) {
+    total += phase.wall_seconds;
+  }
+  return total;
+}
+
+json cda_rail::SolverTelemetry::to_json() const {
+  /**
+   * Returns the phases as json array in the order they were first recorded.
+   */
+
+  json j = json::array();
+  for (const auto& phase : phases) {
+    j.push_back({{"name", phase.name},
+                 {"calls", phase.calls},
+                 {"wall_seconds", phase.wall_seconds},
+                 {"cpu_seconds", phase.cpu_seconds},
+                 {"rss_delta_bytes", phase.rss_delta_bytes}});
+  }
+  return j;
+}
+
+void cda_rail::SolverTelemetry::export_telemetry(
+    const std::filesystem::path& p) const {
+  /**
+   * Exports the phases to p / telemetry.json
+   *
+   * @param p Folder the telemetry is written to, created if necessary
+   */
+
+  if (!is_directory_and_create(p)) {
+    throw exceptions::ExportException("Could not create directory " +
+                                      p.string());
+  }
+
+  std::ofstream file(p / "telemetry.json");
+  file << to_json() << std::endl;
+  file.close();
+}
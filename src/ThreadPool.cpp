@@ -0,0 +1,151 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+cda_rail::ThreadPool::ThreadPool(size_t num_threads) {
+  /**
+   * Starts the workers of the pool.
+   *
+   * @param num_threads Number of threads including the calling thread. If 0,
+   * the number of hardware threads is used.
+   */
+
+  if (num_threads == 0) {
+    num_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+  threads.reserve(num_threads - 1);
+  for (size_t worker = 1; worker < num_threads; ++worker) {
+    threads.emplace_back([this, worker]() { work(worker); });
+  }
+}
+
+cda_rail::ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+  }
+  loop_started.notify_all();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+void cda_rail::ThreadPool::parallel_for(size_t n, const ParallelLoopBody& f) {
+  /**
+   * Calls f(i, worker) for every i in [0, n) and returns once all calls are
+   * done. Must not be called concurrently or from within a loop body.
+   *
+   * @param n Number of indices
+   * @param f Loop body, called with the index and the id of the worker
+   */
+
+  if (n == 0) {
+    return;
+  }
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    body           = &f;
+    loop_size      = n;
+    active_threads = threads.size();
+    error          = nullptr;
+    next_index     = 0;
+    ++loop_count;
+  }
+  if (!threads.empty()) {
+    loop_started.notify_all();
+  }
+
+  run_loop(0);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  loop_finished.wait(lock, [this]() { return active_threads == 0; });
+  body = nullptr;
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void cda_rail::ThreadPool::run_loop(size_t worker) {
+  /**
+   * Processes indices of the current loop until all have been distributed.
+   */
+
+  for (size_t i = next_index++; i < loop_size; i = next_index++) {
+    try {
+      (*body)(i, worker);
+    } catch (...) {
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (!error || i < error_index) {
+        error       = std::current_exception();
+        error_index = i;
+      }
+    }
+  }
+}
+
+void cda_rail::ThreadPool::work(size_t worker) {
+  /**
+   * Main function of every worker thread, takes part in every loop until the
+   * pool is destroyed.
+   */
+
+  size_t loops_done = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      loop_started.wait(lock, [this, loops_done]() {
+        return stopped || loop_count != loops_done;
+      });
+      if (stopped) {
+        return;
+      }
+      loops_done = loop_count;
+    }
+    run_loop(worker);
+    {
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (--active_threads == 0) {
+        loop_finished.notify_one();
+      }
+    }
+  }
+}
+
+size_t cda_rail::resolve_num_threads(size_t num_threads, size_t n) {
+  /**
+   * Number of threads to use for a loop over n indices.
+   *
+   * @param num_threads Requested number of threads, 0 for the number of
+   * hardware threads
+   * @param n Number of indices, at most n threads are used
+   *
+   * @return Number of threads, at least 1
+   */
+
+  if (num_threads == 0) {
+    num_threads = std::thread::hardware_concurrency();
+  }
+  return std::max<size_t>(std::min(num_threads, n), 1);
+}
+
+void cda_rail::parallel_for(size_t n, size_t num_threads,
+                            const ParallelLoopBody& f) {
+  /**
+   * Calls f(i, worker) for every i in [0, n) using a temporary pool of
+   * threads. Loops that are executed frequently should use a ThreadPool that
+   * is kept alive instead.
+   *
+   * @param n Number of indices
+   * @param num_threads Number of threads, 0 for the number of hardware threads
+   * @param f Loop body, called with the index and the id of the worker, which
+   * is smaller than resolve_num_threads(num_threads, n)
+   */
+
+  ThreadPool pool(resolve_num_threads(num_threads, n));
+  pool.parallel_for(n, f);
+}
@@ -0,0 +1,420 @@
+#include "datastructure/GraphMLReader.hpp"
+
+#include "CustomExceptions.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+using Attributes = std::vector<std::pair<std::string_view, std::string>>;
+
+bool is_space(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+std::string_view local_name(std::string_view name) {
+  // Strip namespace prefixes, e.g., "graphml:node" -> "node"
+  const auto colon = name.find(':');
+  return colon == std::string_view::npos ? name : name.substr(colon + 1);
+}
+
+void append_utf8(std::string& out, unsigned long code_point) {
+  if (code_point < 0x80) {
+    out.push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    out.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+
+void append_decoded(std::string& out, std::string_view text) {
+  /**
+   * Appends text to out replacing the predefined XML entities and character
+   * references. Unknown entities are kept as they are.
+   */
+
+  size_t pos = 0;
+  while (pos < text.size()) {
+    const auto amp = text.find('&', pos);
+    out.append(text.substr(pos, amp - pos));
+    if (amp == std::string_view::npos) {
+      return;
+    }
+    const auto semicolon = text.find(';', amp);
+    if (semicolon == std::string_view::npos) {
+      out.append(text.substr(amp));
+      return;
+    }
+    const auto entity = text.substr(amp + 1, semicolon - amp - 1);
+    if (entity == "lt") {
+      out.push_back('<');
+    } else if (entity == "gt") {
+      out.push_back('>');
+    } else if (entity == "amp") {
+      out.push_back('&');
+    } else if (entity == "quot") {
+      out.push_back('"');
+    } else if (entity == "apos") {
+      out.push_back('\'');
+    } else if (entity.size() > 1 && entity[0] == '#') {
+      const bool hex  = entity[1] == 'x' || entity[1] == 'X';
+      const auto code = std::string(entity.substr(hex ? 2 : 1));
+      try {
+        append_utf8(out, std::stoul(code, nullptr, hex ? 16 : 10));
+      } catch (const std::exception&) {
+        throw cda_rail::exceptions::ImportException("graphml");
+      }
+    } else {
+      out.append(text.substr(amp, semicolon - amp + 1));
+    }
+    pos = semicolon + 1;
+  }
+}
+
+std::string trimmed(const std::string& s) {
+  const auto first = std::find_if_not(s.begin(), s.end(), is_space);
+  const auto last  = std::find_if_not(s.rbegin(), s.rend(), is_space).base();
+  return first < last ? std::string(first, last) : std::string();
+}
+
+const std::string* find_attribute(const Attributes& attributes,
+                                  std::string_view  name) {
+  for (const auto& [attribute_name, value] : attributes) {
+    if (attribute_name == name) {
+      return &value;
+    }
+  }
+  return nullptr;
+}
+
+std::string optional_attribute(const Attributes& attributes,
+                               std::string_view  name) {
+  const auto* value = find_attribute(attributes, name);
+  return value == nullptr ? std::string() : *value;
+}
+
+const std::string& required_attribute(const Attributes& attributes,
+                                      std::string_view  name) {
+  const auto* value = find_attribute(attributes, name);
+  if (value == nullptr) {
+    throw cda_rail::exceptions::ImportException("graphml");
+  }
+  return *value;
+}
+
+class Scanner {
+  /**
+   * Cursor over the mapped file content.
+   */
+  const char* cur;
+  const char* end;
+
+public:
+  Scanner(const char* begin, const char* end) : cur(begin), end(end) {};
+
+  [[nodiscard]] bool at_end() const { return cur >= end; };
+  [[nodiscard]] bool starts_with(std::string_view prefix) const {
+    return static_cast<size_t>(end - cur) >= prefix.size() &&
+           std::memcmp(cur, prefix.data(), prefix.size()) == 0;
+  };
+
+  std::string_view character_data() {
+    // Returns everything up to (excluding) the next '<' or the end of the
+    // file and moves behind the '<'
+    const auto* pos = static_cast<const char*>(
+        std::memchr(cur, '<', static_cast<size_t>(end - cur)));
+    if (pos == nullptr) {
+      pos = end;
+    }
+    const std::string_view ret(cur, static_cast<size_t>(pos - cur));
+    cur = pos == end ? end : pos + 1;
+    return ret;
+  };
+  std::string_view until(char c) {
+    // Returns everything up to (excluding) c and moves behind c
+    const auto* pos = static_cast<const char*>(
+        std::memchr(cur, c, static_cast<size_t>(end - cur)));
+    if (pos == nullptr) {
+      throw cda_rail::exceptions::ImportException("graphml");
+    }
+    const std::string_view ret(cur, static_cast<size_t>(pos - cur));
+    cur = pos + 1;
+    return ret;
+  };
+  std::string_view until(std::string_view delimiter) {
+    const std::string_view rest(cur, static_cast<size_t>(end - cur));
+    const auto             pos = rest.find(delimiter);
+    if (pos == std::string_view::npos) {
+      throw cda_rail::exceptions::ImportException("graphml");
+    }
+    cur += pos + delimiter.size();
+    return rest.substr(0, pos);
+  };
+
+  void skip(size_t n) { cur += n; };
+  void skip_space() {
+    while (cur < end && is_space(*cur)) {
+      ++cur;
+    }
+  };
+  [[nodiscard]] char peek() const {
+    if (cur >= end) {
+      throw cda_rail::exceptions::ImportException("graphml");
+    }
+    return *cur;
+  };
+
+  std::string_view name() {
+    const auto* begin = cur;
+    while (cur < end && !is_space(*cur) && *cur != '/' && *cur != '>' &&
+           *cur != '=') {
+      ++cur;
+    }
+    if (cur == begin) {
+      throw cda_rail::exceptions::ImportException("graphml");
+    }
+    return {begin, static_cast<size_t>(cur - begin)};
+  };
+
+  bool start_tag(Attributes& attributes) {
+    /**
+     * Parses the attributes of a start tag, the cursor has to be behind the
+     * element name. Returns true if the element is self-closing.
+     */
+    attributes.clear();
+    while (true) {
+      skip_space();
+      const char c = peek();
+      if (c == '>') {
+        skip(1);
+        return false;
+      }
+      if (c == '/') {
+        skip(1);
+        if (peek() != '>') {
+          throw cda_rail::exceptions::ImportException("graphml");
+        }
+        skip(1);
+        return true;
+      }
+      const auto attribute_name = name();
+      skip_space();
+      if (peek() != '=') {
+        throw cda_rail::exceptions::ImportException("graphml");
+      }
+      skip(1);
+      skip_space();
+      const char quote = peek();
+      if (quote != '"' && quote != '\'') {
+        throw cda_rail::exceptions::ImportException("graphml");
+      }
+      skip(1);
+      std::string value;
+      append_decoded(value, until(quote));
+      attributes.emplace_back(attribute_name, std::move(value));
+    }
+  };
+};
+} // namespace
+
+cda_rail::GraphMLReader::ElementCounts
+cda_rail::GraphMLReader::count_elements() const {
+  /**
+   * Counts the start tags <node ...> and <edge ...> in a single scan of the
+   * file. Commented out elements are counted as well, hence, the results are
+   * upper bounds.
+   */
+
+  const auto             data = file.data();
+  const std::string_view content(data.data(), data.size());
+  const auto             is_tag = [&content](size_t pos, std::string_view tag) {
+    const auto name_end = pos + 1 + tag.size();
+    return content.compare(pos + 1, tag.size(), tag) == 0 &&
+           name_end < content.size() &&
+           (is_space(content[name_end]) || content[name_end] == '>' ||
+            content[name_end] == '/');
+  };
+
+  ElementCounts counts;
+  size_t        pos = content.find('<');
+  while (pos != std::string_view::npos) {
+    if (is_tag(pos, "node")) {
+      ++counts.nodes;
+    } else if (is_tag(pos, "edge")) {
+      ++counts.edges;
+    }
+    pos = content.find('<', pos + 1);
+  }
+  return counts;
+}
+
+bool cda_rail::GraphMLReader::parse(const KeyHandler&     on_key,
+                                    const ElementHandler& on_node,
+                                    const ElementHandler& on_edge) const {
+  /**
+   * Scans the file once and calls the handlers for every key, node and edge.
+   * Data entries of nodes and edges are collected and passed to the handler
+   * once the element is closed. The element passed to the handlers is reused,
+   * i.e., it is only valid during the call.
+   * The elements are read as by the DOM-based import: keys are children of
+   * the graphml root, nodes and edges are children of its first graph and
+   * their data entries are their children. The value of a data entry is its
+   * first text, i.e., the text (or CDATA section) before any child node.
+   * Malformed XML throws an ImportException.
+   *
+   * @param on_key Handler called for every key element
+   * @param on_node Handler called for every node element
+   * @param on_edge Handler called for every edge element
+   *
+   * @return false if the file contains a document type declaration, which is
+   * not supported. In this case, the handlers might have been called for some
+   * elements already.
+   */
+
+  enum class Context { None, Node, Edge };
+
+  const auto data = file.data();
+  Scanner    scanner(data.data(), data.data() + data.size());
+
+  // Names of the currently open elements, they point into the mapped file
+  std::vector<std::string_view> open_elements;
+  bool                          graph_found = false;
+  bool                          graph_open  = false;
+
+  Attributes  attributes;
+  Element     element;
+  Context     context       = Context::None;
+  bool        in_data       = false;
+  bool        text_complete = false;
+  std::string data_key;
+  std::string text;
+
+  const auto in_data_element = [&]() {
+    // Whether the data element currently read is the innermost open one
+    return in_data && open_elements.size() == 4;
+  };
+  const auto end_text = [&]() {
+    // Any child node of the data element ends its first text
+    if (in_data_element()) {
+      text_complete = true;
+    }
+  };
+
+  while (!scanner.at_end()) {
+    const auto character_data = scanner.character_data();
+    if (in_data_element() && !text_complete) {
+      append_decoded(text, character_data);
+    }
+    if (scanner.at_end()) {
+      break;
+    }
+
+    if (scanner.starts_with("!--")) {
+      scanner.until("-->");
+      end_text();
+    } else if (scanner.starts_with("![CDATA[")) {
+      scanner.skip(8);
+      const auto cdata = scanner.until("]]>");
+      if (in_data_element() && !text_complete && trimmed(text).empty()) {
+        text = cdata;
+      }
+      end_text();
+    } else if (scanner.starts_with("?")) {
+      scanner.until("?>");
+      end_text();
+    } else if (scanner.starts_with("!")) {
+      // Document type declarations may define entities and default values
+      return false;
+    } else if (scanner.starts_with("/")) {
+      scanner.skip(1);
+      const auto tag = scanner.name();
+      scanner.skip_space();
+      if (open_elements.empty() || open_elements.back() != tag ||
+          scanner.peek() != '>') {
+        throw exceptions::ImportException("graphml");
+      }
+      scanner.skip(1);
+      open_elements.pop_back();
+
+      if (in_data && open_elements.size() == 3) {
+        element.data.emplace_back(data_key, trimmed(text));
+        in_data = false;
+      } else if (context != Context::None && open_elements.size() == 2) {
+        (context == Context::Node ? on_node : on_edge)(element);
+        context = Context::None;
+      } else if (graph_open && open_elements.size() == 1) {
+        graph_open = false;
+      }
+    } else {
+      end_text();
+      const auto full_tag     = scanner.name();
+      const auto tag          = local_name(full_tag);
+      const bool self_closing = scanner.start_tag(attributes);
+      const auto depth        = open_elements.size();
+
+      if (depth == 0 && tag != "graphml") {
+        throw exceptions::ImportException("graphml");
+      }
+      if (depth == 1 && tag == "key") {
+        on_key({required_attribute(attributes, "id"),
+                optional_attribute(attributes, "for"),
+                optional_attribute(attributes, "attr.name")});
+      } else if (depth == 1 && tag == "graph" && !graph_found) {
+        const auto* edgedefault = find_attribute(attributes, "edgedefault");
+        if (edgedefault == nullptr || *edgedefault != "directed") {
+          throw exceptions::InvalidInputException("Graph is not directed");
+        }
+        graph_found = true;
+        graph_open  = !self_closing;
+      } else if (depth == 2 && graph_open && (tag == "node" || tag == "edge")) {
+        context = tag == "node" ? Context::Node : Context::Edge;
+        element.data.clear();
+        if (context == Context::Node) {
+          element.id = required_attribute(attributes, "id");
+          element.source.clear();
+          element.target.clear();
+        } else {
+          element.id     = optional_attribute(attributes, "id");
+          element.source = required_attribute(attributes, "source");
+          element.target = required_attribute(attributes, "target");
+        }
+        if (self_closing) {
+          (context == Context::Node ? on_node : on_edge)(element);
+          context = Context::None;
+        }
+      } else if (depth == 3 && context != Context::None && tag == "data") {
+        data_key = required_attribute(attributes, "key");
+        text.clear();
+        text_complete = false;
+        if (self_closing) {
+          element.data.emplace_back(data_key, std::string());
+        } else {
+          in_data = true;
+        }
+      }
+
+      if (!self_closing) {
+        open_elements.push_back(full_tag);
+      }
+    }
+  }
+
+  if (!open_elements.empty() || !graph_found) {
+    throw exceptions::ImportException("graphml");
+  }
+  return true;
+}
@@ -1,15 +1,21 @@
 #include "datastructure/RailwayNetwork.hpp"
 
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "MultiArray.hpp"
+#include "ThreadPool.hpp"
+#include "datastructure/GraphMLReader.hpp"
 #include "nlohmann/json.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <queue>
 #include <stack>
@@ -20,6 +26,18 @@
 
 using json = nlohmann::json;
 
+void cda_rail::Network::read_graphml(const std::filesystem::path& p) {
+  /**
+   * Read network graph from GraphML file into the object. Files using XML not
+   * supported by the streaming reader are read using tinyxml2 instead.
+   * @param path Path to directory containing tracks.graphml
+   */
+
+  if (!this->read_graphml_streaming(p)) {
+    this->read_graphml_dom(p);
+  }
+}
+
 void cda_rail::Network::get_keys(tinyxml2::XMLElement* graphml_body,
                                  std::string& breakable, std::string& length,
                                  std::string& max_speed,
@@ -166,10 +184,11 @@ void cda_rail::Network::add_edges_from_graphml(
   }
 }
 
-void cda_rail::Network::read_graphml(const std::filesystem::path& p) {
+void cda_rail::Network::read_graphml_dom(const std::filesystem::path& p) {
   /**
-   * Read network graph from XML file into the object
-   * @param path Path to XML file
+   * Read network graph from GraphML file into the object using a tinyxml2
+   * document. Vertices and edges are inserted one by one.
+   * @param path Path to directory containing tracks.graphml
    */
 
   tinyxml2::XMLDocument graph_xml;
@@ -210,6 +229,121 @@ void cda_rail::Network::read_graphml(const std::filesystem::path& p) {
                                min_block_length, min_stop_block_length);
 }
 
+bool cda_rail::Network::read_graphml_streaming(
+    const std::filesystem::path& p) {
+  /**
+   * Read network graph from GraphML file into the object. The file is read in
+   * a single streaming pass, vertices and edges are collected and inserted in
+   * bulk afterwards.
+   * @param path Path to directory containing tracks.graphml
+   *
+   * @return false if the file is not supported by GraphMLReader, the network
+   * is unchanged in this case
+   */
+
+  const GraphMLReader reader(p / "tracks.graphml");
+
+  std::string breakable;
+  std::string length;
+  std::string max_speed;
+  std::string min_block_length;
+  std::string min_stop_block_length;
+  std::string type;
+  std::string headway;
+
+  std::vector<Vertex> new_vertices;
+  std::vector<Edge>   new_edges;
+  // Vertex names of the edges, resolved once all vertices are known
+  std::vector<std::pair<std::string, std::string>> edge_vertex_names;
+  const auto element_counts = reader.count_elements();
+  new_vertices.reserve(element_counts.nodes);
+  new_edges.reserve(element_counts.edges);
+  edge_vertex_names.reserve(element_counts.edges);
+
+  const auto on_key = [&](const GraphMLReader::Key& key) {
+    if (key.attr_name == "breakable") {
+      breakable = key.id;
+    } else if (key.attr_name == "min_block_length") {
+      min_block_length = key.id;
+    } else if (key.attr_name == "max_speed") {
+      max_speed = key.id;
+    } else if (key.attr_name == "length") {
+      length = key.id;
+    } else if (key.attr_name == "type") {
+      type = key.id;
+    } else if (key.attr_name == "min_stop_block_length") {
+      min_stop_block_length = key.id;
+    } else if (key.attr_name == "headway") {
+      headway = key.id;
+    }
+  };
+
+  const auto on_node = [&](const GraphMLReader::Element& node) {
+    std::optional<int>    v_type;
+    std::optional<double> headway_value;
+    for (const auto& [key, value] : node.data) {
+      if (key == type) {
+        v_type = std::stoi(value);
+      } else if (!headway.empty() && key == headway) {
+        headway_value = std::stod(value);
+      }
+    }
+    if (!v_type.has_value()) {
+      throw exceptions::ImportException("graphml");
+    }
+    new_vertices.emplace_back(node.id, static_cast<VertexType>(v_type.value()),
+                              headway_value.value_or(0.0));
+  };
+
+  const auto on_edge = [&](const GraphMLReader::Element& edge) {
+    std::optional<double> e_length;
+    std::optional<double> e_max_speed;
+    std::optional<bool>   e_breakable;
+    std::optional<double> e_min_block_length;
+    std::optional<double> e_min_stop_block_length;
+    for (const auto& [key, value] : edge.data) {
+      if (key == breakable) {
+        std::string tmp = value;
+        to_bool_optional(tmp, e_breakable);
+      } else if (key == min_block_length) {
+        e_min_block_length = std::stod(value);
+      } else if (key == max_speed) {
+        e_max_speed = std::stod(value);
+      } else if (key == length) {
+        e_length = std::stod(value);
+      } else if (!min_stop_block_length.empty() &&
+                 key == min_stop_block_length) {
+        e_min_stop_block_length = std::stod(value);
+      }
+    }
+    if (!e_length.has_value() || !e_max_speed.has_value() ||
+        !e_breakable.has_value() || !e_min_block_length.has_value()) {
+      throw exceptions::ImportException("graphml");
+    }
+    new_edges.emplace_back(0, 0, e_length.value(), e_max_speed.value(),
+                           e_breakable.value(), e_min_block_length.value(),
+                           e_min_stop_block_length.value_or(100));
+    edge_vertex_names.emplace_back(edge.source, edge.target);
+  };
+
+  if (!reader.parse(on_key, on_node, on_edge)) {
+    return false;
+  }
+
+  if (breakable.empty() || length.empty() || max_speed.empty() ||
+      min_block_length.empty() || type.empty()) {
+    throw exceptions::ImportException("graphml");
+  }
+
+  this->add_vertices_bulk(std::move(new_vertices));
+  for (size_t i = 0; i < new_edges.size(); ++i) {
+    new_edges[i].source = get_vertex_index(edge_vertex_names[i].first);
+    new_edges[i].target = get_vertex_index(edge_vertex_names[i].second);
+  }
+  this->add_edges_bulk(std::move(new_edges));
+  return true;
+}
+
 void cda_rail::Network::read_successors(const std::filesystem::path& p) {
   /**
    * Read successors from path
@@ -246,6 +380,8 @@ size_t cda_rail::Network::add_vertex(const std::string& name, VertexType type,
     throw exceptions::InvalidInputException("Vertex already exists");
   }
   vertices.emplace_back(name, type, headway);
+  out_adjacency.emplace_back();
+  in_adjacency.emplace_back();
   vertex_name_to_index[name] = vertices.size() - 1;
   return vertex_name_to_index[name];
 }
@@ -280,9 +416,95 @@ size_t cda_rail::Network::add_edge(size_t source, size_t target, double length,
   edges.emplace_back(source, target, length, max_speed, breakable,
                      min_block_length, min_stop_block_length);
   successors.emplace_back();
+  // New edge has the largest index, hence, the adjacency lists remain sorted
+  out_adjacency[source].emplace_back(edges.size() - 1);
+  in_adjacency[target].emplace_back(edges.size() - 1);
+  vertices_to_edge_index.emplace(std::make_pair(source, target),
+                                 edges.size() - 1);
+  route_cache.clear();
   return edges.size() - 1;
 }
 
+void cda_rail::Network::add_vertices_bulk(std::vector<Vertex> new_vertices) {
+  /**
+   * Add many vertices to network at once. The batch is validated before any
+   * vertex is inserted, i.e., the network remains unchanged if it is invalid.
+   * @param new_vertices Vertices to add, indices are assigned in this order
+   */
+
+  std::vector<const std::string*> names;
+  names.reserve(new_vertices.size());
+  for (const auto& vertex : new_vertices) {
+    if (has_vertex(vertex.name)) {
+      throw exceptions::InvalidInputException("Vertex already exists");
+    }
+    names.push_back(&vertex.name);
+  }
+  std::sort(names.begin(), names.end(),
+            [](const auto* lhs, const auto* rhs) { return *lhs < *rhs; });
+  if (std::adjacent_find(names.begin(), names.end(),
+                         [](const auto* lhs, const auto* rhs) {
+                           return *lhs == *rhs;
+                         }) != names.end()) {
+    throw exceptions::InvalidInputException("Vertex already exists");
+  }
+
+  const auto num_vertices = vertices.size() + new_vertices.size();
+  vertices.reserve(num_vertices);
+  out_adjacency.resize(num_vertices);
+  in_adjacency.resize(num_vertices);
+  vertex_name_to_index.reserve(num_vertices);
+  for (auto& vertex : new_vertices) {
+    vertex_name_to_index.emplace(vertex.name, vertices.size());
+    vertices.push_back(std::move(vertex));
+  }
+}
+
+void cda_rail::Network::add_edges_bulk(std::vector<Edge> new_edges) {
+  /**
+   * Add many edges to network at once. The batch is validated before any edge
+   * is inserted, i.e., the network remains unchanged if it is invalid.
+   * @param new_edges Edges to add, indices are assigned in this order
+   */
+
+  std::vector<std::pair<size_t, size_t>> vertex_pairs;
+  vertex_pairs.reserve(new_edges.size());
+  for (const auto& edge : new_edges) {
+    if (edge.source == edge.target) {
+      throw exceptions::InvalidInputException("Source and target are the same");
+    }
+    if (!has_vertex(edge.source)) {
+      throw exceptions::VertexNotExistentException(edge.source);
+    }
+    if (!has_vertex(edge.target)) {
+      throw exceptions::VertexNotExistentException(edge.target);
+    }
+    if (has_edge(edge.source, edge.target)) {
+      throw exceptions::InvalidInputException("Edge already exists");
+    }
+    vertex_pairs.emplace_back(edge.source, edge.target);
+  }
+  std::sort(vertex_pairs.begin(), vertex_pairs.end());
+  if (std::adjacent_find(vertex_pairs.begin(), vertex_pairs.end()) !=
+      vertex_pairs.end()) {
+    throw exceptions::InvalidInputException("Edge already exists");
+  }
+
+  const auto num_edges = edges.size() + new_edges.size();
+  edges.reserve(num_edges);
+  successors.resize(num_edges);
+  vertices_to_edge_index.reserve(num_edges);
+  for (const auto& edge : new_edges) {
+    // Indices are increasing, hence, the adjacency lists remain sorted
+    out_adjacency[edge.source].emplace_back(edges.size());
+    in_adjacency[edge.target].emplace_back(edges.size());
+    vertices_to_edge_index.emplace(std::make_pair(edge.source, edge.target),
+                                   edges.size());
+    edges.push_back(edge);
+  }
+  route_cache.clear();
+}
+
 void cda_rail::Network::add_successor(size_t edge_in, size_t edge_out) {
   /**
    * Add successor to edge, but only if the edges are adjacent to each other
@@ -309,6 +531,7 @@ void cda_rail::Network::add_successor(size_t edge_in, size_t edge_out) {
   }
 
   successors[edge_in].emplace_back(edge_out);
+  route_cache.clear();
 }
 
 const cda_rail::Vertex& cda_rail::Network::get_vertex(size_t index) const {
@@ -369,12 +592,11 @@ const cda_rail::Edge& cda_rail::Network::get_edge(size_t source_id,
   if (!has_vertex(target_id)) {
     throw exceptions::VertexNotExistentException(target_id);
   }
-  for (const auto& edge : edges) {
-    if (edge.source == source_id && edge.target == target_id) {
-      return edge;
-    }
+  const auto it = vertices_to_edge_index.find({source_id, target_id});
+  if (it == vertices_to_edge_index.end()) {
+    throw exceptions::EdgeNotExistentException(source_id, target_id);
   }
-  throw exceptions::EdgeNotExistentException(source_id, target_id);
+  return edges[it->second];
 }
 
 size_t cda_rail::Network::get_edge_index(size_t source_id,
@@ -393,12 +615,11 @@ size_t cda_rail::Network::get_edge_index(size_t source_id,
   if (!has_vertex(target_id)) {
     throw exceptions::VertexNotExistentException(target_id);
   }
-  for (size_t i = 0; i < edges.size(); i++) {
-    if (edges[i].source == source_id && edges[i].target == target_id) {
-      return i;
-    }
+  const auto it = vertices_to_edge_index.find({source_id, target_id});
+  if (it == vertices_to_edge_index.end()) {
+    throw exceptions::EdgeNotExistentException(source_id, target_id);
   }
-  throw exceptions::EdgeNotExistentException(source_id, target_id);
+  return it->second;
 }
 
 bool cda_rail::Network::has_edge(size_t source_id, size_t target_id) const {
@@ -416,10 +637,8 @@ bool cda_rail::Network::has_edge(size_t source_id, size_t target_id) const {
   if (!has_vertex(target_id)) {
     throw exceptions::VertexNotExistentException(target_id);
   }
-  return std::any_of(
-      edges.begin(), edges.end(), [source_id, target_id](const Edge& edge) {
-        return edge.source == source_id && edge.target == target_id;
-      });
+  return vertices_to_edge_index.find({source_id, target_id}) !=
+         vertices_to_edge_index.end();
 }
 
 bool cda_rail::Network::has_edge(const std::string& source_name,
@@ -444,7 +663,8 @@ bool cda_rail::Network::has_edge(const std::string& source_name,
 void cda_rail::Network::change_vertex_name(size_t             index,
                                            const std::string& new_name) {
   /**
-   * Change vertex name
+   * Change vertex name. Edges are indexed by vertex indices, hence, only the
+   * name lookup has to be updated.
    *
    * @param index Index of vertex
    * @param new_name New name of vertex
@@ -471,6 +691,7 @@ void cda_rail::Network::change_edge_length(size_t index, double new_length) {
     throw exceptions::EdgeNotExistentException(index);
   }
   edges[index].length = new_length;
+  route_cache.clear();
 }
 
 void cda_rail::Network::change_edge_max_speed(size_t index,
@@ -547,16 +768,8 @@ std::vector<size_t> cda_rail::Network::out_edges(size_t index) const {
    *
    * @return Vector of indices of edges leaving the vertex
    */
-  if (!has_vertex(index)) {
-    throw exceptions::VertexNotExistentException(index);
-  }
-  std::vector<size_t> out_edges;
-  for (size_t i = 0; i < edges.size(); ++i) {
-    if (edges[i].source == index) {
-      out_edges.emplace_back(i);
-    }
-  }
-  return out_edges;
+  const auto out_edges = out_edges_span(index);
+  return {out_edges.begin(), out_edges.end()};
 }
 
 std::vector<size_t> cda_rail::Network::in_edges(size_t index) const {
@@ -567,16 +780,39 @@ std::vector<size_t> cda_rail::Network::in_edges(size_t index) const {
    *
    * @return Vector of indices of edges entering the vertex
    */
+  const auto in_edges = in_edges_span(index);
+  return {in_edges.begin(), in_edges.end()};
+}
+
+gsl::span<const size_t>
+cda_rail::Network::out_edges_span(size_t index) const {
+  /**
+   * Gets all edges leaving a given vertex without copying them. The view is
+   * invalidated by any modification of the network.
+   *
+   * @param index Index of vertex
+   *
+   * @return View of the indices of edges leaving the vertex in ascending order
+   */
   if (!has_vertex(index)) {
     throw exceptions::VertexNotExistentException(index);
   }
-  std::vector<size_t> in_edges;
-  for (size_t i = 0; i < edges.size(); ++i) {
-    if (edges[i].target == index) {
-      in_edges.emplace_back(i);
-    }
+  return out_adjacency[index];
+}
+
+gsl::span<const size_t> cda_rail::Network::in_edges_span(size_t index) const {
+  /**
+   * Gets all edges entering a given vertex without copying them. The view is
+   * invalidated by any modification of the network.
+   *
+   * @param index Index of vertex
+   *
+   * @return View of the indices of edges entering the vertex in ascending order
+   */
+  if (!has_vertex(index)) {
+    throw exceptions::VertexNotExistentException(index);
   }
-  return in_edges;
+  return in_adjacency[index];
 }
 
 const std::vector<size_t>&
@@ -607,7 +843,7 @@ std::vector<size_t> cda_rail::Network::get_predecessors(size_t index) const {
   }
   std::vector<size_t> ret_val;
 
-  for (const auto& e_1 : in_edges(get_edge(index).source)) {
+  for (const auto& e_1 : in_edges_span(get_edge(index).source)) {
     if (is_valid_successor(e_1, index)) {
       ret_val.push_back(e_1);
     }
@@ -812,6 +1048,56 @@ void cda_rail::Network::export_network(const std::filesystem::path& p) const {
   export_successors_python(p);
 }
 
+void cda_rail::Network::export_binary(snapshot::BinaryWriter& writer) const {
+  /**
+   * Appends the network to a binary snapshot. Vertices and edges are stored in
+   * index order, successors as lists of edge indices. The mapping of
+   * transformed edges to their original edges is included.
+   *
+   * @param writer: The writer to append the data to.
+   */
+
+  writer.write_index(vertices.size());
+  for (const auto& vertex : vertices) {
+    writer.write_string(vertex.name);
+    writer.write(static_cast<int32_t>(vertex.type));
+    writer.write(vertex.headway);
+  }
+
+  writer.write_index(edges.size());
+  for (const auto& edge : edges) {
+    writer.write_index(edge.source);
+    writer.write_index(edge.target);
+    writer.write(edge.length);
+    writer.write(edge.max_speed);
+    writer.write(static_cast<uint8_t>(edge.breakable));
+    writer.write(edge.min_block_length);
+    writer.write(edge.min_stop_block_length);
+  }
+
+  for (const auto& edge_successors : successors) {
+    writer.write_indices(edge_successors);
+  }
+
+  // Edges originating from transformations, e.g., discretization, sorted so
+  // that equal networks result in equal snapshots
+  std::vector<size_t> transformed_edges;
+  transformed_edges.reserve(new_edge_to_old_edge_after_transform.size());
+  for (const auto& [new_edge, old_edge_position] :
+       new_edge_to_old_edge_after_transform) {
+    transformed_edges.push_back(new_edge);
+  }
+  std::sort(transformed_edges.begin(), transformed_edges.end());
+  writer.write_index(transformed_edges.size());
+  for (const auto& new_edge : transformed_edges) {
+    const auto& [old_edge, position] =
+        new_edge_to_old_edge_after_transform.at(new_edge);
+    writer.write_index(new_edge);
+    writer.write_index(old_edge);
+    writer.write(position);
+  }
+}
+
 bool cda_rail::Network::is_valid_successor(size_t e0, size_t e1) const {
   /**
    * Checks if the edge e1 is a valid successor of the edge e0, this includes
@@ -851,8 +1137,8 @@ std::vector<size_t> cda_rail::Network::neighbors(size_t index) const {
     throw exceptions::VertexNotExistentException(index);
   }
   std::vector<size_t> neighbors;
-  auto                e_out = out_edges(index);
-  auto                e_in  = in_edges(index);
+  const auto          e_out = out_edges_span(index);
+  const auto          e_in  = in_edges_span(index);
   for (auto e : e_out) {
     if (std::find(neighbors.begin(), neighbors.end(), get_edge(e).target) ==
         neighbors.end()) {
@@ -887,6 +1173,57 @@ cda_rail::Network::Network(const std::filesystem::path& p) {
   this->read_successors(p);
 }
 
+cda_rail::Network::Network(snapshot::BinaryReader& reader) {
+  /**
+   * Construct object and read network from a binary snapshot written by
+   * export_binary.
+   * @param reader Reader positioned at the beginning of the network data
+   */
+
+  const auto num_vertices = reader.read_index();
+  for (size_t v = 0; v < num_vertices; ++v) {
+    auto       name    = reader.read_string();
+    const auto type    = static_cast<VertexType>(reader.read<int32_t>());
+    const auto headway = reader.read<double>();
+    add_vertex(name, type, headway);
+  }
+
+  const auto num_edges = reader.read_index();
+  for (size_t e = 0; e < num_edges; ++e) {
+    const auto source                = reader.read_index();
+    const auto target                = reader.read_index();
+    const auto length                = reader.read<double>();
+    const auto max_speed             = reader.read<double>();
+    const auto breakable             = reader.read<uint8_t>() != 0;
+    const auto min_block_length      = reader.read<double>();
+    const auto min_stop_block_length = reader.read<double>();
+    add_edge(source, target, length, max_speed, breakable, min_block_length,
+             min_stop_block_length);
+  }
+
+  for (size_t e = 0; e < num_edges; ++e) {
+    successors[e] = reader.read_indices();
+    for (const auto& e_out : successors[e]) {
+      if (!has_edge(e_out) || edges[e_out].source != edges[e].target) {
+        throw exceptions::ImportException(
+            "binary snapshot (invalid successor)");
+      }
+    }
+  }
+
+  const auto num_transformed_edges = reader.read_index();
+  for (size_t i = 0; i < num_transformed_edges; ++i) {
+    const auto new_edge = reader.read_index();
+    const auto old_edge = reader.read_index();
+    const auto position = reader.read<double>();
+    if (!has_edge(new_edge)) {
+      throw exceptions::ImportException(
+          "binary snapshot (invalid transformed edge)");
+    }
+    new_edge_to_old_edge_after_transform[new_edge] = {old_edge, position};
+  }
+}
+
 bool cda_rail::Network::is_adjustable(size_t vertex_id) const {
   /**
    * Checks if a given vertex type is adjustable (if applicable for a certain
@@ -984,7 +1321,7 @@ cda_rail::Network::separate_edge_at(
   if (!new_edge_breakable) {
     set_edge_unbreakable(edge_index);
   }
-  edges[edge_index].source = new_vertices.back();
+  change_edge_source(edge_index, new_vertices.back());
   new_edges.emplace_back(edge_index);
 
   // Update successors, i.e.,
@@ -994,7 +1331,7 @@ cda_rail::Network::separate_edge_at(
   // successor
   // - For the last new edge add the same successors as edge_index had (this has
   // already been done implicitly)
-  for (const auto& incoming_edge_index : in_edges(edge.source)) {
+  for (const auto& incoming_edge_index : in_edges_span(edge.source)) {
     std::replace(successors[incoming_edge_index].begin(),
                  successors[incoming_edge_index].end(), edge_index,
                  new_edges.front());
@@ -1034,10 +1371,10 @@ cda_rail::Network::separate_edge_at(
     if (!new_edge_breakable) {
       set_edge_unbreakable(reverse_edge_index);
     }
-    edges[reverse_edge_index].source = new_vertices.front();
+    change_edge_source(reverse_edge_index, new_vertices.front());
     new_reverse_edges.emplace_back(reverse_edge_index);
 
-    for (const auto& incoming_edge_index : in_edges(edge.target)) {
+    for (const auto& incoming_edge_index : in_edges_span(edge.target)) {
       std::replace(successors[incoming_edge_index].begin(),
                    successors[incoming_edge_index].end(), reverse_edge_index,
                    new_reverse_edges.front());
@@ -1047,6 +1384,9 @@ cda_rail::Network::separate_edge_at(
     }
   }
 
+  // Successors have been replaced in place
+  route_cache.clear();
+
   return return_edges;
 }
 
@@ -1633,32 +1973,120 @@ cda_rail::Network::all_edge_pairs_shortest_paths() const {
    * Given e0 = (v0, v1) and e1 = (v2, v3), the distance refers to the distance
    * between v1 and v3 by only using valid successors. If v0 or v2 are of
    * interest the value has to be post-processed accordingly. The distance is
-   * std::numeric_limits<double>::max()/3 if no path exists. This methods uses
-   * the Floyd-Warshall algorithm.
+   * std::numeric_limits<double>::max()/3 if no path exists.
+   * See all_edge_pairs_shortest_paths_matrix for a flat representation.
    *
    * @return: Matrix of distances between all edges
    */
-  std::vector<std::vector<double>> ret_val(
-      number_of_edges(), std::vector<double>(number_of_edges(), INF));
+  return all_edge_pairs_shortest_paths_matrix().to_nested_vector();
+}
 
-  for (size_t u = 0; u < number_of_edges(); ++u) {
-    for (size_t v = 0; v < number_of_edges(); ++v) {
-      if (u == v) {
-        ret_val[u][v] = 0;
-      } else if (is_valid_successor(u, v)) {
-        ret_val[u][v] = get_edge(v).length;
-      }
+cda_rail::DistanceMatrix<double>
+cda_rail::Network::all_edge_pairs_shortest_paths_matrix(
+    size_t num_threads) const {
+  /**
+   * Calculates all shortest paths between all edges, see
+   * all_edge_pairs_shortest_paths for the semantics of the distances.
+   *
+   * @param num_threads: Number of threads to use. Default 0, i.e., the number
+   * of hardware threads.
+   *
+   * @return: Flat matrix of distances between all edges
+   */
+  return all_edge_pairs_shortest_paths_dijkstra<double>(num_threads);
+}
+
+cda_rail::DistanceMatrix<float>
+cda_rail::Network::all_edge_pairs_shortest_paths_matrix_compact(
+    size_t num_threads) const {
+  /**
+   * Same as all_edge_pairs_shortest_paths_matrix, but stores the distances in
+   * single precision to halve the memory footprint. Distances are computed in
+   * double precision and only rounded when written to the matrix.
+   *
+   * @param num_threads: Number of threads to use. Default 0, i.e., the number
+   * of hardware threads.
+   *
+   * @return: Flat matrix of distances between all edges
+   */
+  return all_edge_pairs_shortest_paths_dijkstra<float>(num_threads);
+}
+
+template <typename T>
+cda_rail::DistanceMatrix<T>
+cda_rail::Network::all_edge_pairs_shortest_paths_dijkstra(
+    size_t num_threads) const {
+  /**
+   * Runs one Dijkstra per source edge on the successor graph, i.e., the graph
+   * whose nodes are edges and whose arcs are valid successor relations. Source
+   * edges are distributed dynamically among num_threads worker threads, every
+   * worker writes only to the rows of its source edges.
+   *
+   * @param num_threads: Number of threads to use. If 0, the number of hardware
+   * threads is used.
+   *
+   * @return: Matrix of distances between all edges
+   */
+
+  const auto        n = number_of_edges();
+  DistanceMatrix<T> ret_val(n);
+  if (n == 0) {
+    return ret_val;
+  }
+
+  struct DijkstraBuffers {
+    std::vector<double> dist;
+    std::vector<size_t> touched;
+    std::priority_queue<std::pair<double, size_t>,
+                        std::vector<std::pair<double, size_t>>, std::greater<>>
+        pq;
+  };
+  // Buffers are reused for all source edges handled by the same worker
+  std::vector<DijkstraBuffers> buffers(resolve_num_threads(num_threads, n));
+
+  parallel_for(n, num_threads, [this, n, &ret_val, &buffers](size_t source,
+                                                             size_t worker) {
+    auto& dist    = buffers[worker].dist;
+    auto& touched = buffers[worker].touched;
+    auto& pq      = buffers[worker].pq;
+    if (dist.empty()) {
+      dist.assign(n, INF);
     }
-  }
 
-  // Floyd-Warshall iterations
-  for (size_t k = 0; k < number_of_edges(); ++k) {
-    for (size_t i = 0; i < number_of_edges(); ++i) {
-      for (size_t j = 0; j < number_of_edges(); ++j) {
-        ret_val[i][j] = std::min(ret_val[i][j], ret_val[i][k] + ret_val[k][j]);
+    dist[source] = 0;
+    touched.push_back(source);
+    pq.emplace(0, source);
+
+    while (!pq.empty()) {
+      const auto [d, e] = pq.top();
+      pq.pop();
+      if (d > dist[e]) {
+        // Outdated entry due to later update with shorter path
+        continue;
+      }
+      const auto& e_target = edges[e].target;
+      for (const auto& e_next : successors[e]) {
+        if (edges[e_next].source != e_target) {
+          continue;
+        }
+        const auto d_next = d + edges[e_next].length;
+        if (d_next < dist[e_next]) {
+          if (dist[e_next] >= INF) {
+            touched.push_back(e_next);
+          }
+          dist[e_next] = d_next;
+          pq.emplace(d_next, e_next);
+        }
       }
     }
-  }
+
+    auto row = ret_val.row(source);
+    for (const auto& e : touched) {
+      row[e]  = static_cast<T>(dist[e]);
+      dist[e] = INF;
+    }
+    touched.clear();
+  });
 
   return ret_val;
 }
@@ -1696,7 +2124,25 @@ cda_rail::Network::separate_stop_edges(const std::vector<size_t>& stop_edges) {
   return ret_val;
 }
 
-std::vector<std::vector<size_t>> cda_rail::Network::all_routes_of_given_length(
+size_t cda_rail::Network::RouteQueryHash::operator()(
+    const RouteQuery& query) const noexcept {
+  size_t     seed    = 0;
+  const auto combine = [&seed](size_t h) {
+    seed ^= h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+  };
+  combine(std::hash<std::optional<size_t>>{}(query.v_0));
+  combine(std::hash<std::optional<size_t>>{}(query.e_0));
+  combine(std::hash<double>{}(query.bucket_length));
+  combine(std::hash<bool>{}(query.reverse_direction));
+  combine(std::hash<std::optional<size_t>>{}(query.exit_node));
+  for (const auto& e : query.edges_used_by_train) {
+    combine(std::hash<size_t>{}(e));
+  }
+  return seed;
+}
+
+std::vector<std::vector<size_t>>
+cda_rail::Network::all_routes_of_given_length(
     std::optional<size_t> v_0, std::optional<size_t> e_0, double desired_length,
     bool reverse_direction, std::optional<size_t> exit_node,
     std::vector<size_t> edges_used_by_train) const {
@@ -1704,6 +2150,9 @@ std::vector<std::vector<size_t>> cda_rail::Network::all_routes_of_given_length(
    * Finds all routes from a specified starting point in the specified
    * direction. The routes are of a specified length, i.e., at least that long,
    * however removing the last edge results in a route that is too short.
+   * The routes are derived from the cached routes of the length bucket, hence,
+   * repeated queries (e.g., for trains of similar length) are answered without
+   * enumerating the routes again.
    *
    * @param v_0: The index of the starting vertex. If specified, e_0 should be
    * empty.
@@ -1712,6 +2161,9 @@ std::vector<std::vector<size_t>> cda_rail::Network::all_routes_of_given_length(
    * @param desired_length: The desired length of the routes.
    * @param reverse_direction: If true, the routes are in the reverse direction.
    * Default is false, i.e., in edge order.
+   * @param exit_node: If specified, routes (in forward direction) also end
+   * once they reach this vertex.
+   * @param edges_used_by_train: If not empty, only these edges are used.
    */
 
   if (v_0.has_value() && e_0.has_value()) {
@@ -1734,67 +2186,192 @@ std::vector<std::vector<size_t>> cda_rail::Network::all_routes_of_given_length(
         "Desired length is not strictly positive");
   }
 
-  const std::vector<size_t> edges_to_consider_tmp =
-      v_0.has_value()
-          ? (reverse_direction ? in_edges(v_0.value()) : out_edges(v_0.value()))
-          : std::vector<size_t>{e_0.value()};
+  std::sort(edges_used_by_train.begin(), edges_used_by_train.end());
+  edges_used_by_train.erase(
+      std::unique(edges_used_by_train.begin(), edges_used_by_train.end()),
+      edges_used_by_train.end());
 
-  auto edges_to_consider = edges_used_by_train.empty() ? edges_to_consider_tmp
-                                                       : std::vector<size_t>();
+  if (reverse_direction) {
+    // Only used in forward direction
+    exit_node.reset();
+  }
+  double bucket_length =
+      std::ceil(desired_length / ROUTE_LENGTH_BUCKET) * ROUTE_LENGTH_BUCKET;
+  if (bucket_length < desired_length) {
+    // Rounding error
+    bucket_length += ROUTE_LENGTH_BUCKET;
+  }
 
-  if (!edges_used_by_train.empty()) {
-    for (const auto& e : edges_to_consider_tmp) {
-      if (std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
-                    e) != edges_used_by_train.end()) {
-        edges_to_consider.emplace_back(e);
-      }
+  const RouteQuery query{v_0,
+                         e_0,
+                         bucket_length,
+                         reverse_direction,
+                         exit_node,
+                         std::move(edges_used_by_train)};
+
+  auto bucket_routes = route_cache.find(query);
+  if (bucket_routes == nullptr) {
+    bucket_routes = std::make_shared<const std::vector<std::vector<size_t>>>(
+        enumerate_routes_of_given_length(query));
+    route_cache.insert(query, bucket_routes);
+  }
+
+  return routes_of_given_length(*bucket_routes, desired_length, exit_node);
+}
+
+std::vector<std::vector<size_t>>
+cda_rail::Network::enumerate_routes_of_given_length(
+    const RouteQuery& query) const {
+  /**
+   * Enumerates the routes of length query.bucket_length specified by the
+   * (validated) query using an iterative depth-first search. The current route
+   * is kept on a single stack and only copied once it is complete.
+   * A route must not pass the same point twice. This is equivalent to all
+   * edges of the route having pairwise distinct sources (forward direction)
+   * or targets (reverse direction).
+   * Routes that cannot be extended before reaching the desired length are
+   * included as well, since they contain routes of shorter lengths. The routes
+   * are in depth-first order, i.e., routes with a common prefix are adjacent.
+   */
+
+  const auto& desired_length    = query.bucket_length;
+  const auto& reverse_direction = query.reverse_direction;
+  const auto& exit_node         = query.exit_node;
+
+  std::vector<bool> edge_usable(number_of_edges(),
+                                query.edges_used_by_train.empty());
+  for (const auto& e : query.edges_used_by_train) {
+    if (has_edge(e)) {
+      edge_usable[e] = true;
     }
   }
+  std::vector<bool> vertex_used(number_of_vertices(), false);
+  const auto        blocking_vertex = [this, reverse_direction](size_t e) {
+    return reverse_direction ? edges[e].target : edges[e].source;
+  };
+
+  // Every stack entry consists of the next edges to be considered, the
+  // position of the next candidate among them and whether the route has been
+  // extended by any of them
+  struct StackEntry {
+    std::vector<size_t> next_edges;
+    size_t              next_candidate = 0;
+    bool                extended       = false;
+  };
+  std::vector<StackEntry> stack;
+  std::vector<size_t>     current_route;
+  std::vector<double>     remaining_length;
 
   std::vector<std::vector<size_t>> ret_val;
 
-  for (const auto& e_index : edges_to_consider) {
-    if (!reverse_direction && exit_node.has_value() &&
-        get_edge(e_index).target == exit_node.value()) {
-      ret_val.emplace_back(1, e_index);
+  const auto next_edges_of = [this, reverse_direction,
+                              &edge_usable](size_t e) {
+    std::vector<size_t> next_edges;
+    if (reverse_direction) {
+      for (const auto& e_prev : in_edges_span(edges[e].source)) {
+        if (edge_usable[e_prev] && is_valid_successor(e_prev, e)) {
+          next_edges.emplace_back(e_prev);
+        }
+      }
+    } else {
+      for (const auto& e_next : successors[e]) {
+        if (edge_usable[e_next]) {
+          next_edges.emplace_back(e_next);
+        }
+      }
+    }
+    return next_edges;
+  };
+
+  const auto start_edges =
+      query.v_0.has_value()
+          ? (reverse_direction ? in_edges_span(query.v_0.value())
+                               : out_edges_span(query.v_0.value()))
+          : gsl::span<const size_t>(&query.e_0.value(), 1);
+  StackEntry start_entry;
+  for (const auto& e : start_edges) {
+    if (edge_usable[e]) {
+      start_entry.next_edges.emplace_back(e);
+    }
+  }
+  stack.emplace_back(std::move(start_entry));
+  remaining_length.emplace_back(desired_length);
+
+  while (!stack.empty()) {
+    auto& top = stack.back();
+    if (top.next_candidate >= top.next_edges.size()) {
+      // All candidates explored, backtrack
+      if (!top.extended && !current_route.empty()) {
+        ret_val.push_back(current_route);
+      }
+      stack.pop_back();
+      remaining_length.pop_back();
+      if (!current_route.empty()) {
+        vertex_used[blocking_vertex(current_route.back())] = false;
+        current_route.pop_back();
+      }
       continue;
     }
 
-    const auto& e_len = get_edge(e_index).length;
+    const auto e = top.next_edges[top.next_candidate++];
+    if (vertex_used[blocking_vertex(e)]) {
+      continue;
+    }
 
-    if (e_len >= desired_length) {
-      ret_val.emplace_back(1, e_index);
+    top.extended      = true;
+    const auto& e_len = edges[e].length;
+    if ((exit_node.has_value() && edges[e].target == exit_node.value()) ||
+        e_len >= remaining_length.back()) {
+      current_route.emplace_back(e);
+      ret_val.push_back(current_route);
+      current_route.pop_back();
       continue;
     }
 
-    const auto next_edges =
-        reverse_direction ? get_predecessors(e_index) : get_successors(e_index);
-
-    for (const auto& e_next_index : next_edges) {
-      const auto paths_e_next = all_routes_of_given_length(
-          std::nullopt, e_next_index, desired_length - e_len, reverse_direction,
-          exit_node, edges_used_by_train);
-      for (const auto& path_e_next : paths_e_next) {
-        // check for cycle
-        const auto edges_r = reverse_direction
-                                 ? in_edges(get_edge(e_index).target)
-                                 : out_edges(get_edge(e_index).source);
-        if (std::any_of(
-                edges_r.begin(), edges_r.end(), [&path_e_next](const auto& e) {
-                  return std::find(path_e_next.begin(), path_e_next.end(), e) !=
-                         path_e_next.end();
-                })) {
-          continue;
-        }
+    current_route.emplace_back(e);
+    vertex_used[blocking_vertex(e)] = true;
+    remaining_length.emplace_back(remaining_length.back() - e_len);
+    stack.push_back({next_edges_of(e), 0, false});
+  }
 
-        std::vector<size_t> path;
-        path.emplace_back(e_index);
-        path.insert(path.end(), path_e_next.begin(), path_e_next.end());
-        ret_val.push_back(path);
+  return ret_val;
+}
+
+std::vector<std::vector<size_t>> cda_rail::Network::routes_of_given_length(
+    const std::vector<std::vector<size_t>>& bucket_routes,
+    double desired_length, std::optional<size_t> exit_node) const {
+  /**
+   * Derives the routes of a desired length from the routes enumerated for a
+   * length bucket containing it. Every route of the desired length is the
+   * shortest prefix of a bucket route that reaches the desired length or the
+   * exit node. The remaining length is computed as in the enumeration, so
+   * that the result equals a direct enumeration.
+   *
+   * @param bucket_routes: Routes returned by enumerate_routes_of_given_length
+   * for a length not less than desired_length.
+   * @param desired_length: The desired length of the routes.
+   * @param exit_node: If specified, routes also end once they reach this
+   * vertex.
+   */
+
+  std::vector<std::vector<size_t>> ret_val;
+  for (const auto& route : bucket_routes) {
+    double remaining_length = desired_length;
+    for (auto it = route.begin(); it != route.end(); ++it) {
+      const auto& edge = edges[*it];
+      if ((exit_node.has_value() && edge.target == exit_node.value()) ||
+          edge.length >= remaining_length) {
+        // Bucket routes sharing this prefix are adjacent
+        if (ret_val.empty() ||
+            !std::equal(ret_val.back().begin(), ret_val.back().end(),
+                        route.begin(), it + 1)) {
+          ret_val.emplace_back(route.begin(), it + 1);
+        }
+        break;
       }
+      remaining_length -= edge.length;
     }
   }
-
   return ret_val;
 }
 
@@ -1847,9 +2424,12 @@ double cda_rail::Network::maximal_vertex_speed(
 }
 
 std::vector<size_t> cda_rail::Network::neighboring_edges(size_t index) const {
-  auto       ret_val      = in_edges(index);
-  const auto edges_to_add = out_edges(index);
-  ret_val.insert(ret_val.end(), edges_to_add.begin(), edges_to_add.end());
+  const auto          e_in  = in_edges_span(index);
+  const auto          e_out = out_edges_span(index);
+  std::vector<size_t> ret_val;
+  ret_val.reserve(e_in.size() + e_out.size());
+  ret_val.insert(ret_val.end(), e_in.begin(), e_in.end());
+  ret_val.insert(ret_val.end(), e_out.begin(), e_out.end());
   return ret_val;
 }
 
@@ -1933,6 +2513,42 @@ void cda_rail::Network::update_new_old_edge(size_t new_edge, size_t old_edge,
   new_edge_to_old_edge_after_transform[new_edge] = old_edge_position;
 }
 
+void cda_rail::Network::change_edge_source(size_t edge_index,
+                                           size_t new_source) {
+  /**
+   * Changes the source vertex of an edge and updates the adjacency and edge
+   * lookup indices accordingly. The edge index is kept, hence, successors
+   * remain valid.
+   *
+   * @param edge_index Index of the edge
+   * @param new_source Index of the new source vertex
+   */
+  if (!has_edge(edge_index)) {
+    throw exceptions::EdgeNotExistentException(edge_index);
+  }
+  if (!has_vertex(new_source)) {
+    throw exceptions::VertexNotExistentException(new_source);
+  }
+  const auto target = edges[edge_index].target;
+  if (has_edge(new_source, target)) {
+    throw exceptions::InvalidInputException("Edge already exists");
+  }
+
+  auto& old_out = out_adjacency[edges[edge_index].source];
+  old_out.erase(std::lower_bound(old_out.begin(), old_out.end(), edge_index));
+
+  auto& new_out = out_adjacency[new_source];
+  new_out.insert(std::lower_bound(new_out.begin(), new_out.end(), edge_index),
+                 edge_index);
+
+  vertices_to_edge_index.erase({edges[edge_index].source, target});
+  vertices_to_edge_index.emplace(std::make_pair(new_source, target),
+                                 edge_index);
+
+  edges[edge_index].source = new_source;
+  route_cache.clear();
+}
+
 void cda_rail::Network::change_vertex_headway(size_t index,
                                               double new_headway) {
   if (!has_vertex(index)) {
@@ -2089,22 +2705,17 @@ cda_rail::Network::shortest_path_using_edges(
       return {dist, path};
     }
 
-    const auto&         possible_successors = only_use_valid_successors
-                                                  ? get_successors(edge_id)
-                                                  : out_edges(edge.target);
-    std::vector<size_t> cleaned_successors;
-    if (edges_to_use.empty()) {
-      cleaned_successors = possible_successors;
-    } else {
-      for (const auto& successor : possible_successors) {
-        if (std::find(edges_to_use.begin(), edges_to_use.end(), successor) !=
-            edges_to_use.end()) {
-          cleaned_successors.emplace_back(successor);
-        }
-      }
-    }
+    const auto possible_successors =
+        only_use_valid_successors
+            ? gsl::span<const size_t>(get_successors(edge_id))
+            : out_edges_span(edge.target);
 
-    for (const auto& successor : cleaned_successors) {
+    for (const auto& successor : possible_successors) {
+      if (!edges_to_use.empty() &&
+          std::find(edges_to_use.begin(), edges_to_use.end(), successor) ==
+              edges_to_use.end()) {
+        continue;
+      }
       const auto& successor_edge = get_edge(successor);
       if (successor_edge.source == edge.target &&
           successor_edge.target == edge.source) {
@@ -1,5 +1,6 @@
 #include "datastructure/Route.hpp"
 
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "datastructure/RailwayNetwork.hpp"
@@ -578,3 +579,38 @@ void cda_rail::RouteMap::remove_route(const std::string& train_name) {
   }
   routes.erase(train_name);
 }
+
+void cda_rail::RouteMap::export_binary(snapshot::BinaryWriter& writer) const {
+  /**
+   * Appends all routes to a binary snapshot. Every route is stored as the name
+   * of the train followed by the list of edge indices.
+   *
+   * @param writer The writer to append the data to.
+   */
+
+  writer.write_index(routes.size());
+  for (const auto& [name, route] : routes) {
+    writer.write_string(name);
+    writer.write_indices(route.get_edges());
+  }
+}
+
+cda_rail::RouteMap::RouteMap(snapshot::BinaryReader& reader,
+                             const Network&          network) {
+  /**
+   * Constructs the object and reads the routes from a binary snapshot written
+   * by export_binary.
+   *
+   * @param reader The reader positioned at the beginning of the route data.
+   * @param network The network to which the routes belong.
+   */
+
+  const auto num_routes = reader.read_index();
+  for (size_t i = 0; i < num_routes; ++i) {
+    const auto name = reader.read_string();
+    this->add_empty_route(name);
+    for (const auto& edge : reader.read_indices()) {
+      this->push_back_edge(name, edge, network);
+    }
+  }
+}
@@ -1,5 +1,6 @@
 #include "datastructure/Station.hpp"
 
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "datastructure/RailwayNetwork.hpp"
@@ -182,3 +183,38 @@ bool cda_rail::StationList::is_fully_in_station(
                station_tracks.end();
       });
 }
+
+void cda_rail::StationList::export_binary(
+    snapshot::BinaryWriter& writer) const {
+  /**
+   * This method appends all stations to a binary snapshot. Tracks are stored
+   * by their edge indices.
+   *
+   * @param writer The writer to append the data to.
+   */
+  writer.write_index(stations.size());
+  for (const auto& [name, station] : stations) {
+    writer.write_string(name);
+    writer.write_indices(station.tracks);
+  }
+}
+
+cda_rail::StationList::StationList(snapshot::BinaryReader& reader,
+                                   const Network&          network) {
+  /**
+   * This method constructs the object and reads all stations from a binary
+   * snapshot written by export_binary.
+   *
+   * @param reader The reader positioned at the beginning of the station data.
+   * @param network The network the track indices refer to.
+   */
+
+  const auto num_stations = reader.read_index();
+  for (size_t i = 0; i < num_stations; ++i) {
+    const auto name = reader.read_string();
+    this->add_station(name);
+    for (const auto& track : reader.read_indices()) {
+      this->add_track_to_station(name, track, network);
+    }
+  }
+}
@@ -1,9 +1,11 @@
 #include "datastructure/Train.hpp"
 
+#include "BinarySnapshot.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "nlohmann/json.hpp"
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <string>
@@ -120,3 +122,40 @@ cda_rail::TrainList::TrainList(const std::filesystem::path& p) {
                     train["acceleration"], train["deceleration"], tim);
   }
 }
+
+void cda_rail::TrainList::export_binary(snapshot::BinaryWriter& writer) const {
+  /**
+   * This method appends all trains in index order to a binary snapshot.
+   *
+   * @param writer The writer to append the data to.
+   */
+  writer.write_index(trains.size());
+  for (const auto& train : trains) {
+    writer.write_string(train.name);
+    writer.write(train.length);
+    writer.write(train.max_speed);
+    writer.write(train.acceleration);
+    writer.write(train.deceleration);
+    writer.write(static_cast<uint8_t>(train.tim));
+  }
+}
+
+cda_rail::TrainList::TrainList(snapshot::BinaryReader& reader) {
+  /**
+   * Construct object and read trains from a binary snapshot
+   */
+
+  const auto num_trains = reader.read_index();
+  for (size_t i = 0; i < num_trains; ++i) {
+    auto       name         = reader.read_string();
+    const auto length       = reader.read<double>();
+    const auto max_speed    = reader.read<double>();
+    const auto acceleration = reader.read<double>();
+    const auto deceleration = reader.read<double>();
+    const auto tim          = reader.read<uint8_t>() != 0;
+    const auto index =
+        this->add_train(name, 0, max_speed, acceleration, deceleration, tim);
+    // The length is stored as double, hence, it is set separately
+    trains[index].length = length;
+  }
+}
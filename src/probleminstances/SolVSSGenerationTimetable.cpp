@@ -24,14 +24,22 @@ cda_rail::instances::SolVSSGenerationTimetable::SolVSSGenerationTimetable(
   this->initialize_vectors();
 }
 
+cda_rail::instances::SolVSSGenerationTimetable::SolVSSGenerationTimetable(
+    CopyOnWrite<VSSGenerationTimetable> instance, int dt)
+    : SolGeneralProblemInstanceWithScheduleAndRoutes<VSSGenerationTimetable>(
+          std::move(instance)),
+      dt(dt) {
+  this->initialize_vectors();
+}
+
 double
 cda_rail::instances::SolVSSGenerationTimetable::get_train_pos(size_t train_id,
                                                               int time) const {
-  if (!instance.get_train_list().has_train(train_id)) {
+  if (!instance->get_train_list().has_train(train_id)) {
     throw exceptions::TrainNotExistentException(train_id);
   }
 
-  const auto& [t0, tn] = instance.time_index_interval(train_id, dt, true);
+  const auto& [t0, tn] = instance->time_index_interval(train_id, dt, true);
   if (t0 * dt > time || tn * dt < time) {
     throw exceptions::ConsistencyException("Train " + std::to_string(train_id) +
                                            " is not scheduled at time " +
@@ -64,11 +72,11 @@ cda_rail::instances::SolVSSGenerationTimetable::get_train_pos(size_t train_id,
 
 double cda_rail::instances::SolVSSGenerationTimetable::get_train_speed(
     size_t train_id, int time) const {
-  if (!instance.get_train_list().has_train(train_id)) {
+  if (!instance->get_train_list().has_train(train_id)) {
     throw exceptions::TrainNotExistentException(train_id);
   }
 
-  const auto& [t0, tn] = instance.time_index_interval(train_id, dt, true);
+  const auto& [t0, tn] = instance->time_index_interval(train_id, dt, true);
   if (t0 * dt > time || tn * dt < time) {
     throw exceptions::ConsistencyException("Train " + std::to_string(train_id) +
                                            " is not scheduled at time " +
@@ -101,11 +109,11 @@ double cda_rail::instances::SolVSSGenerationTimetable::get_train_speed(
 
 void cda_rail::instances::SolVSSGenerationTimetable::add_vss_pos(
     size_t edge_id, double pos, bool reverse_edge) {
-  if (!instance.const_n().has_edge(edge_id)) {
+  if (!instance->const_n().has_edge(edge_id)) {
     throw exceptions::EdgeNotExistentException(edge_id);
   }
 
-  const auto& edge = instance.const_n().get_edge(edge_id);
+  const auto& edge = instance->const_n().get_edge(edge_id);
 
   if (pos <= EPS || pos + EPS >= edge.length) {
     throw exceptions::ConsistencyException(
@@ -118,7 +126,7 @@ void cda_rail::instances::SolVSSGenerationTimetable::add_vss_pos(
 
   if (reverse_edge) {
     const auto reverse_edge_index =
-        instance.const_n().get_reverse_edge_index(edge_id);
+        instance->const_n().get_reverse_edge_index(edge_id);
     if (reverse_edge_index.has_value()) {
       vss_pos.at(reverse_edge_index.value()).emplace_back(edge.length - pos);
       std::sort(vss_pos.at(reverse_edge_index.value()).begin(),
@@ -129,11 +137,11 @@ void cda_rail::instances::SolVSSGenerationTimetable::add_vss_pos(
 
 void cda_rail::instances::SolVSSGenerationTimetable::set_vss_pos(
     size_t edge_id, std::vector<double> pos) {
-  if (!instance.const_n().has_edge(edge_id)) {
+  if (!instance->const_n().has_edge(edge_id)) {
     throw exceptions::EdgeNotExistentException(edge_id);
   }
 
-  const auto& edge = instance.const_n().get_edge(edge_id);
+  const auto& edge = instance->const_n().get_edge(edge_id);
 
   for (const auto& p : pos) {
     if (p <= EPS || p + EPS >= edge.length) {
@@ -148,7 +156,7 @@ void cda_rail::instances::SolVSSGenerationTimetable::set_vss_pos(
 
 void cda_rail::instances::SolVSSGenerationTimetable::reset_vss_pos(
     size_t edge_id) {
-  if (!instance.const_n().has_edge(edge_id)) {
+  if (!instance->const_n().has_edge(edge_id)) {
     throw exceptions::EdgeNotExistentException(edge_id);
   }
 
@@ -162,11 +170,11 @@ void cda_rail::instances::SolVSSGenerationTimetable::add_train_pos(
         "Train position " + std::to_string(pos) + " is negative");
   }
 
-  if (!instance.get_train_list().has_train(train_id)) {
+  if (!instance->get_train_list().has_train(train_id)) {
     throw exceptions::TrainNotExistentException(train_id);
   }
 
-  const auto& [t0, tn] = instance.time_index_interval(train_id, dt, true);
+  const auto& [t0, tn] = instance->time_index_interval(train_id, dt, true);
   if (t0 * dt > time || tn * dt < time) {
     throw exceptions::ConsistencyException("Train " + std::to_string(train_id) +
                                            " is not scheduled at time " +
@@ -179,14 +187,14 @@ void cda_rail::instances::SolVSSGenerationTimetable::add_train_pos(
         " is not a multiple of dt = " + std::to_string(dt));
   }
 
-  const auto tr_t0   = instance.time_index_interval(train_id, dt, true).first;
+  const auto tr_t0   = instance->time_index_interval(train_id, dt, true).first;
   const auto t_index = static_cast<size_t>(time / dt) - tr_t0;
   train_pos.at(train_id).at(t_index) = pos;
 }
 
 void cda_rail::instances::SolVSSGenerationTimetable::add_train_speed(
     size_t train_id, int time, double speed) {
-  if (!instance.get_train_list().has_train(train_id)) {
+  if (!instance->get_train_list().has_train(train_id)) {
     throw exceptions::TrainNotExistentException(train_id);
   }
 
@@ -194,17 +202,17 @@ void cda_rail::instances::SolVSSGenerationTimetable::add_train_speed(
     throw exceptions::ConsistencyException(
         "Train speed " + std::to_string(speed) + " is negative");
   }
-  if (speed > instance.get_train_list().get_train(train_id).max_speed + EPS) {
+  if (speed > instance->get_train_list().get_train(train_id).max_speed + EPS) {
     throw exceptions::ConsistencyException(
         "Train speed " + std::to_string(speed) +
         " is greater than the maximum speed of train " +
         std::to_string(train_id) + " (" +
         std::to_string(
-            instance.get_train_list().get_train(train_id).max_speed) +
+            instance->get_train_list().get_train(train_id).max_speed) +
         ")");
   }
 
-  const auto& [t0, tn] = instance.time_index_interval(train_id, dt, true);
+  const auto& [t0, tn] = instance->time_index_interval(train_id, dt, true);
   if (t0 * dt > time || tn * dt < time) {
     throw exceptions::ConsistencyException("Train " + std::to_string(train_id) +
                                            " is not scheduled at time " +
@@ -217,7 +225,7 @@ void cda_rail::instances::SolVSSGenerationTimetable::add_train_speed(
         " is not a multiple of dt = " + std::to_string(dt));
   }
 
-  const auto tr_t0   = instance.time_index_interval(train_id, dt, true).first;
+  const auto tr_t0   = instance->time_index_interval(train_id, dt, true).first;
   const auto t_index = static_cast<size_t>(time / dt) - tr_t0;
   train_speed.at(train_id).at(t_index) = speed;
 }
@@ -231,7 +239,7 @@ bool cda_rail::instances::SolVSSGenerationTimetable::check_consistency() const {
   if (dt < 0) {
     return false;
   }
-  if (!instance.check_consistency(true)) {
+  if (!instance->check_consistency(true)) {
     return false;
   }
 
@@ -247,7 +255,7 @@ bool cda_rail::instances::SolVSSGenerationTimetable::check_consistency() const {
     }
   }
   for (size_t tr_id = 0; tr_id < train_speed.size(); ++tr_id) {
-    const auto& train = instance.get_train_list().get_train(tr_id);
+    const auto& train = instance->get_train_list().get_train(tr_id);
     for (double v : train_speed.at(tr_id)) {
       if (v + EPS < 0 || v > train.max_speed + EPS) {
         return false;
@@ -255,7 +263,7 @@ bool cda_rail::instances::SolVSSGenerationTimetable::check_consistency() const {
     }
   }
   for (size_t edge_id = 0; edge_id < vss_pos.size(); ++edge_id) {
-    const auto& edge = instance.const_n().get_edge(edge_id);
+    const auto& edge = instance->const_n().get_edge(edge_id);
     for (const auto& pos : vss_pos.at(edge_id)) {
       if (pos + EPS < 0 || pos > edge.length + EPS) {
         return false;
@@ -308,11 +316,11 @@ void cda_rail::instances::SolVSSGenerationTimetable::export_solution(
   data_file.close();
 
   json vss_pos_json;
-  for (size_t edge_id = 0; edge_id < instance.const_n().number_of_edges();
+  for (size_t edge_id = 0; edge_id < instance->const_n().number_of_edges();
        ++edge_id) {
-    const auto& edge = instance.const_n().get_edge(edge_id);
-    const auto& v0   = instance.const_n().get_vertex(edge.source).name;
-    const auto& v1   = instance.const_n().get_vertex(edge.target).name;
+    const auto& edge = instance->const_n().get_edge(edge_id);
+    const auto& v0   = instance->const_n().get_vertex(edge.source).name;
+    const auto& v1   = instance->const_n().get_vertex(edge.target).name;
     vss_pos_json["('" + v0 + "', '" + v1 + "')"] = vss_pos.at(edge_id);
   }
 
@@ -322,9 +330,9 @@ void cda_rail::instances::SolVSSGenerationTimetable::export_solution(
 
   json train_pos_json;
   json train_speed_json;
-  for (size_t tr_id = 0; tr_id < instance.get_train_list().size(); ++tr_id) {
-    const auto& train       = instance.get_train_list().get_train(tr_id);
-    const auto  tr_interval = instance.time_index_interval(tr_id, dt, true);
+  for (size_t tr_id = 0; tr_id < instance->get_train_list().size(); ++tr_id) {
+    const auto& train       = instance->get_train_list().get_train(tr_id);
+    const auto  tr_interval = instance->time_index_interval(tr_id, dt, true);
     json        train_pos_json_tmp;
     json        train_speed_json_tmp;
     for (size_t t_id = 0; t_id < train_pos.at(tr_id).size(); ++t_id) {
@@ -357,17 +365,18 @@ cda_rail::instances::SolVSSGenerationTimetable::SolVSSGenerationTimetable(
 
   bool const import_routes = instance.has_value();
   if (instance.has_value()) {
-    this->instance = instance.value();
+    this->instance = CopyOnWrite<VSSGenerationTimetable>(instance.value());
   } else {
-    this->instance = VSSGenerationTimetable(p / "instance");
+    this->instance = CopyOnWrite<VSSGenerationTimetable>(
+        VSSGenerationTimetable(p / "instance"));
   }
 
   if (import_routes) {
-    this->instance.editable_routes() =
-        RouteMap(p / "instance" / "routes", this->instance.const_n());
+    this->instance.edit().editable_routes() =
+        RouteMap(p / "instance" / "routes", this->instance->const_n());
   }
 
-  if (!this->instance.check_consistency(true)) {
+  if (!this->instance->check_consistency(true)) {
     throw exceptions::ConsistencyException(
         "Imported instance is not consistent");
   }
@@ -415,12 +424,12 @@ cda_rail::instances::SolVSSGenerationTimetable::SolVSSGenerationTimetable(
 
 void cda_rail::instances::SolVSSGenerationTimetable::initialize_vectors() {
   vss_pos = std::vector<std::vector<double>>(
-      this->instance.const_n().number_of_edges());
-  train_pos.reserve(this->instance.get_train_list().size());
-  train_speed.reserve(this->instance.get_train_list().size());
+      this->instance->const_n().number_of_edges());
+  train_pos.reserve(this->instance->get_train_list().size());
+  train_speed.reserve(this->instance->get_train_list().size());
 
-  for (size_t tr = 0; tr < this->instance.get_train_list().size(); ++tr) {
-    const auto tr_interval = this->instance.time_index_interval(tr, dt, true);
+  for (size_t tr = 0; tr < this->instance->get_train_list().size(); ++tr) {
+    const auto tr_interval = this->instance->time_index_interval(tr, dt, true);
     const auto tr_interval_size = tr_interval.second - tr_interval.first + 1;
     train_pos.emplace_back(tr_interval_size, -1);
     train_speed.emplace_back(tr_interval_size, -1);
@@ -430,16 +439,16 @@ void cda_rail::instances::SolVSSGenerationTimetable::initialize_vectors() {
 std::vector<double>
 cda_rail::instances::SolVSSGenerationTimetable::get_valid_border_stops(
     size_t train_id) const {
-  const auto& tr_name  = instance.get_train_list().get_train(train_id).name;
-  const auto& tr_route = instance.get_route(tr_name);
+  const auto& tr_name  = instance->get_train_list().get_train(train_id).name;
+  const auto& tr_route = instance->get_route(tr_name);
   const auto& tr_route_edges = tr_route.get_edges();
 
   std::vector<double> valid_border_stops;
   valid_border_stops.emplace_back(0);
   for (const auto& e : tr_route_edges) {
-    const auto& edge            = instance.const_n().get_edge(e);
-    const auto& e_target        = instance.const_n().get_vertex(edge.target);
-    const auto [e_start, e_end] = tr_route.edge_pos(e, instance.const_n());
+    const auto& edge            = instance->const_n().get_edge(e);
+    const auto& e_target        = instance->const_n().get_vertex(edge.target);
+    const auto [e_start, e_end] = tr_route.edge_pos(e, instance->const_n());
 
     const auto& vss_on_e = get_vss_pos(e);
     for (const auto& vss : vss_on_e) {
@@ -462,12 +471,10 @@ cda_rail::instances::SolVSSGenerationTimetable::get_valid_border_stops(
 cda_rail::instances::SolVSSGenerationTimetable
 cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
     bool postprocess, bool full_model,
-    const std::optional<instances::VSSGenerationTimetable>& old_instance)
-    const {
+    const CopyOnWrite<instances::VSSGenerationTimetable>& old_instance) const {
   PLOGD << "Extracting solution object...";
 
-  auto sol_obj = instances::SolVSSGenerationTimetable(
-      (old_instance.has_value() ? old_instance.value() : instance), dt);
+  auto sol_obj = instances::SolVSSGenerationTimetable(old_instance, dt);
 
   if (const auto grb_status = model->get(GRB_IntAttr_Status);
       full_model && grb_status == GRB_OPTIMAL) {
@@ -511,19 +518,19 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
 
   for (size_t r_e_index = 0; r_e_index < relevant_edges.size(); ++r_e_index) {
     const auto  e_index      = relevant_edges.at(r_e_index);
-    const auto  vss_number_e = instance.const_n().max_vss_on_edge(e_index);
-    const auto& e            = instance.const_n().get_edge(e_index);
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e_index);
+    const auto& e            = instance->const_n().get_edge(e_index);
     const auto  reverse_edge_index =
-        instance.const_n().get_reverse_edge_index(e_index);
+        instance->const_n().get_reverse_edge_index(e_index);
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
       bool b_used = false;
 
       if (vss_model.get_model_type() == vss::ModelType::Continuous) {
         b_used =
-            vars.at("b_used").at(r_e_index, vss).get(GRB_DoubleAttr_X) > 0.5;
+            vars.at(Var::BUsed).at(r_e_index, vss).get(GRB_DoubleAttr_X) > 0.5;
       } else if (vss_model.get_model_type() == vss::ModelType::Inferred) {
         b_used =
-            vars.at("num_vss_segments").at(r_e_index).get(GRB_DoubleAttr_X) >
+            vars.at(Var::NumVssSegments).at(r_e_index).get(GRB_DoubleAttr_X) >
             static_cast<double>(vss) + 1.5;
       } else if (vss_model.get_model_type() == vss::ModelType::InferredAlt) {
         // if any of "type_num_vss_segments"(r_e_index, sep_type_index, num_vss)
@@ -533,7 +540,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
              sep_type_index < vss_model.get_separation_functions().size();
              ++sep_type_index) {
           for (size_t num_vss = vss; num_vss < vss_number_e; ++num_vss) {
-            if (vars.at("type_num_vss_segments")
+            if (vars.at(Var::TypeNumVssSegments)
                     .at(r_e_index, sep_type_index, num_vss)
                     .get(GRB_DoubleAttr_X) > 0.5) {
               b_used = true;
@@ -548,8 +555,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
 
       if (postprocess && b_used) {
         IF_PLOG(plog::debug) {
-          const auto& source = instance.const_n().get_vertex(e.source).name;
-          const auto& target = instance.const_n().get_vertex(e.target).name;
+          const auto& source = instance->const_n().get_vertex(e.source).name;
+          const auto& target = instance->const_n().get_vertex(e.target).name;
           PLOGD << "Postprocessing on " << source << " to " << target;
         }
         b_used = false;
@@ -557,20 +564,20 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
           for (size_t t = train_interval.at(tr).first;
                t <= train_interval.at(tr).second; ++t) {
             const auto front1 =
-                vars.at("b_front")
+                vars.at(Var::BFront)
                     .at(tr, t, breakable_edge_indices.at(e_index), vss)
                     .get(GRB_DoubleAttr_X) > 0.5;
             const auto rear1 =
-                vars.at("b_rear")
+                vars.at(Var::BRear)
                     .at(tr, t, breakable_edge_indices.at(e_index), vss)
                     .get(GRB_DoubleAttr_X) > 0.5;
             const auto front2 =
                 (reverse_edge_index.has_value() &&
                  !instance
-                      .trains_on_edge(reverse_edge_index.value(), fix_routes,
-                                      {tr})
+                      ->trains_on_edge(reverse_edge_index.value(), fix_routes,
+                                       {tr})
                       .empty())
-                    ? vars.at("b_front")
+                    ? vars.at(Var::BFront)
                               .at(tr, t,
                                   breakable_edge_indices.at(
                                       reverse_edge_index.value()),
@@ -580,10 +587,10 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
             const auto rear2 =
                 (reverse_edge_index.has_value() &&
                  !instance
-                      .trains_on_edge(reverse_edge_index.value(), fix_routes,
-                                      {tr})
+                      ->trains_on_edge(reverse_edge_index.value(), fix_routes,
+                                       {tr})
                       .empty())
-                    ? vars.at("b_rear")
+                    ? vars.at(Var::BRear)
                               .at(tr, t,
                                   breakable_edge_indices.at(
                                       reverse_edge_index.value()),
@@ -606,13 +613,13 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
       }
 
       const auto b_pos_val =
-          round_to(vars.at("b_pos")
+          round_to(vars.at(Var::BPos)
                        .at(breakable_edge_indices.at(e_index), vss)
                        .get(GRB_DoubleAttr_X),
                    ROUNDING_PRECISION);
       IF_PLOG(plog::debug) {
-        const auto& source = instance.const_n().get_vertex(e.source).name;
-        const auto& target = instance.const_n().get_vertex(e.target).name;
+        const auto& source = instance->const_n().get_vertex(e.source).name;
+        const auto& target = instance->const_n().get_vertex(e.target).name;
         PLOGD << "Add VSS at " << b_pos_val << " on " << source << " to "
               << target;
       }
@@ -628,15 +635,15 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
     sol_obj.reset_routes();
     PLOGD << "Extracting routes";
     for (size_t tr = 0; tr < num_tr; ++tr) {
-      const auto train = instance.get_train_list().get_train(tr);
+      const auto train = instance->get_train_list().get_train(tr);
       sol_obj.add_empty_route(train.name);
-      size_t current_vertex = instance.get_schedule(tr).get_entry();
+      size_t current_vertex = instance->get_schedule(tr).get_entry();
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
         std::unordered_set<size_t> edge_list;
         for (int e = 0; e < num_edges; ++e) {
           const auto tr_on_edge =
-              vars.at("x").at(tr, t, e).get(GRB_DoubleAttr_X) > 0.5;
+              vars.at(Var::X).at(tr, t, e).get(GRB_DoubleAttr_X) > 0.5;
           if (tr_on_edge &&
               !sol_obj.get_instance().get_route(train.name).contains_edge(e) &&
               edge_list.count(e) == 0) {
@@ -646,9 +653,9 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
         while (!edge_list.empty()) {
           bool edge_added = false;
           for (const auto& e : edge_list) {
-            if (instance.const_n().get_edge(e).source == current_vertex) {
+            if (instance->const_n().get_edge(e).source == current_vertex) {
               sol_obj.push_back_edge_to_route(train.name, e);
-              current_vertex = instance.const_n().get_edge(e).target;
+              current_vertex = instance->const_n().get_edge(e).target;
               edge_list.erase(e);
               edge_added = true;
               break;
@@ -663,27 +670,27 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
   }
 
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto train = instance.get_train_list().get_train(tr);
+    const auto train = instance->get_train_list().get_train(tr);
     for (size_t t = train_interval[tr].first;
          t <= train_interval[tr].second + 1; ++t) {
       const auto train_speed_val =
-          round_to(vars.at("v").at(tr, t).get(GRB_DoubleAttr_X), V_MIN);
+          round_to(vars.at(Var::V).at(tr, t).get(GRB_DoubleAttr_X), V_MIN);
       sol_obj.add_train_speed(tr, static_cast<int>(t) * dt, train_speed_val);
     }
   }
 
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto  train  = instance.get_train_list().get_train(tr);
+    const auto  train  = instance->get_train_list().get_train(tr);
     const auto& tr_len = train.length;
     const auto& r_len  = sol_obj.get_instance().route_length(train.name);
     for (auto t = train_interval[tr].first; t <= train_interval[tr].second;
          ++t) {
       double train_pos = r_len;
       if (fix_routes) {
-        train_pos = vars.at("lda").at(tr, t).get(GRB_DoubleAttr_X);
+        train_pos = vars.at(Var::Lda).at(tr, t).get(GRB_DoubleAttr_X);
       } else {
         const double len_in =
-            round_to(vars.at("len_in").at(tr, t).get(GRB_DoubleAttr_X),
+            round_to(vars.at(Var::LenIn).at(tr, t).get(GRB_DoubleAttr_X),
                      ROUNDING_PRECISION);
         if (len_in > EPS) {
           train_pos = -len_in;
@@ -691,10 +698,10 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
           for (auto e_index :
                sol_obj.get_instance().get_route(train.name).get_edges()) {
             const bool e_used =
-                vars.at("x").at(tr, t, e_index).get(GRB_DoubleAttr_X) > 0.5;
+                vars.at(Var::X).at(tr, t, e_index).get(GRB_DoubleAttr_X) > 0.5;
             if (e_used) {
               const double lda_val =
-                  vars.at("e_lda").at(tr, t, e_index).get(GRB_DoubleAttr_X);
+                  vars.at(Var::ELda).at(tr, t, e_index).get(GRB_DoubleAttr_X);
               const double e_pos = sol_obj.get_instance()
                                        .route_edge_pos(train.name, e_index)
                                        .first;
@@ -715,17 +722,18 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::extract_solution(
     double train_pos_final = -1;
     if (fix_routes) {
       train_pos_final =
-          round_to(vars.at("mu").at(tr, t_final - 1).get(GRB_DoubleAttr_X),
+          round_to(vars.at(Var::Mu).at(tr, t_final - 1).get(GRB_DoubleAttr_X),
                    ROUNDING_PRECISION);
     } else {
       train_pos_final =
           r_len +
-          round_to(vars.at("len_out").at(tr, t_final - 1).get(GRB_DoubleAttr_X),
-                   ROUNDING_PRECISION);
+          round_to(
+              vars.at(Var::LenOut).at(tr, t_final - 1).get(GRB_DoubleAttr_X),
+              ROUNDING_PRECISION);
     }
     if (include_braking_curves) {
       train_pos_final -= round_to(
-          vars.at("brakelen").at(tr, t_final - 1).get(GRB_DoubleAttr_X),
+          vars.at(Var::Brakelen).at(tr, t_final - 1).get(GRB_DoubleAttr_X),
           ROUNDING_PRECISION);
     }
     train_pos_final = round_to(train_pos_final, ROUNDING_PRECISION);
@@ -1,16 +1,24 @@
 #include "solver/mip-based/GenPOMovingBlockMIPSolver.hpp"
 
+#include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "EOMHelper.hpp"
 #include "MultiArray.hpp"
+#include "ThreadPool.hpp"
 #include "gurobi_c++.h"
 #include "solver/mip-based/GeneralMIPSolver.hpp"
+#include "solver/mip-based/ModelBatch.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <queue>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -37,57 +45,139 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::solve(
    * @return: respective solution object
    */
 
+  const bool reuse_model = can_reuse_model(
+      model_detail_input, solver_strategy_input, solution_settings_input);
+  if (!reuse_model && model.has_value()) {
+    PLOGD << "Discard persistent model";
+    cleanup();
+  }
+
   std::optional<LazyCallback> cb;
   if (solver_strategy_input.use_lazy_constraints) {
     cb = LazyCallback(this);
-    this->solve_init_general_mip(time_limit, debug_input, &(cb.value()));
+    this->solve_init_general_mip(time_limit, debug_input, &(cb.value()),
+                                 reuse_model);
   } else {
-    this->solve_init_general_mip(time_limit, debug_input);
+    this->solve_init_general_mip(time_limit, debug_input, message_callback(),
+                                 reuse_model);
   }
 
-  if (!instance.n().is_consistent_for_transformation()) {
+  if (!instance->const_n().is_consistent_for_transformation()) {
     PLOGE << "Instance is not consistent for transformation.";
     throw exceptions::ConsistencyException();
   }
 
   PLOGI << "Create model";
 
-  const instances::GeneralPerformanceOptimizationInstance old_instance =
-      instance;
-  this->instance.discretize_stops();
+  // Shares the instance, discretizing the stops works on a copy that is
+  // reused by subsequent solves
+  const auto old_instance = instance;
+  telemetry.measure("discretize_stops", [this]() {
+    preprocess_instance(
+        "discretize_stops",
+        [](instances::GeneralPerformanceOptimizationInstance& inst) {
+          inst.discretize_stops();
+        });
+  });
+
+  if (reuse_model) {
+    PLOGI << "Update persistent model";
+    this->solution_settings = solution_settings_input;
+    this->solver_strategy   = solver_strategy_input;
+    telemetry.measure("update_persistent_model",
+                      [this]() { update_persistent_model(); });
+  } else {
+    this->initialize_variables(solution_settings_input, solver_strategy_input,
+                               model_detail_input);
 
-  this->initialize_variables(solution_settings_input, solver_strategy_input,
-                             model_detail_input);
+    PLOGD << "Create variables";
+    create_variables();
+    PLOGD << "Set objective";
+    telemetry.measure("set_objective", [this]() { set_objective(); });
+    PLOGD << "Create constraints";
+    create_constraints();
 
-  PLOGD << "Create variables";
-  create_variables();
-  PLOGD << "Set objective";
-  set_objective();
-  PLOGD << "Create constraints";
-  create_constraints();
+    telemetry.measure("update_model", [this]() { model->update(); });
 
-  model->update();
+    if (solver_strategy.use_lazy_constraints) {
+      telemetry.measure("fill_callback_solution",
+                        [this]() { fill_callback_solution(); });
+    }
+  }
+
+  if (solver_strategy.use_lazy_constraints) {
+    lazy_callback_profile.clear();
+  }
 
-  PLOGD << "Fix numerical issues with small coefficients";
-  // TODO: Can we prevent this from being necessary by rounding at the source.
-  // On the other hand, this does not take long to fix.
-  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-  size_t       num_fixed   = 0;
-  const double integer_tol = model->getEnv().get(GRB_DoubleParam_IntFeasTol);
-  auto*        vars_tmp    = model->getVars();
-  const int    num_vars    = model->get(GRB_IntAttr_NumVars);
-  for (size_t i = 0; i < num_vars; i++) {
-    auto col_v = model->getCol(vars_tmp[i]);
-    for (size_t j = 0; j < col_v.size(); j++) {
-      if (std::abs(col_v.getCoeff(j)) < integer_tol && col_v.getCoeff(j) != 0) {
-        auto c = col_v.getConstr(j);
-        model->chgCoeff(c, vars_tmp[i], 0);
-        num_fixed++;
+  // Lazy cuts contain big-M values and travel times of the instance, hence,
+  // they are only transferred if neither the instance nor the model detail
+  // have changed since they were separated
+  const bool same_cut_problem =
+      lazy_cut_pool_source.has_value() &&
+      lazy_cut_pool_source->first.shares_with(old_instance) &&
+      lazy_cut_pool_source->second == model_detail;
+  if (!reuse_model) {
+    // The constraints belonged to the previous model
+    promoted_lazy_constrs.clear();
+  } else if (!same_cut_problem && !promoted_lazy_constrs.empty()) {
+    for (const auto& constr : promoted_lazy_constrs) {
+      model->remove(constr);
+    }
+    promoted_lazy_constrs.clear();
+    model->update();
+  }
+
+  if (solver_strategy.use_lazy_constraints &&
+      solver_strategy.use_lazy_cut_pool) {
+    // Reuse the cuts of previous solves of the same problem. Cuts promoted on
+    // a reused model are still part of it and are not added again.
+    lazy_cut_pool.attach(model.value(), same_cut_problem,
+                         reuse_model && same_cut_problem);
+    lazy_cut_pool_source.emplace(old_instance, model_detail);
+    const auto promoted_cuts =
+        lazy_cut_pool.promote(solver_strategy.lazy_cut_promotion_threshold);
+    if (!promoted_cuts.empty()) {
+      PLOGD << "Add " << promoted_cuts.size()
+            << " frequently violated lazy constraints as static constraints";
+      promoted_lazy_constrs.reserve(promoted_lazy_constrs.size() +
+                                    promoted_cuts.size());
+      for (const auto* cut : promoted_cuts) {
+        promoted_lazy_constrs.push_back(model->addConstr(
+            cut->to_temp_constr(),
+            name("promoted_lazy_", promoted_lazy_constrs.size())));
       }
+      model->update();
     }
   }
-  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-  PLOGD << "Fixed " << num_fixed << " coefficients";
+
+  if (!reuse_model) {
+    PLOGD << "Fix numerical issues with small coefficients";
+    // TODO: Can we prevent this from being necessary by rounding at the
+    // source. On the other hand, this does not take long to fix.
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto num_fixed =
+        telemetry.measure("fix_small_coefficients", [this]() {
+          size_t       num_changed = 0;
+          const double integer_tol =
+              model->getEnv().get(GRB_DoubleParam_IntFeasTol);
+          auto*     vars_tmp = model->getVars();
+          const int num_vars = model->get(GRB_IntAttr_NumVars);
+          for (size_t i = 0; i < num_vars; i++) {
+            auto col_v = model->getCol(vars_tmp[i]);
+            for (size_t j = 0; j < col_v.size(); j++) {
+              if (std::abs(col_v.getCoeff(j)) < integer_tol &&
+                  col_v.getCoeff(j) != 0) {
+                auto c = col_v.getConstr(j);
+                model->chgCoeff(c, vars_tmp[i], 0);
+                num_changed++;
+              }
+            }
+          }
+          return num_changed;
+        });
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    PLOGD << "Fixed " << num_fixed << " coefficients";
+  }
 
   PLOGI << "Model created. Optimize.";
   if (plog::get()->checkSeverity(plog::debug) || time_limit > 0) {
@@ -120,7 +210,7 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::solve(
   PLOGD << "Set absolute MIP gap to " << solver_strategy.abs_mip_gap;
   model->set(GRB_DoubleParam_MIPGapAbs, solver_strategy.abs_mip_gap);
 
-  model->optimize();
+  telemetry.measure("optimize", [this]() { model->optimize(); });
 
   IF_PLOG(plog::debug) {
     model_solved = std::chrono::high_resolution_clock::now();
@@ -135,8 +225,19 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::solve(
           << (static_cast<double>(create_time + solve_time) / 1000.0) << " s";
   }
 
-  instances::SolGeneralPerformanceOptimizationInstance solution(old_instance);
-  extract_solution(solution);
+  if (solver_strategy.use_lazy_constraints) {
+    lazy_callback_profile.log_summary();
+  }
+
+  instances::SolGeneralPerformanceOptimizationInstance<
+      instances::GeneralPerformanceOptimizationInstance>
+      solution(old_instance);
+  telemetry.measure("extract_solution",
+                    [this, &solution]() { extract_solution(solution); });
+  if (solver_strategy.persistent_model) {
+    telemetry.measure("set_warm_start", [this]() { set_warm_start(); });
+  }
+  solution.set_telemetry(telemetry);
 
   if (solution_settings.export_option == ExportOption::ExportLP ||
       solution_settings.export_option == ExportOption::ExportSolutionAndLP ||
@@ -157,7 +258,7 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::solve(
 
     PLOGD << "Add " << lazy_constraints.size() << " lazy constraints";
     for (size_t i = 0; i < lazy_constraints.size(); i++) {
-      model->addConstr(lazy_constraints.at(i), "Lazy" + std::to_string(i));
+      model->addConstr(lazy_constraints.at(i), name("Lazy", i));
     }
     model->update();
 
@@ -181,108 +282,312 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::solve(
     solution.export_solution(path, export_instance);
   }
 
-  cleanup();
+  if (solver_strategy.use_lazy_constraints &&
+      solution_settings.export_lazy_callback_profile) {
+    PLOGI << "Saving lazy callback profile";
+    std::vector<std::string> train_names;
+    train_names.reserve(num_tr);
+    for (size_t tr = 0; tr < num_tr; tr++) {
+      train_names.push_back(instance->get_train_list().get_train(tr).name);
+    }
+    lazy_callback_profile.export_profile(
+        std::filesystem::path(solution_settings.path) / solution_settings.name,
+        train_names);
+  }
+
+  if (solver_strategy.use_lazy_constraints &&
+      solver_strategy.use_lazy_cut_pool) {
+    PLOGD << "Lazy cut pool contains " << lazy_cut_pool.size()
+          << " groups of cuts";
+    lazy_cut_pool.detach();
+  }
+
+  if (solver_strategy.persistent_model) {
+    // The callback is destroyed at the end of this function
+    model->setCallback(message_callback());
+    if (!persistent_model.has_value()) {
+      persistent_model = PersistentModel{old_instance, {}, false, {}};
+      persistent_model->t_bounds.reserve(num_tr);
+      for (size_t tr = 0; tr < num_tr; tr++) {
+        persistent_model->t_bounds.push_back(
+            instance->get_schedule(tr).get_t_n_range().second);
+      }
+    }
+    persistent_model->source            = old_instance;
+    persistent_model->objective_changed = false;
+    persistent_model->time_window_changed.assign(num_tr, false);
+  } else {
+    cleanup();
+  }
 
   this->instance = old_instance;
 
   return solution;
 }
 
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::can_reuse_model(
+    const ModelDetail&                 model_detail_input,
+    const SolverStrategyMovingBlock&   solver_strategy_input,
+    const SolutionSettingsMovingBlock& solution_settings_input) const {
+  /**
+   * Checks if the persistent model of the previous solve can be updated
+   * instead of being rebuilt, i.e., if the instance has only been modified
+   * using the respective functions of the solver, no time window has been
+   * extended beyond the bounds the model was built with, and the structure of
+   * the model is unchanged.
+   */
+
+  if (!persistent_model.has_value() || !model.has_value() ||
+      !solver_strategy_input.persistent_model ||
+      !persistent_model->source.shares_with(instance)) {
+    return false;
+  }
+  if (model_detail_input != model_detail ||
+      solver_strategy_input.use_lazy_constraints !=
+          solver_strategy.use_lazy_constraints ||
+      (!solution_settings_input.anonymous_model ||
+       exports_lp(solution_settings_input.export_option)) != use_names) {
+    return false;
+  }
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    if (instance->get_schedule(tr).get_t_n_range().second >
+        persistent_model->t_bounds.at(tr)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
+    update_persistent_model() {
+  /**
+   * Applies the recorded changes of train weights and time windows to the
+   * persistent model. The big-M values of the model are kept, since they are
+   * still valid for smaller time windows.
+   */
+
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    if (!persistent_model->time_window_changed.at(tr)) {
+      continue;
+    }
+    const auto& tr_schedule = instance->get_schedule(tr);
+    const auto& t0_range    = tr_schedule.get_t_0_range();
+    const auto& tn_range    = tr_schedule.get_t_n_range();
+    auto&       constrs     = time_window_constrs.at(tr);
+    constrs.at(0).set(GRB_DoubleAttr_RHS, t0_range.first);
+    constrs.at(1).set(GRB_DoubleAttr_RHS, t0_range.second);
+    constrs.at(2).set(GRB_DoubleAttr_RHS, tn_range.first);
+    constrs.at(3).set(GRB_DoubleAttr_RHS, tn_range.second);
+  }
+
+  if (std::find(persistent_model->time_window_changed.begin(),
+                persistent_model->time_window_changed.end(),
+                true) != persistent_model->time_window_changed.end()) {
+    // The derived bounds may be tightened or loosened again
+    fill_time_windows();
+    set_time_window_bounds();
+  }
+
+  if (persistent_model->objective_changed) {
+    set_objective();
+  }
+
+  model->update();
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::set_warm_start() {
+  /**
+   * Uses the best solution found, if any, as start of the next solve of the
+   * persistent model.
+   */
+
+  if (model->get(GRB_IntAttr_SolCount) == 0) {
+    return;
+  }
+  const int                       num_vars = model->get(GRB_IntAttr_NumVars);
+  const std::unique_ptr<GRBVar[]> model_vars(model->getVars());
+  const std::unique_ptr<double[]> values(
+      model->get(GRB_DoubleAttr_X, model_vars.get(), num_vars));
+  model->set(GRB_DoubleAttr_Start, model_vars.get(), values.get(), num_vars);
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::set_train_weight(
+    size_t tr, double weight) {
+  /**
+   * Changes the weight of a train in the objective.
+   *
+   * @param tr Index of the train
+   * @param weight New weight of the train
+   */
+
+  // The weights are not part of any lazy cut
+  const bool pool_represented =
+      lazy_cut_pool_source.has_value() &&
+      lazy_cut_pool_source->first.shares_with(instance);
+  modify_persistent_instance(
+      [tr, weight](instances::GeneralPerformanceOptimizationInstance& inst) {
+        inst.set_train_weight(tr, weight);
+      });
+  if (pool_represented) {
+    lazy_cut_pool_source->first = instance;
+  }
+  if (persistent_model.has_value()) {
+    persistent_model->objective_changed = true;
+  }
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::set_t_0_range(
+    size_t tr, const std::pair<int, int>& t_0_range) {
+  /**
+   * Changes the time window in which a train enters the network.
+   *
+   * @param tr Index of the train
+   * @param t_0_range Earliest and latest entry time
+   */
+
+  modify_persistent_instance(
+      [tr,
+       &t_0_range](instances::GeneralPerformanceOptimizationInstance& inst) {
+        inst.editable_schedule(tr).set_t_0_range(t_0_range);
+      });
+  if (persistent_model.has_value()) {
+    persistent_model->time_window_changed.at(tr) = true;
+  }
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::set_t_n_range(
+    size_t tr, const std::pair<int, int>& t_n_range) {
+  /**
+   * Changes the time window in which a train leaves the network. The lower
+   * bound is part of the objective. If the upper bound exceeds the one the
+   * persistent model was built with, the model is rebuilt by the next solve.
+   *
+   * @param tr Index of the train
+   * @param t_n_range Earliest and latest exit time
+   */
+
+  modify_persistent_instance(
+      [tr,
+       &t_n_range](instances::GeneralPerformanceOptimizationInstance& inst) {
+        inst.editable_schedule(tr).set_t_n_range(t_n_range);
+      });
+  if (persistent_model.has_value()) {
+    persistent_model->time_window_changed.at(tr) = true;
+    persistent_model->objective_changed          = true;
+  }
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
+    discard_persistent_model() {
+  if (model.has_value()) {
+    cleanup();
+  }
+}
+
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_variables() {
-  create_timing_variables();
-  create_general_edge_variables();
-  create_velocity_extended_variables();
-  create_stop_variables();
-  create_reverse_edge_variables();
+  telemetry.measure("create_timing_variables",
+                    [this]() { create_timing_variables(); });
+  telemetry.measure("create_general_edge_variables",
+                    [this]() { create_general_edge_variables(); });
+  telemetry.measure("create_velocity_extended_variables",
+                    [this]() { create_velocity_extended_variables(); });
+  telemetry.measure("create_stop_variables",
+                    [this]() { create_stop_variables(); });
+  telemetry.measure("create_reverse_edge_variables",
+                    [this]() { create_reverse_edge_variables(); });
+  telemetry.measure("set_time_window_bounds",
+                    [this]() { set_time_window_bounds(); });
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_timing_variables() {
-  vars["t_front_arrival"]   = MultiArray<GRBVar>(num_tr, num_vertices);
-  vars["t_front_departure"] = MultiArray<GRBVar>(num_tr, num_vertices);
-  vars["t_rear_departure"]  = MultiArray<GRBVar>(num_tr, num_vertices);
-  vars["t_ttd_departure"]   = MultiArray<GRBVar>(num_tr, num_ttd);
-
+  auto& t_front_arrival   = vars.get<Var::TFrontArrival>();
+  auto& t_front_departure = vars.get<Var::TFrontDeparture>();
+  auto& t_rear_departure  = vars.get<Var::TRearDeparture>();
+  auto& t_ttd_departure   = vars.get<Var::TTtdDeparture>();
+  t_front_arrival   = FixedRankMultiArray<GRBVar, 2>(num_tr, num_vertices);
+  t_front_departure = FixedRankMultiArray<GRBVar, 2>(num_tr, num_vertices);
+  t_rear_departure  = FixedRankMultiArray<GRBVar, 2>(num_tr, num_vertices);
+  t_ttd_departure   = FixedRankMultiArray<GRBVar, 2>(num_tr, num_ttd);
+
+  VariableBatch batch(*model);
   for (size_t tr = 0; tr < num_tr; tr++) {
     const double ub_timing_dept = ub_timing_variable(tr);
-    const auto&  tr_name        = instance.get_train_list().get_train(tr).name;
+    const auto&  tr_name        = instance->get_train_list().get_train(tr).name;
     for (const auto v :
-         instance.vertices_used_by_train(tr, model_detail.fix_routes, false)) {
-      const auto& v_name = instance.const_n().get_vertex(v).name;
-      vars["t_front_arrival"](tr, v) =
-          model->addVar(0.0, ub_timing_dept, 0.0, GRB_CONTINUOUS,
-                        "t_front_arrival_" + tr_name + "_" + v_name);
-      vars["t_front_departure"](tr, v) =
-          model->addVar(0.0, ub_timing_dept, 0.0, GRB_CONTINUOUS,
-                        "t_front_departure_" + tr_name + "_" + v_name);
-      vars["t_rear_departure"](tr, v) =
-          model->addVar(0.0, ub_timing_dept, 0.0, GRB_CONTINUOUS,
-                        "t_rear_departure_" + tr_name + "_" + v_name);
+         instance->vertices_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& v_name = instance->const_n().get_vertex(v).name;
+      batch.add(t_front_arrival(tr, v), 0.0, ub_timing_dept, 0.0,
+                GRB_CONTINUOUS, name("t_front_arrival_", tr_name, "_", v_name));
+      batch.add(t_front_departure(tr, v), 0.0, ub_timing_dept, 0.0,
+                GRB_CONTINUOUS,
+                name("t_front_departure_", tr_name, "_", v_name));
+      batch.add(t_rear_departure(tr, v), 0.0, ub_timing_dept, 0.0,
+                GRB_CONTINUOUS,
+                name("t_rear_departure_", tr_name, "_", v_name));
     }
-    for (const auto& ttd : instance.sections_used_by_train(
+    for (const auto& ttd : instance->sections_used_by_train(
              tr, ttd_sections, model_detail.fix_routes, false)) {
-      vars["t_ttd_departure"](tr, ttd) = model->addVar(
-          0.0, ub_timing_dept, 0.0, GRB_CONTINUOUS,
-          "t_ttd_departure_" + tr_name + "_" + std::to_string(ttd));
+      batch.add(t_ttd_departure(tr, ttd), 0.0, ub_timing_dept, 0.0,
+                GRB_CONTINUOUS, name("t_ttd_departure_", tr_name, "_", ttd));
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_general_edge_variables() {
-  vars["x"]         = MultiArray<GRBVar>(num_tr, num_edges);
-  vars["order"]     = MultiArray<GRBVar>(num_tr, num_tr, num_edges);
-  vars["x_ttd"]     = MultiArray<GRBVar>(num_tr, num_ttd);
-  vars["order_ttd"] = MultiArray<GRBVar>(num_tr, num_tr, num_ttd);
+  vars.get<Var::X>()    = FixedRankMultiArray<GRBVar, 2>(num_tr, num_edges);
+  vars[Var::Order]      = MultiArray<GRBVar>::sparse(num_tr, num_tr, num_edges);
+  vars.get<Var::XTtd>() = FixedRankMultiArray<GRBVar, 2>(num_tr, num_ttd);
+  vars[Var::OrderTtd]   = MultiArray<GRBVar>::sparse(num_tr, num_tr, num_ttd);
 
+  VariableBatch batch(*model);
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
     for (const auto e :
-         instance.edges_used_by_train(tr, model_detail.fix_routes, false)) {
-      vars["x"](tr, e) = model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                                       "x_" + tr_name + "_" +
-                                           instance.const_n().get_edge_name(e));
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      batch.add(vars.get<Var::X>()(tr, e), 0.0, 1.0, 0.0, GRB_BINARY,
+                name("x_", tr_name, "_", instance->const_n().get_edge_name(e)));
     }
-    for (const auto& ttd : instance.sections_used_by_train(
+    for (const auto& ttd : instance->sections_used_by_train(
              tr, ttd_sections, model_detail.fix_routes, false)) {
-      vars["x_ttd"](tr, ttd) =
-          model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                        "x_ttd_" + tr_name + "_" + std::to_string(ttd));
+      batch.add(vars.get<Var::XTtd>()(tr, ttd), 0.0, 1.0, 0.0, GRB_BINARY,
+                name("x_ttd_", tr_name, "_", ttd));
     }
   }
   for (size_t e = 0; e < num_edges; e++) {
-    const auto tr_on_e = instance.trains_on_edge_mixed_routing(
+    const auto tr_on_e = instance->trains_on_edge_mixed_routing(
         e, model_detail.fix_routes, false);
-    const auto& e_name = instance.const_n().get_edge_name(e);
+    const auto& e_name = instance->const_n().get_edge_name(e);
     for (const auto& tr1 : tr_on_e) {
-      const auto& tr1_name = instance.get_train_list().get_train(tr1).name;
+      const auto& tr1_name = instance->get_train_list().get_train(tr1).name;
       for (const auto& tr2 : tr_on_e) {
         if (tr1 != tr2) {
-          const auto& tr2_name = instance.get_train_list().get_train(tr2).name;
-          vars["order"](tr1, tr2, e) = model->addVar(
-              0.0, 1.0, 0.0, GRB_BINARY,
-              "order_" + tr1_name + "_" + tr2_name + "_" + e_name);
+          const auto& tr2_name = instance->get_train_list().get_train(tr2).name;
+          batch.add(vars[Var::Order](tr1, tr2, e), 0.0, 1.0, 0.0, GRB_BINARY,
+                    name("order_", tr1_name, "_", tr2_name, "_", e_name));
         }
       }
     }
   }
   for (size_t ttd = 0; ttd < num_ttd; ttd++) {
-    const auto tr_on_ttd = instance.trains_in_section(
+    const auto tr_on_ttd = instance->trains_in_section(
         ttd_sections.at(ttd), model_detail.fix_routes, false);
     for (const auto& tr1 : tr_on_ttd) {
-      const auto& tr1_name = instance.get_train_list().get_train(tr1).name;
+      const auto& tr1_name = instance->get_train_list().get_train(tr1).name;
       for (const auto& tr2 : tr_on_ttd) {
         if (tr1 != tr2) {
-          const auto& tr2_name = instance.get_train_list().get_train(tr2).name;
-          vars["order_ttd"](tr1, tr2, ttd) =
-              model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                            "order_ttd_" + tr1_name + "_" + tr2_name + "_" +
-                                std::to_string(ttd));
+          const auto& tr2_name = instance->get_train_list().get_train(tr2).name;
+          batch.add(vars[Var::OrderTtd](tr1, tr2, ttd), 0.0, 1.0, 0.0,
+                    GRB_BINARY,
+                    name("order_ttd_", tr1_name, "_", tr2_name, "_", ttd));
         }
       }
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
@@ -290,65 +595,60 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
   size_t max_num_stops = 0;
   for (size_t tr = 0; tr < num_tr; tr++) {
     max_num_stops =
-        std::max(max_num_stops, instance.get_schedule(tr).get_stops().size());
+        std::max(max_num_stops, instance->get_schedule(tr).get_stops().size());
   }
-  vars["stop"] = MultiArray<GRBVar>(num_tr, max_num_stops, num_vertices);
+  vars[Var::Stop] =
+      MultiArray<GRBVar>::sparse(num_tr, max_num_stops, num_vertices);
 
+  VariableBatch batch(*model);
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
-    for (size_t stop = 0; stop < instance.get_schedule(tr).get_stops().size();
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
+    for (size_t stop = 0; stop < instance->get_schedule(tr).get_stops().size();
          stop++) {
       const auto& stop_name =
-          instance.get_schedule(tr).get_stops().at(stop).get_station_name();
+          instance->get_schedule(tr).get_stops().at(stop).get_station_name();
       const auto& stop_data = tr_stop_data.at(tr).at(stop);
       for (const auto& [v, edges] : stop_data) {
-        vars["stop"](tr, stop, v) =
-            model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                          "stop_" + tr_name + "_" + stop_name + "_" +
-                              instance.const_n().get_vertex(v).name);
+        batch.add(vars[Var::Stop](tr, stop, v), 0.0, 1.0, 0.0, GRB_BINARY,
+                  name("stop_", tr_name, "_", stop_name, "_",
+                       instance->const_n().get_vertex(v).name));
       }
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_velocity_extended_variables() {
   const auto max_velocity_extension_size =
       get_maximal_velocity_extension_size();
-  vars["y"] = MultiArray<GRBVar>(num_tr, num_edges, max_velocity_extension_size,
+  // Only few velocity pairs are possible on every edge, hence, sparse storage
+  vars[Var::Y] =
+      MultiArray<GRBVar>::sparse(num_tr, num_edges, max_velocity_extension_size,
                                  max_velocity_extension_size);
 
+  VariableBatch batch(*model);
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& train = instance.get_train_list().get_train(tr);
+    const auto& train = instance->get_train_list().get_train(tr);
     for (const auto e :
-         instance.edges_used_by_train(tr, model_detail.fix_routes, false)) {
-      const auto& edge = instance.const_n().get_edge(e);
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& edge = instance->const_n().get_edge(e);
       const auto& edge_name =
-          instance.const_n().get_edge_name(edge.source, edge.target);
-      const auto& v_1           = velocity_extensions.at(tr).at(edge.source);
-      const auto& v_2           = velocity_extensions.at(tr).at(edge.target);
-      const auto  tmp_max_speed = std::min(train.max_speed, edge.max_speed);
+          instance->const_n().get_edge_name(edge.source, edge.target);
+      const auto& v_1 = velocity_extensions.at(tr).at(edge.source);
+      const auto& v_2 = velocity_extensions.at(tr).at(edge.target);
       for (size_t i = 0; i < v_1.size(); i++) {
-        if (v_1.at(i) > tmp_max_speed) {
-          continue;
-        }
         for (size_t j = 0; j < v_2.size(); j++) {
-          if (v_2.at(j) > tmp_max_speed) {
-            continue;
-          }
-          if (cda_rail::possible_by_eom(v_1.at(i), v_2.at(j),
-                                        train.acceleration, train.deceleration,
-                                        edge.length)) {
-            vars["y"](tr, e, i, j) =
-                model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                              "y_" + train.name + "_" + edge_name + "_" +
-                                  std::to_string(v_1.at(i)) + "_" +
-                                  std::to_string(v_2.at(j)));
+          if (eom_table_entry(tr, e, i, j).possible) {
+            batch.add(vars[Var::Y](tr, e, i, j), 0.0, 1.0, 0.0, GRB_BINARY,
+                      name("y_", train.name, "_", edge_name, "_", v_1.at(i),
+                           "_", v_2.at(j)));
           }
         }
       }
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
@@ -357,30 +657,107 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
    * In order to prevent collisions of trains traveling in opposite directions,
    * we need additional variables.
    */
-  vars["reverse_order"] =
-      MultiArray<GRBVar>(num_tr, num_tr, relevant_reverse_edges.size());
+  vars[Var::ReverseOrder] =
+      MultiArray<GRBVar>::sparse(num_tr, num_tr, relevant_reverse_edges.size());
 
+  VariableBatch batch(*model);
   for (size_t idx = 0; idx < relevant_reverse_edges.size(); idx++) {
     const auto& [e1, e2] = relevant_reverse_edges.at(idx);
     const auto tr_list =
-        instance.trains_in_section({e1, e2}, model_detail.fix_routes, false);
-    const auto  e_obj   = instance.const_n().get_edge(e1);
-    const auto& v1_name = instance.const_n().get_vertex(e_obj.source).name;
-    const auto& v2_name = instance.const_n().get_vertex(e_obj.target).name;
+        instance->trains_in_section({e1, e2}, model_detail.fix_routes, false);
+    const auto  e_obj   = instance->const_n().get_edge(e1);
+    const auto& v1_name = instance->const_n().get_vertex(e_obj.source).name;
+    const auto& v2_name = instance->const_n().get_vertex(e_obj.target).name;
     for (size_t idx_tr1 = 0; idx_tr1 < tr_list.size(); idx_tr1++) {
       const auto  tr1      = tr_list.at(idx_tr1);
-      const auto& tr1_name = instance.get_train_list().get_train(tr1).name;
+      const auto& tr1_name = instance->get_train_list().get_train(tr1).name;
       for (size_t idx_tr2 = idx_tr1 + 1; idx_tr2 < tr_list.size(); idx_tr2++) {
         const auto  tr2      = tr_list.at(idx_tr2);
-        const auto& tr2_name = instance.get_train_list().get_train(tr2).name;
-        vars["reverse_order"](tr1, tr2, idx) =
-            model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                          "reverse_order_" + tr1_name + "_" + tr2_name + "_" +
-                              v1_name + "-" + v2_name);
-        vars["reverse_order"](tr2, tr1, idx) =
-            model->addVar(0.0, 1.0, 0.0, GRB_BINARY,
-                          "reverse_order_" + tr2_name + "_" + tr1_name + "_" +
-                              v1_name + "-" + v2_name);
+        const auto& tr2_name = instance->get_train_list().get_train(tr2).name;
+        batch.add(vars[Var::ReverseOrder](tr1, tr2, idx), 0.0, 1.0, 0.0,
+                  GRB_BINARY,
+                  name("reverse_order_", tr1_name, "_", tr2_name, "_",
+                       v1_name, "-", v2_name));
+        batch.add(vars[Var::ReverseOrder](tr2, tr1, idx), 0.0, 1.0, 0.0,
+                  GRB_BINARY,
+                  name("reverse_order_", tr2_name, "_", tr1_name, "_",
+                       v1_name, "-", v2_name));
+      }
+    }
+  }
+  batch.submit();
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
+    set_time_window_bounds() {
+  /**
+   * Tightens the bounds of the variables using the time windows of the trains
+   * at every vertex. The timing variables of the front are restricted to the
+   * respective window, edges a train cannot traverse within its windows are
+   * excluded, and so are orders that would violate the vertex headways. Since
+   * only bounds are changed, they can be updated if the time windows of the
+   * persistent model change. The bounds are reset if a window is empty, e.g.,
+   * of vertices a train cannot reach at all.
+   */
+
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    const double ub_timing_dept = ub_timing_variable(tr);
+    for (const auto v :
+         instance->vertices_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& [earliest, latest] = time_windows.at(tr).at(v);
+      const auto lb = earliest <= latest ? earliest : 0.0;
+      const auto ub = earliest <= latest ? latest : ub_timing_dept;
+      for (auto* var : {&vars.get<Var::TFrontArrival>()(tr, v),
+                        &vars.get<Var::TFrontDeparture>()(tr, v)}) {
+        var->set(GRB_DoubleAttr_LB, lb);
+        var->set(GRB_DoubleAttr_UB, ub);
+      }
+      vars.get<Var::TRearDeparture>()(tr, v).set(GRB_DoubleAttr_UB,
+                                                 ub_timing_dept);
+    }
+    for (const auto& ttd : instance->sections_used_by_train(
+             tr, ttd_sections, model_detail.fix_routes, false)) {
+      vars.get<Var::TTtdDeparture>()(tr, ttd).set(GRB_DoubleAttr_UB,
+                                                  ub_timing_dept);
+    }
+
+    for (const auto e :
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& edge      = instance->const_n().get_edge(e);
+      const bool  reachable =
+          time_windows.at(tr).at(edge.source).first +
+              min_edge_travel_times.at(tr).at(e) <=
+          time_windows.at(tr).at(edge.target).second + GRB_EPS;
+      vars.get<Var::X>()(tr, e).set(GRB_DoubleAttr_UB, reachable ? 1.0 : 0.0);
+    }
+  }
+
+  if (solver_strategy.use_lazy_constraints) {
+    // Orders are only bounded by vertex headways if these are no lazy
+    // constraints
+    return;
+  }
+
+  // If tr1 follows tr2 on an edge, the front of tr1 reaches both vertices of
+  // the edge only after the rear of tr2 left them plus the vertex headway
+  const auto order_possible = [this](size_t tr1, size_t tr2, size_t v) {
+    return time_windows.at(tr1).at(v).second + GRB_EPS >=
+           time_windows.at(tr2).at(v).first +
+               instance->const_n().get_vertex(v).headway;
+  };
+  for (size_t e = 0; e < num_edges; e++) {
+    const auto tr_on_e = instance->trains_on_edge_mixed_routing(
+        e, model_detail.fix_routes, false);
+    const auto& edge = instance->const_n().get_edge(e);
+    for (const auto& tr1 : tr_on_e) {
+      for (const auto& tr2 : tr_on_e) {
+        if (tr1 == tr2) {
+          continue;
+        }
+        const bool possible = order_possible(tr1, tr2, edge.source) &&
+                              order_possible(tr1, tr2, edge.target);
+        vars[Var::Order].at(tr1, tr2, e).set(GRB_DoubleAttr_UB,
+                                          possible ? 1.0 : 0.0);
       }
     }
   }
@@ -390,13 +767,14 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::set_objective() {
   GRBLinExpr obj_expr      = 0;
   double     tr_weight_sum = 0;
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto  exit_node     = instance.get_schedule(tr).get_exit();
-    const auto& min_exit_time = instance.get_schedule(tr).get_t_n_range().first;
-    const auto& tr_weight     = instance.get_train_weight(tr);
+    const auto  exit_node = instance->get_schedule(tr).get_exit();
+    const auto& min_exit_time =
+        instance->get_schedule(tr).get_t_n_range().first;
+    const auto& tr_weight = instance->get_train_weight(tr);
     tr_weight_sum += tr_weight;
 
-    obj_expr +=
-        tr_weight * (vars["t_rear_departure"](tr, exit_node) - min_exit_time);
+    obj_expr += tr_weight * (vars.get<Var::TRearDeparture>()(tr, exit_node) -
+                             min_exit_time);
   }
   obj_expr /= tr_weight_sum;
   model->setObjective(obj_expr, GRB_MINIMIZE);
@@ -405,28 +783,38 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::set_objective() {
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_constraints() {
   PLOGD << "Create general path constraints";
-  create_general_path_constraints();
+  telemetry.measure("create_general_path_constraints",
+                    [this]() { create_general_path_constraints(); });
   PLOGD << "Create travel times constraints";
-  create_travel_times_constraints();
+  telemetry.measure("create_travel_times_constraints",
+                    [this]() { create_travel_times_constraints(); });
   PLOGD << "Create basic TTD constraints";
-  create_basic_ttd_constraints();
+  telemetry.measure("create_basic_ttd_constraints",
+                    [this]() { create_basic_ttd_constraints(); });
   PLOGD << "Create train rear constraints";
-  create_train_rear_constraints();
+  telemetry.measure("create_train_rear_constraints",
+                    [this]() { create_train_rear_constraints(); });
   PLOGD << "Create stopping constraints";
-  create_stopping_constraints();
+  telemetry.measure("create_stopping_constraints",
+                    [this]() { create_stopping_constraints(); });
   if (!solver_strategy.use_lazy_constraints) {
     PLOGD << "Create basic order constraints";
-    create_basic_order_constraints();
+    telemetry.measure("create_basic_order_constraints",
+                      [this]() { create_basic_order_constraints(); });
     PLOGD << "Create vertex headway constraints";
-    create_vertex_headway_constraints();
+    telemetry.measure("create_vertex_headway_constraints",
+                      [this]() { create_vertex_headway_constraints(); });
     PLOGD << "Create reverse edge constraints";
-    create_reverse_edge_constraints();
+    telemetry.measure("create_reverse_edge_constraints",
+                      [this]() { create_reverse_edge_constraints(); });
     if (this->model_detail.simplify_headway_constraints) {
       PLOGD << "Create simplified headway constraints";
-      create_simplified_headway_constraints();
+      telemetry.measure("create_simplified_headway_constraints",
+                        [this]() { create_simplified_headway_constraints(); });
     } else {
       PLOGD << "Create headway constraints";
-      create_headway_constraints();
+      telemetry.measure("create_headway_constraints",
+                        [this]() { create_headway_constraints(); });
     }
   }
 }
@@ -440,11 +828,11 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     std::vector<
         std::vector<std::pair<size_t, std::vector<std::vector<size_t>>>>>
         tr_data;
-    tr_data.reserve(instance.get_schedule(tr).get_stops().size());
-    for (const auto& stop : instance.get_schedule(tr).get_stops()) {
-      tr_data.emplace_back(instance.possible_stop_vertices(
+    tr_data.reserve(instance->get_schedule(tr).get_stops().size());
+    for (const auto& stop : instance->get_schedule(tr).get_stops()) {
+      tr_data.emplace_back(instance->possible_stop_vertices(
           tr, stop.get_station_name(),
-          instance.edges_used_by_train(tr, model_detail.fix_routes, false)));
+          instance->edges_used_by_train(tr, model_detail.fix_routes, false)));
     }
     tr_stop_data.emplace_back(tr_data);
   }
@@ -472,19 +860,19 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     std::vector<std::vector<double>> tr_velocity_extensions;
     tr_velocity_extensions.reserve(num_vertices);
     const auto& tr_max_speed =
-        instance.get_train_list().get_train(tr).max_speed;
+        instance->get_train_list().get_train(tr).max_speed;
     for (size_t v = 0; v < num_vertices; v++) {
-      if (instance.get_schedule(tr).get_entry() == v) {
+      if (instance->get_schedule(tr).get_entry() == v) {
         tr_velocity_extensions.emplace_back(
-            std::vector<double>{instance.get_schedule(tr).get_v_0()});
+            std::vector<double>{instance->get_schedule(tr).get_v_0()});
         continue;
       }
 
       std::vector<double> v_velocity_extensions = {0};
       const double        max_vertex_speed      = std::min(
-          instance.const_n().maximal_vertex_speed(
-              v,
-              instance.edges_used_by_train(tr, model_detail.fix_routes, false)),
+          instance->const_n().maximal_vertex_speed(
+              v, instance->edges_used_by_train(tr, model_detail.fix_routes,
+                                               false)),
           tr_max_speed);
       double speed = 0;
       while (speed < max_vertex_speed) {
@@ -506,28 +894,28 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
   for (size_t tr = 0; tr < num_tr; tr++) {
     std::vector<std::vector<double>> tr_velocity_extensions;
     tr_velocity_extensions.reserve(num_vertices);
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     const auto  tr_speed_change =
         std::min(tr_object.acceleration, tr_object.deceleration);
     const auto& tr_max_speed = tr_object.max_speed;
     const auto& tr_length    = tr_object.length;
     for (size_t v = 0; v < num_vertices; v++) {
-      if (instance.get_schedule(tr).get_entry() == v) {
+      if (instance->get_schedule(tr).get_entry() == v) {
         tr_velocity_extensions.emplace_back(
-            std::vector<double>{instance.get_schedule(tr).get_v_0()});
+            std::vector<double>{instance->get_schedule(tr).get_v_0()});
         continue;
       }
 
       const double max_vertex_speed = std::min(
-          instance.const_n().maximal_vertex_speed(
-              v,
-              instance.edges_used_by_train(tr, model_detail.fix_routes, false)),
+          instance->const_n().maximal_vertex_speed(
+              v, instance->edges_used_by_train(tr, model_detail.fix_routes,
+                                               false)),
           tr_max_speed);
       double min_n_length =
-          instance.const_n().minimal_neighboring_edge_length(v);
+          instance->const_n().minimal_neighboring_edge_length(v);
 
       if (min_n_length > tr_length &&
-          instance.get_schedule(tr).get_exit() == v) {
+          instance->get_schedule(tr).get_exit() == v) {
         min_n_length = tr_length;
       }
 
@@ -561,6 +949,262 @@ size_t cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
   return max_size;
 }
 
+size_t cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::velocity_index(
+    size_t tr, size_t v, double vel) const {
+  // Index of a velocity taken from the velocity extensions of tr at v
+  const auto& velocities = velocity_extensions.at(tr).at(v);
+  const auto  it = std::find(velocities.begin(), velocities.end(), vel);
+  if (it == velocities.end()) {
+    throw exceptions::ConsistencyException(
+        "Velocity " + std::to_string(vel) + " of train " + std::to_string(tr) +
+        " at vertex " + std::to_string(v) + " is no velocity extension");
+  }
+  return static_cast<size_t>(it - velocities.begin());
+}
+
+const cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::EOMTableEntry&
+cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::eom_table_entry(
+    size_t tr, size_t e, size_t i, size_t j) const {
+  const auto& edge = instance->const_n().get_edge(e);
+  const auto  num_target_velocities =
+      velocity_extensions.at(tr).at(edge.target).size();
+  assert(i < velocity_extensions.at(tr).at(edge.source).size());
+  assert(j < num_target_velocities);
+  assert(eom_table_offsets.at(tr * num_edges + e) +
+             i * num_target_velocities + j <
+         eom_table_offsets.at(tr * num_edges + e + 1));
+  return eom_table.at(eom_table_offsets.at(tr * num_edges + e) +
+                      i * num_target_velocities + j);
+}
+
+double cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::edge_headway(
+    size_t tr, size_t e, size_t i, size_t j, bool entry_vertex) const {
+  /**
+   * Headway of train tr on edge e using velocity extensions i and j, see
+   * headway. Only arcs starting at an entry vertex are not tabulated.
+   */
+
+  if (!entry_vertex) {
+    return eom_table_entry(tr, e, i, j).headway;
+  }
+  const auto& edge = instance->const_n().get_edge(e);
+  return headway(instance->get_train_list().get_train(tr), edge,
+                 velocity_extensions.at(tr).at(edge.source).at(i),
+                 velocity_extensions.at(tr).at(edge.target).at(j), true);
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::fill_eom_table() {
+  /**
+   * Calculates the values of the equations of motion of all velocity arcs
+   * once, so that neither the model nor the lazy callback evaluates them
+   * repeatedly. Trains are distributed among solver_strategy.eom_table_threads
+   * threads, every thread writes only to the entries of its trains.
+   */
+
+  const auto& network = instance->const_n();
+
+  std::vector<std::vector<size_t>> edges_used(num_tr);
+  eom_table_offsets.assign(num_tr * num_edges + 1, 0);
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    edges_used.at(tr) =
+        instance->edges_used_by_train(tr, model_detail.fix_routes, false);
+    for (const auto e : edges_used.at(tr)) {
+      const auto& edge = network.get_edge(e);
+      eom_table_offsets.at(tr * num_edges + e + 1) =
+          velocity_extensions.at(tr).at(edge.source).size() *
+          velocity_extensions.at(tr).at(edge.target).size();
+    }
+  }
+  std::partial_sum(eom_table_offsets.begin(), eom_table_offsets.end(),
+                   eom_table_offsets.begin());
+  eom_table.assign(eom_table_offsets.back(), {});
+  ma_backward_times.assign(num_tr, {});
+
+  const auto fill_train = [this, &network, &edges_used](size_t tr) {
+    const auto& tr_object = instance->get_train_list().get_train(tr);
+
+    auto& tr_ma_backward_times = ma_backward_times.at(tr);
+    tr_ma_backward_times.resize(num_vertices);
+    for (size_t v = 0; v < num_vertices; v++) {
+      for (const auto vel : velocity_extensions.at(tr).at(v)) {
+        tr_ma_backward_times.at(v).push_back(min_time_to_push_ma_fully_backward(
+            vel, tr_object.acceleration, tr_object.deceleration));
+      }
+    }
+
+    for (const auto e : edges_used.at(tr)) {
+      const auto& edge          = network.get_edge(e);
+      const auto& v1_values     = velocity_extensions.at(tr).at(edge.source);
+      const auto& v2_values     = velocity_extensions.at(tr).at(edge.target);
+      const auto  tmp_max_speed = std::min(tr_object.max_speed, edge.max_speed);
+      const auto  offset        = eom_table_offsets.at(tr * num_edges + e);
+
+      // Travel times of all possible arcs are calculated at once
+      std::vector<size_t> arc_entries;
+      EOMBatch            min_t_batch;
+      EOMBatch            max_t_batch;
+      for (size_t i = 0; i < v1_values.size(); i++) {
+        if (v1_values.at(i) > tmp_max_speed) {
+          continue;
+        }
+        for (size_t j = 0; j < v2_values.size(); j++) {
+          if (v2_values.at(j) > tmp_max_speed ||
+              !cda_rail::possible_by_eom(v1_values.at(i), v2_values.at(j),
+                                         tr_object.acceleration,
+                                         tr_object.deceleration, edge.length)) {
+            continue;
+          }
+          auto& entry    = eom_table.at(offset + i * v2_values.size() + j);
+          entry.possible = true;
+          entry.headway =
+              headway(tr_object, edge, v1_values.at(i), v2_values.at(j));
+          arc_entries.push_back(offset + i * v2_values.size() + j);
+          min_t_batch.add(v1_values.at(i), v2_values.at(j), tmp_max_speed,
+                          tr_object.acceleration, tr_object.deceleration,
+                          edge.length);
+          max_t_batch.add(v1_values.at(i), v2_values.at(j), V_MIN,
+                          tr_object.acceleration, tr_object.deceleration,
+                          edge.length);
+        }
+      }
+      const auto min_t_arcs = min_t_batch.min_travel_time_from_start();
+      const auto max_t_arcs =
+          max_t_batch.max_travel_time_from_start(edge.breakable);
+      for (size_t arc = 0; arc < arc_entries.size(); arc++) {
+        auto& entry           = eom_table.at(arc_entries.at(arc));
+        entry.min_travel_time = min_t_arcs.at(arc);
+        entry.max_travel_time = max_t_arcs.at(arc);
+      }
+    }
+  };
+
+  parallel_for(num_tr, solver_strategy.eom_table_threads,
+               [&fill_train](size_t tr, size_t /*worker*/) { fill_train(tr); });
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
+    fill_time_windows() {
+  /**
+   * Calculates for every train and vertex the earliest arrival and the latest
+   * departure of the train's front, such that the train can still enter and
+   * leave the network within the time windows of its schedule. Both follow
+   * from shortest paths with respect to the minimal travel time of every edge
+   * over all velocity extensions. Stops can only delay a train and are,
+   * hence, ignored.
+   */
+
+  const auto& network = instance->const_n();
+
+  // Minimal total travel time from (or to if reverse) v_start
+  const auto min_travel_times = [&network, this](size_t v_start,
+                                                 const std::vector<double>& tt,
+                                                 bool reverse) {
+    std::vector<double> dist(num_vertices, INF);
+    std::priority_queue<std::pair<double, size_t>,
+                        std::vector<std::pair<double, size_t>>, std::greater<>>
+        pq;
+    dist.at(v_start) = 0;
+    pq.emplace(0, v_start);
+    while (!pq.empty()) {
+      const auto [d, v] = pq.top();
+      pq.pop();
+      if (d > dist.at(v)) {
+        // Outdated entry due to later update with shorter path
+        continue;
+      }
+      for (const auto e :
+           reverse ? network.in_edges(v) : network.out_edges(v)) {
+        const auto& edge   = network.get_edge(e);
+        const auto  v_next = reverse ? edge.source : edge.target;
+        const auto  d_next = d + tt.at(e);
+        if (d_next < dist.at(v_next)) {
+          dist.at(v_next) = d_next;
+          pq.emplace(d_next, v_next);
+        }
+      }
+    }
+    return dist;
+  };
+
+  min_edge_travel_times.assign(num_tr, std::vector<double>(num_edges, INF));
+  time_windows.assign(num_tr, std::vector<std::pair<double, double>>(
+                                  num_vertices, {INF, -INF}));
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    const auto& tr_schedule = instance->get_schedule(tr);
+    auto&       tt          = min_edge_travel_times.at(tr);
+    for (const auto e :
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& edge = network.get_edge(e);
+      for (size_t i = 0;
+           i < velocity_extensions.at(tr).at(edge.source).size(); i++) {
+        for (size_t j = 0;
+             j < velocity_extensions.at(tr).at(edge.target).size(); j++) {
+          const auto& arc = eom_table_entry(tr, e, i, j);
+          if (arc.possible) {
+            tt.at(e) = std::min(tt.at(e), arc.min_travel_time);
+          }
+        }
+      }
+    }
+
+    const auto from_entry =
+        min_travel_times(tr_schedule.get_entry(), tt, false);
+    const auto to_exit = min_travel_times(tr_schedule.get_exit(), tt, true);
+    for (size_t v = 0; v < num_vertices; v++) {
+      if (from_entry.at(v) < INF && to_exit.at(v) < INF) {
+        time_windows.at(tr).at(v) = {
+            tr_schedule.get_t_0_range().first + from_entry.at(v),
+            tr_schedule.get_t_n_range().second - to_exit.at(v)};
+      }
+    }
+  }
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
+    fill_callback_solution() {
+  /**
+   * Registers all variables that are read by the lazy callback, so that their
+   * values are extracted using a single query per callback. Moreover, the
+   * velocity extended variables of every train and edge are listed, so that
+   * velocities can be decoded without checking every pair of velocities.
+   */
+
+  callback_solution.clear();
+  for (const auto family :
+       {Var::X, Var::XTtd, Var::TFrontArrival, Var::TFrontDeparture,
+        Var::TRearDeparture, Var::TTtdDeparture, Var::Order, Var::Y}) {
+    callback_solution.add_family(vars, family);
+  }
+
+  velocity_slot_offsets.assign(num_tr * num_edges + 1, 0);
+  velocity_slots.clear();
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    std::vector<bool> edge_used(num_edges, false);
+    for (const auto& e :
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      edge_used.at(e) = true;
+    }
+    for (size_t e = 0; e < num_edges; e++) {
+      if (edge_used.at(e)) {
+        const auto& edge = instance->const_n().get_edge(e);
+        const auto  num_source_velocities =
+            velocity_extensions.at(tr).at(edge.source).size();
+        const auto num_target_velocities =
+            velocity_extensions.at(tr).at(edge.target).size();
+        for (size_t i = 0; i < num_source_velocities; i++) {
+          for (size_t j = 0; j < num_target_velocities; j++) {
+            const auto slot = callback_solution.slot(Var::Y, tr, e, i, j);
+            if (slot != 0) {
+              velocity_slots.push_back({i, j, slot});
+            }
+          }
+        }
+      }
+      velocity_slot_offsets.at(tr * num_edges + e + 1) = velocity_slots.size();
+    }
+  }
+}
+
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     initialize_variables(
         const SolutionSettingsMovingBlock& solution_settings_input,
@@ -579,188 +1223,165 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
         "added.");
   }
 
-  num_tr                  = instance.get_train_list().size();
-  num_edges               = instance.const_n().number_of_edges();
-  num_vertices            = instance.const_n().number_of_vertices();
-  max_t                   = instance.max_t();
+  num_tr                  = instance->get_train_list().size();
+  num_edges               = instance->const_n().number_of_edges();
+  num_vertices            = instance->const_n().number_of_vertices();
+  max_t                   = instance->max_t();
   this->solution_settings = solution_settings_input;
   this->solver_strategy   = solver_strategy_input;
   this->model_detail      = model_detail_input;
-  this->ttd_sections      = instance.n().unbreakable_sections();
+  this->ttd_sections      = instance->const_n().unbreakable_sections();
   this->num_ttd           = this->ttd_sections.size();
+  this->set_use_names(solution_settings.anonymous_model,
+                      solution_settings.export_option);
   this->fill_tr_stop_data();
   this->fill_velocity_extensions();
   this->fill_relevant_reverse_edges();
+  telemetry.measure("fill_eom_table", [this]() { fill_eom_table(); });
+  this->fill_time_windows();
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_general_path_constraints() {
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     for (const auto& e :
-         instance.edges_used_by_train(tr, model_detail.fix_routes, false)) {
-      const auto&      edge       = instance.const_n().get_edge(e);
-      const auto&      source_obj = instance.const_n().get_vertex(edge.source);
-      const auto&      target_obj = instance.const_n().get_vertex(edge.target);
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto&      edge       = instance->const_n().get_edge(e);
+      const auto&      source_obj = instance->const_n().get_vertex(edge.source);
+      const auto&      target_obj = instance->const_n().get_vertex(edge.target);
       const auto&      v1_values  = velocity_extensions.at(tr).at(edge.source);
       const auto&      v2_values  = velocity_extensions.at(tr).at(edge.target);
-      const GRBLinExpr lhs        = vars["x"](tr, e);
+      const GRBLinExpr lhs        = vars.get<Var::X>()(tr, e);
       GRBLinExpr       rhs        = 0;
-      const auto tmp_max_speed = std::min(tr_object.max_speed, edge.max_speed);
       for (size_t i = 0; i < v1_values.size(); i++) {
-        if (v1_values.at(i) > tmp_max_speed) {
-          continue;
-        }
         for (size_t j = 0; j < v2_values.size(); j++) {
-          if (v2_values.at(j) > tmp_max_speed) {
-            continue;
-          }
-          if (cda_rail::possible_by_eom(v1_values.at(i), v2_values.at(j),
-                                        tr_object.acceleration,
-                                        tr_object.deceleration, edge.length)) {
-            rhs += vars["y"](tr, e, i, j);
+          if (eom_table_entry(tr, e, i, j).possible) {
+            rhs += vars[Var::Y].at(tr, e, i, j);
           }
         }
       }
       // Edge is used if one of the velocity extended arcs is used
-      model->addConstr(lhs == rhs, "aggregate_edge_velocity_extension_" +
-                                       tr_object.name + "_" + source_obj.name +
-                                       "-" + target_obj.name);
+      model->addConstr(lhs == rhs, name("aggregate_edge_velocity_extension_",
+                                        tr_object.name, "_", source_obj.name,
+                                        "-", target_obj.name));
     }
-    const auto& schedule = instance.get_schedule(tr);
+    const auto& schedule = instance->get_schedule(tr);
     const auto& entry    = schedule.get_entry();
     const auto& exit     = schedule.get_exit();
     const auto  edges_used_by_train =
-        instance.edges_used_by_train(tr, model_detail.fix_routes, false);
+        instance->edges_used_by_train(tr, model_detail.fix_routes, false);
     for (const auto& v :
-         instance.vertices_used_by_train(tr, model_detail.fix_routes, false)) {
+         instance->vertices_used_by_train(tr, model_detail.fix_routes, false)) {
       if (v == entry) {
         GRBLinExpr lhs = 0;
-        for (const auto& e : instance.const_n().out_edges(v)) {
+        for (const auto& e : instance->const_n().out_edges(v)) {
           if (std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
                         e) != edges_used_by_train.end()) {
-            lhs += vars["x"](tr, e);
+            lhs += vars.get<Var::X>()(tr, e);
           }
         }
         // The entry vertex is only left but not entered
-        model->addConstr(lhs == 1, "entry_vertex_" + tr_object.name + "_" +
-                                       instance.const_n().get_vertex(v).name);
+        model->addConstr(
+            lhs == 1, name("entry_vertex_", tr_object.name, "_",
+                           instance->const_n().get_vertex(v).name));
       } else if (v == exit) {
         GRBLinExpr lhs = 0;
-        for (const auto& e : instance.const_n().in_edges(v)) {
+        for (const auto& e : instance->const_n().in_edges(v)) {
           if (std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
                         e) != edges_used_by_train.end()) {
-            lhs += vars["x"](tr, e);
+            lhs += vars.get<Var::X>()(tr, e);
           }
         }
         // The exit vertex is only entered but not left
-        model->addConstr(lhs == 1, "exit_vertex_" + tr_object.name + "_" +
-                                       instance.const_n().get_vertex(v).name);
+        model->addConstr(
+            lhs == 1, name("exit_vertex_", tr_object.name, "_",
+                           instance->const_n().get_vertex(v).name));
       } else {
         GRBLinExpr x_in_edges  = 0;
         GRBLinExpr x_out_edges = 0;
-        for (const auto& e : instance.const_n().in_edges(v)) {
+        for (const auto& e : instance->const_n().in_edges(v)) {
           if (std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
                         e) != edges_used_by_train.end()) {
-            x_in_edges += vars["x"](tr, e);
+            x_in_edges += vars.get<Var::X>()(tr, e);
           }
         }
-        for (const auto& e : instance.const_n().out_edges(v)) {
+        for (const auto& e : instance->const_n().out_edges(v)) {
           if (std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
                         e) != edges_used_by_train.end()) {
-            x_out_edges += vars["x"](tr, e);
+            x_out_edges += vars.get<Var::X>()(tr, e);
           }
         }
         // All other vertices are entered and left at most once
         model->addConstr(x_in_edges <= 1,
-                         "in_edges_" + tr_object.name + "_" +
-                             instance.const_n().get_vertex(v).name);
+                         name("in_edges_", tr_object.name, "_",
+                              instance->const_n().get_vertex(v).name));
         model->addConstr(x_out_edges <= 1,
-                         "out_edges_" + tr_object.name + "_" +
-                             instance.const_n().get_vertex(v).name);
+                         name("out_edges_", tr_object.name, "_",
+                              instance->const_n().get_vertex(v).name));
         const auto& v1_values = velocity_extensions.at(tr).at(v);
         for (size_t i = 0; i < v1_values.size(); i++) {
           GRBLinExpr lhs = 0;
           GRBLinExpr rhs = 0;
-          for (const auto& e : instance.const_n().in_edges(v)) {
+          for (const auto& e : instance->const_n().in_edges(v)) {
             if (std::find(edges_used_by_train.begin(),
                           edges_used_by_train.end(),
                           e) != edges_used_by_train.end()) {
-              const auto& edge = instance.const_n().get_edge(e);
+              const auto& edge = instance->const_n().get_edge(e);
               const auto& v2_values =
                   velocity_extensions.at(tr).at(edge.source);
-              const auto tmp_max_speed =
-                  std::min(tr_object.max_speed, edge.max_speed);
-              if (v1_values.at(i) > tmp_max_speed) {
-                continue;
-              }
               for (size_t j = 0; j < v2_values.size(); j++) {
-                if (v2_values.at(j) > tmp_max_speed) {
-                  continue;
-                }
-                if (cda_rail::possible_by_eom(v2_values.at(j), v1_values.at(i),
-                                              tr_object.acceleration,
-                                              tr_object.deceleration,
-                                              edge.length)) {
-                  lhs += vars["y"](tr, e, j, i);
+                if (eom_table_entry(tr, e, j, i).possible) {
+                  lhs += vars[Var::Y].at(tr, e, j, i);
                 }
               }
             }
           }
-          for (const auto& e : instance.const_n().out_edges(v)) {
+          for (const auto& e : instance->const_n().out_edges(v)) {
             if (std::find(edges_used_by_train.begin(),
                           edges_used_by_train.end(),
                           e) != edges_used_by_train.end()) {
-              const auto& edge = instance.const_n().get_edge(e);
-              const auto  tmp_max_speed =
-                  std::min(tr_object.max_speed, edge.max_speed);
-              if (v1_values.at(i) > tmp_max_speed) {
-                continue;
-              }
+              const auto& edge = instance->const_n().get_edge(e);
               const auto& v2_values =
                   velocity_extensions.at(tr).at(edge.target);
               for (size_t j = 0; j < v2_values.size(); j++) {
-                if (v2_values.at(j) > tmp_max_speed) {
-                  continue;
-                }
-                if (cda_rail::possible_by_eom(v1_values.at(i), v2_values.at(j),
-                                              tr_object.acceleration,
-                                              tr_object.deceleration,
-                                              edge.length)) {
-                  rhs += vars["y"](tr, e, i, j);
+                if (eom_table_entry(tr, e, i, j).possible) {
+                  rhs += vars[Var::Y].at(tr, e, i, j);
                 }
               }
             }
           }
           // And they fulfill a flow condition
           model->addConstr(lhs == rhs,
-                           "vertex_velocity_extension_flow_condition_" +
-                               tr_object.name + "_" +
-                               instance.const_n().get_vertex(v).name + "_" +
-                               std::to_string(v1_values.at(i)));
+                           name("vertex_velocity_extension_flow_condition_",
+                                tr_object.name, "_",
+                                instance->const_n().get_vertex(v).name, "_",
+                                v1_values.at(i)));
         }
       }
     }
 
     // Prevent illegal paths
     for (const auto& e :
-         instance.edges_used_by_train(tr, model_detail.fix_routes, false)) {
-      const auto& e_object  = instance.const_n().get_edge(e);
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& e_object  = instance->const_n().get_edge(e);
       const auto& v2        = e_object.target;
-      const auto& out_edges = instance.const_n().out_edges(v2);
-      const auto& v1_name = instance.const_n().get_vertex(e_object.source).name;
-      const auto& v2_name = instance.const_n().get_vertex(v2).name;
+      const auto& out_edges = instance->const_n().out_edges(v2);
+      const auto& v1_name =
+          instance->const_n().get_vertex(e_object.source).name;
+      const auto& v2_name = instance->const_n().get_vertex(v2).name;
       for (const auto& e2 : out_edges) {
-        if (!instance.const_n().is_valid_successor(e, e2) &&
+        if (!instance->const_n().is_valid_successor(e, e2) &&
             std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
                       e2) != edges_used_by_train.end()) {
           const auto& v3_name =
-              instance.const_n()
-                  .get_vertex(instance.const_n().get_edge(e2).target)
+              instance->const_n()
+                  .get_vertex(instance->const_n().get_edge(e2).target)
                   .name;
-          model->addConstr(vars["x"](tr, e) + vars["x"](tr, e2) <= 1,
-                           "illegal_path_" + tr_object.name + "_" + v1_name +
-                               "-" + v2_name + "-" + v3_name);
+          model->addConstr(
+              vars.get<Var::X>()(tr, e) + vars.get<Var::X>()(tr, e2) <= 1,
+              name("illegal_path_", tr_object.name, "_", v1_name, "-", v2_name,
+                   "-", v3_name));
         }
       }
     }
@@ -769,74 +1390,65 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_travel_times_constraints() {
+  ConstraintBatch batch(*model);
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     for (const auto& e :
-         instance.edges_used_by_train(tr, model_detail.fix_routes, false)) {
-      const auto& edge          = instance.const_n().get_edge(e);
-      const auto& v1_values     = velocity_extensions.at(tr).at(edge.source);
-      const auto& v2_values     = velocity_extensions.at(tr).at(edge.target);
-      const auto  tmp_max_speed = std::min(tr_object.max_speed, edge.max_speed);
+         instance->edges_used_by_train(tr, model_detail.fix_routes, false)) {
+      const auto& edge      = instance->const_n().get_edge(e);
+      const auto& v1_values = velocity_extensions.at(tr).at(edge.source);
+      const auto& v2_values = velocity_extensions.at(tr).at(edge.target);
       for (size_t i = 0; i < v1_values.size(); i++) {
-        if (v1_values.at(i) > tmp_max_speed) {
-          continue;
-        }
         for (size_t j = 0; j < v2_values.size(); j++) {
-          if (v2_values.at(j) > tmp_max_speed) {
+          const auto& arc = eom_table_entry(tr, e, i, j);
+          if (!arc.possible) {
             continue;
           }
-          if (cda_rail::possible_by_eom(v1_values.at(i), v2_values.at(j),
-                                        tr_object.acceleration,
-                                        tr_object.deceleration, edge.length)) {
-            // t_front_arrival >= t_rear_departure + minimal travel time if arc
-            // is used
-            const auto& min_t_arc = cda_rail::min_travel_time(
-                v1_values.at(i), v2_values.at(j), tmp_max_speed,
-                tr_object.acceleration, tr_object.deceleration, edge.length);
-            const auto& max_t_arc = cda_rail::max_travel_time(
-                v1_values.at(i), v2_values.at(j), V_MIN, tr_object.acceleration,
-                tr_object.deceleration, edge.length, edge.breakable);
-            model->addConstr(
-                vars["t_front_arrival"](tr, edge.target) +
+          const auto& min_t_arc = arc.min_travel_time;
+          const auto& max_t_arc = arc.max_travel_time;
+
+          // t_front_arrival >= t_rear_departure + minimal travel time if arc
+          // is used
+          batch.add(vars.get<Var::TFrontArrival>()(tr, edge.target) +
                         (ub_timing_variable(tr) + min_t_arc) *
-                            (1 - vars["y"](tr, e, i, j)) >=
-                    vars["t_front_departure"](tr, edge.source) + min_t_arc,
-                "edge_minimal_travel_time_" + tr_object.name + "_" +
-                    instance.const_n().get_vertex(edge.source).name + "-" +
-                    instance.const_n().get_vertex(edge.target).name + "_" +
-                    std::to_string(v1_values.at(i)) + "-" +
-                    std::to_string(v2_values.at(j)));
-
-            if (max_t_arc >= std::numeric_limits<double>::infinity()) {
-              continue;
-            }
+                            (1 - vars[Var::Y].at(tr, e, i, j)),
+                    GRB_GREATER_EQUAL,
+                    vars.get<Var::TFrontDeparture>()(tr, edge.source) +
+                        min_t_arc,
+                    name("edge_minimal_travel_time_", tr_object.name, "_",
+                         instance->const_n().get_vertex(edge.source).name, "-",
+                         instance->const_n().get_vertex(edge.target).name, "_",
+                         v1_values.at(i), "-", v2_values.at(j)));
+
+          if (max_t_arc >= std::numeric_limits<double>::infinity()) {
+            continue;
+          }
 
-            // t_front_arrival <= t_rear_departure + maximal travel time if arc
-            // is used
-            model->addConstr(
-                vars["t_front_arrival"](tr, edge.target) <=
-                    vars["t_front_departure"](tr, edge.source) + max_t_arc +
+          // t_front_arrival <= t_rear_departure + maximal travel time if arc
+          // is used
+          batch.add(vars.get<Var::TFrontArrival>()(tr, edge.target),
+                    GRB_LESS_EQUAL,
+                    vars.get<Var::TFrontDeparture>()(tr, edge.source) +
+                        max_t_arc +
                         (ub_timing_variable(tr) - max_t_arc) *
-                            (1 - vars["y"](tr, e, i, j)),
-                "edge_maximal_travel_time_" + tr_object.name + "_" +
-                    instance.const_n().get_vertex(edge.source).name + "-" +
-                    instance.const_n().get_vertex(edge.target).name + "_" +
-                    std::to_string(v1_values.at(i)) + "-" +
-                    std::to_string(v2_values.at(j)));
-          }
+                            (1 - vars[Var::Y].at(tr, e, i, j)),
+                    name("edge_maximal_travel_time_", tr_object.name, "_",
+                         instance->const_n().get_vertex(edge.source).name, "-",
+                         instance->const_n().get_vertex(edge.target).name, "_",
+                         v1_values.at(i), "-", v2_values.at(j)));
         }
       }
     }
 
     const auto e_used_tr =
-        instance.edges_used_by_train(tr, model_detail.fix_routes, false);
+        instance->edges_used_by_train(tr, model_detail.fix_routes, false);
     for (const auto& v :
-         instance.vertices_used_by_train(tr, model_detail.fix_routes, false)) {
+         instance->vertices_used_by_train(tr, model_detail.fix_routes, false)) {
       // t_front_departure >= t_front_arrival
-      model->addConstr(vars["t_front_departure"](tr, v) >=
-                           vars["t_front_arrival"](tr, v),
-                       "tr_dep_after_arrival_" + tr_object.name + "_" +
-                           instance.const_n().get_vertex(v).name);
+      batch.add(vars.get<Var::TFrontDeparture>()(tr, v), GRB_GREATER_EQUAL,
+                vars.get<Var::TFrontArrival>()(tr, v),
+                name("tr_dep_after_arrival_", tr_object.name, "_",
+                     instance->const_n().get_vertex(v).name));
 
       if (velocity_extensions.at(tr).at(v).at(0) != 0) {
         continue;
@@ -845,71 +1457,58 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
       // t_front_departure <= t_front_arrival if train cannot be stopped at
       // vertex v
       GRBLinExpr speed_0_arcs = 0;
-      for (const auto& e_in : instance.const_n().in_edges(v)) {
+      for (const auto& e_in : instance->const_n().in_edges(v)) {
         if (std::find(e_used_tr.begin(), e_used_tr.end(), e_in) !=
             e_used_tr.end()) {
-          const auto& e_in_object = instance.const_n().get_edge(e_in);
+          const auto& e_in_object = instance->const_n().get_edge(e_in);
           const auto& v1_velocities =
               velocity_extensions.at(tr).at(e_in_object.source);
           assert(velocity_extensions.at(tr).at(v).at(0) == 0);
-          const auto tmp_max_speed =
-              std::min(tr_object.max_speed, e_in_object.max_speed);
           for (size_t i = 0; i < v1_velocities.size(); i++) {
-            if (v1_velocities.at(i) > tmp_max_speed) {
-              continue;
-            }
-            if (cda_rail::possible_by_eom(
-                    v1_velocities.at(i), 0, tr_object.acceleration,
-                    tr_object.deceleration, e_in_object.length)) {
-              speed_0_arcs += vars["y"](tr, e_in, i, 0);
+            if (eom_table_entry(tr, e_in, i, 0).possible) {
+              speed_0_arcs += vars[Var::Y].at(tr, e_in, i, 0);
             }
           }
         }
       }
-      for (const auto& e_out : instance.const_n().out_edges(v)) {
+      for (const auto& e_out : instance->const_n().out_edges(v)) {
         if (std::find(e_used_tr.begin(), e_used_tr.end(), e_out) !=
             e_used_tr.end()) {
-          const auto& e_out_object = instance.const_n().get_edge(e_out);
+          const auto& e_out_object = instance->const_n().get_edge(e_out);
           const auto& v2_velocities =
               velocity_extensions.at(tr).at(e_out_object.target);
           assert(velocity_extensions.at(tr).at(v).at(0) == 0);
-          const auto tmp_max_speed =
-              std::min(tr_object.max_speed, e_out_object.max_speed);
           for (size_t i = 0; i < v2_velocities.size(); i++) {
-            if (v2_velocities.at(i) > tmp_max_speed) {
-              continue;
-            }
-            if (cda_rail::possible_by_eom(
-                    0, v2_velocities.at(i), tr_object.acceleration,
-                    tr_object.deceleration, e_out_object.length)) {
-              speed_0_arcs += vars["y"](tr, e_out, 0, i);
+            if (eom_table_entry(tr, e_out, 0, i).possible) {
+              speed_0_arcs += vars[Var::Y].at(tr, e_out, 0, i);
             }
           }
         }
       }
-      model->addConstr(vars["t_front_departure"](tr, v) <=
-                           vars["t_front_arrival"](tr, v) +
-                               ub_timing_variable(tr) * speed_0_arcs,
-                       "tr_might_stop_at_vertex_" + tr_object.name + "_" +
-                           instance.const_n().get_vertex(v).name);
+      batch.add(vars.get<Var::TFrontDeparture>()(tr, v), GRB_LESS_EQUAL,
+                vars.get<Var::TFrontArrival>()(tr, v) +
+                    ub_timing_variable(tr) * speed_0_arcs,
+                name("tr_might_stop_at_vertex_", tr_object.name, "_",
+                     instance->const_n().get_vertex(v).name));
     }
   }
+  batch.submit();
 }
 
 double
 cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::ub_timing_variable(
     size_t tr) const {
-  return instance.get_schedule(tr).get_t_n_range().second;
+  return instance->get_schedule(tr).get_t_n_range().second;
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_basic_order_constraints() {
   for (size_t e = 0; e < num_edges; e++) {
-    const auto& tr_on_edge = instance.trains_on_edge_mixed_routing(
+    const auto& tr_on_edge = instance->trains_on_edge_mixed_routing(
         e, model_detail.fix_routes, false);
-    const auto e_obj = instance.const_n().get_edge(e);
-    const auto v1    = instance.const_n().get_vertex(e_obj.source);
-    const auto v2    = instance.const_n().get_vertex(e_obj.target);
+    const auto e_obj = instance->const_n().get_edge(e);
+    const auto v1    = instance->const_n().get_vertex(e_obj.source);
+    const auto v2    = instance->const_n().get_vertex(e_obj.target);
     for (const auto& tr1 : tr_on_edge) {
       for (const auto& tr2 : tr_on_edge) {
         if (tr1 == tr2) {
@@ -917,18 +1516,22 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
         }
 
         model->addConstr(
-            vars["order"](tr1, tr2, e) + vars["order"](tr2, tr1, e) <=
-                0.5 * (vars["x"](tr1, e) + vars["x"](tr2, e)),
-            "edge_order_1_" + instance.get_train_list().get_train(tr1).name +
-                "_" + instance.get_train_list().get_train(tr2).name + "_" +
-                v1.name + "-" + v2.name);
+            vars[Var::Order].at(tr1, tr2, e) +
+                    vars[Var::Order].at(tr2, tr1, e) <=
+                0.5 * (vars.get<Var::X>()(tr1, e) + vars.get<Var::X>()(tr2, e)),
+            name("edge_order_1_",
+                 instance->get_train_list().get_train(tr1).name, "_",
+                 instance->get_train_list().get_train(tr2).name, "_", v1.name,
+                 "-", v2.name));
 
         model->addConstr(
-            vars["order"](tr1, tr2, e) + vars["order"](tr2, tr1, e) >=
-                vars["x"](tr1, e) + vars["x"](tr2, e) - 1,
-            "edge_order_2_" + instance.get_train_list().get_train(tr1).name +
-                "_" + instance.get_train_list().get_train(tr2).name + "_" +
-                v1.name + "-" + v2.name);
+            vars[Var::Order].at(tr1, tr2, e) +
+                    vars[Var::Order].at(tr2, tr1, e) >=
+                vars.get<Var::X>()(tr1, e) + vars.get<Var::X>()(tr2, e) - 1,
+            name("edge_order_2_",
+                 instance->get_train_list().get_train(tr1).name, "_",
+                 instance->get_train_list().get_train(tr2).name, "_", v1.name,
+                 "-", v2.name));
       }
     }
   }
@@ -938,27 +1541,27 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_train_rear_constraints() {
   for (size_t tr = 0; tr < num_tr; tr++) {
     // Rear departure time is equal to front departure time at certain position
-    const auto& tr_object = instance.get_train_list().get_train(tr);
-    const auto& schedule  = instance.get_schedule(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
+    const auto& schedule  = instance->get_schedule(tr);
     const auto& exit      = schedule.get_exit();
     const auto& v_n       = schedule.get_v_n();
     const auto  edges_used_by_train =
-        instance.edges_used_by_train(tr, model_detail.fix_routes, false);
+        instance->edges_used_by_train(tr, model_detail.fix_routes, false);
 
     // NOLINTNEXTLINE(readability-identifier-naming)
     const auto M = ub_timing_variable(tr);
 
     for (const auto& v :
-         instance.vertices_used_by_train(tr, model_detail.fix_routes, false)) {
+         instance->vertices_used_by_train(tr, model_detail.fix_routes, false)) {
       if (v == exit) {
         // In case the train has partially left the network use edge case
         // constraints
         const auto v_max_speed =
-            instance.const_n().maximal_vertex_speed(v, edges_used_by_train);
+            instance->const_n().maximal_vertex_speed(v, edges_used_by_train);
         const auto v_exit_velocities = velocity_extensions.at(tr).at(v);
         // t_rear_departure(v) >= t_front_departure(v)  + min_t selected by
         // incoming edge speed
-        const auto          in_edges          = instance.const_n().in_edges(v);
+        const auto          in_edges          = instance->const_n().in_edges(v);
         std::vector<size_t> relevant_in_edges = {};
         for (const auto& e : in_edges) {
           if (std::find(edges_used_by_train.begin(), edges_used_by_train.end(),
@@ -980,95 +1583,72 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                 v_exit_velocity, v_n, V_MIN, tr_object.acceleration,
                 tr_object.deceleration, tr_object.length, false);
             for (const auto& e_in : relevant_in_edges) {
-              const auto& e_in_object = instance.const_n().get_edge(e_in);
-              const auto  tmp_max_speed =
-                  std::min(tr_object.max_speed, e_in_object.max_speed);
-              if (v_exit_velocity > tmp_max_speed) {
-                continue;
-              }
+              const auto& e_in_object = instance->const_n().get_edge(e_in);
               const auto& v1_velocities =
                   velocity_extensions.at(tr).at(e_in_object.source);
               for (size_t j = 0; j < v1_velocities.size(); j++) {
-                if (v1_velocities.at(j) > tmp_max_speed) {
-                  continue;
-                }
-                if (cda_rail::possible_by_eom(
-                        v1_velocities.at(j), v_exit_velocity,
-                        tr_object.acceleration, tr_object.deceleration,
-                        e_in_object.length)) {
+                if (eom_table_entry(tr, e_in, j, i).possible) {
                   min_travel_time_expr +=
-                      vars["y"](tr, e_in, j, i) * min_t_to_full_exit;
+                      vars[Var::Y].at(tr, e_in, j, i) * min_t_to_full_exit;
                   max_travel_time_expr +=
-                      vars["y"](tr, e_in, j, i) * max_t_to_full_exit;
+                      vars[Var::Y].at(tr, e_in, j, i) * max_t_to_full_exit;
                 }
               }
             }
           } else {
             // Velocity is not possible at exit vertex
             for (const auto& e_in : relevant_in_edges) {
-              const auto& e_in_object = instance.const_n().get_edge(e_in);
+              const auto& e_in_object = instance->const_n().get_edge(e_in);
               const auto& e_in_source_vertex =
-                  instance.const_n().get_vertex(e_in_object.source);
-              const auto tmp_max_speed =
-                  std::min(tr_object.max_speed, e_in_object.max_speed);
-              if (v_exit_velocity > tmp_max_speed) {
-                continue;
-              }
+                  instance->const_n().get_vertex(e_in_object.source);
               const auto& v1_velocities =
                   velocity_extensions.at(tr).at(e_in_object.source);
               for (size_t j = 0; j < v1_velocities.size(); j++) {
-                if (v1_velocities.at(j) > tmp_max_speed) {
-                  continue;
-                }
-                if (cda_rail::possible_by_eom(
-                        v1_velocities.at(j), v_exit_velocity,
-                        tr_object.acceleration, tr_object.deceleration,
-                        e_in_object.length)) {
+                if (eom_table_entry(tr, e_in, j, i).possible) {
                   model->addConstr(
-                      vars["y"](tr, e_in, j, i) == 0,
-                      "y_exit_velocity_" + std::to_string(v_exit_velocity) +
-                          "_not_possible_from_" +
-                          std::to_string(v1_velocities.at(j)) + "_at_" +
-                          e_in_source_vertex.name + "_tr_" + tr_object.name);
+                      vars[Var::Y].at(tr, e_in, j, i) == 0,
+                      name("y_exit_velocity_", v_exit_velocity,
+                           "_not_possible_from_", v1_velocities.at(j), "_at_",
+                           e_in_source_vertex.name, "_tr_", tr_object.name));
                 }
               }
             }
           }
         }
-        model->addConstr(vars["t_rear_departure"](tr, v) >=
-                             vars["t_front_departure"](tr, v) +
+        model->addConstr(vars.get<Var::TRearDeparture>()(tr, v) >=
+                             vars.get<Var::TFrontDeparture>()(tr, v) +
                                  min_travel_time_expr,
-                         "rear_departure_vertex_c1_" + tr_object.name + "_" +
-                             instance.const_n().get_vertex(v).name);
-        model->addConstr(vars["t_rear_departure"](tr, v) <=
-                             vars["t_front_departure"](tr, v) +
+                         name("rear_departure_vertex_c1_", tr_object.name, "_",
+                              instance->const_n().get_vertex(v).name));
+        model->addConstr(vars.get<Var::TRearDeparture>()(tr, v) <=
+                             vars.get<Var::TFrontDeparture>()(tr, v) +
                                  max_travel_time_expr,
-                         "rear_departure_vertex_c2_" + tr_object.name + "_" +
-                             instance.const_n()
-                                 .get_vertex(v)
-                                 .name); // not needed because objective pushes
-                                         // rear departure down
+                         name("rear_departure_vertex_c2_", tr_object.name, "_",
+                              instance->const_n()
+                                  .get_vertex(v)
+                                  .name)); // not needed because objective
+                                           // pushes rear departure down
       } else {
         // Otherwise deduce limits from last path edge
-        const auto possible_paths =
-            instance.const_n().all_paths_of_length_starting_in_vertex(
+        const auto& possible_paths =
+            instance->const_n().all_paths_of_length_starting_in_vertex(
                 v, tr_object.length, exit, edges_used_by_train);
         for (size_t p_ind = 0; p_ind < possible_paths.size(); p_ind++) {
           const auto&  p                 = possible_paths.at(p_ind);
           const double p_len_last_vertex = std::accumulate(
               p.begin(), p.end() - 1, 0.0,
               [this](double sum, const auto& edge_index) {
-                return sum + instance.const_n().get_edge(edge_index).length;
+                return sum + instance->const_n().get_edge(edge_index).length;
               });
           assert(p_len_last_vertex >= 0);
           assert(p_len_last_vertex <= tr_object.length);
           const auto& last_edge     = p.back();
-          const auto& last_edge_obj = instance.const_n().get_edge(last_edge);
+          const auto& last_edge_obj = instance->const_n().get_edge(last_edge);
 
-          GRBLinExpr lhs = vars["t_rear_departure"](tr, v) +
+          GRBLinExpr lhs = vars.get<Var::TRearDeparture>()(tr, v) +
                            M * static_cast<double>(p.size());
           for (const auto& e_p : p) {
-            lhs -= M * vars["x"](tr, e_p);
+            lhs -= M * vars.get<Var::X>()(tr, e_p);
           }
 
           if (last_edge_obj.target == exit &&
@@ -1082,7 +1662,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
 
             const auto tr_max_speed_tmp =
                 std::min({tr_object.max_speed,
-                          instance.const_n().maximal_vertex_speed(
+                          instance->const_n().maximal_vertex_speed(
                               exit, edges_used_by_train),
                           last_edge_obj.max_speed});
 
@@ -1112,32 +1692,30 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                 const auto& v1_velocities =
                     velocity_extensions.at(tr).at(last_edge_obj.source);
                 for (size_t j = 0; j < v1_velocities.size(); j++) {
-                  if (v1_velocities.at(j) > tr_max_speed_tmp) {
-                    continue;
-                  }
-                  if (cda_rail::possible_by_eom(
-                          v1_velocities.at(j), v_exit_velocity,
-                          tr_object.acceleration, tr_object.deceleration,
-                          last_edge_obj.length)) {
+                  if (eom_table_entry(tr, last_edge, j, i).possible) {
                     min_travel_time_expr +=
-                        vars["y"](tr, last_edge, j, i) * min_t_to_required_pos;
+                        vars[Var::Y].at(tr, last_edge, j, i) *
+                        min_t_to_required_pos;
                     max_travel_time_expr +=
-                        vars["y"](tr, last_edge, j, i) * max_t_to_required_pos;
+                        vars[Var::Y].at(tr, last_edge, j, i) *
+                        max_t_to_required_pos;
                   }
                 }
               }
             }
 
-            model->addConstr(lhs >= vars["t_front_departure"](tr, exit) +
+            model->addConstr(lhs >= vars.get<Var::TFrontDeparture>()(tr, exit) +
                                         min_travel_time_expr,
-                             "rear_departure_half_leaving_1_" + tr_object.name +
-                                 "_" + instance.const_n().get_vertex(v).name +
-                                 "_" + std::to_string(p_ind));
-            model->addConstr(lhs <= vars["t_front_departure"](tr, exit) +
+                             name("rear_departure_half_leaving_1_",
+                                  tr_object.name, "_",
+                                  instance->const_n().get_vertex(v).name, "_",
+                                  p_ind));
+            model->addConstr(lhs <= vars.get<Var::TFrontDeparture>()(tr, exit) +
                                         max_travel_time_expr,
-                             "rear_departure_half_leaving_2_" + tr_object.name +
-                                 "_" + instance.const_n().get_vertex(v).name +
-                                 "_" + std::to_string(p_ind));
+                             name("rear_departure_half_leaving_2_",
+                                  tr_object.name, "_",
+                                  instance->const_n().get_vertex(v).name, "_",
+                                  p_ind));
 
           } else {
             // The relevant point is on an actual edge
@@ -1153,32 +1731,23 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
             if (rel_pt_on_edge + 1e-6 >= last_edge_obj.length) {
               // Directly use corresponding variable
               model->addConstr(
-                  lhs >= vars["t_front_departure"](tr, last_edge_obj.target),
-                  "rear_departure_2_" + tr_object.name + "_" +
-                      instance.const_n().get_vertex(v).name + "_" +
-                      std::to_string(p_ind));
+                  lhs >= vars.get<Var::TFrontDeparture>()(
+                             tr, last_edge_obj.target),
+                  name("rear_departure_2_", tr_object.name, "_",
+                       instance->const_n().get_vertex(v).name, "_", p_ind));
             } else {
               // Only in this case there is no corresponding variable. Note that
               // objective pushes rear departure down.
               GRBLinExpr t_ref_1 =
-                  vars["t_front_departure"](tr, last_edge_obj.source);
+                  vars.get<Var::TFrontDeparture>()(tr, last_edge_obj.source);
               GRBLinExpr t_ref_2 =
-                  vars["t_front_arrival"](tr, last_edge_obj.target);
+                  vars.get<Var::TFrontArrival>()(tr, last_edge_obj.target);
               const auto v_max_rel_e =
                   std::min(last_edge_obj.max_speed, tr_object.max_speed);
               for (size_t i = 0; i < v_0_velocities.size(); i++) {
-                if (v_0_velocities.at(i) > v_max_rel_e) {
-                  continue;
-                }
                 for (size_t j = 0; j < v_1_velocities.size(); j++) {
-                  if (v_1_velocities.at(j) > v_max_rel_e) {
-                    continue;
-                  }
-                  if (cda_rail::possible_by_eom(
-                          v_0_velocities.at(i), v_1_velocities.at(j),
-                          tr_object.acceleration, tr_object.deceleration,
-                          last_edge_obj.length)) {
-                    t_ref_1 += vars["y"](tr, last_edge, i, j) *
+                  if (eom_table_entry(tr, last_edge, i, j).possible) {
+                    t_ref_1 += vars[Var::Y].at(tr, last_edge, i, j) *
                                cda_rail::min_travel_time_from_start(
                                    v_0_velocities.at(i), v_1_velocities.at(j),
                                    v_max_rel_e, tr_object.acceleration,
@@ -1190,7 +1759,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                             tr_object.acceleration, tr_object.deceleration,
                             last_edge_obj.length, rel_pt_on_edge,
                             last_edge_obj.breakable);
-                    t_ref_2 -= vars["y"](tr, last_edge, i, j) *
+                    t_ref_2 -= vars[Var::Y].at(tr, last_edge, i, j) *
                                (max_travel_time >=
                                         std::numeric_limits<double>::infinity()
                                     ? M
@@ -1200,13 +1769,13 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
               }
 
               model->addConstr(lhs >= t_ref_1,
-                               "rear_departure_1_" + tr_object.name + "_" +
-                                   instance.const_n().get_vertex(v).name + "_" +
-                                   std::to_string(p_ind));
+                               name("rear_departure_1_", tr_object.name, "_",
+                                    instance->const_n().get_vertex(v).name, "_",
+                                    p_ind));
               model->addConstr(lhs >= t_ref_2,
-                               "rear_departure_2_" + tr_object.name + "_" +
-                                   instance.const_n().get_vertex(v).name + "_" +
-                                   std::to_string(p_ind));
+                               name("rear_departure_2_", tr_object.name, "_",
+                                    instance->const_n().get_vertex(v).name, "_",
+                                    p_ind));
             }
           }
         }
@@ -1217,13 +1786,14 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_stopping_constraints() {
+  time_window_constrs.resize(num_tr);
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     // NOLINTNEXTLINE(readability-identifier-naming)
     const auto M = ub_timing_variable(tr);
 
     // Stop at exactly one stop using lhs
-    const auto& tr_schedule = instance.get_schedule(tr);
+    const auto& tr_schedule = instance->get_schedule(tr);
     const auto& tr_stops    = tr_schedule.get_stops();
     for (size_t stop = 0; stop < tr_stops.size(); stop++) {
       const auto& stop_data         = tr_stop_data.at(tr).at(stop);
@@ -1231,46 +1801,48 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
       const auto& stop_station_name = stop_object.get_station_name();
       GRBLinExpr  lhs               = 0;
       for (const auto& [v, paths] : stop_data) {
-        lhs += vars["stop"](tr, stop, v);
+        lhs += vars[Var::Stop].at(tr, stop, v);
 
         // If stopped then t_front_departure - t_front_arrival >= stop_time,
         // otherwise unconstrained Hence, >= stop_time * stop
         model->addConstr(
-            vars["t_front_departure"](tr, v) - vars["t_front_arrival"](tr, v) >=
-                stop_object.get_min_stopping_time() * vars["stop"](tr, stop, v),
-            "min_stop_time_" + tr_object.name + "_" + stop_station_name +
-                "_vertex_" + instance.const_n().get_vertex(v).name);
+            vars.get<Var::TFrontDeparture>()(tr, v) -
+                    vars.get<Var::TFrontArrival>()(tr, v) >=
+                stop_object.get_min_stopping_time() *
+                    vars[Var::Stop].at(tr, stop, v),
+            name("min_stop_time_", tr_object.name, "_", stop_station_name,
+                 "_vertex_", instance->const_n().get_vertex(v).name));
 
         // If stopped then t_front_arrival is within desired arrival interval
         const auto t_0_interval = stop_object.get_begin_range();
         // t >= t_0 * stop
-        model->addConstr(vars["t_front_arrival"](tr, v) >=
-                             t_0_interval.first * vars["stop"](tr, stop, v),
-                         "min_arrival_time_" + tr_object.name + "_" +
-                             stop_station_name + "_vertex_" +
-                             instance.const_n().get_vertex(v).name);
+        model->addConstr(
+            vars.get<Var::TFrontArrival>()(tr, v) >=
+                t_0_interval.first * vars[Var::Stop].at(tr, stop, v),
+            name("min_arrival_time_", tr_object.name, "_", stop_station_name,
+                 "_vertex_", instance->const_n().get_vertex(v).name));
         // t <= t_0 + M * (1 - stop)
         model->addConstr(
-            vars["t_front_arrival"](tr, v) <=
-                t_0_interval.second + M * (1 - vars["stop"](tr, stop, v)),
-            "max_arrival_time_" + tr_object.name + "_" + stop_station_name +
-                "_vertex_" + instance.const_n().get_vertex(v).name);
+            vars.get<Var::TFrontArrival>()(tr, v) <=
+                t_0_interval.second + M * (1 - vars[Var::Stop].at(tr, stop, v)),
+            name("max_arrival_time_", tr_object.name, "_", stop_station_name,
+                 "_vertex_", instance->const_n().get_vertex(v).name));
 
         // If stopped then t_front_departure is within desired departure
         // interval
         const auto t_n_interval = stop_object.get_end_range();
         // t >= t_n * stop
-        model->addConstr(vars["t_front_departure"](tr, v) >=
-                             t_n_interval.first * vars["stop"](tr, stop, v),
-                         "min_departure_time_" + tr_object.name + "_" +
-                             stop_station_name + "_vertex_" +
-                             instance.const_n().get_vertex(v).name);
+        model->addConstr(
+            vars.get<Var::TFrontDeparture>()(tr, v) >=
+                t_n_interval.first * vars[Var::Stop].at(tr, stop, v),
+            name("min_departure_time_", tr_object.name, "_", stop_station_name,
+                 "_vertex_", instance->const_n().get_vertex(v).name));
         // t <= t_n + M * (1 - stop)
         model->addConstr(
-            vars["t_front_departure"](tr, v) <=
-                t_n_interval.second + M * (1 - vars["stop"](tr, stop, v)),
-            "max_departure_time_" + tr_object.name + "_" + stop_station_name +
-                "_vertex_" + instance.const_n().get_vertex(v).name);
+            vars.get<Var::TFrontDeparture>()(tr, v) <=
+                t_n_interval.second + M * (1 - vars[Var::Stop].at(tr, stop, v)),
+            name("max_departure_time_", tr_object.name, "_", stop_station_name,
+                 "_vertex_", instance->const_n().get_vertex(v).name));
 
         // Train can only stop if one of the valid edge paths is used
         GRBLinExpr path_expr = 0;
@@ -1280,67 +1852,71 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
           // direction of inference is needed, continuous should suffice
           const auto tmp_var = model->addVar(
               0.0, 1.0, 0.0, GRB_CONTINUOUS,
-              "stop_path_" + tr_object.name + "_" + stop_station_name +
-                  "_vertex_" + instance.const_n().get_vertex(v).name +
-                  "_path_" + std::to_string(p_index));
+              name("stop_path_", tr_object.name, "_", stop_station_name,
+                   "_vertex_", instance->const_n().get_vertex(v).name, "_path_",
+                   p_index));
           path_expr += tmp_var;
           for (const auto& e : p) {
-            model->addConstr(tmp_var <= vars["x"](tr, e),
-                             "stop_path_" + tr_object.name + "_" +
-                                 stop_station_name + "_vertex_" +
-                                 instance.const_n().get_vertex(v).name +
-                                 "_path_" + std::to_string(p_index) + "_edge_" +
-                                 std::to_string(e));
+            model->addConstr(tmp_var <= vars.get<Var::X>()(tr, e),
+                             name("stop_path_", tr_object.name, "_",
+                                  stop_station_name, "_vertex_",
+                                  instance->const_n().get_vertex(v).name,
+                                  "_path_", p_index, "_edge_", e));
           }
-          model->addConstr(vars["stop"](tr, stop, v) >= tmp_var,
-                           "use_path_only_if_stopped_" + tr_object.name + "_" +
-                               stop_station_name + "_vertex_" +
-                               instance.const_n().get_vertex(v).name +
-                               "_path_" + std::to_string(p_index));
+          model->addConstr(vars[Var::Stop].at(tr, stop, v) >= tmp_var,
+                           name("use_path_only_if_stopped_", tr_object.name,
+                                "_", stop_station_name, "_vertex_",
+                                instance->const_n().get_vertex(v).name,
+                                "_path_", p_index));
         }
-        model->addConstr(vars["stop"](tr, stop, v) <= path_expr,
-                         "stop_only_if_path_is_used_" + tr_object.name + "_" +
-                             stop_station_name + "_vertex_" +
-                             instance.const_n().get_vertex(v).name);
+        model->addConstr(vars[Var::Stop].at(tr, stop, v) <= path_expr,
+                         name("stop_only_if_path_is_used_", tr_object.name, "_",
+                              stop_station_name, "_vertex_",
+                              instance->const_n().get_vertex(v).name));
       }
       model->addConstr(lhs == 1,
-                       "stop_at_one_vertex_" +
-                           instance.get_train_list().get_train(tr).name + "_" +
-                           stop_station_name);
+                       name("stop_at_one_vertex_",
+                            instance->get_train_list().get_train(tr).name, "_",
+                            stop_station_name));
     }
 
     // Initial
-    const auto& t0_range = tr_schedule.get_t_0_range();
-    model->addConstr(vars["t_front_arrival"](tr, tr_schedule.get_entry()) >=
-                         t0_range.first,
-                     "initial_arrival_time_lb_" + tr_object.name);
-    model->addConstr(vars["t_front_arrival"](tr, tr_schedule.get_entry()) <=
-                         t0_range.second,
-                     "initial_arrival_time_ub_" + tr_object.name);
+    auto&       tr_time_window_constrs = time_window_constrs.at(tr);
+    const auto& t0_range               = tr_schedule.get_t_0_range();
+    tr_time_window_constrs.at(0)       = model->addConstr(
+        vars.get<Var::TFrontArrival>()(tr, tr_schedule.get_entry()) >=
+            t0_range.first,
+        name("initial_arrival_time_lb_", tr_object.name));
+    tr_time_window_constrs.at(1) = model->addConstr(
+        vars.get<Var::TFrontArrival>()(tr, tr_schedule.get_entry()) <=
+            t0_range.second,
+        name("initial_arrival_time_ub_", tr_object.name));
 
     // Final
-    const auto& tn_range = tr_schedule.get_t_n_range();
-    model->addConstr(vars["t_rear_departure"](tr, tr_schedule.get_exit()) >=
-                         tn_range.first,
-                     "final_departure_time_lb_" + tr_object.name);
-    model->addConstr(vars["t_rear_departure"](tr, tr_schedule.get_exit()) <=
-                         tn_range.second,
-                     "final_departure_time_ub_" + tr_object.name);
+    const auto& tn_range         = tr_schedule.get_t_n_range();
+    tr_time_window_constrs.at(2) = model->addConstr(
+        vars.get<Var::TRearDeparture>()(tr, tr_schedule.get_exit()) >=
+            tn_range.first,
+        name("final_departure_time_lb_", tr_object.name));
+    tr_time_window_constrs.at(3) = model->addConstr(
+        vars.get<Var::TRearDeparture>()(tr, tr_schedule.get_exit()) <=
+            tn_range.second,
+        name("final_departure_time_ub_", tr_object.name));
   }
 }
 
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_headway_constraints() {
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     const auto  tr_used_edges =
-        instance.edges_used_by_train(tr, model_detail.fix_routes, false);
-    const auto& tr_schedule_object = instance.get_schedule(tr);
+        instance->edges_used_by_train(tr, model_detail.fix_routes, false);
+    const auto& tr_schedule_object = instance->get_schedule(tr);
     const auto& entry_node         = tr_schedule_object.get_entry();
     const auto  t_bound            = ub_timing_variable(tr);
 
     for (const auto v :
-         instance.vertices_used_by_train(tr, model_detail.fix_routes, false)) {
+         instance->vertices_used_by_train(tr, model_detail.fix_routes, false)) {
       const auto v_velocities = velocity_extensions.at(tr).at(v);
       for (size_t v_source_index = 0; v_source_index < v_velocities.size();
            v_source_index++) {
@@ -1351,8 +1927,8 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
         const auto bd = vel * vel / (2 * tr_object.deceleration);
         // What if bd is outside network. Then relation to point where ma was
         // set to exit node or leave as it is?
-        const auto brake_paths =
-            instance.const_n().all_paths_of_length_starting_in_vertex(
+        const auto& brake_paths =
+            instance->const_n().all_paths_of_length_starting_in_vertex(
                 v, std::max(EPS, bd), {},
                 tr_used_edges); // min EPS so that following edge is detected
                                 // for speed 0
@@ -1361,7 +1937,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
           const auto  p_len = std::accumulate(
               p.begin(), p.end(), 0.0,
               [this](double sum, const auto& edge_index) {
-                return sum + instance.const_n().get_edge(edge_index).length;
+                return sum + instance->const_n().get_edge(edge_index).length;
               });
 
           // Variables to decide if path was used. First edge must leave from
@@ -1369,12 +1945,12 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
           const GRBLinExpr edge_path_expr = get_edge_path_expr(tr, p, vel);
           const auto       tmp_max_speed =
               std::min(tr_object.max_speed,
-                       instance.const_n().get_edge(p.front()).max_speed);
+                       instance->const_n().get_edge(p.front()).max_speed);
 
-          const auto tr_on_last_edge = instance.trains_on_edge_mixed_routing(
+          const auto tr_on_last_edge = instance->trains_on_edge_mixed_routing(
               p.back(), model_detail.fix_routes, false);
 
-          const auto& last_edge_object = instance.const_n().get_edge(p.back());
+          const auto& last_edge_object = instance->const_n().get_edge(p.back());
 
           for (const auto& tr2 : tr_on_last_edge) {
             if (tr == tr2) {
@@ -1384,16 +1960,16 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
             const auto t_bound_tmp = std::max(t_bound, ub_timing_variable(tr2));
 
             const GRBLinExpr lhs =
-                vars["t_front_arrival"](tr, v) +
+                vars.get<Var::TFrontArrival>()(tr, v) +
                 t_bound_tmp * (static_cast<double>(p.size()) - edge_path_expr) +
-                t_bound_tmp * (1 - vars["order"](tr, tr2, p.back()));
+                t_bound_tmp * (1 - vars[Var::Order].at(tr, tr2, p.back()));
             std::vector<GRBLinExpr> rhs;
             if (p_len + EPS >= bd && p_len - EPS <= bd) {
               // Target vertex is exactly the desired moving authority
               // t_front_departure(tr, v) >= t_rear_departure(tr2, target) if
               // order(tr, tr2, e) = 1 and path p chosen.
-              rhs.emplace_back(
-                  vars["t_rear_departure"](tr2, last_edge_object.target));
+              rhs.emplace_back(vars.get<Var::TRearDeparture>()(
+                  tr2, last_edge_object.target));
             } else {
               assert(p_len > bd && p_len - last_edge_object.length <= bd);
               const auto  target_point = bd - p_len + last_edge_object.length;
@@ -1401,11 +1977,12 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                   velocity_extensions.at(tr2).at(last_edge_object.source);
               const auto& v_tr2_target_velocities =
                   velocity_extensions.at(tr2).at(last_edge_object.target);
-              rhs.emplace_back(
-                  vars["t_rear_departure"](tr2, last_edge_object.source));
-              rhs.emplace_back(
-                  vars["t_rear_departure"](tr2, last_edge_object.target));
-              const auto& tr2_object = instance.get_train_list().get_train(tr2);
+              rhs.emplace_back(vars.get<Var::TRearDeparture>()(
+                  tr2, last_edge_object.source));
+              rhs.emplace_back(vars.get<Var::TRearDeparture>()(
+                  tr2, last_edge_object.target));
+              const auto& tr2_object =
+                  instance->get_train_list().get_train(tr2);
               const auto  max_speed =
                   std::min(tr2_object.max_speed, last_edge_object.max_speed);
               for (size_t v_tr2_source_index = 0;
@@ -1413,25 +1990,18 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                    v_tr2_source_index++) {
                 const auto& vel_tr2_source =
                     v_tr2_source_velocities.at(v_tr2_source_index);
-                if (vel_tr2_source > max_speed) {
-                  continue;
-                }
                 for (size_t v_tr2_target_index = 0;
                      v_tr2_target_index < v_tr2_target_velocities.size();
                      v_tr2_target_index++) {
                   const auto& vel_tr2_target =
                       v_tr2_target_velocities.at(v_tr2_target_index);
-                  if (vel_tr2_target > max_speed) {
-                    continue;
-                  }
-                  if (cda_rail::possible_by_eom(vel_tr2_source, vel_tr2_target,
-                                                tr2_object.acceleration,
-                                                tr2_object.deceleration,
-                                                last_edge_object.length)) {
+                  if (eom_table_entry(tr2, p.back(), v_tr2_source_index,
+                                      v_tr2_target_index)
+                          .possible) {
                     // first: += y * min_t
                     // second: -= y * max_t
                     rhs.at(0) +=
-                        vars["y"](tr2, p.back(), v_tr2_source_index,
+                        vars[Var::Y].at(tr2, p.back(), v_tr2_source_index,
                                   v_tr2_target_index) *
                         cda_rail::min_travel_time_from_start(
                             vel_tr2_source, vel_tr2_target, max_speed,
@@ -1444,7 +2014,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                             last_edge_object.length, target_point,
                             last_edge_object.breakable);
                     rhs.at(1) -=
-                        vars["y"](tr2, p.back(), v_tr2_source_index,
+                        vars[Var::Y].at(tr2, p.back(), v_tr2_source_index,
                                   v_tr2_target_index) *
                         (max_travel_time > t_bound_tmp ? t_bound_tmp
                                                        : max_travel_time);
@@ -1455,11 +2025,11 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
             for (size_t rhs_idx = 0; rhs_idx < rhs.size(); rhs_idx++) {
               model->addConstr(
                   lhs >= rhs.at(rhs_idx),
-                  "headway_" + std::to_string(rhs_idx) + "-" +
-                      std::to_string(rhs.size()) + "_" + tr_object.name + "_" +
-                      instance.get_train_list().get_train(tr2).name + "_" +
-                      instance.const_n().get_vertex(v).name + "_" +
-                      std::to_string(vel) + "_" + std::to_string(p_index));
+                  name("headway_", rhs_idx, "-", rhs.size(), "_",
+                       tr_object.name, "_",
+                       instance->get_train_list().get_train(tr2).name, "_",
+                       instance->const_n().get_vertex(v).name, "_", vel, "_",
+                       p_index));
             }
           }
 
@@ -1472,18 +2042,18 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
             const auto p_tmp_len = std::accumulate(
                 p_tmp.begin(), p_tmp.end(), 0.0,
                 [this](double sum, const auto& edge_index) {
-                  return sum + instance.const_n().get_edge(edge_index).length;
+                  return sum + instance->const_n().get_edge(edge_index).length;
                 });
             GRBLinExpr edge_tmp_path_expr = 0;
             for (const auto& e_tmp : p_tmp) {
-              edge_tmp_path_expr += vars["x"](tr, e_tmp);
+              edge_tmp_path_expr += vars.get<Var::X>()(tr, e_tmp);
             }
 
             const auto obd = bd - p_tmp_len;
 
             assert(obd >= 0);
 
-            const auto tr_on_ttd = instance.trains_in_section(
+            const auto tr_on_ttd = instance->trains_in_section(
                 ttd_sections.at(ttd_index), model_detail.fix_routes, false);
             for (const auto& tr2 : tr_on_ttd) {
               if (tr == tr2) {
@@ -1494,12 +2064,13 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                   std::max(t_bound, ub_timing_variable(tr2));
 
               GRBLinExpr lhs_from_rear =
-                  vars["t_front_arrival"](tr, v) +
+                  vars.get<Var::TFrontArrival>()(tr, v) +
                   t_bound_tmp *
                       (static_cast<double>(p_tmp.size()) - edge_tmp_path_expr);
               const GRBLinExpr rhs =
-                  vars["t_ttd_departure"](tr2, ttd_index) +
-                  t_bound_tmp * (vars["order_ttd"](tr, tr2, ttd_index) - 1);
+                  vars.get<Var::TTtdDeparture>()(tr2, ttd_index) +
+                  t_bound_tmp *
+                      (vars[Var::OrderTtd].at(tr, tr2, ttd_index) - 1);
 
               bool is_relevant = obd < GRB_EPS;
 
@@ -1514,7 +2085,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                   is_relevant = true;
                 } else {
                   std::vector<size_t> rel_in_edges;
-                  for (const auto& e : instance.const_n().in_edges(v)) {
+                  for (const auto& e : instance->const_n().in_edges(v)) {
                     if (std::find(tr_used_edges.begin(), tr_used_edges.end(),
                                   e) != tr_used_edges.end()) {
                       rel_in_edges.push_back(e);
@@ -1525,7 +2096,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                   // might not be reachable from the network itself.
                   for (const auto& e_before_v : rel_in_edges) {
                     const auto& e_before_v_obj =
-                        instance.const_n().get_edge(e_before_v);
+                        instance->const_n().get_edge(e_before_v);
                     const auto& v_before_v = e_before_v_obj.source;
                     const auto  v_before_v_velocities =
                         velocity_extensions.at(tr).at(v_before_v);
@@ -1545,11 +2116,11 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                               e_before_v_obj.length + p_tmp_len) {
                         continue;
                       }
-                      if (cda_rail::possible_by_eom(
-                              vel_before_v, vel, tr_object.acceleration,
-                              tr_object.deceleration, e_before_v_obj.length)) {
+                      if (eom_table_entry(tr, e_before_v, v_before_v_index,
+                                          v_source_index)
+                              .possible) {
                         lhs_from_rear -=
-                            vars["y"](tr, e_before_v, v_before_v_index,
+                            vars[Var::Y].at(tr, e_before_v, v_before_v_index,
                                       v_source_index) *
                             cda_rail::min_time_from_rear_to_ma_point(
                                 vel_before_v, vel, V_MIN, e_before_v_tmp_max,
@@ -1564,23 +2135,22 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
                                 e_before_v_obj.length, obd,
                                 e_before_v_obj.breakable);
                         const GRBLinExpr lhs_from_front =
-                            vars["t_front_departure"](tr, v_before_v) +
+                            vars.get<Var::TFrontDeparture>()(tr, v_before_v) +
                             std::min(max_from_front, t_bound_tmp) +
                             t_bound_tmp *
                                 (static_cast<double>(p_tmp.size()) + 1 -
-                                 vars["y"](tr, e_before_v, v_before_v_index,
-                                           v_source_index) -
+                                 vars[Var::Y].at(tr, e_before_v,
+                                                 v_before_v_index,
+                                                 v_source_index) -
                                  edge_tmp_path_expr);
                         model->addConstr(
                             lhs_from_front >= rhs,
-                            "headway_ttd_" + std::to_string(ttd_index) +
-                                "from_front_" + tr_object.name + "_" +
-                                instance.get_train_list().get_train(tr2).name +
-                                "_" + instance.const_n().get_vertex(v).name +
-                                "_" + std::to_string(vel) + "_" +
-                                std::to_string(p_index) + "_" +
-                                std::to_string(e_before_v) + "_" +
-                                std::to_string(vel_before_v));
+                            name("headway_ttd_", ttd_index, "from_front_",
+                                 tr_object.name, "_",
+                                 instance->get_train_list().get_train(tr2).name,
+                                 "_", instance->const_n().get_vertex(v).name,
+                                 "_", vel, "_", p_index, "_", e_before_v, "_",
+                                 vel_before_v));
                       }
                     }
                   }
@@ -1589,11 +2159,10 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
               if (is_relevant) {
                 model->addConstr(
                     lhs_from_rear >= rhs,
-                    "headway_ttd_" + tr_object.name + "_" +
-                        instance.get_train_list().get_train(tr2).name + "_" +
-                        instance.const_n().get_vertex(v).name + "_" +
-                        std::to_string(vel) + "_" + std::to_string(p_index) +
-                        "_" + std::to_string(ttd_index));
+                    name("headway_ttd_", tr_object.name, "_",
+                         instance->get_train_list().get_train(tr2).name, "_",
+                         instance->const_n().get_vertex(v).name, "_", vel, "_",
+                         p_index, "_", ttd_index));
               }
             }
           }
@@ -1611,45 +2180,46 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
   // parameters
 
   for (size_t tr = 0; tr < num_tr; tr++) {
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     const auto  t_bound   = ub_timing_variable(tr);
 
-    for (const auto e : instance.edges_used_by_train(
+    for (const auto e : instance->edges_used_by_train(
              tr, this->model_detail.fix_routes, false)) {
-      const auto& e_obj           = instance.const_n().get_edge(e);
+      const auto& e_obj           = instance->const_n().get_edge(e);
       const auto& v_source        = e_obj.source;
       const auto& v_target        = e_obj.target;
-      const auto& v_source_object = instance.const_n().get_vertex(v_source);
-      const auto& v_target_object = instance.const_n().get_vertex(v_target);
+      const auto& v_source_object = instance->const_n().get_vertex(v_source);
+      const auto& v_target_object = instance->const_n().get_vertex(v_target);
 
       auto [hw_max, headway_tr_on_e, hw_max_ttd, headway_tr_on_ttd] =
           get_edge_headway_expressions(tr, e);
 
       // departure because ma might move forward, otherwise arrival and
       // departure are equal due to non-zero velocity
-      GRBVar tr_t_var = vars["t_front_departure"](tr, v_source);
+      GRBVar tr_t_var = vars.get<Var::TFrontDeparture>()(tr, v_source);
 
-      const auto tr_on_e = instance.trains_on_edge_mixed_routing(
+      const auto tr_on_e = instance->trains_on_edge_mixed_routing(
           e, model_detail.fix_routes, false);
       for (const auto& tr2 : tr_on_e) {
         if (tr == tr2) {
           continue;
         }
         const auto t_bound_tmp = std::max(t_bound, ub_timing_variable(tr2));
-        const auto tr2_t_var   = vars["t_rear_departure"](tr2, v_target);
+        const auto tr2_t_var   = vars.get<Var::TRearDeparture>()(tr2, v_target);
 
         model->addConstr(
             tr_t_var - tr2_t_var +
-                    (t_bound_tmp + hw_max) * (1 - vars["order"](tr, tr2, e)) >=
+                    (t_bound_tmp + hw_max) *
+                        (1 - vars[Var::Order].at(tr, tr2, e)) >=
                 headway_tr_on_e,
-            "headway_simplified_" + tr_object.name + "_" +
-                instance.get_train_list().get_train(tr2).name + "_" +
-                v_source_object.name + "_" + v_target_object.name);
+            name("headway_simplified_", tr_object.name, "_",
+                 instance->get_train_list().get_train(tr2).name, "_",
+                 v_source_object.name, "_", v_target_object.name));
       }
 
       // TTD constraint on entering edge
       const auto neighboring_edges =
-          instance.const_n().neighboring_edges(v_source);
+          instance->const_n().neighboring_edges(v_source);
       const auto intersecting_ttd =
           cda_rail::Network::get_intersecting_ttd({e}, ttd_sections);
       for (const auto& [ttd_index, _] : intersecting_ttd) {
@@ -1665,23 +2235,24 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
             });
         if (is_entering_edge) {
           // We need a constraint for each other train in the TTD section
-          const auto tr_on_ttd = instance.trains_in_section(
+          const auto tr_on_ttd = instance->trains_in_section(
               ttd_section, model_detail.fix_routes, false);
           for (const auto& tr2 : tr_on_ttd) {
             if (tr == tr2) {
               continue;
             }
             const auto t_bound_tmp = std::max(t_bound, ub_timing_variable(tr2));
-            const auto tr2_t_var   = vars["t_ttd_departure"](tr2, ttd_index);
+            const auto tr2_t_var =
+                vars.get<Var::TTtdDeparture>()(tr2, ttd_index);
             model->addConstr(
                 tr_t_var - tr2_t_var +
                         (t_bound_tmp + hw_max_ttd) *
-                            (1 - vars["order_ttd"](tr, tr2, ttd_index)) >=
+                            (1 - vars[Var::OrderTtd].at(tr, tr2, ttd_index)) >=
                     headway_tr_on_ttd,
-                "headway_simplified_ttd_" + tr_object.name + "_" +
-                    instance.get_train_list().get_train(tr2).name + "_" +
-                    v_source_object.name + "_" + v_target_object.name + "_ttd" +
-                    std::to_string(ttd_index));
+                name("headway_simplified_ttd_", tr_object.name, "_",
+                     instance->get_train_list().get_train(tr2).name, "_",
+                     v_source_object.name, "_", v_target_object.name, "_ttd",
+                     ttd_index));
           }
         }
       }
@@ -1693,17 +2264,17 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_basic_ttd_constraints() {
   for (size_t i = 0; i < ttd_sections.size(); i++) {
     const auto& ttd_section = ttd_sections.at(i);
-    const auto  tr_on_ttd =
-        instance.trains_in_section(ttd_section, model_detail.fix_routes, false);
+    const auto  tr_on_ttd   = instance->trains_in_section(
+        ttd_section, model_detail.fix_routes, false);
     for (size_t tr_on_ttd_index = 0; tr_on_ttd_index < tr_on_ttd.size();
          tr_on_ttd_index++) {
       const auto& tr      = tr_on_ttd.at(tr_on_ttd_index);
       const auto  t_bound = ub_timing_variable(tr);
-      const auto& tr_name = instance.get_train_list().get_train(tr).name;
+      const auto& tr_name = instance->get_train_list().get_train(tr).name;
 
       // x_ttd aggregates x values
       const auto e_tr =
-          instance.edges_used_by_train(tr, model_detail.fix_routes, false);
+          instance->edges_used_by_train(tr, model_detail.fix_routes, false);
       // relevant edges are intersection of ttd_section and e_tr
       std::vector<size_t> relevant_edges;
       for (const auto& e : ttd_section) {
@@ -1713,17 +2284,17 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
       }
       GRBLinExpr rhs = 0;
       for (const auto& e : relevant_edges) {
-        const auto e_object = instance.const_n().get_edge(e);
+        const auto e_object = instance->const_n().get_edge(e);
         const auto v1_name =
-            instance.const_n().get_vertex(e_object.source).name;
+            instance->const_n().get_vertex(e_object.source).name;
         const auto v2_name =
-            instance.const_n().get_vertex(e_object.target).name;
-        model->addConstr(vars["x_ttd"](tr, i) >= vars["x"](tr, e),
-                         "aggregate_edge_ttd_1_" +
-                             instance.get_train_list().get_train(tr).name +
-                             "_" + std::to_string(i) + "_" + v1_name + "-" +
-                             v2_name);
-        rhs += vars["x"](tr, e);
+            instance->const_n().get_vertex(e_object.target).name;
+        model->addConstr(
+            vars.get<Var::XTtd>()(tr, i) >= vars.get<Var::X>()(tr, e),
+            name("aggregate_edge_ttd_1_",
+                 instance->get_train_list().get_train(tr).name, "_", i, "_",
+                 v1_name, "-", v2_name));
+        rhs += vars.get<Var::X>()(tr, e);
 
         // Moreover bound t_ttd_departure
         // >= t_rear_departure(v2) * x(e)
@@ -1734,52 +2305,53 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
         // t_ttd >= 0 (already by definition)
         // Because we are only interested in bounding the time from below no
         // other constraints are needed.
-        model->addConstr(vars["t_ttd_departure"](tr, i) >=
-                             vars["t_rear_departure"](tr, e_object.target) -
-                                 t_bound * (1 - vars["x"](tr, e)),
-                         "ttd_departure_bound_" +
-                             instance.get_train_list().get_train(tr).name +
-                             "_" + std::to_string(i) + "_" + v1_name + "-" +
-                             v2_name);
+        model->addConstr(
+            vars.get<Var::TTtdDeparture>()(tr, i) >=
+                vars.get<Var::TRearDeparture>()(tr, e_object.target) -
+                    t_bound * (1 - vars.get<Var::X>()(tr, e)),
+            name("ttd_departure_bound_",
+                 instance->get_train_list().get_train(tr).name, "_", i, "_",
+                 v1_name, "-", v2_name));
       }
-      model->addConstr(vars["x_ttd"](tr, i) <= rhs,
-                       "aggregate_edge_ttd_2_" +
-                           instance.get_train_list().get_train(tr).name + "_" +
-                           std::to_string(i));
+      model->addConstr(vars.get<Var::XTtd>()(tr, i) <= rhs,
+                       name("aggregate_edge_ttd_2_",
+                            instance->get_train_list().get_train(tr).name, "_",
+                            i));
 
       for (size_t tr2_on_ttd_index = tr_on_ttd_index + 1;
            tr2_on_ttd_index < tr_on_ttd.size(); tr2_on_ttd_index++) {
         const auto& tr2         = tr_on_ttd.at(tr2_on_ttd_index);
         const auto  t_bound_tmp = std::max(t_bound, ub_timing_variable(tr2));
-        const auto& tr2_name    = instance.get_train_list().get_train(tr2).name;
+        const auto& tr2_name = instance->get_train_list().get_train(tr2).name;
 
         // Order constraints as usual
         model->addConstr(
-            vars["order_ttd"](tr, tr2, i) + vars["order_ttd"](tr2, tr, i) <=
-                0.5 * (vars["x_ttd"](tr, i) + vars["x_ttd"](tr2, i)),
-            "ttd_order_1_" + tr_name + "_" + tr2_name + "_" +
-                std::to_string(i));
-        model->addConstr(vars["order_ttd"](tr, tr2, i) +
-                                 vars["order_ttd"](tr2, tr, i) >=
-                             vars["x_ttd"](tr, i) - vars["x_ttd"](tr2, i) - 1,
-                         "ttd_order_2_" + tr_name + "_" + tr2_name + "_" +
-                             std::to_string(i));
+            vars[Var::OrderTtd].at(tr, tr2, i) +
+                    vars[Var::OrderTtd].at(tr2, tr, i) <=
+                0.5 * (vars.get<Var::XTtd>()(tr, i) +
+                       vars.get<Var::XTtd>()(tr2, i)),
+            name("ttd_order_1_", tr_name, "_", tr2_name, "_", i));
+        model->addConstr(vars[Var::OrderTtd].at(tr, tr2, i) +
+                                 vars[Var::OrderTtd].at(tr2, tr, i) >=
+                             vars.get<Var::XTtd>()(tr, i) -
+                                 vars.get<Var::XTtd>()(tr2, i) - 1,
+                         name("ttd_order_2_", tr_name, "_", tr2_name, "_", i));
 
         // If tr1 follows tr2 then t_ttd_departure(tr1) >= t_ttd_departure(tr2)
-        model->addConstr(vars["t_ttd_departure"](tr, i) +
+        model->addConstr(vars.get<Var::TTtdDeparture>()(tr, i) +
                                  t_bound_tmp *
-                                     (1 - vars["order_ttd"](tr, tr2, i)) >=
-                             vars["t_ttd_departure"](tr2, i),
-                         "ttd_order_3_time_" + tr_name + "_" + tr2_name + "_" +
-                             std::to_string(i));
+                                     (1 - vars[Var::OrderTtd].at(tr, tr2, i)) >=
+                             vars.get<Var::TTtdDeparture>()(tr2, i),
+                         name("ttd_order_3_time_", tr_name, "_", tr2_name, "_",
+                              i));
 
         // If tr2 follows tr1 then t_ttd_departure(tr2) >= t_ttd_departure(tr1)
-        model->addConstr(vars["t_ttd_departure"](tr2, i) +
+        model->addConstr(vars.get<Var::TTtdDeparture>()(tr2, i) +
                                  t_bound_tmp *
-                                     (1 - vars["order_ttd"](tr2, tr, i)) >=
-                             vars["t_ttd_departure"](tr, i),
-                         "ttd_order_4_time_" + tr2_name + "_" + tr_name + "_" +
-                             std::to_string(i));
+                                     (1 - vars[Var::OrderTtd].at(tr2, tr, i)) >=
+                             vars.get<Var::TTtdDeparture>()(tr, i),
+                         name("ttd_order_4_time_", tr2_name, "_", tr_name, "_",
+                              i));
       }
     }
   }
@@ -1789,53 +2361,54 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_reverse_edge_constraints() {
   for (size_t idx = 0; idx < relevant_reverse_edges.size(); idx++) {
     const auto& [e1, e2] = relevant_reverse_edges.at(idx);
-    const auto tr_list_1 = instance.trains_on_edge_mixed_routing(
+    const auto tr_list_1 = instance->trains_on_edge_mixed_routing(
         e1, model_detail.fix_routes, false);
-    const auto tr_list_2 = instance.trains_on_edge_mixed_routing(
+    const auto tr_list_2 = instance->trains_on_edge_mixed_routing(
         e2, model_detail.fix_routes, false);
 
-    const auto  e_obj   = instance.const_n().get_edge(e1);
-    const auto& v1_name = instance.const_n().get_vertex(e_obj.source).name;
-    const auto& v2_name = instance.const_n().get_vertex(e_obj.target).name;
+    const auto  e_obj   = instance->const_n().get_edge(e1);
+    const auto& v1_name = instance->const_n().get_vertex(e_obj.source).name;
+    const auto& v2_name = instance->const_n().get_vertex(e_obj.target).name;
 
     for (const auto& tr1 : tr_list_1) {
-      const auto& tr1_name = instance.get_train_list().get_train(tr1).name;
+      const auto& tr1_name = instance->get_train_list().get_train(tr1).name;
       const auto  ub_val_1 = ub_timing_variable(tr1);
       for (const auto& tr2 : tr_list_2) {
         if (tr1 == tr2) {
           continue;
         }
-        const auto& tr2_name = instance.get_train_list().get_train(tr2).name;
+        const auto& tr2_name = instance->get_train_list().get_train(tr2).name;
         const auto  ub_val_2 = ub_timing_variable(tr2);
         const auto  t_bound  = std::max(ub_val_1, ub_val_2);
-        model->addConstr(vars["reverse_order"](tr1, tr2, idx) +
-                                 vars["reverse_order"](tr2, tr1, idx) >=
-                             vars["x"](tr1, e1) + vars["x"](tr2, e2) - 1,
-                         "reverse_order_lb_" + tr1_name + "_" + tr2_name + "_" +
-                             v1_name + "-" + v2_name);
-        model->addConstr(vars["reverse_order"](tr1, tr2, idx) +
-                                 vars["reverse_order"](tr2, tr1, idx) <=
+        model->addConstr(vars[Var::ReverseOrder].at(tr1, tr2, idx) +
+                                 vars[Var::ReverseOrder].at(tr2, tr1, idx) >=
+                             vars.get<Var::X>()(tr1, e1) +
+                                 vars.get<Var::X>()(tr2, e2) - 1,
+                         name("reverse_order_lb_", tr1_name, "_", tr2_name, "_",
+                              v1_name, "-", v2_name));
+        model->addConstr(vars[Var::ReverseOrder].at(tr1, tr2, idx) +
+                                 vars[Var::ReverseOrder].at(tr2, tr1, idx) <=
                              1,
-                         "reverse_order_ub_" + tr1_name + "_" + tr2_name + "_" +
-                             v1_name + "-" + v2_name);
+                         name("reverse_order_ub_", tr1_name, "_", tr2_name, "_",
+                              v1_name, "-", v2_name));
 
         // If tr1 follows tr2 then front of tr1 >= rear of tr2 at source vertex
         // (of e1)
         model->addConstr(
-            vars["t_front_arrival"](tr1, e_obj.source) +
-                    t_bound * (1 - vars["reverse_order"](tr1, tr2, idx)) >=
-                vars["t_rear_departure"](tr2, e_obj.source),
-            "reverse_order_1_" + tr1_name + "_" + tr2_name + "_" + v1_name +
-                "-" + v2_name);
+            vars.get<Var::TFrontArrival>()(tr1, e_obj.source) +
+                    t_bound * (1 - vars[Var::ReverseOrder].at(tr1, tr2, idx)) >=
+                vars.get<Var::TRearDeparture>()(tr2, e_obj.source),
+            name("reverse_order_1_", tr1_name, "_", tr2_name, "_", v1_name, "-",
+                 v2_name));
 
         // If tr2 follows tr1 then front of tr2 >= rear of tr1 at source vertex
         // of e2, hence, target vertex of e1
         model->addConstr(
-            vars["t_front_arrival"](tr2, e_obj.target) +
-                    t_bound * (1 - vars["reverse_order"](tr2, tr1, idx)) >=
-                vars["t_rear_departure"](tr1, e_obj.target),
-            "reverse_order_2_" + tr2_name + "_" + tr1_name + "_" + v1_name +
-                "-" + v2_name);
+            vars.get<Var::TFrontArrival>()(tr2, e_obj.target) +
+                    t_bound * (1 - vars[Var::ReverseOrder].at(tr2, tr1, idx)) >=
+                vars.get<Var::TRearDeparture>()(tr1, e_obj.target),
+            name("reverse_order_2_", tr2_name, "_", tr1_name, "_", v1_name, "-",
+                 v2_name));
       }
     }
   }
@@ -1845,22 +2418,24 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     create_vertex_headway_constraints() {
   // If a line headway is specified (most importantly on exit nodes), then obey
   // This only takes into account if the same previous or next edge is used
+  const auto& t_front_arrival  = vars.get<Var::TFrontArrival>();
+  const auto& t_rear_departure = vars.get<Var::TRearDeparture>();
   for (size_t e = 0; e < num_edges; e++) {
-    const auto& tr_on_edge = instance.trains_on_edge_mixed_routing(
+    const auto& tr_on_edge = instance->trains_on_edge_mixed_routing(
         e, model_detail.fix_routes, false);
     if (tr_on_edge.size() <= 1) {
       continue;
     }
 
-    const auto& e_object        = instance.const_n().get_edge(e);
+    const auto& e_object        = instance->const_n().get_edge(e);
     const auto& source_v        = e_object.source;
     const auto& target_v        = e_object.target;
-    const auto& source_v_object = instance.const_n().get_vertex(source_v);
-    const auto& target_v_object = instance.const_n().get_vertex(target_v);
+    const auto& source_v_object = instance->const_n().get_vertex(source_v);
+    const auto& target_v_object = instance->const_n().get_vertex(target_v);
 
     for (size_t tr1_index = 1; tr1_index < tr_on_edge.size(); tr1_index++) {
       const auto& tr1         = tr_on_edge.at(tr1_index);
-      const auto& tr1_object  = instance.get_train_list().get_train(tr1);
+      const auto& tr1_object  = instance->get_train_list().get_train(tr1);
       const auto  tr1_t_bound = ub_timing_variable(tr1);
 
       auto [hw_s1_max, hw_s1, hw_t1_max, hw_t1] =
@@ -1868,7 +2443,7 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
 
       for (size_t tr2_index = 0; tr2_index < tr1_index; tr2_index++) {
         const auto& tr2         = tr_on_edge.at(tr2_index);
-        const auto& tr2_object  = instance.get_train_list().get_train(tr2);
+        const auto& tr2_object  = instance->get_train_list().get_train(tr2);
         const auto  tr2_t_bound = ub_timing_variable(tr2);
         const auto  t_bound     = std::max(tr1_t_bound, tr2_t_bound);
 
@@ -1877,34 +2452,34 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
 
         // Add headway constraints to both source and target vertices depending
         // on train order
-        model->addConstr(vars["t_front_arrival"](tr1, source_v) +
+        model->addConstr(t_front_arrival.at(tr1, source_v) +
                                  (t_bound + hw_s1_max) *
-                                     (1 - vars["order"](tr1, tr2, e)) >=
-                             vars["t_rear_departure"](tr2, source_v) + hw_s1,
-                         "headway_vertex_source_1_" + tr1_object.name + "_" +
-                             tr2_object.name + "_" + source_v_object.name +
-                             "-" + target_v_object.name);
-        model->addConstr(vars["t_front_arrival"](tr2, source_v) +
+                                     (1 - vars[Var::Order].at(tr1, tr2, e)) >=
+                             t_rear_departure.at(tr2, source_v) + hw_s1,
+                         name("headway_vertex_source_1_", tr1_object.name, "_",
+                              tr2_object.name, "_", source_v_object.name, "-",
+                              target_v_object.name));
+        model->addConstr(t_front_arrival.at(tr2, source_v) +
                                  (t_bound + hw_s2_max) *
-                                     (1 - vars["order"](tr2, tr1, e)) >=
-                             vars["t_rear_departure"](tr1, source_v) + hw_s2,
-                         "headway_vertex_source_2_" + tr1_object.name + "_" +
-                             tr2_object.name + "_" + source_v_object.name +
-                             "-" + target_v_object.name);
-        model->addConstr(vars["t_front_arrival"](tr1, target_v) +
+                                     (1 - vars[Var::Order].at(tr2, tr1, e)) >=
+                             t_rear_departure.at(tr1, source_v) + hw_s2,
+                         name("headway_vertex_source_2_", tr1_object.name, "_",
+                              tr2_object.name, "_", source_v_object.name, "-",
+                              target_v_object.name));
+        model->addConstr(t_front_arrival.at(tr1, target_v) +
                                  (t_bound + hw_t1_max) *
-                                     (1 - vars["order"](tr1, tr2, e)) >=
-                             vars["t_rear_departure"](tr2, target_v) + hw_t1,
-                         "headway_vertex_target_1_" + tr1_object.name + "_" +
-                             tr2_object.name + "_" + source_v_object.name +
-                             "-" + target_v_object.name);
-        model->addConstr(vars["t_front_arrival"](tr2, target_v) +
+                                     (1 - vars[Var::Order].at(tr1, tr2, e)) >=
+                             t_rear_departure.at(tr2, target_v) + hw_t1,
+                         name("headway_vertex_target_1_", tr1_object.name, "_",
+                              tr2_object.name, "_", source_v_object.name, "-",
+                              target_v_object.name));
+        model->addConstr(t_front_arrival.at(tr2, target_v) +
                                  (t_bound + hw_t2_max) *
-                                     (1 - vars["order"](tr2, tr1, e)) >=
-                             vars["t_rear_departure"](tr1, target_v) + hw_t2,
-                         "headway_vertex_target_2_" + tr1_object.name + "_" +
-                             tr2_object.name + "_" + source_v_object.name +
-                             "-" + target_v_object.name);
+                                     (1 - vars[Var::Order].at(tr2, tr1, e)) >=
+                             t_rear_departure.at(tr1, target_v) + hw_t2,
+                         name("headway_vertex_target_2_", tr1_object.name, "_",
+                              tr2_object.name, "_", source_v_object.name, "-",
+                              target_v_object.name));
       }
     }
   }
@@ -1913,17 +2488,15 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
 GRBLinExpr
 cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::get_edge_path_expr(
     size_t tr, const std::vector<size_t>& p, double initial_velocity,
-    bool also_higher_velocities) {
+    bool also_higher_velocities) const {
   // Get linear expression that sums up all corresponding binary variables.
   // For the first edge, only extended vertices starting with the desired
   // velocity are considered If, optionally, also_higher_velocities is true,
   // then also edges leaving with any higher velocity are considered.
   GRBLinExpr edge_path_expr = 0;
 
-  const auto& tr_object     = instance.get_train_list().get_train(tr);
-  const auto& e_1           = p.front();
-  const auto& e_1_obj       = instance.const_n().get_edge(e_1);
-  const auto  tmp_max_speed = std::min(tr_object.max_speed, e_1_obj.max_speed);
+  const auto& e_1     = p.front();
+  const auto& e_1_obj = instance->const_n().get_edge(e_1);
   const auto& v_source_velocities =
       velocity_extensions.at(tr).at(e_1_obj.source);
   const auto& v_target_velocities =
@@ -1935,25 +2508,20 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::get_edge_path_expr(
         std::abs(vel_source - initial_velocity) > EPS) {
       continue;
     }
-    if (vel_source + EPS < initial_velocity || vel_source > tmp_max_speed) {
+    if (vel_source + EPS < initial_velocity) {
       continue;
     }
     for (size_t v_target_index = 0; v_target_index < v_target_velocities.size();
          v_target_index++) {
-      const auto& vel_target = v_target_velocities.at(v_target_index);
-      if (vel_target > tmp_max_speed) {
-        continue;
-      }
-      if (cda_rail::possible_by_eom(vel_source, vel_target,
-                                    tr_object.acceleration,
-                                    tr_object.deceleration, e_1_obj.length)) {
-        edge_path_expr += vars["y"](tr, e_1, v_source_index, v_target_index);
+      if (eom_table_entry(tr, e_1, v_source_index, v_target_index).possible) {
+        edge_path_expr +=
+            vars.at(Var::Y).at(tr, e_1, v_source_index, v_target_index);
       }
     }
   }
   for (const auto& e_p : p) {
     if (e_p != e_1) {
-      edge_path_expr += vars["x"](tr, e_p);
+      edge_path_expr += vars.get<Var::X>().at(tr, e_p);
     }
   }
 
@@ -1963,10 +2531,10 @@ cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::get_edge_path_expr(
 void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::
     fill_relevant_reverse_edges() {
   const auto relevant_breakable_edges =
-      instance.const_n().relevant_breakable_edges();
+      instance->const_n().relevant_breakable_edges();
   relevant_reverse_edges.clear();
   for (const auto& e : relevant_breakable_edges) {
-    const auto reverse_edge = instance.const_n().get_reverse_edge_index(e);
+    const auto reverse_edge = instance->const_n().get_reverse_edge_index(e);
     if (reverse_edge.has_value()) {
       relevant_reverse_edges.emplace_back(e, reverse_edge.value());
     }
@@ -2004,13 +2572,13 @@ double cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::headway(
 
 std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
     GenPOMovingBlockMIPSolver::get_vertex_headway_expressions(size_t tr,
-                                                              size_t e) {
-  const auto& e_object        = instance.const_n().get_edge(e);
+                                                              size_t e) const {
+  const auto& e_object        = instance->const_n().get_edge(e);
   const auto& source_v        = e_object.source;
   const auto& target_v        = e_object.target;
-  const auto& source_v_object = instance.const_n().get_vertex(source_v);
-  const auto& target_v_object = instance.const_n().get_vertex(target_v);
-  const auto& tr_object       = instance.get_train_list().get_train(tr);
+  const auto& source_v_object = instance->const_n().get_vertex(source_v);
+  const auto& target_v_object = instance->const_n().get_vertex(target_v);
+  const auto& tr_object       = instance->get_train_list().get_train(tr);
 
   auto       hw_s1_max = source_v_object.headway;
   auto       hw_t1_max = target_v_object.headway;
@@ -2029,8 +2597,8 @@ std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
       if (source_vel > tr_object.max_speed || source_vel > e_object.max_speed) {
         continue;
       }
-      const auto source_velocity_headway = min_time_to_push_ma_fully_backward(
-          source_vel, tr_object.acceleration, tr_object.deceleration);
+      const auto source_velocity_headway =
+          ma_backward_times.at(tr).at(source_v).at(s_vel_idx);
       hw_s1_max = std::max(hw_s1_max, source_velocity_headway);
       for (size_t t_vel_idx = 0; t_vel_idx < tr_target_velocities.size();
            t_vel_idx++) {
@@ -2039,20 +2607,18 @@ std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
             target_vel > e_object.max_speed) {
           continue;
         }
-        const auto target_velocity_headway = min_time_to_push_ma_fully_backward(
-            target_vel, tr_object.acceleration, tr_object.deceleration);
+        const auto target_velocity_headway =
+            ma_backward_times.at(tr).at(target_v).at(t_vel_idx);
         hw_t1_max = std::max(hw_t1_max, target_velocity_headway);
-        if (cda_rail::possible_by_eom(
-                source_vel, target_vel, tr_object.acceleration,
-                tr_object.deceleration, e_object.length)) {
+        if (eom_table_entry(tr, e, s_vel_idx, t_vel_idx).possible) {
           // Add more headway if velocity headway is larger than vertex
           // required headway
           if (source_velocity_headway > source_v_object.headway) {
-            hw_s1 += vars["y"](tr, e, s_vel_idx, t_vel_idx) *
+            hw_s1 += vars.at(Var::Y).at(tr, e, s_vel_idx, t_vel_idx) *
                      (source_velocity_headway - source_v_object.headway);
           }
           if (target_velocity_headway > target_v_object.headway) {
-            hw_t1 += vars["y"](tr, e, s_vel_idx, t_vel_idx) *
+            hw_t1 += vars.at(Var::Y).at(tr, e, s_vel_idx, t_vel_idx) *
                      (target_velocity_headway - target_v_object.headway);
           }
         }
@@ -2065,15 +2631,14 @@ std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
 
 std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
     GenPOMovingBlockMIPSolver::get_edge_headway_expressions(size_t tr,
-                                                            size_t e) {
-  const auto& e_obj               = instance.const_n().get_edge(e);
-  const auto& tr_object           = instance.get_train_list().get_train(tr);
+                                                            size_t e) const {
+  const auto& e_obj               = instance->const_n().get_edge(e);
   const auto& v_source            = e_obj.source;
   const auto& v_target            = e_obj.target;
   const auto& v_source_velocities = velocity_extensions.at(tr).at(v_source);
   const auto& v_target_velocities = velocity_extensions.at(tr).at(v_target);
 
-  const auto& tr_schedule_object = instance.get_schedule(tr);
+  const auto& tr_schedule_object = instance->get_schedule(tr);
   const auto& entry_node         = tr_schedule_object.get_entry();
   const auto  t_bound            = ub_timing_variable(tr);
 
@@ -2084,23 +2649,13 @@ std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
 
   for (size_t v_source_index = 0; v_source_index < v_source_velocities.size();
        v_source_index++) {
-    const auto& vel_source = v_source_velocities.at(v_source_index);
-    if (vel_source > tr_object.max_speed || vel_source > e_obj.max_speed) {
-      continue;
-    }
     for (size_t v_target_index = 0; v_target_index < v_target_velocities.size();
          v_target_index++) {
-      const auto& vel_target = v_target_velocities.at(v_target_index);
-      if (vel_target > tr_object.max_speed || vel_target > e_obj.max_speed) {
-        continue;
-      }
-      if (cda_rail::possible_by_eom(vel_source, vel_target,
-                                    tr_object.acceleration,
-                                    tr_object.deceleration, e_obj.length)) {
-        auto       hw_tmp = headway(tr_object, e_obj, vel_source, vel_target,
-                                    v_source_index == entry_node);
-        const auto hw_tmp_ttd = min_time_to_push_ma_fully_backward(
-            vel_source, tr_object.acceleration, tr_object.deceleration);
+      if (eom_table_entry(tr, e, v_source_index, v_target_index).possible) {
+        auto       hw_tmp = edge_headway(tr, e, v_source_index, v_target_index,
+                                         v_source_index == entry_node);
+        const auto hw_tmp_ttd =
+            ma_backward_times.at(tr).at(v_source).at(v_source_index);
 
         if (hw_tmp < -t_bound) {
           hw_tmp = -t_bound;
@@ -2116,10 +2671,12 @@ std::tuple<double, GRBLinExpr, double, GRBLinExpr> cda_rail::solver::mip_based::
         }
 
         headway_tr_on_e +=
-            vars["y"](tr, e, v_source_index, v_target_index) * hw_tmp;
+            vars.at(Var::Y).at(tr, e, v_source_index, v_target_index) *
+            hw_tmp;
 
         headway_tr_on_ttd +=
-            vars["y"](tr, e, v_source_index, v_target_index) * hw_tmp_ttd;
+            vars.at(Var::Y).at(tr, e, v_source_index, v_target_index) *
+            hw_tmp_ttd;
       }
     }
   }
@@ -2141,6 +2698,17 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::cleanup() {
   tr_stop_data.clear();
   velocity_extensions.clear();
   relevant_reverse_edges.clear();
+  eom_table_offsets.clear();
+  eom_table.clear();
+  ma_backward_times.clear();
+  min_edge_travel_times.clear();
+  time_windows.clear();
+  callback_solution.clear();
+  velocity_slot_offsets.clear();
+  velocity_slots.clear();
+  persistent_model.reset();
+  time_window_constrs.clear();
+  promoted_lazy_constrs.clear();
 }
 
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-array-to-pointer-decay,performance-inefficient-string-concatenation)
@@ -2,19 +2,27 @@
 #include "Definitions.hpp"
 #include "EOMHelper.hpp"
 #include "MultiArray.hpp"
+#include "ThreadPool.hpp"
 #include "gurobi_c++.h"
 #include "solver/mip-based/GenPOMovingBlockMIPSolver.hpp"
 #include "solver/mip-based/GeneralMIPSolver.hpp"
+#include "solver/mip-based/LazyCallbackProfile.hpp"
+#include "solver/mip-based/LazyCutPool.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <cstdlib>
 #include <exception>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -28,30 +36,65 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
     if (where == GRB_CB_MESSAGE) {
       MessageCallback::callback();
     } else if (where == GRB_CB_MIPSOL) {
-      const auto routes                = get_routes();
-      const auto train_velocities      = get_train_velocities(routes);
-      const auto train_orders_on_edges = get_train_orders_on_edges(routes);
-      const auto train_orders_on_ttd   = get_train_orders_on_ttd();
-
-      auto constraint_created = create_lazy_vertex_headway_constraints(
-          routes, train_velocities, train_orders_on_edges);
+      auto&      profile = solver->lazy_callback_profile;
+      const auto start   = std::chrono::steady_clock::now();
+
+      profile.measure(LazyCallbackPhase::SolutionQuery, [this]() {
+        solver->callback_solution.update([this](const GRBVar* vars, int len) {
+          return getSolution(vars, len);
+        });
+      });
+      const auto& solution = solver->callback_solution;
+
+      const auto routes = profile.measure(LazyCallbackPhase::Routes,
+                                          [this]() { return get_routes(); });
+      const auto train_velocities =
+          profile.measure(LazyCallbackPhase::Velocities,
+                          [&]() { return get_train_velocities(routes); });
+      const auto& train_orders_on_edges = profile.measure(
+          LazyCallbackPhase::EdgeOrders, [&]() -> const TrainOrdersOnEdges& {
+            return get_train_orders_on_edges(routes);
+          });
+      const auto train_orders_on_ttd =
+          profile.measure(LazyCallbackPhase::TtdOrders,
+                          [this]() { return get_train_orders_on_ttd(); });
+
+      auto constraint_created =
+          profile.measure(LazyCallbackPhase::VertexHeadway, [&]() {
+            return create_lazy_vertex_headway_constraints(
+                routes, train_velocities, train_orders_on_edges, solution);
+          });
       if (solver->solver_strategy.lazy_constraint_selection_strategy !=
               LazyConstraintSelectionStrategy::OnlyFirstFound ||
           !constraint_created) {
-        constraint_created =
-            solver->model_detail.simplify_headway_constraints
-                ? create_lazy_simplified_edge_constraints(
-                      routes, train_velocities, train_orders_on_edges,
-                      train_orders_on_ttd)
-                : create_lazy_edge_and_ttd_headway_constraints(
-                      routes, train_velocities, train_orders_on_edges,
-                      train_orders_on_ttd);
+        if (solver->model_detail.simplify_headway_constraints) {
+          constraint_created =
+              profile.measure(LazyCallbackPhase::SimplifiedEdgeHeadway, [&]() {
+                return create_lazy_simplified_edge_constraints(
+                    routes, train_velocities, train_orders_on_edges,
+                    train_orders_on_ttd, solution);
+              });
+        } else {
+          constraint_created =
+              profile.measure(LazyCallbackPhase::EdgeAndTtdHeadway, [&]() {
+                return create_lazy_edge_and_ttd_headway_constraints(
+                    routes, train_velocities, train_orders_on_edges,
+                    train_orders_on_ttd, solution);
+              });
+        }
       }
       if (solver->solver_strategy.lazy_constraint_selection_strategy !=
               LazyConstraintSelectionStrategy::OnlyFirstFound ||
           !constraint_created) {
-        create_lazy_reverse_edge_constraints(train_orders_on_edges);
+        profile.measure(LazyCallbackPhase::ReverseEdge, [&]() {
+          return create_lazy_reverse_edge_constraints(train_orders_on_edges);
+        });
       }
+
+      profile.record_phase(LazyCallbackPhase::Callback,
+                           std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
     }
   } catch (GRBException& e) {
     PLOGE << "Error number: " << e.getErrorCode();
@@ -72,28 +115,28 @@ std::vector<std::vector<std::pair<size_t, double>>> cda_rail::solver::
    * At the same time, save the distance from the start for every vertex.
    */
 
+  const auto& solution = solver->callback_solution;
+
   std::vector<std::vector<std::pair<size_t, double>>> routes;
   routes.reserve(solver->num_tr);
   for (size_t tr = 0; tr < solver->num_tr; tr++) {
     routes.emplace_back();
     assert(routes.size() == tr + 1);
-    const auto entry = solver->instance.get_schedule(tr).get_entry();
-    auto       edges_to_consider = solver->instance.const_n().out_edges(entry);
+    const auto entry = solver->instance->get_schedule(tr).get_entry();
+    auto       edges_to_consider =
+        solver->instance->const_n().out_edges_span(entry);
 
     double current_pos = 0;
     routes[tr].emplace_back(entry, current_pos);
     while (!edges_to_consider.empty()) {
-      const auto& edge_id = edges_to_consider.back();
-      edges_to_consider.pop_back();
-      auto& tmp_var = solver->vars["x"](tr, edge_id);
-      if (!tmp_var.sameAs(GRBVar()) && getSolution(tmp_var) > 0.5) {
-        const auto& edge_object = solver->instance.const_n().get_edge(edge_id);
+      const auto edge_id = edges_to_consider.back();
+      edges_to_consider  = edges_to_consider.first(edges_to_consider.size() - 1);
+      if (solution.value(Var::X, tr, edge_id) > 0.5) {
+        const auto& edge_object = solver->instance->const_n().get_edge(edge_id);
         current_pos += edge_object.length;
         routes[tr].emplace_back(edge_object.target, current_pos);
-        const auto& [old_edge_id, old_edge_pos] =
-            solver->instance.const_n().get_old_edge(edge_id);
-        edges_to_consider = solver->instance.const_n().out_edges(
-            solver->instance.const_n().get_edge(edge_id).target);
+        edges_to_consider =
+            solver->instance->const_n().out_edges_span(edge_object.target);
       }
     }
   }
@@ -103,6 +146,8 @@ std::vector<std::vector<std::pair<size_t, double>>> cda_rail::solver::
 
 std::vector<std::vector<size_t>> cda_rail::solver::mip_based::
     GenPOMovingBlockMIPSolver::LazyCallback::get_train_orders_on_ttd() {
+  const auto& solution = solver->callback_solution;
+
   std::vector<std::vector<size_t>> train_orders_on_ttd;
   train_orders_on_ttd.reserve(solver->num_ttd);
   for (size_t ttd = 0; ttd < solver->num_ttd; ttd++) {
@@ -110,10 +155,8 @@ std::vector<std::vector<size_t>> cda_rail::solver::mip_based::
     assert(train_orders_on_ttd.size() == ttd + 1);
     std::unordered_map<size_t, double> train_ttd_times;
     for (size_t tr = 0; tr < solver->num_tr; tr++) {
-      GRBVar x_ttd = solver->vars["x_ttd"](tr, ttd);
-      GRBVar t_ttd = solver->vars["t_ttd_departure"](tr, ttd);
-      if (!x_ttd.sameAs(GRBVar()) && getSolution(x_ttd) > 0.5) {
-        train_ttd_times[tr] = getSolution(t_ttd);
+      if (solution.value(Var::XTtd, tr, ttd) > 0.5) {
+        train_ttd_times[tr] = solution.value(Var::TTtdDeparture, tr, ttd);
         train_orders_on_ttd[ttd].emplace_back(tr);
       }
     }
@@ -129,69 +172,109 @@ std::vector<std::vector<size_t>> cda_rail::solver::mip_based::
   return train_orders_on_ttd;
 }
 
-std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                      std::vector<std::pair<size_t, bool>>>>
-cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
-    get_train_orders_on_edges(
-        const std::vector<std::vector<std::pair<size_t, double>>>& routes) {
-  std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                        std::vector<std::pair<size_t, bool>>>>
-      train_orders_on_edges;
-  train_orders_on_edges.reserve(solver->num_edges);
-  for (size_t edge_id = 0; edge_id < solver->num_edges; edge_id++) {
-    train_orders_on_edges.emplace_back();
-    assert(train_orders_on_edges.size() == edge_id + 1);
-    const auto& edge_object = solver->instance.const_n().get_edge(edge_id);
-    std::unordered_map<size_t, double> train_edge_times_source;
-    std::unordered_map<size_t, double> train_edge_times_target;
-    for (size_t tr = 0; tr < solver->num_tr; tr++) {
-      bool edge_found = false;
-      for (size_t i = 0; i < routes[tr].size() - 1 && !edge_found; i++) {
-        if ((routes[tr][i].first == edge_object.source &&
-             routes[tr][i + 1].first == edge_object.target) ||
-            (routes[tr][i].first == edge_object.target &&
-             routes[tr][i + 1].first == edge_object.source)) {
-          GRBVar t_source =
-              solver->vars["t_front_departure"](tr, edge_object.source);
-          GRBVar t_target =
-              solver->vars["t_rear_departure"](tr, edge_object.target);
-          // Assume they exist by choice of routes
-          train_edge_times_source[tr] = getSolution(t_source);
-          train_edge_times_target[tr] = getSolution(t_target);
-          train_orders_on_edges[edge_id].first.emplace_back(
-              tr, routes[tr][i].first == edge_object.source);
-          train_orders_on_edges[edge_id].second.emplace_back(
-              tr, routes[tr][i].first == edge_object.source);
-          edge_found = true;
-        }
+const cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    TrainOrdersOnEdges&
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+        get_train_orders_on_edges(
+            const std::vector<std::vector<std::pair<size_t, double>>>& routes) {
+  /**
+   * Orders the trains using every edge in either direction. The routes are
+   * traversed once and every visited edge is recorded, so that only edges that
+   * are actually used have to be sorted. All buffers are kept between
+   * callbacks to avoid reallocations.
+   * Only the first traversal of an edge (or its reverse) by a train counts.
+   */
+
+  const auto& solution  = solver->callback_solution;
+  const auto  num_edges = solver->num_edges;
+
+  edge_orders.offsets.assign(num_edges + 1, 0);
+  edge_last_train.assign(num_edges, solver->num_tr);
+  edge_visits.clear();
+
+  const auto visit_edge = [&](size_t edge_id, size_t tr, bool forward) {
+    if (edge_last_train[edge_id] == tr) {
+      return;
+    }
+    edge_last_train[edge_id] = tr;
+    edge_orders.offsets[edge_id + 1]++;
+    // Assume the timing variables exist by choice of routes
+    const auto& edge_object = solver->instance->const_n().get_edge(edge_id);
+    edge_visits.push_back(
+        {edge_id, tr, forward,
+         solution.value(Var::TFrontDeparture, tr, edge_object.source),
+         solution.value(Var::TRearDeparture, tr, edge_object.target)});
+  };
+
+  for (size_t tr = 0; tr < solver->num_tr; tr++) {
+    for (size_t i = 0; i + 1 < routes[tr].size(); i++) {
+      const auto edge_id = solver->instance->const_n().get_edge_index(
+          routes[tr][i].first, routes[tr][i + 1].first);
+      visit_edge(edge_id, tr, true);
+      if (const auto reverse_edge_id =
+              solver->instance->const_n().get_reverse_edge_index(edge_id);
+          reverse_edge_id.has_value()) {
+        visit_edge(reverse_edge_id.value(), tr, false);
       }
     }
-    if (train_orders_on_edges[edge_id].first.size() >= 2) {
-      std::sort(train_orders_on_edges[edge_id].first.begin(),
-                train_orders_on_edges[edge_id].first.end(),
-                [&train_edge_times_source](std::pair<size_t, bool> tr1,
-                                           std::pair<size_t, bool> tr2) {
-                  return train_edge_times_source[tr1.first] <
-                         train_edge_times_source[tr2.first];
-                });
+  }
+
+  for (size_t edge_id = 0; edge_id < num_edges; edge_id++) {
+    edge_orders.offsets[edge_id + 1] += edge_orders.offsets[edge_id];
+  }
+
+  // Bucket the visits by edge, within each edge they remain ordered by train
+  edge_positions.assign(edge_orders.offsets.begin(),
+                        edge_orders.offsets.end() - 1);
+  sorted_edge_visits.resize(edge_visits.size());
+  for (const auto& edge_visit : edge_visits) {
+    sorted_edge_visits[edge_positions[edge_visit.edge_id]++] = edge_visit;
+  }
+
+  edge_orders.by_source.resize(edge_visits.size());
+  edge_orders.by_target.resize(edge_visits.size());
+  const auto write_order = [this](size_t begin, size_t end,
+                                  std::vector<std::pair<size_t, bool>>& order) {
+    for (size_t k = begin; k < end; k++) {
+      order[k] = {sorted_edge_visits[k].tr, sorted_edge_visits[k].forward};
     }
-    if (train_orders_on_edges[edge_id].second.size() >= 2) {
-      std::sort(train_orders_on_edges[edge_id].second.begin(),
-                train_orders_on_edges[edge_id].second.end(),
-                [&train_edge_times_target](std::pair<size_t, bool> tr1,
-                                           std::pair<size_t, bool> tr2) {
-                  return train_edge_times_target[tr1.first] <
-                         train_edge_times_target[tr2.first];
-                });
+  };
+  for (size_t edge_id = 0; edge_id < num_edges; edge_id++) {
+    const auto begin = edge_orders.offsets[edge_id];
+    const auto end   = edge_orders.offsets[edge_id + 1];
+    if (end - begin >= 2) {
+      const auto first = sorted_edge_visits.begin() + begin;
+      const auto last  = sorted_edge_visits.begin() + end;
+      std::sort(first, last, [](const EdgeVisit& v1, const EdgeVisit& v2) {
+        return std::tie(v1.source_time, v1.tr) <
+               std::tie(v2.source_time, v2.tr);
+      });
+      write_order(begin, end, edge_orders.by_source);
+      std::sort(first, last, [](const EdgeVisit& v1, const EdgeVisit& v2) {
+        return std::tie(v1.target_time, v1.tr) <
+               std::tie(v2.target_time, v2.tr);
+      });
+      write_order(begin, end, edge_orders.by_target);
+    } else {
+      write_order(begin, end, edge_orders.by_source);
+      write_order(begin, end, edge_orders.by_target);
     }
   }
 
-  return train_orders_on_edges;
+  return edge_orders;
 }
 
 std::vector<std::unordered_map<size_t, double>> cda_rail::solver::mip_based::
     GenPOMovingBlockMIPSolver::LazyCallback::get_train_velocities(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes) {
+  /**
+   * Extract the velocity of every train at every vertex of its route. Only the
+   * velocity extended variables that exist for the respective edge are
+   * checked.
+   */
+
+  const auto& solution = solver->callback_solution;
+
   std::vector<std::unordered_map<size_t, double>> train_velocities(
       solver->num_tr);
   for (size_t tr = 0; tr < solver->num_tr; tr++) {
@@ -199,27 +282,29 @@ std::vector<std::unordered_map<size_t, double>> cda_rail::solver::mip_based::
          route_v_idx++) {
       const auto& v_idx = routes[tr][route_v_idx].first;
       const auto  e_idx = (route_v_idx == routes[tr].size() - 1)
-                              ? solver->instance.const_n().get_edge_index(
+                              ? solver->instance->const_n().get_edge_index(
                                    routes[tr][route_v_idx - 1].first, v_idx)
-                              : solver->instance.const_n().get_edge_index(
+                              : solver->instance->const_n().get_edge_index(
                                    v_idx, routes[tr][route_v_idx + 1].first);
-      const auto& edge  = solver->instance.const_n().get_edge(e_idx);
+      const auto& edge  = solver->instance->const_n().get_edge(e_idx);
       const auto& source_velocities =
           solver->velocity_extensions.at(tr).at(edge.source);
       const auto& target_velocities =
           solver->velocity_extensions.at(tr).at(edge.target);
 
+      const auto  offset = tr * solver->num_edges + e_idx;
+
       bool vel_found = false;
-      for (size_t i = 0; i < source_velocities.size() && !vel_found; i++) {
-        const auto& source_v = source_velocities[i];
-        for (size_t j = 0; j < target_velocities.size() && !vel_found; j++) {
-          const auto& target_v  = target_velocities[j];
-          GRBVar      y_var_tmp = solver->vars["y"](tr, e_idx, i, j);
-          if (!y_var_tmp.sameAs(GRBVar()) && getSolution(y_var_tmp) > 0.5) {
-            train_velocities[tr][v_idx] =
-                edge.source == v_idx ? source_v : target_v;
-            vel_found = true;
-          }
+      for (size_t k = solver->velocity_slot_offsets.at(offset);
+           k < solver->velocity_slot_offsets.at(offset + 1) && !vel_found;
+           k++) {
+        const auto& y_slot = solver->velocity_slots.at(k);
+        if (solution.value(y_slot.slot) > 0.5) {
+          train_velocities[tr][v_idx] =
+              edge.source == v_idx
+                  ? source_velocities.at(y_slot.source_velocity_index)
+                  : target_velocities.at(y_slot.target_velocity_index);
+          vel_found = true;
         }
       }
       if (!vel_found) {
@@ -238,417 +323,448 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
     create_lazy_edge_and_ttd_headway_constraints(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes,
         const std::vector<std::unordered_map<size_t, double>>& train_velocities,
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-                                                train_orders_on_edges,
-        const std::vector<std::vector<size_t>>& train_orders_on_ttd) {
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution) {
+  return separate_trains_in_parallel(
+      [&](size_t tr, std::vector<PendingLazyCuts>& pending_cuts) {
+        return separate_edge_and_ttd_headway_constraints(
+            tr, routes, train_velocities, train_orders_on_edges,
+            train_orders_on_ttd, solution, pending_cuts);
+      });
+}
+
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    separate_edge_and_ttd_headway_constraints(
+        size_t                                                     tr,
+        const std::vector<std::vector<std::pair<size_t, double>>>& routes,
+        const std::vector<std::unordered_map<size_t, double>>& train_velocities,
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution,
+        std::vector<PendingLazyCuts>&                     pending_cuts) const {
   bool       violated_constraint_found = false;
   const bool only_one_constraint =
       solver->solver_strategy.lazy_constraint_selection_strategy ==
       LazyConstraintSelectionStrategy::OnlyFirstFound;
-  for (size_t tr = 0; tr < solver->num_tr &&
-                      (!only_one_constraint || !violated_constraint_found);
-       tr++) {
-    const auto& tr_object = solver->instance.get_train_list().get_train(tr);
-    const auto  t_bound   = solver->ub_timing_variable(tr);
-    const auto& entry     = solver->instance.get_schedule(tr).get_entry();
-    // Check every vertex except the last one, because only vertex headway is
-    // imposed in that case
-    for (size_t r_v_idx = 0;
-         r_v_idx < routes.at(tr).size() - 1 &&
-         (!only_one_constraint || !violated_constraint_found);
-         r_v_idx++) {
-      const auto& [v_idx, pos] = routes.at(tr).at(r_v_idx);
-      const auto& vel          = train_velocities.at(tr).at(v_idx);
-      const auto  bd           = vel * vel / (2 * tr_object.deceleration);
-      const auto  ma_pos       = pos + bd;
-
-      const auto& tr_t_var       = solver->vars["t_front_arrival"](tr, v_idx);
-      const auto& tr_t_var_value = getSolution(tr_t_var);
-
-      if (ma_pos <= routes.at(tr).back().second) {
-        // r_ma_idx >= r_v_idx s.th. routes.at(tr).at(r_ma_idx).second <
-        // ma_pos <= routes.at(tr).at(r_ma_idx + 1).second which should be
-        // unique by design unless bd = 0, then r_ma_idx = r_v_idx
-        size_t r_ma_idx = r_v_idx;
-        while (routes.at(tr).at(r_ma_idx + 1).second < ma_pos - EPS) {
-          r_ma_idx++;
+  const auto& tr_object = solver->instance->get_train_list().get_train(tr);
+  const auto  t_bound   = solver->ub_timing_variable(tr);
+  const auto& entry     = solver->instance->get_schedule(tr).get_entry();
+  // Check every vertex except the last one, because only vertex headway is
+  // imposed in that case
+  for (size_t r_v_idx = 0;
+       r_v_idx < routes.at(tr).size() - 1 &&
+       (!only_one_constraint || !violated_constraint_found);
+       r_v_idx++) {
+    const auto& [v_idx, pos] = routes.at(tr).at(r_v_idx);
+    const auto& vel          = train_velocities.at(tr).at(v_idx);
+    const auto  bd           = vel * vel / (2 * tr_object.deceleration);
+    const auto  ma_pos       = pos + bd;
+
+    const auto tr_t_var =
+        solver->vars.get<Var::TFrontArrival>().at(tr, v_idx);
+    const auto tr_t_var_value = solution.value(Var::TFrontArrival, tr, v_idx);
+
+    if (ma_pos <= routes.at(tr).back().second) {
+      // r_ma_idx >= r_v_idx s.th. routes.at(tr).at(r_ma_idx).second <
+      // ma_pos <= routes.at(tr).at(r_ma_idx + 1).second which should be
+      // unique by design unless bd = 0, then r_ma_idx = r_v_idx
+      size_t r_ma_idx = r_v_idx;
+      while (routes.at(tr).at(r_ma_idx + 1).second < ma_pos - EPS) {
+        r_ma_idx++;
+      }
+      const auto& [rel_source, rel_source_pos] = routes.at(tr).at(r_ma_idx);
+      const auto& [rel_target, rel_target_pos] =
+          routes.at(tr).at(r_ma_idx + 1);
+      assert(bd == 0 || rel_source_pos < ma_pos - EPS);
+      assert(ma_pos <= rel_target_pos);
+      const auto rel_pos_on_edge = ma_pos - rel_source_pos;
+
+      // Get used path, which is
+      // routes.at(tr).at(i) -> routes.at(tr).at(i + 1) for i in [r_v_idx,
+      // r_ma_idx]
+      const std::vector<size_t> p = [&]() {
+        std::vector<size_t> p_tmp;
+        p_tmp.reserve(r_ma_idx - r_v_idx + 1);
+        for (size_t i = r_v_idx; i <= r_ma_idx; i++) {
+          p_tmp.emplace_back(solver->instance->const_n().get_edge_index(
+              routes.at(tr).at(i).first, routes.at(tr).at(i + 1).first));
         }
-        const auto& [rel_source, rel_source_pos] = routes.at(tr).at(r_ma_idx);
-        const auto& [rel_target, rel_target_pos] =
-            routes.at(tr).at(r_ma_idx + 1);
-        assert(bd == 0 || rel_source_pos < ma_pos - EPS);
-        assert(ma_pos <= rel_target_pos);
-        const auto rel_pos_on_edge = ma_pos - rel_source_pos;
-
-        // Get used path, which is
-        // routes.at(tr).at(i) -> routes.at(tr).at(i + 1) for i in [r_v_idx,
-        // r_ma_idx]
-        const std::vector<size_t> p = [&]() {
-          std::vector<size_t> p_tmp;
-          p_tmp.reserve(r_ma_idx - r_v_idx + 1);
-          for (size_t i = r_v_idx; i <= r_ma_idx; i++) {
-            p_tmp.emplace_back(solver->instance.const_n().get_edge_index(
-                routes.at(tr).at(i).first, routes.at(tr).at(i + 1).first));
-          }
-          return p_tmp;
-        }();
-        const auto& rel_e_idx = p.back();
-        const auto& rel_e_obj = solver->instance.const_n().get_edge(rel_e_idx);
-
-        // Create path expression according to route. The first edge must
-        // use the specified velocity or faster, since only then the desired
-        // headway must hold.
-        const GRBLinExpr edge_path_expr = solver->get_edge_path_expr(
-            tr, p, vel,
-            solver->solver_strategy.include_higher_velocities_in_edge_expr);
+        return p_tmp;
+      }();
+      const auto& rel_e_idx = p.back();
+      const auto& rel_e_obj = solver->instance->const_n().get_edge(rel_e_idx);
+
+      // Path expression according to route. The first edge must use the
+      // specified velocity or faster, since only then the desired headway
+      // must hold. It is only created if the cuts are not pooled already.
+      std::optional<GRBLinExpr> edge_path_expr;
+
+      // Get other trains that might conflict with the current train on
+      // this edge
+      std::unordered_set<size_t> other_trains;
+      const auto tr_order = train_orders_on_edges.source_order(rel_e_idx);
+      const auto tr_index = std::find(tr_order.begin(), tr_order.end(),
+                                      std::pair<size_t, bool>(tr, true)) -
+                            tr_order.begin();
+      assert(tr_index != tr_order.end() - tr_order.begin());
+      for (size_t tr_other_idx = 0; tr_other_idx < tr_order.size();
+           tr_other_idx++) {
+        if (tr_other_idx == tr_index) {
+          continue;
+        }
+        if (!tr_order[tr_other_idx].second) {
+          // The train travels in reverse direction!
+          continue;
+        }
+        if (solver->solver_strategy.lazy_train_selection_strategy ==
+                LazyTrainSelectionStrategy::OnlyAdjacent &&
+            std::abs(static_cast<int>(tr_other_idx) -
+                     static_cast<int>(tr_index)) > 1) {
+          continue;
+        }
+        if (!solver->solver_strategy.include_reverse_headways &&
+            tr_other_idx > tr_index) {
+          // In this case tr_other follows tr, which is irrelevant for tr ma
+          continue;
+        }
+        other_trains.insert(tr_order[tr_other_idx].first);
+      }
+      for (const auto& tr_other_idx : other_trains) {
+        const auto& tr_other_object =
+            solver->instance->get_train_list().get_train(tr_other_idx);
+        const auto& tr_other_source_speed =
+            train_velocities.at(tr_other_idx).at(rel_source);
+        const auto& tr_other_target_speed =
+            train_velocities.at(tr_other_idx).at(rel_target);
+
+        const auto& tr_other_source_var =
+            solver->vars.get<Var::TRearDeparture>().at(tr_other_idx,
+                                                       rel_source);
+        const auto& tr_other_target_var =
+            solver->vars.get<Var::TRearDeparture>().at(tr_other_idx,
+                                                       rel_target);
+
+        const auto& tr_other_max_speed =
+            std::min(tr_other_object.max_speed, rel_e_obj.max_speed);
 
-        // Get other trains that might conflict with the current train on
-        // this edge
-        std::unordered_set<size_t> other_trains;
-        const auto& tr_order = train_orders_on_edges.at(rel_e_idx).first;
-        const auto  tr_index = std::find(tr_order.begin(), tr_order.end(),
-                                         std::pair<size_t, bool>(tr, true)) -
-                              tr_order.begin();
-        assert(tr_index != tr_order.end() - tr_order.begin());
-        for (size_t tr_other_idx = 0; tr_other_idx < tr_order.size();
-             tr_other_idx++) {
-          if (tr_other_idx == tr_index) {
-            continue;
-          }
-          if (!tr_order.at(tr_other_idx).second) {
-            // The train travels in reverse direction!
-            continue;
-          }
-          if (solver->solver_strategy.lazy_train_selection_strategy ==
-                  LazyTrainSelectionStrategy::OnlyAdjacent &&
-              std::abs(static_cast<int>(tr_other_idx) -
-                       static_cast<int>(tr_index)) > 1) {
-            continue;
-          }
-          if (!solver->solver_strategy.include_reverse_headways &&
-              tr_other_idx > tr_index) {
-            // In this case tr_other follows tr, which is irrelevant for tr ma
-            continue;
-          }
-          other_trains.insert(tr_order.at(tr_other_idx).first);
+        // Check if this constraint should be added
+        bool violated = false;
+        if (tr_t_var_value <
+            solution.value(Var::TRearDeparture, tr_other_idx, rel_source) +
+                cda_rail::min_travel_time_from_start(
+                    tr_other_source_speed, tr_other_target_speed,
+                    tr_other_max_speed, tr_other_object.acceleration,
+                    tr_other_object.deceleration, rel_e_obj.length,
+                    rel_pos_on_edge) -
+                GRB_EPS) {
+          violated = true;
+        }
+        if (!violated && rel_pos_on_edge > EPS &&
+            tr_t_var_value <
+                solution.value(Var::TRearDeparture, tr_other_idx, rel_target) -
+                    cda_rail::max_travel_time_to_end(
+                        tr_other_source_speed, tr_other_target_speed, V_MIN,
+                        tr_other_object.acceleration,
+                        tr_other_object.deceleration, rel_e_obj.length,
+                        rel_pos_on_edge, rel_e_obj.breakable) -
+                    GRB_EPS) {
+          violated = true;
+        }
+        if (!violated &&
+            solver->solver_strategy.lazy_constraint_selection_strategy !=
+                LazyConstraintSelectionStrategy::AllChecked) {
+          continue;
         }
-        for (const auto& tr_other_idx : other_trains) {
-          const auto& tr_other_object =
-              solver->instance.get_train_list().get_train(tr_other_idx);
-          const auto& tr_other_source_speed =
-              train_velocities.at(tr_other_idx).at(rel_source);
-          const auto& tr_other_target_speed =
-              train_velocities.at(tr_other_idx).at(rel_target);
-
-          const auto& tr_other_source_var =
-              solver->vars["t_rear_departure"](tr_other_idx, rel_source);
-          const auto& tr_other_target_var =
-              solver->vars["t_rear_departure"](tr_other_idx, rel_target);
-
-          const auto& tr_other_max_speed =
-              std::min(tr_other_object.max_speed, rel_e_obj.max_speed);
 
-          // Check if this constraint should be added
-          bool add_constr =
-              (solver->solver_strategy.lazy_constraint_selection_strategy ==
-               LazyConstraintSelectionStrategy::AllChecked);
-          if (!add_constr &&
-              tr_t_var_value <
-                  getSolution(tr_other_source_var) +
+        const auto t_bound_tmp =
+            std::max(t_bound, solver->ub_timing_variable(tr_other_idx));
+
+        // The cuts are determined by the trains, the path and the velocity
+        LazyCutSignature signature{
+            LazyCutType::EdgeHeadway, {tr, tr_other_idx}, {vel}};
+        signature.indices.insert(signature.indices.end(), p.begin(), p.end());
+
+        if (is_pooled(signature)) {
+          pending_cuts.push_back({signature, violated, {}});
+          violated_constraint_found = violated_constraint_found || violated;
+        } else {
+          if (!edge_path_expr.has_value()) {
+            edge_path_expr = solver->get_edge_path_expr(
+                tr, p, vel,
+                solver->solver_strategy.include_higher_velocities_in_edge_expr);
+          }
+          const GRBLinExpr lhs =
+              tr_t_var +
+              t_bound_tmp * (static_cast<double>(p.size()) -
+                             edge_path_expr.value()) +
+              t_bound_tmp *
+                  (1 - solver->vars[Var::Order].at(tr, tr_other_idx, p.back()));
+          std::vector<GRBLinExpr> rhs;
+          if (std::abs(rel_e_obj.length - rel_pos_on_edge) < EPS) {
+            rhs.emplace_back(tr_other_target_var);
+          } else if (rel_pos_on_edge < EPS) {
+            rhs.emplace_back(tr_other_source_var);
+          } else {
+            rhs.emplace_back(tr_other_source_var);
+            rhs.emplace_back(tr_other_target_var);
+
+            const auto& v_tr_other_source_velocities =
+                solver->velocity_extensions.at(tr_other_idx).at(rel_source);
+            const auto& v_tr_other_target_velocities =
+                solver->velocity_extensions.at(tr_other_idx).at(rel_target);
+
+            for (size_t v_tr_other_source_index = 0;
+                 v_tr_other_source_index <
+                 v_tr_other_source_velocities.size();
+                 v_tr_other_source_index++) {
+              const auto& vel_tr_other_source =
+                  v_tr_other_source_velocities.at(v_tr_other_source_index);
+              for (size_t v_tr_other_target_index = 0;
+                   v_tr_other_target_index <
+                   v_tr_other_target_velocities.size();
+                   v_tr_other_target_index++) {
+                const auto& vel_tr_other_target =
+                    v_tr_other_target_velocities.at(v_tr_other_target_index);
+                if (solver
+                        ->eom_table_entry(tr_other_idx, rel_e_idx,
+                                          v_tr_other_source_index,
+                                          v_tr_other_target_index)
+                        .possible) {
+                  rhs.at(0) +=
+                      solver->vars[Var::Y].at(tr_other_idx, rel_e_idx,
+                                              v_tr_other_source_index,
+                                              v_tr_other_target_index) *
                       cda_rail::min_travel_time_from_start(
-                          tr_other_source_speed, tr_other_target_speed,
+                          vel_tr_other_source, vel_tr_other_target,
                           tr_other_max_speed, tr_other_object.acceleration,
                           tr_other_object.deceleration, rel_e_obj.length,
-                          rel_pos_on_edge) -
-                      GRB_EPS) {
-            add_constr = true;
-          }
-          if (!add_constr && rel_pos_on_edge > EPS &&
-              tr_t_var_value <
-                  getSolution(tr_other_target_var) -
+                          rel_pos_on_edge);
+                  const auto max_travel_time =
                       cda_rail::max_travel_time_to_end(
-                          tr_other_source_speed, tr_other_target_speed, V_MIN,
+                          vel_tr_other_source, vel_tr_other_target, V_MIN,
                           tr_other_object.acceleration,
                           tr_other_object.deceleration, rel_e_obj.length,
-                          rel_pos_on_edge, rel_e_obj.breakable) -
-                      GRB_EPS) {
-            add_constr = true;
-          }
-
-          const auto t_bound_tmp =
-              std::max(t_bound, solver->ub_timing_variable(tr_other_idx));
-
-          if (add_constr) {
-            const GRBLinExpr lhs =
-                tr_t_var +
-                t_bound_tmp * (static_cast<double>(p.size()) - edge_path_expr) +
-                t_bound_tmp *
-                    (1 - solver->vars["order"](tr, tr_other_idx, p.back()));
-            std::vector<GRBLinExpr> rhs;
-            if (std::abs(rel_e_obj.length - rel_pos_on_edge) < EPS) {
-              rhs.emplace_back(tr_other_target_var);
-            } else if (rel_pos_on_edge < EPS) {
-              rhs.emplace_back(tr_other_source_var);
-            } else {
-              rhs.emplace_back(tr_other_source_var);
-              rhs.emplace_back(tr_other_target_var);
-
-              const auto& v_tr_other_source_velocities =
-                  solver->velocity_extensions.at(tr_other_idx).at(rel_source);
-              const auto& v_tr_other_target_velocities =
-                  solver->velocity_extensions.at(tr_other_idx).at(rel_target);
-
-              for (size_t v_tr_other_source_index = 0;
-                   v_tr_other_source_index <
-                   v_tr_other_source_velocities.size();
-                   v_tr_other_source_index++) {
-                const auto& vel_tr_other_source =
-                    v_tr_other_source_velocities.at(v_tr_other_source_index);
-                if (vel_tr_other_source > tr_other_max_speed) {
-                  continue;
-                }
-                for (size_t v_tr_other_target_index = 0;
-                     v_tr_other_target_index <
-                     v_tr_other_target_velocities.size();
-                     v_tr_other_target_index++) {
-                  const auto& vel_tr_other_target =
-                      v_tr_other_target_velocities.at(v_tr_other_target_index);
-                  if (vel_tr_other_target > tr_other_max_speed) {
-                    continue;
-                  }
-                  if (cda_rail::possible_by_eom(
-                          vel_tr_other_source, vel_tr_other_target,
-                          tr_other_object.acceleration,
-                          tr_other_object.deceleration, rel_e_obj.length)) {
-                    rhs.at(0) +=
-                        solver->vars["y"](tr_other_idx, rel_e_idx,
-                                          v_tr_other_source_index,
-                                          v_tr_other_target_index) *
-                        cda_rail::min_travel_time_from_start(
-                            vel_tr_other_source, vel_tr_other_target,
-                            tr_other_max_speed, tr_other_object.acceleration,
-                            tr_other_object.deceleration, rel_e_obj.length,
-                            rel_pos_on_edge);
-                    const auto max_travel_time =
-                        cda_rail::max_travel_time_to_end(
-                            vel_tr_other_source, vel_tr_other_target, V_MIN,
-                            tr_other_object.acceleration,
-                            tr_other_object.deceleration, rel_e_obj.length,
-                            rel_pos_on_edge, rel_e_obj.breakable);
-                    rhs.at(1) -=
-                        solver->vars["y"](tr_other_idx, rel_e_idx,
-                                          v_tr_other_source_index,
-                                          v_tr_other_target_index) *
-                        (max_travel_time > t_bound_tmp ? t_bound_tmp
-                                                       : max_travel_time);
-                  }
+                          rel_pos_on_edge, rel_e_obj.breakable);
+                  rhs.at(1) -=
+                      solver->vars[Var::Y].at(tr_other_idx, rel_e_idx,
+                                              v_tr_other_source_index,
+                                              v_tr_other_target_index) *
+                      (max_travel_time > t_bound_tmp ? t_bound_tmp
+                                                     : max_travel_time);
                 }
               }
             }
-
-            // Previous simple order constraint deleted, because making sure
-            // that the order variable has the correct semantic value is ensured
-            // by vertex headway constraints
-
-            for (const auto& rhs_expr : rhs) {
-              addLazy(lhs >= rhs_expr);
-              if (solver->solution_settings.export_option ==
-                      ExportOption::ExportLP ||
-                  solver->solution_settings.export_option ==
-                      ExportOption::ExportSolutionAndLP ||
-                  solver->solution_settings.export_option ==
-                      ExportOption::ExportSolutionWithInstanceAndLP) {
-                solver->lazy_constraints.push_back(lhs >= rhs_expr);
-              }
-              violated_constraint_found = true;
-            }
-          }
-        }
-
-        // Is there a conflict with TTD constraints
-        const auto intersecting_ttd =
-            cda_rail::Network::get_intersecting_ttd(p, solver->ttd_sections);
-        for (const auto& [ttd_index, e_index] : intersecting_ttd) {
-          const auto& p_tmp =
-              std::vector<size_t>(p.begin(), p.begin() + e_index);
-          const auto p_tmp_len = std::accumulate(
-              p_tmp.begin(), p_tmp.end(), 0.0,
-              [this](double sum, const auto& edge_index) {
-                return sum +
-                       solver->instance.const_n().get_edge(edge_index).length;
-              });
-          GRBLinExpr edge_tmp_path_expr = 0;
-          for (const auto& e_tmp : p_tmp) {
-            edge_tmp_path_expr += solver->vars["x"](tr, e_tmp);
           }
 
-          const auto obd = bd - p_tmp_len;
-          assert(obd >= 0);
+          // Previous simple order constraint deleted, because making sure
+          // that the order variable has the correct semantic value is ensured
+          // by vertex headway constraints
 
-          double                t_reduction = 0;
-          std::optional<double> t_addition;
+          std::vector<LazyCut> cuts;
+          cuts.reserve(rhs.size());
+          for (const auto& rhs_expr : rhs) {
+            cuts.emplace_back(lhs, GRB_GREATER_EQUAL, rhs_expr);
+          }
+          pending_cuts.push_back({signature, violated, std::move(cuts)});
+          violated_constraint_found = true;
+        }
+      }
 
-          std::optional<size_t> prev_v_idx;
-          std::optional<double> prev_pos;
-          std::optional<double> prev_vel;
-          std::optional<GRBVar> prev_t_var;
-          std::optional<double> prev_t_var_value;
-          std::optional<size_t> prev_edge_index;
+      // Is there a conflict with TTD constraints
+      const auto intersecting_ttd =
+          cda_rail::Network::get_intersecting_ttd(p, solver->ttd_sections);
+      for (const auto& [ttd_index, e_index] : intersecting_ttd) {
+        const auto& p_tmp = std::vector<size_t>(p.begin(), p.begin() + e_index);
+        const auto p_tmp_len = std::accumulate(
+            p_tmp.begin(), p_tmp.end(), 0.0,
+            [this](double sum, const auto& edge_index) {
+              return sum +
+                     solver->instance->const_n().get_edge(edge_index).length;
+            });
+        GRBLinExpr edge_tmp_path_expr = 0;
+        for (const auto& e_tmp : p_tmp) {
+          edge_tmp_path_expr += solver->vars.get<Var::X>().at(tr, e_tmp);
+        }
 
-          bool skip = false;
-          if (v_idx == entry) {
-            t_reduction = vel <= GRB_EPS ? 0 : obd / vel;
+        const auto obd = bd - p_tmp_len;
+        assert(obd >= 0);
+
+        double                t_reduction = 0;
+        std::optional<double> t_addition;
+
+        std::optional<size_t> prev_v_idx;
+        std::optional<double> prev_pos;
+        std::optional<double> prev_vel;
+        std::optional<GRBVar> prev_t_var;
+        std::optional<double> prev_t_var_value;
+        std::optional<size_t> prev_edge_index;
+
+        bool skip = false;
+        if (v_idx == entry) {
+          t_reduction = vel <= GRB_EPS ? 0 : obd / vel;
+        } else {
+          assert(r_v_idx >= 1);
+          prev_v_idx = routes.at(tr).at(r_v_idx - 1).first;
+          prev_pos   = routes.at(tr).at(r_v_idx - 1).second;
+          prev_vel   = train_velocities.at(tr).at(prev_v_idx.value());
+          const auto& prev_bd = prev_vel.value() * prev_vel.value() /
+                                (2 * tr_object.deceleration);
+          const auto& prev_ma_pos = prev_pos.value() + prev_bd;
+          prev_edge_index         = solver->instance->const_n().get_edge_index(
+              prev_v_idx.value(), v_idx);
+          const auto& prev_edge_object =
+              solver->instance->const_n().get_edge(prev_edge_index.value());
+          prev_t_var = solver->vars.get<Var::TFrontDeparture>().at(
+              tr, prev_v_idx.value());
+          prev_t_var_value =
+              solution.value(Var::TFrontDeparture, tr, prev_v_idx.value());
+          const auto& prev_max_speed =
+              std::min(prev_edge_object.max_speed, tr_object.max_speed);
+          if (prev_ma_pos > pos + p_tmp_len) {
+            skip = true;
+            // obd is too long and relevant vertex is earlier
           } else {
-            assert(r_v_idx >= 1);
-            prev_v_idx = routes.at(tr).at(r_v_idx - 1).first;
-            prev_pos   = routes.at(tr).at(r_v_idx - 1).second;
-            prev_vel   = train_velocities.at(tr).at(prev_v_idx.value());
-            const auto& prev_bd = prev_vel.value() * prev_vel.value() /
-                                  (2 * tr_object.deceleration);
-            const auto& prev_ma_pos = prev_pos.value() + prev_bd;
-            prev_edge_index         = solver->instance.const_n().get_edge_index(
-                prev_v_idx.value(), v_idx);
-            const auto& prev_edge_object =
-                solver->instance.const_n().get_edge(prev_edge_index.value());
-            prev_t_var =
-                solver->vars["t_front_departure"](tr, prev_v_idx.value());
-            prev_t_var_value = getSolution(prev_t_var.value());
-            const auto& prev_max_speed =
-                std::min(prev_edge_object.max_speed, tr_object.max_speed);
-            if (prev_ma_pos > pos + p_tmp_len) {
-              skip = true;
-              // obd is too long and relevant vertex is earlier
-            } else {
-              t_reduction = cda_rail::min_time_from_rear_to_ma_point(
-                  prev_vel.value(), vel, V_MIN, prev_max_speed,
-                  tr_object.acceleration, tr_object.deceleration,
-                  prev_edge_object.length, obd);
-              const auto tmp_max = cda_rail::max_time_from_front_to_ma_point(
-                  prev_vel.value(), vel, V_MIN, tr_object.acceleration,
-                  tr_object.deceleration, prev_edge_object.length, obd,
-                  prev_edge_object.breakable);
-              if (tmp_max < std::numeric_limits<double>::infinity()) {
-                t_addition = tmp_max;
-              }
+            t_reduction = cda_rail::min_time_from_rear_to_ma_point(
+                prev_vel.value(), vel, V_MIN, prev_max_speed,
+                tr_object.acceleration, tr_object.deceleration,
+                prev_edge_object.length, obd);
+            const auto tmp_max = cda_rail::max_time_from_front_to_ma_point(
+                prev_vel.value(), vel, V_MIN, tr_object.acceleration,
+                tr_object.deceleration, prev_edge_object.length, obd,
+                prev_edge_object.breakable);
+            if (tmp_max < std::numeric_limits<double>::infinity()) {
+              t_addition = tmp_max;
             }
           }
+        }
 
-          if (skip) {
+        if (skip) {
+          continue;
+        }
+
+        // Get other trains that might conflict with the current train on
+        // this TTD section
+        const auto& rel_tr_order_ttd = train_orders_on_ttd.at(ttd_index);
+        std::unordered_set<size_t> other_trains_ttd;
+        const auto                 tr_index =
+            std::find(rel_tr_order_ttd.begin(), rel_tr_order_ttd.end(), tr) -
+            rel_tr_order_ttd.begin();
+        assert(tr_index != rel_tr_order_ttd.end() - rel_tr_order_ttd.begin());
+        for (size_t tr_other_idx = 0; tr_other_idx < rel_tr_order_ttd.size();
+             tr_other_idx++) {
+          if (tr_other_idx == tr_index) {
             continue;
           }
-
-          // Get other trains that might conflict with the current train on
-          // this TTD section
-          const auto& rel_tr_order_ttd = train_orders_on_ttd.at(ttd_index);
-          std::unordered_set<size_t> other_trains_ttd;
-          const auto                 tr_index =
-              std::find(rel_tr_order_ttd.begin(), rel_tr_order_ttd.end(), tr) -
-              rel_tr_order_ttd.begin();
-          assert(tr_index != rel_tr_order_ttd.end() - rel_tr_order_ttd.begin());
-          for (size_t tr_other_idx = 0; tr_other_idx < rel_tr_order_ttd.size();
-               tr_other_idx++) {
-            if (tr_other_idx == tr_index) {
-              continue;
-            }
-            if (solver->solver_strategy.lazy_train_selection_strategy ==
-                    LazyTrainSelectionStrategy::OnlyAdjacent &&
-                std::abs(static_cast<int>(tr_other_idx) -
-                         static_cast<int>(tr_index)) > 1) {
-              continue;
-            }
-            if (!solver->solver_strategy.include_reverse_headways &&
-                tr_other_idx > tr_index) {
-              // In this case tr_other follows tr, which is irrelevant for tr ma
-              continue;
-            }
-            other_trains_ttd.insert(rel_tr_order_ttd.at(tr_other_idx));
+          if (solver->solver_strategy.lazy_train_selection_strategy ==
+                  LazyTrainSelectionStrategy::OnlyAdjacent &&
+              std::abs(static_cast<int>(tr_other_idx) -
+                       static_cast<int>(tr_index)) > 1) {
+            continue;
+          }
+          if (!solver->solver_strategy.include_reverse_headways &&
+              tr_other_idx > tr_index) {
+            // In this case tr_other follows tr, which is irrelevant for tr ma
+            continue;
           }
+          other_trains_ttd.insert(rel_tr_order_ttd.at(tr_other_idx));
+        }
 
-          for (const size_t other_tr : other_trains_ttd) {
-            // Check if TTD constraint is violated or not and add if needed
-            bool add_constr =
-                (solver->solver_strategy.lazy_constraint_selection_strategy ==
-                 LazyConstraintSelectionStrategy::AllChecked);
-            const auto& other_tr_t_variable =
-                solver->vars["t_ttd_departure"](other_tr, ttd_index);
-            if (!add_constr && tr_t_var_value - t_reduction <
-                                   getSolution(other_tr_t_variable)) {
-              add_constr = true;
-            }
-            if (!add_constr && prev_t_var_value.has_value() &&
-                t_addition.has_value() &&
-                prev_t_var_value.value() + t_addition.value() <
-                    getSolution(other_tr_t_variable) - GRB_EPS) {
-              add_constr = true;
-            }
+        for (const size_t other_tr : other_trains_ttd) {
+          // Check if TTD constraint is violated or not and add if needed
+          bool        violated = false;
+          const auto& other_tr_t_variable =
+              solver->vars.get<Var::TTtdDeparture>().at(other_tr, ttd_index);
+          const auto other_tr_t_value =
+              solution.value(Var::TTtdDeparture, other_tr, ttd_index);
+          if (tr_t_var_value - t_reduction < other_tr_t_value) {
+            violated = true;
+          }
+          if (!violated && prev_t_var_value.has_value() &&
+              t_addition.has_value() &&
+              prev_t_var_value.value() + t_addition.value() <
+                  other_tr_t_value - GRB_EPS) {
+            violated = true;
+          }
+          if (!violated &&
+              solver->solver_strategy.lazy_constraint_selection_strategy !=
+                  LazyConstraintSelectionStrategy::AllChecked) {
+            continue;
+          }
 
-            if (add_constr) {
-              const auto t_bound_tmp =
-                  std::max(t_bound, solver->ub_timing_variable(other_tr));
-              GRBLinExpr rhs =
-                  other_tr_t_variable +
+          // The cuts are determined by the trains, the section, the path up
+          // to the section and the velocities at the relevant vertices
+          LazyCutSignature signature{
+              LazyCutType::TtdHeadway,
+              {tr, other_tr, ttd_index, v_idx, prev_v_idx.value_or(v_idx)},
+              {vel, prev_vel.value_or(0.0)}};
+          signature.indices.insert(signature.indices.end(), p_tmp.begin(),
+                                   p_tmp.end());
+
+          if (is_pooled(signature)) {
+            pending_cuts.push_back({signature, violated, {}});
+            violated_constraint_found = violated_constraint_found || violated;
+          } else {
+            const auto t_bound_tmp =
+                std::max(t_bound, solver->ub_timing_variable(other_tr));
+            GRBLinExpr rhs =
+                other_tr_t_variable +
+                t_bound_tmp *
+                    (solver->vars[Var::OrderTtd].at(tr, other_tr, ttd_index) -
+                     1);
+            std::vector<GRBLinExpr> lhs;
+            if (prev_edge_index.has_value()) {
+              assert(prev_vel.has_value());
+              const auto vel_idx =
+                  std::find(
+                      solver->velocity_extensions.at(tr).at(v_idx).begin(),
+                      solver->velocity_extensions.at(tr).at(v_idx).end(),
+                      vel) -
+                  solver->velocity_extensions.at(tr).at(v_idx).begin();
+              const auto prev_vel_idx =
+                  std::find(solver->velocity_extensions.at(tr)
+                                .at(prev_v_idx.value())
+                                .begin(),
+                            solver->velocity_extensions.at(tr)
+                                .at(prev_v_idx.value())
+                                .end(),
+                            prev_vel.value()) -
+                  solver->velocity_extensions.at(tr)
+                      .at(prev_v_idx.value())
+                      .begin();
+              lhs.emplace_back(
+                  tr_t_var - t_reduction +
                   t_bound_tmp *
-                      (solver->vars["order_ttd"](tr, other_tr, ttd_index) - 1);
-              std::vector<GRBLinExpr> lhs;
-              if (prev_edge_index.has_value()) {
-                assert(prev_vel.has_value());
-                const auto vel_idx =
-                    std::find(
-                        solver->velocity_extensions.at(tr).at(v_idx).begin(),
-                        solver->velocity_extensions.at(tr).at(v_idx).end(),
-                        vel) -
-                    solver->velocity_extensions.at(tr).at(v_idx).begin();
-                const auto prev_vel_idx =
-                    std::find(solver->velocity_extensions.at(tr)
-                                  .at(prev_v_idx.value())
-                                  .begin(),
-                              solver->velocity_extensions.at(tr)
-                                  .at(prev_v_idx.value())
-                                  .end(),
-                              prev_vel.value()) -
-                    solver->velocity_extensions.at(tr)
-                        .at(prev_v_idx.value())
-                        .begin();
+                      (static_cast<double>(p_tmp.size()) -
+                       edge_tmp_path_expr + 1 -
+                       solver->vars[Var::Y].at(tr, prev_edge_index.value(),
+                                               prev_vel_idx, vel_idx)));
+              if (t_addition.has_value()) {
+                assert(prev_t_var.has_value());
                 lhs.emplace_back(
-                    tr_t_var - t_reduction +
+                    prev_t_var.value() + t_addition.value() +
                     t_bound_tmp *
                         (static_cast<double>(p_tmp.size()) -
                          edge_tmp_path_expr + 1 -
-                         solver->vars["y"](tr, prev_edge_index.value(),
-                                           prev_vel_idx, vel_idx)));
-                if (t_addition.has_value()) {
-                  assert(prev_t_var.has_value());
-                  lhs.emplace_back(
-                      prev_t_var.value() + t_addition.value() +
-                      t_bound_tmp *
-                          (static_cast<double>(p_tmp.size()) -
-                           edge_tmp_path_expr + 1 -
-                           solver->vars["y"](tr, prev_edge_index.value(),
-                                             prev_vel_idx, vel_idx)));
-                }
-              } else {
-                // Entry node
-                assert(v_idx == entry);
-                lhs.emplace_back(tr_t_var - t_reduction +
-                                 t_bound_tmp *
-                                     (static_cast<double>(p_tmp.size()) -
-                                      edge_tmp_path_expr));
+                         solver->vars[Var::Y].at(tr, prev_edge_index.value(),
+                                                 prev_vel_idx, vel_idx)));
               }
+            } else {
+              // Entry node
+              assert(v_idx == entry);
+              lhs.emplace_back(tr_t_var - t_reduction +
+                               t_bound_tmp *
+                                   (static_cast<double>(p_tmp.size()) -
+                                    edge_tmp_path_expr));
+            }
 
-              for (const auto& lhs_expr : lhs) {
-                addLazy(lhs_expr >= rhs);
-                if (solver->solution_settings.export_option ==
-                        ExportOption::ExportLP ||
-                    solver->solution_settings.export_option ==
-                        ExportOption::ExportSolutionAndLP ||
-                    solver->solution_settings.export_option ==
-                        ExportOption::ExportSolutionWithInstanceAndLP) {
-                  solver->lazy_constraints.push_back(lhs_expr >= rhs);
-                }
-                violated_constraint_found = true;
-              }
+            std::vector<LazyCut> cuts;
+            cuts.reserve(lhs.size());
+            for (const auto& lhs_expr : lhs) {
+              cuts.emplace_back(lhs_expr, GRB_GREATER_EQUAL, rhs);
             }
+            pending_cuts.push_back({signature, violated, std::move(cuts)});
+            violated_constraint_found = true;
           }
         }
       }
@@ -662,187 +778,198 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
     create_lazy_vertex_headway_constraints(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes,
         const std::vector<std::unordered_map<size_t, double>>& train_velocities,
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-            train_orders_on_edges) {
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution) {
+  return separate_trains_in_parallel(
+      [&](size_t tr, std::vector<PendingLazyCuts>& pending_cuts) {
+        return separate_vertex_headway_constraints(tr, routes, train_velocities,
+                                                   train_orders_on_edges,
+                                                   solution, pending_cuts);
+      });
+}
+
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    separate_vertex_headway_constraints(
+        size_t                                                     tr,
+        const std::vector<std::vector<std::pair<size_t, double>>>& routes,
+        const std::vector<std::unordered_map<size_t, double>>& train_velocities,
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution,
+        std::vector<PendingLazyCuts>&                     pending_cuts) const {
   // Check for violated vertex headways
-  bool violated_constraint_found = false;
-  bool only_one_constraint =
+  bool       violated_constraint_found = false;
+  const bool only_one_constraint =
       solver->solver_strategy.lazy_constraint_selection_strategy ==
       LazyConstraintSelectionStrategy::OnlyFirstFound;
 
-  for (size_t tr = 0; tr < solver->num_tr &&
-                      (!only_one_constraint || !violated_constraint_found);
-       tr++) {
-    const auto tr_t_bound = solver->ub_timing_variable(tr);
-    const auto tr_object  = solver->instance.get_train_list().get_train(tr);
-    // Check every vertex on the route
-    for (size_t r_v_idx = 0;
-         r_v_idx < routes.at(tr).size() - 1 &&
+  const auto tr_t_bound = solver->ub_timing_variable(tr);
+  // Check every vertex on the route
+  for (size_t r_v_idx = 0;
+       r_v_idx < routes.at(tr).size() - 1 &&
+       (!only_one_constraint || !violated_constraint_found);
+       r_v_idx++) {
+    const auto& v_source   = routes.at(tr).at(r_v_idx).first;
+    const auto& v_target   = routes.at(tr).at(r_v_idx + 1).first;
+    const auto& vel_source = train_velocities.at(tr).at(v_source);
+    const auto& vel_target = train_velocities.at(tr).at(v_target);
+    const auto& edge_index =
+        solver->instance->const_n().get_edge_index(v_source, v_target);
+
+    const auto rel_tr_order_source =
+        train_orders_on_edges.source_order(edge_index);
+    const auto rel_tr_order_target =
+        train_orders_on_edges.target_order(edge_index);
+
+    const auto& v_source_obj =
+        solver->instance->const_n().get_vertex(v_source);
+    const auto& v_target_obj =
+        solver->instance->const_n().get_vertex(v_target);
+
+    // Variables to possibly strengthen the constraints
+    auto [hw_s1_max, hw_s1, hw_t1_max, hw_t1] =
+        solver->get_vertex_headway_expressions(tr, edge_index);
+
+    auto hw_s1_value =
+        std::max(v_source_obj.headway,
+                 solver->ma_backward_time(tr, v_source, vel_source));
+    auto hw_t1_value =
+        std::max(v_target_obj.headway,
+                 solver->ma_backward_time(tr, v_target, vel_target));
+
+    const auto tr_idx_source =
+        std::find(rel_tr_order_source.begin(), rel_tr_order_source.end(),
+                  std::pair<size_t, bool>(tr, true)) -
+        rel_tr_order_source.begin();
+    const auto tr_idx_target =
+        std::find(rel_tr_order_target.begin(), rel_tr_order_target.end(),
+                  std::pair<size_t, bool>(tr, true)) -
+        rel_tr_order_target.begin();
+    assert(tr_idx_source < rel_tr_order_source.size());
+    assert(tr_idx_target < rel_tr_order_target.size());
+    size_t       lb_idx = 0;
+    const size_t ub_idx = static_cast<int>(tr_idx_source);
+    // Depending on strategy, not all trains are considered
+    if (solver->solver_strategy.lazy_train_selection_strategy ==
+        LazyTrainSelectionStrategy::OnlyAdjacent) {
+      lb_idx = std::max<int>(static_cast<int>(lb_idx),
+                             static_cast<int>(tr_idx_source) - 1);
+    }
+    // Note reverse orders are always included anyway
+
+    auto tr_t_var_source_front =
+        solver->vars.get<Var::TFrontArrival>().at(tr, v_source);
+    auto tr_t_var_source_rear =
+        solver->vars.get<Var::TRearDeparture>().at(tr, v_source);
+    auto tr_t_var_target_front =
+        solver->vars.get<Var::TFrontArrival>().at(tr, v_target);
+    auto tr_t_var_target_rear =
+        solver->vars.get<Var::TRearDeparture>().at(tr, v_target);
+
+    for (size_t edge_order_other_tr_idx = lb_idx;
+         edge_order_other_tr_idx < ub_idx &&
          (!only_one_constraint || !violated_constraint_found);
-         r_v_idx++) {
-      const auto& v_source   = routes.at(tr).at(r_v_idx).first;
-      const auto& v_target   = routes.at(tr).at(r_v_idx + 1).first;
-      const auto& vel_source = train_velocities.at(tr).at(v_source);
-      const auto& vel_target = train_velocities.at(tr).at(v_target);
-      const auto& edge_index =
-          solver->instance.const_n().get_edge_index(v_source, v_target);
-
-      const auto& [rel_tr_order_source, rel_tr_order_target] =
-          train_orders_on_edges.at(edge_index);
-
-      const auto& v_source_obj =
-          solver->instance.const_n().get_vertex(v_source);
-      const auto& v_target_obj =
-          solver->instance.const_n().get_vertex(v_target);
-
-      // Variables to possibly strengthen the constraints
-      auto [hw_s1_max, hw_s1, hw_t1_max, hw_t1] =
-          solver->get_vertex_headway_expressions(tr, edge_index);
-
-      auto hw_s1_value = std::max(
-          v_source_obj.headway,
-          min_time_to_push_ma_fully_backward(vel_source, tr_object.acceleration,
-                                             tr_object.deceleration));
-      auto hw_t1_value = std::max(
-          v_target_obj.headway,
-          min_time_to_push_ma_fully_backward(vel_target, tr_object.acceleration,
-                                             tr_object.deceleration));
-
-      const auto tr_idx_source =
-          std::find(rel_tr_order_source.begin(), rel_tr_order_source.end(),
-                    std::pair<size_t, bool>(tr, true)) -
-          rel_tr_order_source.begin();
-      const auto tr_idx_target =
+         edge_order_other_tr_idx++) {
+      const auto& [other_tr, other_tr_direction] =
+          rel_tr_order_source[edge_order_other_tr_idx];
+      if (!other_tr_direction) {
+        // The train travels in reverse direction!
+        continue;
+      }
+
+      auto other_tr_t_var_source_front =
+          solver->vars.get<Var::TFrontArrival>().at(other_tr, v_source);
+      auto other_tr_t_var_source_rear =
+          solver->vars.get<Var::TRearDeparture>().at(other_tr, v_source);
+      auto other_tr_t_var_target_front =
+          solver->vars.get<Var::TFrontArrival>().at(other_tr, v_target);
+      auto other_tr_t_var_target_rear =
+          solver->vars.get<Var::TRearDeparture>().at(other_tr, v_target);
+
+      // If train order differs between source and target, also add vertex
+      // constraints
+      const auto other_tr_idx_target =
           std::find(rel_tr_order_target.begin(), rel_tr_order_target.end(),
-                    std::pair<size_t, bool>(tr, true)) -
+                    std::pair<size_t, bool>(other_tr, true)) -
           rel_tr_order_target.begin();
-      assert(tr_idx_source < rel_tr_order_source.size());
-      assert(tr_idx_target < rel_tr_order_target.size());
-      size_t       lb_idx = 0;
-      const size_t ub_idx = static_cast<int>(tr_idx_source);
-      // Depending on strategy, not all trains are considered
-      if (solver->solver_strategy.lazy_train_selection_strategy ==
-          LazyTrainSelectionStrategy::OnlyAdjacent) {
-        lb_idx = std::max<int>(static_cast<int>(lb_idx),
-                               static_cast<int>(tr_idx_source) - 1);
+      assert(other_tr_idx_target < rel_tr_order_target.size());
+      const bool same_order = other_tr_idx_target <
+                              tr_idx_target; // Because < at source by design
+      const auto wrong_order_var_is_one =
+          solution.value(Var::Order, other_tr, tr, edge_index) > 0.5;
+
+      // Check if specified vertex headway is fulfilled
+      const bool violated =
+          !same_order || wrong_order_var_is_one ||
+          solution.value(Var::TFrontArrival, tr, v_source) -
+                  solution.value(Var::TRearDeparture, other_tr, v_source) <
+              hw_s1_value - GRB_EPS ||
+          solution.value(Var::TFrontArrival, tr, v_target) -
+                  solution.value(Var::TRearDeparture, other_tr, v_target) <
+              hw_t1_value - GRB_EPS;
+      if (!violated &&
+          solver->solver_strategy.lazy_constraint_selection_strategy !=
+              LazyConstraintSelectionStrategy::AllChecked) {
+        continue;
       }
-      // Note reverse orders are always included anyway
-
-      auto tr_t_var_source_front =
-          solver->vars["t_front_arrival"](tr, v_source);
-      auto tr_t_var_source_rear =
-          solver->vars["t_rear_departure"](tr, v_source);
-      auto tr_t_var_target_front =
-          solver->vars["t_front_arrival"](tr, v_target);
-      auto tr_t_var_target_rear =
-          solver->vars["t_rear_departure"](tr, v_target);
-
-      for (size_t edge_order_other_tr_idx = lb_idx;
-           edge_order_other_tr_idx < ub_idx &&
-           (!only_one_constraint || !violated_constraint_found);
-           edge_order_other_tr_idx++) {
-        const auto& [other_tr, other_tr_direction] =
-            rel_tr_order_source.at(edge_order_other_tr_idx);
-        if (!other_tr_direction) {
-          // The train travels in reverse direction!
-          continue;
-        }
 
-        auto other_tr_t_var_source_front =
-            solver->vars["t_front_arrival"](other_tr, v_source);
-        auto other_tr_t_var_source_rear =
-            solver->vars["t_rear_departure"](other_tr, v_source);
-        auto other_tr_t_var_target_front =
-            solver->vars["t_front_arrival"](other_tr, v_target);
-        auto other_tr_t_var_target_rear =
-            solver->vars["t_rear_departure"](other_tr, v_target);
-
-        // If train order differs between source and target, also add vertex
-        // constraints
-        const auto other_tr_idx_target =
-            std::find(rel_tr_order_target.begin(), rel_tr_order_target.end(),
-                      std::pair<size_t, bool>(other_tr, true)) -
-            rel_tr_order_target.begin();
-        assert(other_tr_idx_target < rel_tr_order_target.size());
-        const bool same_order = other_tr_idx_target <
-                                tr_idx_target; // Because < at source by design
-        const auto wrong_order_var_is_one =
-            getSolution(solver->vars["order"](other_tr, tr, edge_index)) > 0.5;
-
-        // Check if specified vertex headway is fulfilled
-        if (!same_order || wrong_order_var_is_one ||
-            solver->solver_strategy.lazy_constraint_selection_strategy ==
-                LazyConstraintSelectionStrategy::AllChecked ||
-            getSolution(tr_t_var_source_front) -
-                    getSolution(other_tr_t_var_source_rear) <
-                hw_s1_value - GRB_EPS ||
-            getSolution(tr_t_var_target_front) -
-                    getSolution(other_tr_t_var_target_rear) <
-                hw_t1_value - GRB_EPS) {
-          const auto t_bound_tmp =
-              std::max(tr_t_bound, solver->ub_timing_variable(other_tr));
-
-          // Introduce basic constraints on order
-          GRBLinExpr order_expr =
-              solver->vars["order"](tr, other_tr, edge_index) +
-              solver->vars["order"](other_tr, tr, edge_index);
-          GRBLinExpr edge_expr = solver->vars["x"](tr, edge_index) +
-                                 solver->vars["x"](other_tr, edge_index);
-          addLazy(order_expr <= 0.5 * edge_expr);
-          addLazy(order_expr >= edge_expr - 1);
-
-          // Add headway constraints
-          GRBLinExpr lhs_source =
-              tr_t_var_source_front +
-              (t_bound_tmp + hw_s1_max) *
-                  (1 - solver->vars["order"](tr, other_tr, edge_index));
-          GRBLinExpr rhs_source = other_tr_t_var_source_rear + hw_s1;
-
-          GRBLinExpr lhs_target =
-              tr_t_var_target_front +
-              (t_bound_tmp + hw_t1_max) *
-                  (1 - solver->vars["order"](tr, other_tr, edge_index));
-          GRBLinExpr rhs_target = other_tr_t_var_target_rear + hw_t1;
-
-          // Reverse constraints are needed. Otherwise, the solver can
-          // reschedule the trains the exact same way by setting the order
-          // variable to the wrong value
-          auto [hw_s2_max, hw_s2, hw_t2_max, hw_t2] =
-              solver->get_vertex_headway_expressions(other_tr, edge_index);
-
-          GRBLinExpr lhs_source_2 =
-              other_tr_t_var_source_front +
-              (t_bound_tmp + hw_s2_max) *
-                  (1 - solver->vars["order"](other_tr, tr, edge_index));
-          GRBLinExpr rhs_source_2 = tr_t_var_source_rear + hw_s2;
-
-          GRBLinExpr lhs_target_2 =
-              other_tr_t_var_target_front +
-              (t_bound_tmp + hw_t2_max) *
-                  (1 - solver->vars["order"](other_tr, tr, edge_index));
-          GRBLinExpr rhs_target_2 = tr_t_var_target_rear + hw_t2;
-
-          addLazy(lhs_source >= rhs_source);
-          addLazy(lhs_target >= rhs_target);
-          addLazy(lhs_source_2 >= rhs_source_2);
-          addLazy(lhs_target_2 >= rhs_target_2);
-          if (solver->solution_settings.export_option ==
-                  ExportOption::ExportLP ||
-              solver->solution_settings.export_option ==
-                  ExportOption::ExportSolutionAndLP ||
-              solver->solution_settings.export_option ==
-                  ExportOption::ExportSolutionWithInstanceAndLP) {
-            // So that the constraint can be exported
-            solver->lazy_constraints.push_back(order_expr <= 0.5 * edge_expr);
-            solver->lazy_constraints.push_back(order_expr >= edge_expr - 1);
-            solver->lazy_constraints.push_back(lhs_source >= rhs_source);
-            solver->lazy_constraints.push_back(lhs_target >= rhs_target);
-            solver->lazy_constraints.push_back(lhs_source_2 >= rhs_source_2);
-            solver->lazy_constraints.push_back(lhs_target_2 >= rhs_target_2);
-          }
-          violated_constraint_found = true;
-        }
+      const LazyCutSignature signature{
+          LazyCutType::VertexHeadway, {tr, other_tr, edge_index}, {}};
+      if (is_pooled(signature)) {
+        pending_cuts.push_back({signature, violated, {}});
+        violated_constraint_found = violated_constraint_found || violated;
+      } else {
+        const auto t_bound_tmp =
+            std::max(tr_t_bound, solver->ub_timing_variable(other_tr));
+
+        // Introduce basic constraints on order
+        GRBLinExpr order_expr =
+            solver->vars[Var::Order].at(tr, other_tr, edge_index) +
+            solver->vars[Var::Order].at(other_tr, tr, edge_index);
+        GRBLinExpr edge_expr =
+            solver->vars.get<Var::X>().at(tr, edge_index) +
+            solver->vars.get<Var::X>().at(other_tr, edge_index);
+
+        // Add headway constraints
+        GRBLinExpr lhs_source =
+            tr_t_var_source_front +
+            (t_bound_tmp + hw_s1_max) *
+                (1 - solver->vars[Var::Order].at(tr, other_tr, edge_index));
+        GRBLinExpr rhs_source = other_tr_t_var_source_rear + hw_s1;
+
+        GRBLinExpr lhs_target =
+            tr_t_var_target_front +
+            (t_bound_tmp + hw_t1_max) *
+                (1 - solver->vars[Var::Order].at(tr, other_tr, edge_index));
+        GRBLinExpr rhs_target = other_tr_t_var_target_rear + hw_t1;
+
+        // Reverse constraints are needed. Otherwise, the solver can
+        // reschedule the trains the exact same way by setting the order
+        // variable to the wrong value
+        auto [hw_s2_max, hw_s2, hw_t2_max, hw_t2] =
+            solver->get_vertex_headway_expressions(other_tr, edge_index);
+
+        GRBLinExpr lhs_source_2 =
+            other_tr_t_var_source_front +
+            (t_bound_tmp + hw_s2_max) *
+                (1 - solver->vars[Var::Order].at(other_tr, tr, edge_index));
+        GRBLinExpr rhs_source_2 = tr_t_var_source_rear + hw_s2;
+
+        GRBLinExpr lhs_target_2 =
+            other_tr_t_var_target_front +
+            (t_bound_tmp + hw_t2_max) *
+                (1 - solver->vars[Var::Order].at(other_tr, tr, edge_index));
+        GRBLinExpr rhs_target_2 = tr_t_var_target_rear + hw_t2;
+
+        std::vector<LazyCut> cuts;
+        cuts.reserve(6);
+        cuts.emplace_back(order_expr, GRB_LESS_EQUAL, 0.5 * edge_expr);
+        cuts.emplace_back(order_expr, GRB_GREATER_EQUAL, edge_expr - 1);
+        cuts.emplace_back(lhs_source, GRB_GREATER_EQUAL, rhs_source);
+        cuts.emplace_back(lhs_target, GRB_GREATER_EQUAL, rhs_target);
+        cuts.emplace_back(lhs_source_2, GRB_GREATER_EQUAL, rhs_source_2);
+        cuts.emplace_back(lhs_target_2, GRB_GREATER_EQUAL, rhs_target_2);
+        pending_cuts.push_back({signature, violated, std::move(cuts)});
+        violated_constraint_found = true;
       }
     }
   }
@@ -852,9 +979,7 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
 
 bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
     create_lazy_reverse_edge_constraints(
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-            train_orders_on_edges) {
+        const TrainOrdersOnEdges& train_orders_on_edges) {
   // Prevent trains from front crashing into each other
   bool violated_constraint_found = false;
   bool only_one_constraint =
@@ -866,20 +991,23 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
                        (!only_one_constraint || !violated_constraint_found);
        idx++) {
     const auto& [e1, e2] = solver->relevant_reverse_edges.at(idx);
-    const auto& e_obj    = solver->instance.const_n().get_edge(e1);
+    const auto& e_obj    = solver->instance->const_n().get_edge(e1);
     for (size_t i = 0;
          i < 2 && (!only_one_constraint || !violated_constraint_found); i++) {
-      const auto& tr_order = i == 0 ? train_orders_on_edges.at(e1).first
-                                    : train_orders_on_edges.at(e1).second;
+      const auto tr_order = i == 0 ? train_orders_on_edges.source_order(e1)
+                                   : train_orders_on_edges.target_order(e1);
       for (size_t tr1_idx = 1;
            tr1_idx < tr_order.size() &&
            (!only_one_constraint || !violated_constraint_found);
            tr1_idx++) {
-        const auto& [tr1, tr1_direction] = tr_order.at(tr1_idx);
-        const auto& tr1_t_var_front      = solver->vars["t_front_arrival"](
-            tr1, tr1_direction ? e_obj.source : e_obj.target);
-        const auto& tr1_t_var_value_front = getSolution(tr1_t_var_front);
-        const auto& tr1_t_var_rear        = solver->vars["t_rear_departure"](
+        const auto& [tr1, tr1_direction] = tr_order[tr1_idx];
+        const auto& tr1_t_var_front =
+            solver->vars.get<Var::TFrontArrival>()(
+                tr1, tr1_direction ? e_obj.source : e_obj.target);
+        const auto tr1_t_var_value_front = solver->callback_solution.value(
+            Var::TFrontArrival, tr1,
+            tr1_direction ? e_obj.source : e_obj.target);
+        const auto& tr1_t_var_rear = solver->vars.get<Var::TRearDeparture>()(
             tr1, tr1_direction ? e_obj.target : e_obj.source);
         const auto tr1_t_bound = solver->ub_timing_variable(tr1);
 
@@ -898,56 +1026,64 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
              (!only_one_constraint || !violated_constraint_found);
              tr2_idx++) {
           assert(tr1_idx != tr2_idx);
-          const auto& [tr2, tr2_direction] = tr_order.at(tr2_idx);
+          const auto& [tr2, tr2_direction] = tr_order[tr2_idx];
           if (tr1_direction == tr2_direction) {
             // The trains travel in the same direction!
             continue;
           }
-          const auto& tr2_t_var_front = solver->vars["t_front_arrival"](
+          const auto& tr2_t_var_front = solver->vars.get<Var::TFrontArrival>()(
               tr2, tr2_direction ? e_obj.source : e_obj.target);
-          const auto& tr2_t_var_rear = solver->vars["t_rear_departure"](
+          const auto& tr2_t_var_rear = solver->vars.get<Var::TRearDeparture>()(
               tr2, tr2_direction ? e_obj.target : e_obj.source);
-          const auto& tr2_t_var_value_rear = getSolution(tr2_t_var_rear);
+          const auto  tr2_t_var_value_rear = solver->callback_solution.value(
+              Var::TRearDeparture, tr2,
+              tr2_direction ? e_obj.target : e_obj.source);
 
           // Check if trains do not crash as specified
-          if (solver->solver_strategy.lazy_constraint_selection_strategy ==
-                  LazyConstraintSelectionStrategy::AllChecked ||
-              tr1_t_var_value_front < tr2_t_var_value_rear - GRB_EPS) {
+          const bool violated =
+              tr1_t_var_value_front < tr2_t_var_value_rear - GRB_EPS;
+          if (!violated &&
+              solver->solver_strategy.lazy_constraint_selection_strategy !=
+                  LazyConstraintSelectionStrategy::AllChecked) {
+            continue;
+          }
+
+          const LazyCutSignature signature{
+              LazyCutType::ReverseEdge,
+              {tr1, tr2, idx, static_cast<size_t>(tr1_direction)},
+              {}};
+          if (submit_pooled_lazy_cuts(signature, violated)) {
+            violated_constraint_found = violated_constraint_found || violated;
+          } else {
             const auto  tr2_t_bound = solver->ub_timing_variable(tr2);
             const auto  t_bound     = std::max(tr1_t_bound, tr2_t_bound);
             const auto& tr1_edge    = tr1_direction ? e1 : e2;
             const auto& tr2_edge    = tr2_direction ? e1 : e2;
 
-            GRBLinExpr lhs1 = solver->vars["reverse_order"](tr1, tr2, idx) +
-                              solver->vars["reverse_order"](tr2, tr1, idx);
-            GRBLinExpr rhs1 = solver->vars["x"](tr1, tr1_edge) +
-                              solver->vars["x"](tr2, tr2_edge) - 1;
+            GRBLinExpr lhs1 =
+                solver->vars[Var::ReverseOrder].at(tr1, tr2, idx) +
+                solver->vars[Var::ReverseOrder].at(tr2, tr1, idx);
+            GRBLinExpr rhs1 = solver->vars.get<Var::X>()(tr1, tr1_edge) +
+                              solver->vars.get<Var::X>()(tr2, tr2_edge) - 1;
 
             GRBLinExpr lhs2 =
                 tr1_t_var_front +
-                t_bound * (1 - solver->vars["reverse_order"](tr1, tr2, idx));
+                t_bound *
+                    (1 - solver->vars[Var::ReverseOrder].at(tr1, tr2, idx));
             GRBLinExpr rhs2 = tr2_t_var_rear;
             GRBLinExpr lhs3 =
                 tr2_t_var_front +
-                t_bound * (1 - solver->vars["reverse_order"](tr2, tr1, idx));
+                t_bound *
+                    (1 - solver->vars[Var::ReverseOrder].at(tr2, tr1, idx));
             GRBLinExpr rhs3 = tr1_t_var_rear;
 
-            addLazy(lhs1 >= rhs1);
-            addLazy(lhs1 <= 1);
-            addLazy(lhs2 >= rhs2);
-            addLazy(lhs3 >= rhs3);
-
-            if (solver->solution_settings.export_option ==
-                    ExportOption::ExportLP ||
-                solver->solution_settings.export_option ==
-                    ExportOption::ExportSolutionAndLP ||
-                solver->solution_settings.export_option ==
-                    ExportOption::ExportSolutionWithInstanceAndLP) {
-              solver->lazy_constraints.push_back(lhs1 >= rhs1);
-              solver->lazy_constraints.push_back(lhs1 <= 1);
-              solver->lazy_constraints.push_back(lhs2 >= rhs2);
-              solver->lazy_constraints.push_back(lhs3 >= rhs3);
-            }
+            std::vector<LazyCut> cuts;
+            cuts.reserve(4);
+            cuts.emplace_back(lhs1, GRB_GREATER_EQUAL, rhs1);
+            cuts.emplace_back(lhs1, GRB_LESS_EQUAL, 1);
+            cuts.emplace_back(lhs2, GRB_GREATER_EQUAL, rhs2);
+            cuts.emplace_back(lhs3, GRB_GREATER_EQUAL, rhs3);
+            submit_lazy_cuts(signature, violated, std::move(cuts));
 
             violated_constraint_found = true;
           }
@@ -962,193 +1098,269 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
     create_lazy_simplified_edge_constraints(
         const std::vector<std::vector<std::pair<size_t, double>>>& routes,
         const std::vector<std::unordered_map<size_t, double>>& train_velocities,
-        const std::vector<std::pair<std::vector<std::pair<size_t, bool>>,
-                                    std::vector<std::pair<size_t, bool>>>>&
-                                                train_orders_on_edges,
-        const std::vector<std::vector<size_t>>& train_orders_on_ttd) {
-  bool violated_constraint_found = false;
-  bool only_one_constraint =
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution) {
+  return separate_trains_in_parallel(
+      [&](size_t tr, std::vector<PendingLazyCuts>& pending_cuts) {
+        return separate_simplified_edge_constraints(
+            tr, routes, train_velocities, train_orders_on_edges,
+            train_orders_on_ttd, solution, pending_cuts);
+      });
+}
+
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    separate_simplified_edge_constraints(
+        size_t                                                     tr,
+        const std::vector<std::vector<std::pair<size_t, double>>>& routes,
+        const std::vector<std::unordered_map<size_t, double>>& train_velocities,
+        const TrainOrdersOnEdges&                         train_orders_on_edges,
+        const std::vector<std::vector<size_t>>&           train_orders_on_ttd,
+        const VariableSnapshot<GenPOMovingBlockVariable>& solution,
+        std::vector<PendingLazyCuts>&                     pending_cuts) const {
+  bool       violated_constraint_found = false;
+  const bool only_one_constraint =
       solver->solver_strategy.lazy_constraint_selection_strategy ==
       LazyConstraintSelectionStrategy::OnlyFirstFound;
 
-  for (size_t tr = 0; tr < solver->num_tr &&
-                      (!only_one_constraint || !violated_constraint_found);
-       tr++) {
-    const auto tr_t_bound = solver->ub_timing_variable(tr);
-    const auto tr_object  = solver->instance.get_train_list().get_train(tr);
-    // Check every vertex on the route
-    for (size_t r_v_idx = 0;
-         r_v_idx < routes.at(tr).size() - 1 &&
-         (!only_one_constraint || !violated_constraint_found);
-         r_v_idx++) {
-      const auto& v_source   = routes.at(tr).at(r_v_idx).first;
-      const auto& v_target   = routes.at(tr).at(r_v_idx + 1).first;
-      const auto& vel_source = train_velocities.at(tr).at(v_source);
-      const auto& vel_target = train_velocities.at(tr).at(v_target);
-      const auto& edge_index =
-          solver->instance.const_n().get_edge_index(v_source, v_target);
-      const auto& edge_object = solver->instance.const_n().get_edge(edge_index);
-
-      const auto hw_edge =
-          cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::headway(
-              tr_object, edge_object, vel_source, vel_target, r_v_idx == 0);
-
-      // Variables to possibly strengthen the constraints
-      auto [hw_max, headway_tr_on_e, hw_max_ttd, headway_tr_on_ttd] =
-          solver->get_edge_headway_expressions(tr, edge_index);
-      const auto& tr_t_var = solver->vars["t_front_departure"](tr, v_source);
-      const auto  tr_t_var_value = getSolution(tr_t_var);
+  const auto tr_t_bound = solver->ub_timing_variable(tr);
+  // Check every vertex on the route
+  for (size_t r_v_idx = 0;
+       r_v_idx < routes.at(tr).size() - 1 &&
+       (!only_one_constraint || !violated_constraint_found);
+       r_v_idx++) {
+    const auto& v_source   = routes.at(tr).at(r_v_idx).first;
+    const auto& v_target   = routes.at(tr).at(r_v_idx + 1).first;
+    const auto& vel_source = train_velocities.at(tr).at(v_source);
+    const auto& vel_target = train_velocities.at(tr).at(v_target);
+    const auto& edge_index =
+        solver->instance->const_n().get_edge_index(v_source, v_target);
+
+    const auto hw_edge = solver->edge_headway(
+        tr, edge_index, solver->velocity_index(tr, v_source, vel_source),
+        solver->velocity_index(tr, v_target, vel_target), r_v_idx == 0);
+
+    // Variables to possibly strengthen the constraints
+    auto [hw_max, headway_tr_on_e, hw_max_ttd, headway_tr_on_ttd] =
+        solver->get_edge_headway_expressions(tr, edge_index);
+    const auto& tr_t_var =
+        solver->vars.get<Var::TFrontDeparture>().at(tr, v_source);
+    const auto  tr_t_var_value =
+        solution.value(Var::TFrontDeparture, tr, v_source);
+
+    std::unordered_set<size_t> other_trains;
+    const auto tr_order = train_orders_on_edges.source_order(edge_index);
+    const auto tr_index = std::find(tr_order.begin(), tr_order.end(),
+                                    std::pair<size_t, bool>(tr, true)) -
+                          tr_order.begin();
+    assert(tr_index != tr_order.end() - tr_order.begin());
+    for (size_t tr_other_idx = 0; tr_other_idx < tr_order.size();
+         tr_other_idx++) {
+      if (tr_other_idx == tr_index) {
+        continue;
+      }
+      if (!tr_order[tr_other_idx].second) {
+        // The train travels in reverse direction!
+        continue;
+      }
+      if (solver->solver_strategy.lazy_train_selection_strategy ==
+              LazyTrainSelectionStrategy::OnlyAdjacent &&
+          std::abs(static_cast<int>(tr_other_idx) -
+                   static_cast<int>(tr_index)) > 1) {
+        continue;
+      }
+      if (!solver->solver_strategy.include_reverse_headways &&
+          tr_other_idx > tr_index) {
+        // In this case tr_other follows tr, which is irrelevant for tr ma
+        continue;
+      }
+      other_trains.insert(tr_order[tr_other_idx].first);
+    }
 
-      std::unordered_set<size_t> other_trains;
-      const auto& tr_order = train_orders_on_edges.at(edge_index).first;
-      const auto  tr_index = std::find(tr_order.begin(), tr_order.end(),
-                                       std::pair<size_t, bool>(tr, true)) -
-                            tr_order.begin();
-      assert(tr_index != tr_order.end() - tr_order.begin());
-      for (size_t tr_other_idx = 0; tr_other_idx < tr_order.size();
-           tr_other_idx++) {
-        if (tr_other_idx == tr_index) {
-          continue;
-        }
-        if (!tr_order.at(tr_other_idx).second) {
-          // The train travels in reverse direction!
-          continue;
-        }
-        if (solver->solver_strategy.lazy_train_selection_strategy ==
-                LazyTrainSelectionStrategy::OnlyAdjacent &&
-            std::abs(static_cast<int>(tr_other_idx) -
-                     static_cast<int>(tr_index)) > 1) {
-          continue;
-        }
-        if (!solver->solver_strategy.include_reverse_headways &&
-            tr_other_idx > tr_index) {
-          // In this case tr_other follows tr, which is irrelevant for tr ma
-          continue;
-        }
-        other_trains.insert(tr_order.at(tr_other_idx).first);
+    for (const auto& tr_other_idx : other_trains) {
+      const auto& tr_other_t_var =
+          solver->vars.get<Var::TRearDeparture>().at(tr_other_idx, v_target);
+      const auto tr_other_var_value =
+          solution.value(Var::TRearDeparture, tr_other_idx, v_target);
+
+      // Check if this constraint should be added
+      const bool violated =
+          tr_t_var_value - tr_other_var_value < hw_edge - GRB_EPS;
+      if (!violated &&
+          solver->solver_strategy.lazy_constraint_selection_strategy !=
+              LazyConstraintSelectionStrategy::AllChecked) {
+        continue;
       }
 
-      for (const auto& tr_other_idx : other_trains) {
-        const auto& tr_other_t_var =
-            solver->vars["t_rear_departure"](tr_other_idx, v_target);
-        const auto& tr_other_var_value = getSolution(tr_other_t_var);
+      const auto t_bound_tmp =
+          std::max(tr_t_bound, solver->ub_timing_variable(tr_other_idx));
+
+      const LazyCutSignature signature{LazyCutType::SimplifiedEdgeHeadway,
+                                       {tr, tr_other_idx, edge_index},
+                                       {}};
+      if (is_pooled(signature)) {
+        pending_cuts.push_back({signature, violated, {}});
+        violated_constraint_found = violated_constraint_found || violated;
+      } else {
+        GRBLinExpr lhs =
+            tr_t_var - tr_other_t_var +
+            (t_bound_tmp + hw_max) *
+                (1 - solver->vars[Var::Order].at(tr, tr_other_idx, edge_index));
+        GRBLinExpr rhs = headway_tr_on_e;
+        pending_cuts.push_back(
+            {signature, violated, {LazyCut(lhs, GRB_GREATER_EQUAL, rhs)}});
+        violated_constraint_found = true;
+      }
+    }
 
-        // Check if this constraint should be added
-        bool add_constr =
-            (solver->solver_strategy.lazy_constraint_selection_strategy ==
-             LazyConstraintSelectionStrategy::AllChecked);
-        if (!add_constr &&
-            tr_t_var_value - tr_other_var_value < hw_edge - GRB_EPS) {
-          add_constr = true;
+    // TTD constraint on entering edge
+    const auto neighboring_edges =
+        solver->instance->const_n().neighboring_edges(v_source);
+    const auto intersecting_ttd = cda_rail::Network::get_intersecting_ttd(
+        {edge_index}, solver->ttd_sections);
+    for (const auto& [ttd_index, _] : intersecting_ttd) {
+      const auto& ttd_section = solver->ttd_sections.at(ttd_index);
+      // If all of neighboring_edges are in ttd_section, then it is not an
+      // entering edge Hence, if at least one neighboring edge is not in
+      // ttd_section, then we have an entering edge
+      const bool is_entering_edge = std::any_of(
+          neighboring_edges.begin(), neighboring_edges.end(),
+          [&ttd_section](const auto& e_tmp) {
+            return std::find(ttd_section.begin(), ttd_section.end(), e_tmp) ==
+                   ttd_section.end();
+          });
+      if (is_entering_edge) {
+        // Check TTD condition on entering edge
+        const auto& tr_order_ttd = train_orders_on_ttd.at(ttd_index);
+        std::unordered_set<size_t> other_trains_ttd;
+        const auto                 tr_index_ttd =
+            std::find(tr_order_ttd.begin(), tr_order_ttd.end(), tr) -
+            tr_order_ttd.begin();
+        assert(tr_index_ttd < tr_order_ttd.end() - tr_order_ttd.begin());
+
+        for (size_t tr_other_idx_ttd = 0;
+             tr_other_idx_ttd < tr_order_ttd.size(); tr_other_idx_ttd++) {
+          if (tr_other_idx_ttd == tr_index_ttd) {
+            continue;
+          }
+          if (solver->solver_strategy.lazy_train_selection_strategy ==
+                  LazyTrainSelectionStrategy::OnlyAdjacent &&
+              std::abs(static_cast<int>(tr_other_idx_ttd) -
+                       static_cast<int>(tr_index_ttd)) > 1) {
+            continue;
+          }
+          if (!solver->solver_strategy.include_reverse_headways &&
+              tr_other_idx_ttd > tr_index_ttd) {
+            // In this case tr_other follows tr, which is irrelevant for tr ma
+            continue;
+          }
+          other_trains_ttd.insert(tr_order_ttd.at(tr_other_idx_ttd));
         }
 
-        const auto t_bound_tmp =
-            std::max(tr_t_bound, solver->ub_timing_variable(tr_other_idx));
-
-        if (add_constr) {
-          GRBLinExpr lhs =
-              tr_t_var - tr_other_t_var +
-              (t_bound_tmp + hw_max) *
-                  (1 - solver->vars["order"](tr, tr_other_idx, edge_index));
-          GRBLinExpr rhs = headway_tr_on_e;
-          addLazy(lhs >= rhs);
-          if (solver->solution_settings.export_option ==
-                  ExportOption::ExportLP ||
-              solver->solution_settings.export_option ==
-                  ExportOption::ExportSolutionAndLP ||
-              solver->solution_settings.export_option ==
-                  ExportOption::ExportSolutionWithInstanceAndLP) {
-            solver->lazy_constraints.push_back(lhs >= rhs);
+        const auto hw_ttd_value =
+            solver->ma_backward_time(tr, v_source, vel_source);
+
+        for (const auto& tr_other_ttd : other_trains_ttd) {
+          const auto& tr_other_t_var_ttd =
+              solver->vars.get<Var::TTtdDeparture>().at(tr_other_ttd,
+                                                        ttd_index);
+          const auto tr_other_t_var_value_ttd =
+              solution.value(Var::TTtdDeparture, tr_other_ttd, ttd_index);
+
+          // Check if this constraint should be added
+          const bool violated = tr_t_var_value - tr_other_t_var_value_ttd <
+                                hw_ttd_value - GRB_EPS;
+          if (!violated &&
+              solver->solver_strategy.lazy_constraint_selection_strategy !=
+                  LazyConstraintSelectionStrategy::AllChecked) {
+            continue;
+          }
+
+          const auto t_bound_tmp =
+              std::max(tr_t_bound, solver->ub_timing_variable(tr_other_ttd));
+
+          const LazyCutSignature signature{
+              LazyCutType::SimplifiedTtdHeadway,
+              {tr, tr_other_ttd, edge_index, ttd_index},
+              {}};
+          if (is_pooled(signature)) {
+            pending_cuts.push_back({signature, violated, {}});
+            violated_constraint_found = violated_constraint_found || violated;
+          } else {
+            GRBLinExpr lhs = tr_t_var - tr_other_t_var_ttd +
+                             (t_bound_tmp + hw_max_ttd) *
+                                 (1 - solver->vars[Var::OrderTtd].at(
+                                          tr, tr_other_ttd, ttd_index));
+            GRBLinExpr rhs = headway_tr_on_ttd;
+            pending_cuts.push_back(
+                {signature, violated, {LazyCut(lhs, GRB_GREATER_EQUAL, rhs)}});
+            violated_constraint_found = true;
           }
-          violated_constraint_found = true;
         }
       }
+    }
+  }
 
-      // TTD constraint on entering edge
-      const auto neighboring_edges =
-          solver->instance.const_n().neighboring_edges(v_source);
-      const auto intersecting_ttd = cda_rail::Network::get_intersecting_ttd(
-          {edge_index}, solver->ttd_sections);
-      for (const auto& [ttd_index, _] : intersecting_ttd) {
-        const auto& ttd_section = solver->ttd_sections.at(ttd_index);
-        // If all of neighboring_edges are in ttd_section, then it is not an
-        // entering edge Hence, if at least one neighboring edge is not in
-        // ttd_section, then we have an entering edge
-        const bool is_entering_edge = std::any_of(
-            neighboring_edges.begin(), neighboring_edges.end(),
-            [&ttd_section](const auto& e_tmp) {
-              return std::find(ttd_section.begin(), ttd_section.end(), e_tmp) ==
-                     ttd_section.end();
-            });
-        if (is_entering_edge) {
-          // Check TTD condition on entering edge
-          const auto& tr_order_ttd = train_orders_on_ttd.at(ttd_index);
-          std::unordered_set<size_t> other_trains_ttd;
-          const auto                 tr_index_ttd =
-              std::find(tr_order_ttd.begin(), tr_order_ttd.end(), tr) -
-              tr_order_ttd.begin();
-          assert(tr_index_ttd < tr_order_ttd.end() - tr_order_ttd.begin());
-
-          for (size_t tr_other_idx_ttd = 0;
-               tr_other_idx_ttd < tr_order_ttd.size(); tr_other_idx_ttd++) {
-            if (tr_other_idx_ttd == tr_index_ttd) {
-              continue;
-            }
-            if (solver->solver_strategy.lazy_train_selection_strategy ==
-                    LazyTrainSelectionStrategy::OnlyAdjacent &&
-                std::abs(static_cast<int>(tr_other_idx_ttd) -
-                         static_cast<int>(tr_index_ttd)) > 1) {
-              continue;
-            }
-            if (!solver->solver_strategy.include_reverse_headways &&
-                tr_other_idx_ttd > tr_index_ttd) {
-              // In this case tr_other follows tr, which is irrelevant for tr ma
-              continue;
-            }
-            other_trains_ttd.insert(tr_order_ttd.at(tr_other_idx_ttd));
-          }
+  return violated_constraint_found;
+}
 
-          const auto hw_ttd_value =
-              cda_rail::min_time_to_push_ma_fully_backward(
-                  vel_source, tr_object.acceleration, tr_object.deceleration);
-
-          for (const auto& tr_other_ttd : other_trains_ttd) {
-            const auto& tr_other_t_var_ttd =
-                solver->vars["t_ttd_departure"](tr_other_ttd, ttd_index);
-            const auto& tr_other_t_var_value_ttd =
-                getSolution(tr_other_t_var_ttd);
-
-            // Check if this constraint should be added
-            bool add_constr =
-                (solver->solver_strategy.lazy_constraint_selection_strategy ==
-                 LazyConstraintSelectionStrategy::AllChecked);
-            if (!add_constr && tr_t_var_value - tr_other_t_var_value_ttd <
-                                   hw_ttd_value - GRB_EPS) {
-              add_constr = true;
-            }
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    separate_trains_in_parallel(const TrainSeparator& separate_train) {
+  /**
+   * Separates the lazy constraints of all trains and submits the found cuts.
+   * Trains are distributed dynamically among the workers of separation_pool,
+   * every worker writes only to the buffers of its trains. Gurobi may only be
+   * called from the callback thread, hence, the cuts are submitted after all
+   * workers are done and in the order of the trains. Thus, the result does not
+   * depend on the number of threads.
+   *
+   * @param separate_train Collects the cuts of a single train and returns true
+   * if a violated constraint was found
+   *
+   * @return true if a violated constraint was found
+   */
 
-            const auto t_bound_tmp =
-                std::max(tr_t_bound, solver->ub_timing_variable(tr_other_ttd));
-
-            if (add_constr) {
-              GRBLinExpr lhs = tr_t_var - tr_other_t_var_ttd +
-                               (t_bound_tmp + hw_max_ttd) *
-                                   (1 - solver->vars["order_ttd"](
-                                            tr, tr_other_ttd, ttd_index));
-              GRBLinExpr rhs = headway_tr_on_ttd;
-              addLazy(lhs >= rhs);
-              if (solver->solution_settings.export_option ==
-                      ExportOption::ExportLP ||
-                  solver->solution_settings.export_option ==
-                      ExportOption::ExportSolutionAndLP ||
-                  solver->solution_settings.export_option ==
-                      ExportOption::ExportSolutionWithInstanceAndLP) {
-                solver->lazy_constraints.push_back(lhs >= rhs);
-              }
-              violated_constraint_found = true;
-            }
-          }
-        }
+  const auto num_tr              = solver->num_tr;
+  const bool only_one_constraint =
+      solver->solver_strategy.lazy_constraint_selection_strategy ==
+      LazyConstraintSelectionStrategy::OnlyFirstFound;
+
+  if (separation_pool == nullptr) {
+    // Kept for all callbacks of the current solve
+    separation_pool = std::make_unique<ThreadPool>(resolve_num_threads(
+        solver->solver_strategy.lazy_separation_threads, num_tr));
+  }
+
+  std::vector<std::vector<PendingLazyCuts>> pending_cuts(num_tr);
+  // If only one constraint is needed, trains after the first train with a
+  // violated constraint do not have to be checked
+  std::atomic<size_t> first_violated_tr(num_tr);
+  separation_pool->parallel_for(num_tr, [&](size_t tr, size_t /*worker*/) {
+    if (only_one_constraint && tr > first_violated_tr) {
+      return;
+    }
+    if (separate_train(tr, pending_cuts[tr]) && only_one_constraint) {
+      size_t current = first_violated_tr;
+      while (tr < current &&
+             !first_violated_tr.compare_exchange_weak(current, tr)) {
+        // On failure, current is updated to the latest value
+      }
+    }
+  });
+
+  bool violated_constraint_found = false;
+  for (size_t tr = 0; tr < num_tr; tr++) {
+    for (auto& pending : pending_cuts[tr]) {
+      if (only_one_constraint && violated_constraint_found) {
+        return true;
+      }
+      if (submit_pooled_lazy_cuts(pending.signature, pending.violated)) {
+        violated_constraint_found =
+            violated_constraint_found || pending.violated;
+      } else {
+        submit_lazy_cuts(pending.signature, pending.violated,
+                         std::move(pending.cuts));
+        violated_constraint_found = true;
       }
     }
   }
@@ -1156,4 +1368,85 @@ bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
   return violated_constraint_found;
 }
 
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    is_pooled(const LazyCutSignature& signature) const {
+  /**
+   * Checks if the cuts identified by signature are known to the lazy cut pool,
+   * in which case they do not have to be created again. The pool is not
+   * modified, hence, this can be called by worker threads.
+   */
+
+  return solver->solver_strategy.use_lazy_cut_pool &&
+         solver->lazy_cut_pool.contains(signature);
+}
+
+bool cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    submit_pooled_lazy_cuts(const LazyCutSignature& signature, bool violated) {
+  /**
+   * Checks if the cuts identified by signature are known to the lazy cut pool.
+   * In this case, they do not have to be created again. Known cuts that have
+   * been submitted to the current model already are only submitted again if
+   * they are violated by the current solution, since Gurobi does not
+   * guarantee that previously added lazy constraints are respected.
+   *
+   * @param signature Canonical description of the cuts
+   * @param violated If true, the cuts are violated by the current solution
+   *
+   * @return true if the cuts are pooled, false if they have to be created and
+   * submitted using submit_lazy_cuts
+   */
+
+  if (!solver->solver_strategy.use_lazy_cut_pool) {
+    return false;
+  }
+
+  auto* entry = solver->lazy_cut_pool.find(signature);
+  if (entry == nullptr) {
+    return false;
+  }
+  if (entry->promoted || (entry->submitted && !violated)) {
+    solver->lazy_callback_profile.record_cuts(signature, violated, true, 0);
+    return true;
+  }
+
+  solver->lazy_callback_profile.record_cuts(signature, violated, true,
+                                            entry->cuts.size());
+  entry->hits++;
+  for (const auto& cut : entry->cuts) {
+    addLazy(cut.expr, cut.sense, cut.rhs);
+    if (!entry->submitted &&
+        exports_lp(solver->solution_settings.export_option)) {
+      solver->lazy_constraints.push_back(cut.to_temp_constr());
+    }
+  }
+  entry->submitted = true;
+  return true;
+}
+
+void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::LazyCallback::
+    submit_lazy_cuts(const LazyCutSignature& signature, bool violated,
+                     std::vector<LazyCut> cuts) {
+  /**
+   * Submits newly created cuts and records them in the lazy cut pool.
+   *
+   * @param signature Canonical description of the cuts
+   * @param violated If true, the cuts are violated by the current solution
+   * @param cuts Cuts to submit
+   */
+
+  solver->lazy_callback_profile.record_cuts(signature, violated, false,
+                                            cuts.size());
+
+  for (const auto& cut : cuts) {
+    addLazy(cut.expr, cut.sense, cut.rhs);
+    if (exports_lp(solver->solution_settings.export_option)) {
+      // So that the constraint can be exported
+      solver->lazy_constraints.push_back(cut.to_temp_constr());
+    }
+  }
+  if (solver->solver_strategy.use_lazy_cut_pool) {
+    solver->lazy_cut_pool.insert(signature, std::move(cuts));
+  }
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-array-to-pointer-decay,performance-inefficient-string-concatenation)
@@ -58,10 +58,10 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_solution(
   sol.reset_routes();
   for (int tr = 0; tr < num_tr; tr++) {
     bool        tr_routed = false;
-    const auto& tr_object = instance.get_train_list().get_train(tr);
+    const auto& tr_object = instance->get_train_list().get_train(tr);
     sol.add_empty_route(tr_object.name);
-    const auto entry             = instance.get_schedule(tr).get_entry();
-    auto       edges_to_consider = instance.const_n().out_edges(entry);
+    const auto entry             = instance->get_schedule(tr).get_entry();
+    auto       edges_to_consider = instance->const_n().out_edges(entry);
 
     double                                 current_pos = 0;
     std::vector<std::pair<size_t, double>> route_marker_tr;
@@ -69,19 +69,19 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_solution(
     while (!edges_to_consider.empty()) {
       const auto& edge_id = edges_to_consider.back();
       edges_to_consider.pop_back();
-      if (!vars.at("x").at(tr, edge_id).sameAs(GRBVar()) &&
-          vars.at("x").at(tr, edge_id).get(GRB_DoubleAttr_X) > 0.5) {
-        const auto& edge_object = instance.const_n().get_edge(edge_id);
+      if (!vars.get<Var::X>().at(tr, edge_id).sameAs(GRBVar()) &&
+          vars.get<Var::X>().at(tr, edge_id).get(GRB_DoubleAttr_X) > 0.5) {
+        const auto& edge_object = instance->const_n().get_edge(edge_id);
         current_pos += edge_object.length;
         route_marker_tr.emplace_back(edge_object.target, current_pos);
         const auto& [old_edge_id, old_edge_pos] =
-            instance.const_n().get_old_edge(edge_id);
+            instance->const_n().get_old_edge(edge_id);
         if (old_edge_pos == 0) {
           sol.push_back_edge_to_route(tr_object.name, old_edge_id);
           tr_routed = true;
         }
-        edges_to_consider = instance.const_n().out_edges(
-            instance.const_n().get_edge(edge_id).target);
+        edges_to_consider = instance->const_n().out_edges(
+            instance->const_n().get_edge(edge_id).target);
       }
     }
     route_markers.push_back(route_marker_tr);
@@ -91,13 +91,15 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_solution(
   // Save routing times
   PLOGD << "Setting timings and velocities...";
   for (int tr = 0; tr < num_tr; tr++) {
-    const auto& tr_object   = instance.get_train_list().get_train(tr);
-    const auto& tr_schedule = instance.get_schedule(tr);
+    const auto& tr_object   = instance->get_train_list().get_train(tr);
+    const auto& tr_schedule = instance->get_schedule(tr);
     for (const auto& [vertex_id, pos] : route_markers[tr]) {
-      const auto time_1 =
-          vars.at("t_front_arrival").at(tr, vertex_id).get(GRB_DoubleAttr_X);
-      const auto time_2 =
-          vars.at("t_front_departure").at(tr, vertex_id).get(GRB_DoubleAttr_X);
+      const auto time_1 = vars.get<Var::TFrontArrival>()
+                              .at(tr, vertex_id)
+                              .get(GRB_DoubleAttr_X);
+      const auto time_2 = vars.get<Var::TFrontDeparture>()
+                              .at(tr, vertex_id)
+                              .get(GRB_DoubleAttr_X);
       const auto vertex_speed = extract_speed(tr, vertex_id);
       sol.add_train_pos(tr_object.name, time_1, pos);
       sol.add_train_speed(tr_object.name, time_1, vertex_speed);
@@ -107,8 +109,9 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_solution(
       }
 
       if (vertex_id == tr_schedule.get_exit()) {
-        const auto last_time =
-            vars.at("t_rear_departure").at(tr, vertex_id).get(GRB_DoubleAttr_X);
+        const auto last_time = vars.get<Var::TRearDeparture>()
+                                   .at(tr, vertex_id)
+                                   .get(GRB_DoubleAttr_X);
         const auto last_speed = tr_schedule.get_v_n();
         sol.add_train_pos(tr_object.name, last_time, pos + tr_object.length);
         sol.add_train_speed(tr_object.name, last_time, last_speed);
@@ -122,10 +125,10 @@ void cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_solution(
 double cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_speed(
     size_t tr, size_t vertex_id) const {
   assert(model->get(GRB_IntAttr_SolCount) >= 1);
-  const auto& tr_object      = instance.get_train_list().get_train(tr);
-  const auto  delta_consider = instance.const_n().neighboring_edges(vertex_id);
+  const auto& tr_object      = instance->get_train_list().get_train(tr);
+  const auto  delta_consider = instance->const_n().neighboring_edges(vertex_id);
   const auto  edges_used_by_td =
-      instance.edges_used_by_train(tr, model_detail.fix_routes, false);
+      instance->edges_used_by_train(tr, model_detail.fix_routes, false);
   std::vector<size_t> edges_to_consider;
   for (const auto& edge_id : delta_consider) {
     if (std::find(edges_used_by_td.begin(), edges_used_by_td.end(), edge_id) !=
@@ -135,7 +138,7 @@ double cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_speed(
   }
 
   for (const auto& edge_id : edges_to_consider) {
-    const auto edge_obj = instance.const_n().get_edge(edge_id);
+    const auto edge_obj = instance->const_n().get_edge(edge_id);
     assert(edge_obj.source == vertex_id || edge_obj.target == vertex_id);
     const auto v1_extensions = velocity_extensions.at(tr).at(edge_obj.source);
     const auto v2_extensions = velocity_extensions.at(tr).at(edge_obj.target);
@@ -145,7 +148,7 @@ double cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver::extract_speed(
         const auto& v2 = v2_extensions.at(v2_idx);
         if (possible_by_eom(v1, v2, tr_object.acceleration,
                             tr_object.deceleration, edge_obj.length)) {
-          GRBVar rel_var = vars.at("y").at(tr, edge_id, v1_idx, v2_idx);
+          GRBVar rel_var = vars.at(Var::Y).at(tr, edge_id, v1_idx, v2_idx);
           if (!rel_var.sameAs(GRBVar()) &&
               rel_var.get(GRB_DoubleAttr_X) > 0.5) {
             return edge_obj.source == vertex_id ? v1 : v2;
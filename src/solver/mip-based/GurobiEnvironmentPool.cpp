@@ -0,0 +1,101 @@
+#include "solver/mip-based/GurobiEnvironmentPool.hpp"
+
+#include "CustomExceptions.hpp"
+#include "gurobi_c++.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <plog/Log.h>
+#include <utility>
+
+cda_rail::solver::mip_based::GurobiEnvironmentPool&
+cda_rail::solver::mip_based::GurobiEnvironmentPool::get() {
+  static GurobiEnvironmentPool pool;
+  return pool;
+}
+
+void cda_rail::solver::mip_based::GurobiEnvironmentPool::configure(
+    const GurobiEnvironmentSettings& settings) {
+  /**
+   * Sets the parameters of all environments of the pool. This is only
+   * possible before the first environment is acquired, since the parameters
+   * are meant to be fixed for the whole process.
+   *
+   * @param settings Thread count and further parameters of the environments
+   */
+
+  const std::lock_guard<std::mutex> lock(state->mutex);
+  if (state->settings_fixed) {
+    throw exceptions::InvalidInputException(
+        "Gurobi environments can only be configured before they are used.");
+  }
+  state->settings = settings;
+}
+
+std::shared_ptr<GRBEnv>
+cda_rail::solver::mip_based::GurobiEnvironmentPool::acquire() {
+  /**
+   * Returns an idle environment of the pool or starts a new one if all are
+   * in use. The environment is returned to the pool as soon as the last copy
+   * of the pointer is destroyed. Models created on it have to be destroyed
+   * before.
+   */
+
+  std::unique_ptr<GRBEnv>   env;
+  GurobiEnvironmentSettings settings;
+  {
+    const std::lock_guard<std::mutex> lock(state->mutex);
+    state->settings_fixed = true;
+    if (!state->idle_environments.empty()) {
+      env = std::move(state->idle_environments.back());
+      state->idle_environments.pop_back();
+    } else {
+      settings = state->settings;
+    }
+  }
+
+  if (env == nullptr) {
+    // Starting is slow, hence, other threads are not blocked meanwhile
+    PLOGD << "Start shared Gurobi environment";
+    env = std::make_unique<GRBEnv>(true);
+    if (settings.threads > 0) {
+      env->set(GRB_IntParam_Threads, settings.threads);
+    }
+    for (const auto& [param_name, value] : settings.parameters) {
+      env->set(param_name, value);
+    }
+    env->start();
+    const std::lock_guard<std::mutex> lock(state->mutex);
+    state->num_environments++;
+  }
+
+  return {env.release(), [pool_state = state](GRBEnv* released_env) {
+            const std::lock_guard<std::mutex> lock(pool_state->mutex);
+            pool_state->idle_environments.emplace_back(released_env);
+          }};
+}
+
+size_t cda_rail::solver::mip_based::GurobiEnvironmentPool::size() const {
+  // Number of environments started, both idle and in use
+  const std::lock_guard<std::mutex> lock(state->mutex);
+  return state->num_environments;
+}
+
+size_t cda_rail::solver::mip_based::GurobiEnvironmentPool::idle() const {
+  const std::lock_guard<std::mutex> lock(state->mutex);
+  return state->idle_environments.size();
+}
+
+void cda_rail::solver::mip_based::GurobiEnvironmentPool::clear() {
+  /**
+   * Frees all idle environments, e.g., to release license tokens.
+   * Environments in use are returned to the pool as usual.
+   */
+
+  std::vector<std::unique_ptr<GRBEnv>> idle_environments;
+  const std::lock_guard<std::mutex>    lock(state->mutex);
+  state->num_environments -= state->idle_environments.size();
+  idle_environments = std::move(state->idle_environments);
+  state->idle_environments.clear();
+}
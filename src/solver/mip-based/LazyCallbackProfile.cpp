@@ -0,0 +1,184 @@
+#include "solver/mip-based/LazyCallbackProfile.hpp"
+
+#include "CustomExceptions.hpp"
+#include "Definitions.hpp"
+#include "nlohmann/json.hpp"
+#include "solver/mip-based/LazyCutPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <plog/Log.h>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+constexpr std::array PHASE_NAMES{"callback",
+                                 "solution_query",
+                                 "routes",
+                                 "velocities",
+                                 "edge_orders",
+                                 "ttd_orders",
+                                 "vertex_headway",
+                                 "edge_and_ttd_headway",
+                                 "simplified_edge_headway",
+                                 "reverse_edge"};
+static_assert(PHASE_NAMES.size() ==
+              cda_rail::solver::mip_based::LazyCallbackProfile::NUM_PHASES);
+
+constexpr std::array CUT_TYPE_NAMES{
+    "vertex_headway",          "edge_headway",           "ttd_headway",
+    "simplified_edge_headway", "simplified_ttd_headway", "reverse_edge"};
+static_assert(CUT_TYPE_NAMES.size() ==
+              cda_rail::solver::mip_based::LazyCallbackProfile::NUM_CUT_TYPES);
+
+} // namespace
+
+void cda_rail::solver::mip_based::LazyCallbackProfile::record_phase(
+    LazyCallbackPhase phase, double seconds) {
+  auto& statistics = phases.at(static_cast<size_t>(phase));
+  statistics.calls++;
+  statistics.total_seconds += seconds;
+  statistics.max_seconds = std::max(statistics.max_seconds, seconds);
+}
+
+void cda_rail::solver::mip_based::LazyCallbackProfile::record_cuts(
+    const LazyCutSignature& signature, bool violated, bool pooled,
+    size_t num_cuts) {
+  /**
+   * Records a group of cuts that was passed to the solver.
+   *
+   * @param signature Canonical description of the cuts, the first two indices
+   * are the trains involved
+   * @param violated If true, the cuts are violated by the current incumbent
+   * @param pooled If true, the cuts were known to the lazy cut pool
+   * @param num_cuts Number of cuts that were actually submitted
+   */
+
+  auto& statistics = cut_types.at(static_cast<size_t>(signature.type));
+  statistics.checked++;
+  statistics.cuts += num_cuts;
+  if (pooled) {
+    statistics.duplicates++;
+  }
+  if (violated) {
+    statistics.violated++;
+    if (signature.indices.size() >= 2) {
+      train_pair_violations[{signature.indices.at(0),
+                             signature.indices.at(1)}]++;
+    }
+  }
+}
+
+size_t
+cda_rail::solver::mip_based::LazyCallbackProfile::get_train_pair_violations(
+    size_t tr1, size_t tr2) const {
+  /**
+   * Number of violated groups of cuts separated for train tr1 with respect to
+   * train tr2.
+   */
+
+  const auto it = train_pair_violations.find({tr1, tr2});
+  return it == train_pair_violations.end() ? 0 : it->second;
+}
+
+json cda_rail::solver::mip_based::LazyCallbackProfile::to_json(
+    const std::vector<std::string>& train_names) const {
+  /**
+   * Returns all statistics as json object.
+   *
+   * @param train_names Names of the trains used to label train pairs. If a
+   * train index is out of range, the index is used instead.
+   */
+
+  const auto train_name = [&train_names](size_t tr) {
+    return tr < train_names.size() ? train_names.at(tr) : std::to_string(tr);
+  };
+
+  json j;
+  for (size_t i = 0; i < NUM_PHASES; i++) {
+    const auto& statistics         = phases.at(i);
+    j["phases"][PHASE_NAMES.at(i)] = {
+        {"calls", statistics.calls},
+        {"total_seconds", statistics.total_seconds},
+        {"max_seconds", statistics.max_seconds}};
+  }
+  for (size_t i = 0; i < NUM_CUT_TYPES; i++) {
+    const auto& statistics          = cut_types.at(i);
+    j["cuts"][CUT_TYPE_NAMES.at(i)] = {{"checked", statistics.checked},
+                                       {"violated", statistics.violated},
+                                       {"duplicates", statistics.duplicates},
+                                       {"cuts", statistics.cuts}};
+  }
+  j["train_pairs"] = json::array();
+  for (const auto& [train_pair, violations] : train_pair_violations) {
+    j["train_pairs"].push_back({{"train", train_name(train_pair.first)},
+                                {"other_train", train_name(train_pair.second)},
+                                {"violations", violations}});
+  }
+  return j;
+}
+
+void cda_rail::solver::mip_based::LazyCallbackProfile::export_profile(
+    const std::filesystem::path&    p,
+    const std::vector<std::string>& train_names) const {
+  /**
+   * Exports all statistics to p / lazy_callback_profile.json
+   *
+   * @param p Folder the profile is written to, created if necessary
+   * @param train_names Names of the trains used to label train pairs
+   */
+
+  if (!is_directory_and_create(p)) {
+    throw exceptions::ExportException("Could not create directory " +
+                                      p.string());
+  }
+
+  std::ofstream file(p / "lazy_callback_profile.json");
+  file << to_json(train_names) << std::endl;
+  file.close();
+}
+
+void cda_rail::solver::mip_based::LazyCallbackProfile::log_summary() const {
+  for (size_t i = 0; i < NUM_PHASES; i++) {
+    const auto& statistics = phases.at(i);
+    if (statistics.calls == 0) {
+      continue;
+    }
+    PLOGI << "Lazy callback " << PHASE_NAMES.at(i) << ": " << statistics.calls
+          << " calls, " << statistics.total_seconds << " s total, "
+          << statistics.max_seconds << " s max";
+  }
+  for (size_t i = 0; i < NUM_CUT_TYPES; i++) {
+    const auto& statistics = cut_types.at(i);
+    if (statistics.checked == 0) {
+      continue;
+    }
+    PLOGI << "Lazy cuts " << CUT_TYPE_NAMES.at(i) << ": " << statistics.checked
+          << " checked, " << statistics.violated << " violated, "
+          << statistics.duplicates << " duplicates, " << statistics.cuts
+          << " cuts submitted";
+  }
+  if (!train_pair_violations.empty()) {
+    const auto most_violated = std::max_element(
+        train_pair_violations.begin(), train_pair_violations.end(),
+        [](const auto& pair1, const auto& pair2) {
+          return pair1.second < pair2.second;
+        });
+    PLOGI << "Violations found for " << train_pair_violations.size()
+          << " train pairs, most for trains " << most_violated->first.first
+          << " and " << most_violated->first.second << " ("
+          << most_violated->second << ")";
+  }
+}
+
+void cda_rail::solver::mip_based::LazyCallbackProfile::clear() {
+  phases    = {};
+  cut_types = {};
+  train_pair_violations.clear();
+}
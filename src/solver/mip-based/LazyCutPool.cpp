@@ -0,0 +1,171 @@
+#include "solver/mip-based/LazyCutPool.hpp"
+
+#include "gurobi_c++.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+size_t cda_rail::solver::mip_based::LazyCutSignatureHash::operator()(
+    const LazyCutSignature& signature) const noexcept {
+  size_t     seed    = 0;
+  const auto combine = [&seed](size_t h) {
+    seed ^= h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+  };
+  combine(std::hash<std::uint8_t>{}(static_cast<std::uint8_t>(signature.type)));
+  for (const auto& index : signature.indices) {
+    combine(std::hash<size_t>{}(index));
+  }
+  for (const auto& value : signature.values) {
+    combine(std::hash<double>{}(value));
+  }
+  return seed;
+}
+
+cda_rail::solver::mip_based::LazyCut::LazyCut(const GRBLinExpr& lhs,
+                                              char              sense,
+                                              const GRBLinExpr& rhs)
+    : expr(lhs - rhs), sense(sense), rhs(0) {
+  /**
+   * Creates the cut lhs sense rhs. All constants are moved to the right hand
+   * side.
+   */
+
+  const double constant = expr.getConstant();
+  expr -= constant;
+  this->rhs = -constant;
+}
+
+GRBTempConstr cda_rail::solver::mip_based::LazyCut::to_temp_constr() const {
+  if (sense == GRB_LESS_EQUAL) {
+    return expr <= rhs;
+  }
+  if (sense == GRB_GREATER_EQUAL) {
+    return expr >= rhs;
+  }
+  return expr == rhs;
+}
+
+cda_rail::solver::mip_based::LazyCutPool::Entry*
+cda_rail::solver::mip_based::LazyCutPool::find(
+    const LazyCutSignature& signature) {
+  /**
+   * Returns the entry of the given signature or nullptr if the respective cuts
+   * have not been recorded yet.
+   */
+
+  const auto it = entries.find(signature);
+  return it == entries.end() ? nullptr : &it->second;
+}
+
+cda_rail::solver::mip_based::LazyCutPool::Entry&
+cda_rail::solver::mip_based::LazyCutPool::insert(
+    const LazyCutSignature& signature, std::vector<LazyCut> cuts) {
+  /**
+   * Records cuts that have just been submitted for the first time.
+   */
+
+  auto& entry     = entries[signature];
+  entry.cuts      = std::move(cuts);
+  entry.hits      = 1;
+  entry.submitted = true;
+  entry.promoted  = false;
+  return entry;
+}
+
+void cda_rail::solver::mip_based::LazyCutPool::attach(GRBModel& model,
+                                                      bool      same_problem,
+                                                      bool      same_model) {
+  /**
+   * Binds the pool to a model. The recorded cuts can only be transferred if
+   * the model represents the same instance with the same model detail as the
+   * one the pool was filled on, since variable indices, big-M values and
+   * travel times depend on both. Otherwise, or if the pool was not detached
+   * from the previous model, the pool is cleared. If the cuts are transferred,
+   * their expressions are rebuilt using the variables of model.
+   * The model has to be updated before calling this function.
+   *
+   * @param model Model the cuts are going to be separated on
+   * @param same_problem If the model represents the same problem as the one
+   * the pool was filled on
+   * @param same_model If model is the very model the pool was filled on, so
+   * that previously promoted cuts are still part of it
+   */
+
+  const bool transferable = detached && same_problem;
+  detached                = false;
+  if (!transferable) {
+    entries.clear();
+    return;
+  }
+
+  const std::unique_ptr<GRBVar[]> model_vars(model.getVars());
+  std::vector<GRBVar>             cut_vars;
+  for (auto& [signature, entry] : entries) {
+    entry.submitted = false;
+    if (!same_model) {
+      entry.promoted = false;
+    }
+    for (auto& cut : entry.cuts) {
+      cut_vars.clear();
+      cut_vars.reserve(cut.var_indices.size());
+      for (const auto& index : cut.var_indices) {
+        cut_vars.push_back(model_vars[index]);
+      }
+      cut.expr = GRBLinExpr();
+      cut.expr.addTerms(cut.coeffs.data(), cut_vars.data(),
+                        static_cast<int>(cut_vars.size()));
+    }
+  }
+}
+
+void cda_rail::solver::mip_based::LazyCutPool::detach() {
+  /**
+   * Stores all cuts independently of the current model, i.e., variables are
+   * referenced by their index. Has to be called before the model is destroyed
+   * if the cuts should be reused on the next model.
+   */
+
+  for (auto& [signature, entry] : entries) {
+    for (auto& cut : entry.cuts) {
+      const auto size = cut.expr.size();
+      cut.var_indices.resize(size);
+      cut.coeffs.resize(size);
+      for (unsigned int i = 0; i < size; ++i) {
+        cut.var_indices[i] = cut.expr.getVar(static_cast<int>(i)).index();
+        cut.coeffs[i]      = cut.expr.getCoeff(static_cast<int>(i));
+      }
+      cut.expr = GRBLinExpr();
+    }
+  }
+  detached = true;
+}
+
+std::vector<const cda_rail::solver::mip_based::LazyCut*>
+cda_rail::solver::mip_based::LazyCutPool::promote(size_t min_hits) {
+  /**
+   * Marks all cuts that have been submitted at least min_hits times as static
+   * and returns them, so that they can be added to the model as normal
+   * constraints. Promoted cuts are not submitted lazily anymore.
+   *
+   * @param min_hits Minimal number of submissions, 0 disables promotion
+   */
+
+  std::vector<const LazyCut*> promoted_cuts;
+  if (min_hits == 0) {
+    return promoted_cuts;
+  }
+  for (auto& [signature, entry] : entries) {
+    if (entry.hits < min_hits || entry.promoted) {
+      continue;
+    }
+    entry.promoted  = true;
+    entry.submitted = true;
+    for (const auto& cut : entry.cuts) {
+      promoted_cuts.push_back(&cut);
+    }
+  }
+  return promoted_cuts;
+}
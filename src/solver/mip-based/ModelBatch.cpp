@@ -0,0 +1,136 @@
+#include "solver/mip-based/ModelBatch.hpp"
+
+#include "gurobi_c++.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+void cda_rail::solver::mip_based::VariableBatch::add(
+    GRBVar& target, double lb, double ub, double obj, char type,
+    std::string name) {
+  /**
+   * Adds a variable to the batch. The variable is created once the batch is
+   * submitted, at which point it is assigned to target.
+   *
+   * @param target Reference to which the created variable is assigned
+   * @param lb Lower bound
+   * @param ub Upper bound
+   * @param obj Objective coefficient
+   * @param type Variable type, e.g., GRB_BINARY
+   * @param name Name of the variable, possibly empty
+   */
+
+  lbs.push_back(lb);
+  ubs.push_back(ub);
+  objs.push_back(obj);
+  types.push_back(type);
+  names.push_back(std::move(name));
+  targets.push_back(&target);
+
+  if (targets.size() >= flush_size) {
+    submit();
+  }
+}
+
+void cda_rail::solver::mip_based::VariableBatch::submit() {
+  /**
+   * Adds all collected variables to the model and clears the buffers.
+   */
+
+  if (targets.empty()) {
+    return;
+  }
+
+  const std::unique_ptr<GRBVar[]> created(
+      model->addVars(lbs.data(), ubs.data(), objs.data(), types.data(),
+                     names.data(), static_cast<int>(targets.size())));
+  for (size_t i = 0; i < targets.size(); ++i) {
+    *targets[i] = created[i];
+  }
+
+  lbs.clear();
+  ubs.clear();
+  objs.clear();
+  types.clear();
+  names.clear();
+  targets.clear();
+}
+
+void cda_rail::solver::mip_based::ConstraintBatch::add_terms(
+    const GRBLinExpr& expr, double sign) {
+  /**
+   * Appends the terms of expr multiplied by sign to the current row.
+   */
+
+  const auto num_terms = expr.size();
+  for (unsigned int i = 0; i < num_terms; ++i) {
+    row_vars.push_back(expr.getVar(static_cast<int>(i)));
+    row_coeffs.push_back(sign * expr.getCoeff(static_cast<int>(i)));
+  }
+}
+
+void cda_rail::solver::mip_based::ConstraintBatch::add(const GRBLinExpr& lhs,
+                                                       char              sense,
+                                                       const GRBLinExpr& rhs,
+                                                       std::string       name) {
+  /**
+   * Adds the constraint lhs sense rhs to the batch. The terms of both sides
+   * are written to the row buffers directly, duplicate variables are merged
+   * by Gurobi.
+   *
+   * @param lhs Left hand side
+   * @param sense Constraint sense, i.e., GRB_LESS_EQUAL, GRB_EQUAL or
+   * GRB_GREATER_EQUAL
+   * @param rhs Right hand side
+   * @param name Name of the constraint, possibly empty
+   */
+
+  add_terms(lhs, 1);
+  add_terms(rhs, -1);
+  row_begins.push_back(row_vars.size());
+  senses.push_back(sense);
+  rhss.push_back(rhs.getConstant() - lhs.getConstant());
+  names.push_back(std::move(name));
+
+  if (senses.size() >= flush_size) {
+    submit();
+  }
+}
+
+void cda_rail::solver::mip_based::ConstraintBatch::submit() {
+  /**
+   * Adds all collected constraints to the model and clears the buffers. The
+   * expressions passed to Gurobi are built from the row buffers in chunks of
+   * SUBMIT_CHUNK_SIZE rows, so that at most one chunk of expressions exists
+   * at any time.
+   */
+
+  if (senses.empty()) {
+    return;
+  }
+
+  std::vector<GRBLinExpr> exprs;
+  exprs.reserve(std::min(senses.size(), SUBMIT_CHUNK_SIZE));
+  for (size_t first = 0; first < senses.size(); first += SUBMIT_CHUNK_SIZE) {
+    const auto last = std::min(first + SUBMIT_CHUNK_SIZE, senses.size());
+    exprs.clear();
+    for (size_t row = first; row < last; ++row) {
+      auto& expr = exprs.emplace_back();
+      expr.addTerms(row_coeffs.data() + row_begins[row],
+                    row_vars.data() + row_begins[row],
+                    static_cast<int>(row_begins[row + 1] - row_begins[row]));
+    }
+    const std::unique_ptr<GRBConstr[]> created(model->addConstrs(
+        exprs.data(), senses.data() + first, rhss.data() + first,
+        names.data() + first, static_cast<int>(last - first)));
+  }
+
+  row_begins.assign(1, 0);
+  row_vars.clear();
+  row_coeffs.clear();
+  senses.clear();
+  rhss.clear();
+  names.clear();
+}
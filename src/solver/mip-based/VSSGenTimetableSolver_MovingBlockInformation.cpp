@@ -16,6 +16,7 @@
 #include <plog/Log.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
 
@@ -41,6 +42,13 @@ cda_rail::instances::SolVSSGenerationTimetable cda_rail::solver::mip_based::
    * maximal positions
    * @param model_detail_mb_information.hint_approximate_positions: Whether to
    * hint approximate positions of trains at every given time
+   * @param model_detail_mb_information.use_as_warm_start: Whether to use the
+   * above information only to compute a start solution of the unrestricted
+   * model, so that optimality is preserved
+   * @param model_detail_mb_information.warm_start_time_share: Share of
+   * time_limit available for computing the start solution
+   * @param model_detail_mb_information.warm_start_max_time: Time limit in
+   * seconds for computing the start solution if time_limit is not positive
    *
    * @return The solution object
    */
@@ -50,6 +58,14 @@ cda_rail::instances::SolVSSGenerationTimetable cda_rail::solver::mip_based::
     throw cda_rail::exceptions::InvalidInputException(
         "Discrete model type is not supported.");
   }
+  if (model_detail_mb_information.use_as_warm_start &&
+      (model_detail_mb_information.warm_start_time_share <= 0 ||
+       model_detail_mb_information.warm_start_time_share > 1 ||
+       model_detail_mb_information.warm_start_max_time <= 0)) {
+    throw cda_rail::exceptions::InvalidInputException(
+        "Time share and maximal time of the warm start must be positive, "
+        "the share must not exceed 1.");
+  }
 
   auto old_instance =
       initialize_variables({model_detail_mb_information.delta_t, true,
@@ -58,7 +74,7 @@ cda_rail::instances::SolVSSGenerationTimetable cda_rail::solver::mip_based::
                            model_settings, solver_strategy, solution_settings,
                            time_limit, debug_input);
 
-  assert(!old_instance.has_value());
+  assert(old_instance.shares_with(instance));
 
   fix_orders_on_edges  = model_detail_mb_information.fix_order_on_edges;
   fix_stop_positions   = model_detail_mb_information.fix_stop_positions;
@@ -66,15 +82,30 @@ cda_rail::instances::SolVSSGenerationTimetable cda_rail::solver::mip_based::
   fix_exact_velocities = model_detail_mb_information.fix_exact_velocities;
   hint_approximate_positions =
       model_detail_mb_information.hint_approximate_positions;
+  use_as_warm_start = model_detail_mb_information.use_as_warm_start;
 
   create_variables();
-  set_objective();
+  telemetry.measure("set_objective", [this]() { set_objective(); });
   create_constraints();
-  include_additional_information();
+  if (use_as_warm_start) {
+    // The time used is subtracted from the time limit of the final solve
+    const double start_time_limit =
+        time_limit > 0
+            ? model_detail_mb_information.warm_start_time_share * time_limit
+            : static_cast<double>(
+                  model_detail_mb_information.warm_start_max_time);
+    telemetry.measure("set_moving_block_start", [this, start_time_limit]() {
+      set_moving_block_start(start_time_limit);
+    });
+  } else {
+    telemetry.measure("include_additional_information",
+                      [this]() { include_additional_information(); });
+  }
 
   set_timeout(time_limit);
 
-  const auto sol_object = optimize(old_instance, time_limit);
+  auto sol_object = optimize(old_instance, time_limit);
+  sol_object->set_telemetry(telemetry);
 
   export_lp_if_applicable(solution_settings);
   export_solution_if_applicable(sol_object, solution_settings);
@@ -107,10 +138,132 @@ void cda_rail::solver::mip_based::
   }
 }
 
+void cda_rail::solver::mip_based::
+    VSSGenTimetableSolverWithMovingBlockInformation::set_moving_block_start(
+        double time_limit) {
+  /**
+   * Computes a complete start solution from the moving block solution. For
+   * this, the model is temporarily restricted by the information selected and
+   * solved until a first feasible solution is found. Afterwards, the
+   * restricting constraints and variable hints are removed again. The
+   * solution is passed to Gurobi as MIP start only if it is feasible for the
+   * unrestricted model.
+   *
+   * @param time_limit Time limit in seconds for computing the start solution
+   */
+
+  model->update();
+  const int num_constrs = model->get(GRB_IntAttr_NumConstrs);
+
+  include_additional_information();
+  model->set(GRB_IntParam_SolutionLimit, 1);
+  model->set(GRB_DoubleParam_TimeLimit, time_limit);
+  model->optimize();
+  if (model->get(GRB_IntAttr_Status) == GRB_TIME_LIMIT) {
+    PLOGW << "Time limit of " << time_limit
+          << " seconds reached while computing the start solution";
+  }
+  model->set(GRB_IntParam_SolutionLimit, GRB_MAXINT);
+  // set_timeout only sets a new time limit if there is one
+  model->set(GRB_DoubleParam_TimeLimit, GRB_INFINITY);
+
+  const int                       num_vars = model->get(GRB_IntAttr_NumVars);
+  const std::unique_ptr<GRBVar[]> model_vars(model->getVars());
+  std::unique_ptr<double[]>       values;
+  if (model->get(GRB_IntAttr_SolCount) > 0) {
+    values.reset(model->get(GRB_DoubleAttr_X, model_vars.get(), num_vars));
+  }
+
+  // Remove the restriction, the solution found is kept as start only
+  const int                          num_constrs_restricted =
+      model->get(GRB_IntAttr_NumConstrs);
+  const std::unique_ptr<GRBConstr[]> constrs(model->getConstrs());
+  for (int i = num_constrs; i < num_constrs_restricted; ++i) {
+    model->remove(constrs[i]);
+  }
+  if (hint_approximate_positions) {
+    // The hints are part of the restriction, too
+    const std::vector<double> no_hints(num_vars, GRB_UNDEFINED);
+    model->set(GRB_DoubleAttr_VarHintVal, model_vars.get(), no_hints.data(),
+               num_vars);
+  }
+  model->reset(0);
+  model->update();
+
+  if (values == nullptr) {
+    PLOGW << "No start solution found using the moving block information";
+    return;
+  }
+  if (!is_feasible_start(values.get())) {
+    PLOGW << "Start solution is infeasible for the unrestricted model";
+    return;
+  }
+  PLOGD << "Setting start solution from the moving block information";
+  model->set(GRB_DoubleAttr_Start, model_vars.get(), values.get(), num_vars);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+bool cda_rail::solver::mip_based::
+    VSSGenTimetableSolverWithMovingBlockInformation::is_feasible_start(
+        const double* values) {
+  /**
+   * Checks the variable bounds, integrality and linear constraints of the
+   * current model for the given values. General and quadratic constraints
+   * are not restricted by the moving block information, hence, they are
+   * satisfied by any solution of the restricted model.
+   *
+   * @param values Values of all variables ordered by their index
+   *
+   * @return True if the values are feasible within a tolerance of GRB_EPS
+   */
+
+  const int                       num_vars = model->get(GRB_IntAttr_NumVars);
+  const std::unique_ptr<GRBVar[]> model_vars(model->getVars());
+  for (int i = 0; i < num_vars; ++i) {
+    const auto& var = model_vars[i];
+    if (values[i] < var.get(GRB_DoubleAttr_LB) - GRB_EPS ||
+        values[i] > var.get(GRB_DoubleAttr_UB) + GRB_EPS) {
+      PLOGD << "Start value of " << var.get(GRB_StringAttr_VarName)
+            << " violates its bounds";
+      return false;
+    }
+    if (var.get(GRB_CharAttr_VType) != GRB_CONTINUOUS &&
+        std::abs(values[i] - std::round(values[i])) > GRB_EPS) {
+      PLOGD << "Start value of " << var.get(GRB_StringAttr_VarName)
+            << " is not integral";
+      return false;
+    }
+  }
+
+  const int                          num_constrs =
+      model->get(GRB_IntAttr_NumConstrs);
+  const std::unique_ptr<GRBConstr[]> constrs(model->getConstrs());
+  for (int i = 0; i < num_constrs; ++i) {
+    const auto row = model->getRow(constrs[i]);
+    double     lhs = row.getConstant();
+    for (unsigned int j = 0; j < row.size(); ++j) {
+      lhs += row.getCoeff(j) * values[row.getVar(j).index()];
+    }
+    const auto rhs   = constrs[i].get(GRB_DoubleAttr_RHS);
+    const auto sense = constrs[i].get(GRB_CharAttr_Sense);
+    if ((sense != GRB_GREATER_EQUAL && lhs > rhs + GRB_EPS) ||
+        (sense != GRB_LESS_EQUAL && lhs < rhs - GRB_EPS)) {
+      PLOGD << "Start solution violates "
+            << constrs[i].get(GRB_StringAttr_ConstrName);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
 void cda_rail::solver::mip_based::
     VSSGenTimetableSolverWithMovingBlockInformation::
         fix_stop_positions_constraints() {
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_obj  = train_list.get_train(tr);
     const auto& tr_name = tr_obj.name;
@@ -123,25 +276,22 @@ void cda_rail::solver::mip_based::
       if (approx_info.has_value()) {
         const auto& [pos_approx, vel_approx] = approx_info.value();
         if (std::abs(vel_approx) < GRB_EPS &&
-            instance.is_forced_to_stop(tr_name, t)) {
+            instance->is_forced_to_stop(tr_name, t)) {
           // Train is stopping
+          model->addConstr(vars[Var::Lda](tr, t_steps) >=
+                               pos_approx - tr_len - STOP_TOLERANCE,
+              name("stop_pos_lb_lda_", tr_name, "_", t));
+          model->addConstr(vars[Var::Lda](tr, t_steps) <= pos_approx - tr_len,
+                           name("stop_pos_ub_lda_", tr_name, "_", t));
           model->addConstr(
-              vars["lda"](tr, t_steps) >= pos_approx - tr_len - STOP_TOLERANCE,
-              "stop_pos_lb_lda_" + tr_name + "_" + std::to_string(t));
-          model->addConstr(vars["lda"](tr, t_steps) <= pos_approx - tr_len,
-                           "stop_pos_ub_lda_" + tr_name + "_" +
-                               std::to_string(t));
-          model->addConstr(
-              vars["mu"](tr, t_steps - 1) >= pos_approx - STOP_TOLERANCE,
-              "stop_pos_lb_mu_" + tr_name + "_" + std::to_string(t));
-          model->addConstr(vars["mu"](tr, t_steps - 1) <= pos_approx,
-                           "stop_pos_ub_mu_" + tr_name + "_" +
-                               std::to_string(t));
-          model->addConstr(vars["v"](tr, t_steps) == 0,
-                           "stop_vel_" + tr_name + "_" + std::to_string(t));
-          model->addConstr(vars["brakelen"](tr, t_steps - 1) == 0,
-                           "stop_brakelen_" + tr_name + "_" +
-                               std::to_string(t));
+              vars[Var::Mu](tr, t_steps - 1) >= pos_approx - STOP_TOLERANCE,
+              name("stop_pos_lb_mu_", tr_name, "_", t));
+          model->addConstr(vars[Var::Mu](tr, t_steps - 1) <= pos_approx,
+                           name("stop_pos_ub_mu_", tr_name, "_", t));
+          model->addConstr(vars[Var::V](tr, t_steps) == 0,
+                           name("stop_vel_", tr_name, "_", t));
+          model->addConstr(vars[Var::Brakelen](tr, t_steps - 1) == 0,
+                           name("stop_brakelen_", tr_name, "_", t));
         }
       }
     }
@@ -151,7 +301,7 @@ void cda_rail::solver::mip_based::
 void cda_rail::solver::mip_based::
     VSSGenTimetableSolverWithMovingBlockInformation::
         fix_exact_positions_and_velocities_constraints() {
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; tr++) {
     const auto&  tr_obj  = train_list.get_train(tr);
     const auto&  tr_name = tr_obj.name;
@@ -168,42 +318,38 @@ void cda_rail::solver::mip_based::
 
       if (fix_exact_positions) {
         model->addConstr(
-            vars["lda"](tr, t_steps) >= pos_lb - tr_len - delta_pos,
-            "exact_pos_lb_lda_" + tr_name + "_" + std::to_string(t));
+            vars[Var::Lda](tr, t_steps) >= pos_lb - tr_len - delta_pos,
+            name("exact_pos_lb_lda_", tr_name, "_", t));
         model->addConstr(
-            vars["lda"](tr, t_steps) <= pos_ub - tr_len + delta_pos,
-            "exact_pos_ub_lda_" + tr_name + "_" + std::to_string(t));
+            vars[Var::Lda](tr, t_steps) <= pos_ub - tr_len + delta_pos,
+            name("exact_pos_ub_lda_", tr_name, "_", t));
 
-        GRBLinExpr pos_mu_expr = vars["mu"](tr, t_steps - 1);
+        GRBLinExpr pos_mu_expr = vars[Var::Mu](tr, t_steps - 1);
         if (include_braking_curves) {
-          pos_mu_expr -= vars["brakelen"](tr, t_steps - 1);
+          pos_mu_expr -= vars[Var::Brakelen](tr, t_steps - 1);
         }
         model->addConstr(pos_mu_expr >= pos_lb - delta_pos,
-                         "exact_pos_lb_mu_" + tr_name + "_" +
-                             std::to_string(t));
+                         name("exact_pos_lb_mu_", tr_name, "_", t));
         model->addConstr(pos_mu_expr <= pos_ub + delta_pos,
-                         "exact_pos_ub_mu_" + tr_name + "_" +
-                             std::to_string(t));
+                         name("exact_pos_ub_mu_", tr_name, "_", t));
       }
 
       if (fix_exact_velocities) {
         const auto rel_vel_lb = std::max(vel_lb - delta_v, 0.0);
         const auto rel_vel_ub = vel_ub + delta_v;
-        model->addConstr(vars["v"](tr, t_steps) >= rel_vel_lb,
-                         "exact_vel_lb_" + tr_name + "_" + std::to_string(t));
-        model->addConstr(vars["v"](tr, t_steps) <= rel_vel_ub,
-                         "exact_vel_ub_" + tr_name + "_" + std::to_string(t));
+        model->addConstr(vars[Var::V](tr, t_steps) >= rel_vel_lb,
+                         name("exact_vel_lb_", tr_name, "_", t));
+        model->addConstr(vars[Var::V](tr, t_steps) <= rel_vel_ub,
+                         name("exact_vel_ub_", tr_name, "_", t));
         if (include_braking_curves) {
           const auto bl_lb =
               rel_vel_lb * rel_vel_lb / (2 * tr_obj.deceleration);
           const auto bl_ub =
               rel_vel_ub * rel_vel_ub / (2 * tr_obj.deceleration);
-          model->addConstr(vars["brakelen"](tr, t_steps - 1) >= bl_lb,
-                           "exact_brakelen_lb_" + tr_name + "_" +
-                               std::to_string(t));
-          model->addConstr(vars["brakelen"](tr, t_steps - 1) <= bl_ub,
-                           "exact_brakelen_ub_" + tr_name + "_" +
-                               std::to_string(t));
+          model->addConstr(vars[Var::Brakelen](tr, t_steps - 1) >= bl_lb,
+                           name("exact_brakelen_lb_", tr_name, "_", t));
+          model->addConstr(vars[Var::Brakelen](tr, t_steps - 1) <= bl_ub,
+                           name("exact_brakelen_ub_", tr_name, "_", t));
         }
       }
     }
@@ -213,7 +359,7 @@ void cda_rail::solver::mip_based::
 void cda_rail::solver::mip_based::
     VSSGenTimetableSolverWithMovingBlockInformation::
         hint_approximate_positions_constraints() {
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_obj  = train_list.get_train(tr);
     const auto& tr_name = tr_obj.name;
@@ -228,17 +374,17 @@ void cda_rail::solver::mip_based::
         const double bl = include_braking_curves ? vel_approx * vel_approx /
                                                        (2 * tr_obj.deceleration)
                                                  : 0;
-        vars["v"](tr, t_steps).set(GRB_DoubleAttr_VarHintVal, vel_approx);
+        vars[Var::V](tr, t_steps).set(GRB_DoubleAttr_VarHintVal, vel_approx);
         if (t_steps >= train_interval[tr].first + 1) {
-          vars["mu"](tr, t_steps - 1)
+          vars[Var::Mu](tr, t_steps - 1)
               .set(GRB_DoubleAttr_VarHintVal, pos_approx + bl);
           if (include_braking_curves) {
-            vars["brakelen"](tr, t_steps - 1)
+            vars[Var::Brakelen](tr, t_steps - 1)
                 .set(GRB_DoubleAttr_VarHintVal, bl);
           }
         }
         if (t_steps <= train_interval[tr].second) {
-          vars["lda"](tr, t_steps)
+          vars[Var::Lda](tr, t_steps)
               .set(GRB_DoubleAttr_VarHintVal, pos_approx - tr_len);
         }
       }
@@ -252,17 +398,17 @@ void cda_rail::solver::mip_based::
   // For this b_front and b_rear are set equal where applicable
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e            = breakable_edges[i];
-    const auto  vss_number_e = instance.const_n().max_vss_on_edge(e);
-    const auto& edge         = instance.const_n().get_edge(e);
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
     const auto& edge_name =
-        "[" + instance.const_n().get_vertex(edge.source).name + "," +
-        instance.const_n().get_vertex(edge.target).name + "]";
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     const auto tr_order_on_e = moving_block_solution.get_train_order(e);
     for (size_t tr_i = 1; tr_i < tr_order_on_e.size(); tr_i++) {
       const auto& tr_object =
-          instance.get_train_list().get_train(tr_order_on_e.at(tr_i));
+          instance->get_train_list().get_train(tr_order_on_e.at(tr_i));
       const auto& tr_object_prev =
-          instance.get_train_list().get_train(tr_order_on_e.at(tr_i - 1));
+          instance->get_train_list().get_train(tr_order_on_e.at(tr_i - 1));
       if (!tr_object_prev.tim) {
         continue;
       }
@@ -274,11 +420,10 @@ void cda_rail::solver::mip_based::
              t <= train_interval[tr_order_on_e.at(tr_i - 1)].second;
              ++t) {
           model->addConstr(
-              vars["b_front"](tr_order_on_e.at(tr_i), t, i, vss) ==
-                  vars["b_rear"](tr_order_on_e.at(tr_i - 1), t, i, vss),
-              "fix_order_" + tr_object_prev.name + "_" + tr_object.name + "_" +
-                  std::to_string(t * dt) + "_" + edge_name + "_" +
-                  std::to_string(vss));
+              vars[Var::BFront](tr_order_on_e.at(tr_i), t, i, vss) ==
+                  vars[Var::BRear](tr_order_on_e.at(tr_i - 1), t, i, vss),
+              name("fix_order_", tr_object_prev.name, "_", tr_object.name, "_",
+                   t * dt, "_", edge_name, "_", vss));
         }
       }
     }
@@ -286,14 +431,14 @@ void cda_rail::solver::mip_based::
 
   // Additional fix order by constraints on x variables on every edge
   for (size_t e = 0; e < num_edges; ++e) {
-    const auto& edge_obj = instance.const_n().get_edge(e);
+    const auto& edge_obj = instance->const_n().get_edge(e);
     const auto& edge_name =
-        "[" + instance.const_n().get_vertex(edge_obj.source).name + "," +
-        instance.const_n().get_vertex(edge_obj.target).name + "]";
+        "[" + instance->const_n().get_vertex(edge_obj.source).name + "," +
+        instance->const_n().get_vertex(edge_obj.target).name + "]";
     const auto tr_order_on_e =
         moving_block_solution.get_train_order_with_reverse(e);
     const std::optional<size_t> rev_e =
-        instance.const_n().get_reverse_edge_index(e);
+        instance->const_n().get_reverse_edge_index(e);
     for (size_t tr_i = 1; tr_i < tr_order_on_e.size(); tr_i++) {
       // Fix order on edge e
       const auto& [tr_following, tr_following_direction] =
@@ -303,10 +448,10 @@ void cda_rail::solver::mip_based::
         continue;
       }
       const auto& tr_following_obj =
-          instance.get_train_list().get_train(tr_following);
+          instance->get_train_list().get_train(tr_following);
 
       const auto& [tr_prev, tr_prev_direction] = tr_order_on_e.at(tr_i - 1);
-      const auto& tr_prev_obj = instance.get_train_list().get_train(tr_prev);
+      const auto& tr_prev_obj = instance->get_train_list().get_train(tr_prev);
 
       const auto& tr_following_interval = train_interval[tr_following];
       const auto& tr_prev_interval      = train_interval[tr_prev];
@@ -319,7 +464,7 @@ void cda_rail::solver::mip_based::
       GRBLinExpr following_x_expr = 0;
       for (size_t t_idx = tr_following_interval.first;
            t_idx <= tr_following_interval.second; ++t_idx) {
-        following_x_expr += vars["x"](tr_following, t_idx, e);
+        following_x_expr += vars[Var::X](tr_following, t_idx, e);
       }
 
       for (size_t t_idx =
@@ -330,31 +475,29 @@ void cda_rail::solver::mip_based::
         const int t = t_idx * dt;
         if (t_idx >= tr_prev_interval.first &&
             t_idx <= tr_prev_interval.second) {
-          prev_x_expr += vars["x"](tr_prev, t_idx, prev_e);
+          prev_x_expr += vars[Var::X](tr_prev, t_idx, prev_e);
         }
         if (t_idx - 1 >= tr_following_interval.first &&
             t_idx - 1 <= tr_following_interval.second) {
-          following_x_expr -= vars["x"](tr_following, t_idx - 1, e);
+          following_x_expr -= vars[Var::X](tr_following, t_idx - 1, e);
         }
 
         // tr_following can only be on the edge after tr_prev
         if (t_idx >= tr_following_interval.first &&
             t_idx <= tr_following_interval.second) {
-          model->addConstr(vars["x"](tr_following, t_idx, e) <= prev_x_expr,
-                           "fix_order_type_1_" + tr_prev_obj.name + "_" +
-                               tr_following_obj.name + "_" + std::to_string(t) +
-                               "_" + edge_name);
+          model->addConstr(vars[Var::X](tr_following, t_idx, e) <= prev_x_expr,
+                           name("fix_order_type_1_", tr_prev_obj.name, "_",
+                                tr_following_obj.name, "_", t, "_", edge_name));
         }
 
         // tr_prev can only be on the edge if tr_following will still be on the
         // edge
         if (t_idx >= tr_prev_interval.first &&
             t_idx <= tr_prev_interval.second) {
-          model->addConstr(vars["x"](tr_prev, t_idx, prev_e) <=
+          model->addConstr(vars[Var::X](tr_prev, t_idx, prev_e) <=
                                following_x_expr,
-                           "fix_order_type_2_" + tr_prev_obj.name + "_" +
-                               tr_following_obj.name + "_" + std::to_string(t) +
-                               "_" + edge_name);
+                           name("fix_order_type_2_", tr_prev_obj.name, "_",
+                                tr_following_obj.name, "_", t, "_", edge_name));
         }
       }
     }
@@ -369,6 +512,7 @@ void cda_rail::solver::mip_based::
   fix_exact_positions        = true;
   fix_exact_velocities       = true;
   hint_approximate_positions = true;
+  use_as_warm_start          = false;
 }
 
 // NOLINTEND(performance-inefficient-string-concatenation)
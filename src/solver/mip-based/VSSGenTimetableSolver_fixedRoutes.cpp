@@ -1,6 +1,7 @@
 #include "CustomExceptions.hpp"
 #include "MultiArray.hpp"
 #include "gurobi_c++.h"
+#include "solver/mip-based/ModelBatch.hpp"
 #include "solver/mip-based/VSSGenTimetableSolver.hpp"
 
 #include <cmath>
@@ -13,15 +14,16 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Creates variables connected to the fixed route version of the problem
    */
 
-  vars["lda"]   = MultiArray<GRBVar>(num_tr, num_t);
-  vars["mu"]    = MultiArray<GRBVar>(num_tr, num_t);
-  vars["x_lda"] = MultiArray<GRBVar>(num_tr, num_t, num_edges);
-  vars["x_mu"]  = MultiArray<GRBVar>(num_tr, num_t, num_edges);
+  vars[Var::Lda]   = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::Mu]    = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::XLda] = MultiArray<GRBVar>(num_tr, num_t, num_edges);
+  vars[Var::XMu]  = MultiArray<GRBVar>(num_tr, num_t, num_edges);
 
-  const auto& train_list = instance.get_train_list();
+  VariableBatch batch(*model);
+  const auto&   train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto tr_name = train_list.get_train(tr).name;
-    const auto r_len   = instance.route_length(tr_name);
+    const auto r_len   = instance->route_length(tr_name);
     const auto tr_len  = train_list.get_train(tr_name).length;
     double     mu_ub   = r_len + tr_len;
     if (this->include_braking_curves) {
@@ -30,27 +32,24 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     for (size_t t_steps = train_interval[tr].first;
          t_steps <= train_interval[tr].second; ++t_steps) {
       auto t = t_steps * dt;
-      vars["mu"](tr, t_steps) =
-          model->addVar(0, mu_ub, 0, GRB_CONTINUOUS,
-                        "mu_" + tr_name + "_" + std::to_string(t));
-      vars["lda"](tr, t_steps) =
-          model->addVar(-tr_len, r_len, 0, GRB_CONTINUOUS,
-                        "lda_" + tr_name + "_" + std::to_string(t));
+      batch.add(vars[Var::Mu](tr, t_steps), 0, mu_ub, 0, GRB_CONTINUOUS,
+                name("mu_", tr_name, "_", t));
+      batch.add(vars[Var::Lda](tr, t_steps), -tr_len, r_len, 0, GRB_CONTINUOUS,
+                name("lda_", tr_name, "_", t));
       for (auto const edge_id :
-           instance.edges_used_by_train(tr_name, fix_routes)) {
-        const auto& edge = instance.n().get_edge(edge_id);
+           instance->edges_used_by_train(tr_name, fix_routes)) {
+        const auto& edge = instance->const_n().get_edge(edge_id);
         const auto& edge_name =
-            "[" + instance.n().get_vertex(edge.source).name + "," +
-            instance.n().get_vertex(edge.target).name + "]";
-        vars["x_lda"](tr, t_steps, edge_id) = model->addVar(
-            0, 1, 0, GRB_BINARY,
-            "x_lda_" + tr_name + "_" + std::to_string(t) + "_" + edge_name);
-        vars["x_mu"](tr, t_steps, edge_id) = model->addVar(
-            0, 1, 0, GRB_BINARY,
-            "x_mu_" + tr_name + "_" + std::to_string(t) + "_" + edge_name);
+            "[" + instance->const_n().get_vertex(edge.source).name + "," +
+            instance->const_n().get_vertex(edge.target).name + "]";
+        batch.add(vars[Var::XLda](tr, t_steps, edge_id), 0, 1, 0, GRB_BINARY,
+                  name("x_lda_", tr_name, "_", t, "_", edge_name));
+        batch.add(vars[Var::XMu](tr, t_steps, edge_id), 0, 1, 0, GRB_BINARY,
+                  name("x_mu_", tr_name, "_", t, "_", edge_name));
       }
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::
@@ -76,44 +75,44 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * fixed routes.
    */
 
-  auto train_list = instance.get_train_list();
+  auto train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     auto tr_name = train_list.get_train(tr).name;
-    auto tr_len  = instance.get_train_list().get_train(tr_name).length;
+    auto tr_len  = instance->get_train_list().get_train(tr_name).length;
     for (size_t t = train_interval[tr].first;
          t <= train_interval[tr].second - 1; ++t) {
       // full pos: mu - lda = len + (v(t) + v(t+1))/2 * dt + brakelen (if
       // applicable)
       GRBLinExpr rhs =
-          tr_len + (vars["v"](tr, t) + vars["v"](tr, t + 1)) * dt / 2;
+          tr_len + (vars[Var::V](tr, t) + vars[Var::V](tr, t + 1)) * dt / 2;
       if (this->include_braking_curves) {
-        rhs += vars["brakelen"](tr, t);
+        rhs += vars[Var::Brakelen](tr, t);
       }
-      model->addConstr(vars["mu"](tr, t) - vars["lda"](tr, t) == rhs,
-                       "full_pos_" + tr_name + "_" + std::to_string(t));
+      model->addConstr(vars[Var::Mu](tr, t) - vars[Var::Lda](tr, t) == rhs,
+                       name("full_pos_", tr_name, "_", t));
       // overlap: mu(t) - lda(t+1) = len + brakelen (if applicable)
       rhs = tr_len;
       if (this->include_braking_curves) {
-        rhs += vars["brakelen"](tr, t);
+        rhs += vars[Var::Brakelen](tr, t);
       }
-      model->addConstr(vars["mu"](tr, t) - vars["lda"](tr, t + 1) == rhs,
-                       "overlap_" + tr_name + "_" + std::to_string(t));
+      model->addConstr(vars[Var::Mu](tr, t) - vars[Var::Lda](tr, t + 1) == rhs,
+                       name("overlap_", tr_name, "_", t));
       // mu increasing: mu(t+1) >= mu(t)
-      model->addConstr(vars["mu"](tr, t + 1) >= vars["mu"](tr, t),
-                       "mu_increasing_" + tr_name + "_" + std::to_string(t));
+      model->addConstr(vars[Var::Mu](tr, t + 1) >= vars[Var::Mu](tr, t),
+                       name("mu_increasing_", tr_name, "_", t));
       // lda increasing: lda(t+1) >= lda(t)
-      model->addConstr(vars["lda"](tr, t + 1) >= vars["lda"](tr, t),
-                       "lda_increasing_" + tr_name + "_" + std::to_string(t));
+      model->addConstr(vars[Var::Lda](tr, t + 1) >= vars[Var::Lda](tr, t),
+                       name("lda_increasing_", tr_name, "_", t));
     }
     // full pos also holds for t = train_interval[i].second
     auto       t = train_interval[tr].second;
     GRBLinExpr rhs =
-        tr_len + (vars["v"](tr, t) + vars["v"](tr, t + 1)) * dt / 2;
+        tr_len + (vars[Var::V](tr, t) + vars[Var::V](tr, t + 1)) * dt / 2;
     if (this->include_braking_curves) {
-      rhs += vars["brakelen"](tr, t);
+      rhs += vars[Var::Brakelen](tr, t);
     }
-    model->addConstr(vars["mu"](tr, t) - vars["lda"](tr, t) == rhs,
-                     "full_pos_" + tr_name + "_" + std::to_string(t));
+    model->addConstr(vars[Var::Mu](tr, t) - vars[Var::Lda](tr, t) == rhs,
+                     name("full_pos_", tr_name, "_", t));
   }
 }
 
@@ -123,22 +122,22 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Create boundary conditions for the fixed routes of the trains
    */
 
-  auto train_list = instance.get_train_list();
+  auto train_list = instance->get_train_list();
   for (size_t i = 0; i < num_tr; ++i) {
     auto tr_name = train_list.get_train(i).name;
-    auto r_len   = instance.route_length(tr_name);
-    auto tr_len  = instance.get_train_list().get_train(tr_name).length;
+    auto r_len   = instance->route_length(tr_name);
+    auto tr_len  = instance->get_train_list().get_train(tr_name).length;
     // initial_lda: lda(train_interval[i].first) = - tr_len
-    model->addConstr(vars["lda"](i, train_interval[i].first) == -tr_len,
-                     "initial_lda_" + tr_name);
+    model->addConstr(vars[Var::Lda](i, train_interval[i].first) == -tr_len,
+                     name("initial_lda_", tr_name));
     // final_mu: mu(train_interval[i].second) = r_len + tr_len + brakelen (if
     // applicable)
     GRBLinExpr rhs = r_len + tr_len;
     if (this->include_braking_curves) {
-      rhs += vars["brakelen"](i, train_interval[i].second);
+      rhs += vars[Var::Brakelen](i, train_interval[i].second);
     }
-    model->addConstr(vars["mu"](i, train_interval[i].second) == rhs,
-                     "final_mu_" + tr_name);
+    model->addConstr(vars[Var::Mu](i, train_interval[i].second) == rhs,
+                     name("final_mu_", tr_name));
   }
 }
 
@@ -149,13 +148,13 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    */
 
   // Iterate over all trains
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < train_list.size(); ++tr) {
     const auto  tr_name  = train_list.get_train(tr).name;
-    const auto  r_len    = instance.route_length(tr_name);
-    const auto& tr_route = instance.get_route(tr_name);
+    const auto  r_len    = instance->route_length(tr_name);
+    const auto& tr_route = instance->get_route(tr_name);
     const auto  r_size   = tr_route.size();
-    const auto  tr_len   = instance.get_train_list().get_train(tr_name).length;
+    const auto  tr_len   = instance->get_train_list().get_train(tr_name).length;
 
     double mu_ub = r_len + tr_len;
     if (this->include_braking_curves) {
@@ -165,39 +164,34 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     // Iterate over all edges
     for (size_t j = 0; j < r_size; ++j) {
       const auto edge_id  = tr_route.get_edge(j);
-      const auto edge_pos = instance.route_edge_pos(tr_name, edge_id);
+      const auto edge_pos = instance->route_edge_pos(tr_name, edge_id);
       // Iterate over possible time steps
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
         // x_mu(tr, t, edge_id) = 1 if, and only if, mu(tr,t) > edge_pos.first
-        model->addConstr(mu_ub * vars["x_mu"](tr, t, edge_id) >=
-                             (vars["mu"](tr, t) - edge_pos.first),
-                         "x_mu_if_" + tr_name + "_" + std::to_string(t) + "_" +
-                             std::to_string(edge_id));
-        model->addConstr(r_len * vars["x_mu"](tr, t, edge_id) <=
-                             r_len + vars["mu"](tr, t) - edge_pos.first,
-                         "x_mu_only_if_" + tr_name + "_" + std::to_string(t) +
-                             "_" + std::to_string(edge_id));
+        model->addConstr(mu_ub * vars[Var::XMu](tr, t, edge_id) >=
+                             (vars[Var::Mu](tr, t) - edge_pos.first),
+                         name("x_mu_if_", tr_name, "_", t, "_", edge_id));
+        model->addConstr(r_len * vars[Var::XMu](tr, t, edge_id) <=
+                             r_len + vars[Var::Mu](tr, t) - edge_pos.first,
+                         name("x_mu_only_if_", tr_name, "_", t, "_", edge_id));
 
         // x_lda = 1 if, and only if, lda < edge_pos.second
-        model->addConstr((r_len + tr_len) * vars["x_lda"](tr, t, edge_id) >=
-                             edge_pos.second - vars["lda"](tr, t),
-                         "x_lda_if_" + tr_name + "_" + std::to_string(t) + "_" +
-                             std::to_string(edge_id));
-        model->addConstr(r_len * vars["x_lda"](tr, t, edge_id) <=
-                             r_len + edge_pos.second - vars["lda"](tr, t),
-                         "x_lda_only_if_" + tr_name + "_" + std::to_string(t) +
-                             "_" + std::to_string(edge_id));
+        model->addConstr((r_len + tr_len) * vars[Var::XLda](tr, t, edge_id) >=
+                             edge_pos.second - vars[Var::Lda](tr, t),
+                         name("x_lda_if_", tr_name, "_", t, "_", edge_id));
+        model->addConstr(r_len * vars[Var::XLda](tr, t, edge_id) <=
+                             r_len + edge_pos.second - vars[Var::Lda](tr, t),
+                         name("x_lda_only_if_", tr_name, "_", t, "_", edge_id));
 
         // x = x_lda AND x_mu
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
         GRBVar clause[2];
-        clause[0] = vars["x_lda"](tr, t, edge_id);
-        clause[1] = vars["x_mu"](tr, t, edge_id);
+        clause[0] = vars[Var::XLda](tr, t, edge_id);
+        clause[1] = vars[Var::XMu](tr, t, edge_id);
         // NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-        model->addGenConstrAnd(vars["x"](tr, t, edge_id), clause, 2,
-                               "x_" + tr_name + "_" + std::to_string(t) + "_" +
-                                   std::to_string(edge_id));
+        model->addGenConstrAnd(vars[Var::X](tr, t, edge_id), clause, 2,
+                               name("x_", tr_name, "_", t, "_", edge_id));
         // NOLINTEND(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
       }
     }
@@ -211,30 +205,30 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    */
 
   // Iterate over all trains
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < train_list.size(); ++tr) {
     const auto  tr_name     = train_list.get_train(tr).name;
-    const auto& tr_schedule = instance.get_schedule(tr_name);
+    const auto& tr_schedule = instance->get_schedule(tr_name);
     for (const auto& tr_stop : tr_schedule.get_stops()) {
       const auto  t0 = tr_stop.arrival() / dt;
       const auto  t1 = std::ceil(static_cast<double>(tr_stop.departure()) / dt);
-      const auto& stop_edges = instance.get_station_list()
+      const auto& stop_edges = instance->get_station_list()
                                    .get_station(tr_stop.get_station_name())
                                    .tracks;
-      const auto& stop_pos = instance.route_edge_pos(tr_name, stop_edges);
+      const auto& stop_pos = instance->route_edge_pos(tr_name, stop_edges);
       // Other cases follow by increasing of lambda and mu
-      model->addConstr(vars["mu"](tr, t0 - 1) >= stop_pos.first,
-                       "mu_station_min_" + tr_name + "_" +
-                           std::to_string(t0 - 1)); // entering station
-      model->addConstr(vars["mu"](tr, t1 - 1) <= stop_pos.second,
-                       "mu_station_max_" + tr_name + "_" +
-                           std::to_string(t1 - 1)); // last before leaving
-      model->addConstr(vars["lda"](tr, t0) >= stop_pos.first,
-                       "lda_station_min_" + tr_name + "_" +
-                           std::to_string(t0)); // first after entering
-      model->addConstr(vars["lda"](tr, t1) <= stop_pos.second,
-                       "lda_station_max_" + tr_name + "_" +
-                           std::to_string(t1)); // leaving station
+      model->addConstr(vars[Var::Mu](tr, t0 - 1) >= stop_pos.first,
+                       name("mu_station_min_", tr_name, "_",
+                            t0 - 1)); // entering station
+      model->addConstr(vars[Var::Mu](tr, t1 - 1) <= stop_pos.second,
+                       name("mu_station_max_", tr_name, "_",
+                            t1 - 1)); // last before leaving
+      model->addConstr(vars[Var::Lda](tr, t0) >= stop_pos.first,
+                       name("lda_station_min_", tr_name, "_",
+                            t0)); // first after entering
+      model->addConstr(vars[Var::Lda](tr, t1) <= stop_pos.second,
+                       name("lda_station_max_", tr_name, "_",
+                            t1)); // leaving station
     }
   }
 }
@@ -246,7 +240,7 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    */
 
   // Iterate over all trains
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < train_list.size(); ++tr) {
     const auto tr_name = train_list.get_train(tr).name;
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
@@ -264,14 +258,14 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         before_max = 0;
       } else {
         before_max =
-            instance.route_edge_pos(tr_name, before_after_struct.edges_before)
+            instance->route_edge_pos(tr_name, before_after_struct.edges_before)
                 .second;
       }
       if (before_after_struct.t_after >= train_interval[tr].second) {
-        after_min = instance.route_length(tr_name);
+        after_min = instance->route_length(tr_name);
       } else {
         after_min =
-            instance.route_edge_pos(tr_name, before_after_struct.edges_after)
+            instance->route_edge_pos(tr_name, before_after_struct.edges_after)
                 .first;
       }
 
@@ -281,9 +275,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
           tr, t_steps, before_after_struct.v_before,
           train_list.get_train(tr).acceleration, this->include_braking_curves);
       // mu <= before_max + dist_travelled
-      model->addConstr(vars["mu"](tr, t), GRB_LESS_EQUAL,
+      model->addConstr(vars[Var::Mu](tr, t), GRB_LESS_EQUAL,
                        before_max + dist_travelled,
-                       "mu_cut_" + tr_name + "_" + std::to_string(t));
+                       name("mu_cut_", tr_name, "_", t));
 
       // Constraint inferred from after position
       t_steps = before_after_struct.t_after - t;
@@ -291,9 +285,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
           max_distance_travelled(tr, t_steps, before_after_struct.v_after,
                                  train_list.get_train(tr).deceleration, false);
       // lda >= after_min - dist_travelled
-      model->addConstr(vars["lda"](tr, t), GRB_GREATER_EQUAL,
+      model->addConstr(vars[Var::Lda](tr, t), GRB_GREATER_EQUAL,
                        after_min - dist_travelled,
-                       "lda_cut_" + tr_name + "_" + std::to_string(t));
+                       name("lda_cut_", tr_name, "_", t));
     }
   }
 }
@@ -305,18 +299,18 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    */
 
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
-    const auto  r_len   = instance.route_length(tr_name);
-    const auto& tr_len  = instance.get_train_list().get_train(tr).length;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
+    const auto  r_len   = instance->route_length(tr_name);
+    const auto& tr_len  = instance->get_train_list().get_train(tr).length;
     double      mu_ub   = r_len + tr_len;
     if (this->include_braking_curves) {
       mu_ub += get_max_brakelen(tr);
     }
-    for (const auto e : instance.edges_used_by_train(tr, this->fix_routes)) {
+    for (const auto e : instance->edges_used_by_train(tr, this->fix_routes)) {
       const auto& e_index      = breakable_edge_indices[e];
-      const auto& e_len        = instance.n().get_edge(e).length;
-      const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-      const auto  edge_pos     = instance.route_edge_pos(tr_name, e);
+      const auto& e_len        = instance->const_n().get_edge(e).length;
+      const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+      const auto  edge_pos     = instance->route_edge_pos(tr_name, e);
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
@@ -326,20 +320,18 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
           // lda(tr, t) - edge_pos.first + (r_len + tr_len + e_len) * (1 -
           // b_rear(tr, t, e_index, vss)) >= b_pos(e_index, vss)
           const auto m1 = mu_ub;
-          model->addConstr(vars["mu"](tr, t) - edge_pos.first, GRB_LESS_EQUAL,
-                           vars["b_pos"](e_index, vss) +
-                               m1 * (1 - vars["b_front"](tr, t, e_index, vss)),
-                           "b_pos_front_" + std::to_string(tr) + "_" +
-                               std::to_string(t) + "_" + std::to_string(e) +
-                               "_" + std::to_string(vss));
-          if (instance.get_train_list().get_train(tr).tim) {
+          model->addConstr(
+              vars[Var::Mu](tr, t) - edge_pos.first, GRB_LESS_EQUAL,
+              vars[Var::BPos](e_index, vss) +
+                  m1 * (1 - vars[Var::BFront](tr, t, e_index, vss)),
+                           name("b_pos_front_", tr, "_", t, "_", e, "_", vss));
+          if (instance->get_train_list().get_train(tr).tim) {
             const auto m2 = r_len + tr_len + e_len;
-            model->addConstr(vars["lda"](tr, t) - edge_pos.first +
-                                 m2 * (1 - vars["b_rear"](tr, t, e_index, vss)),
-                             GRB_GREATER_EQUAL, vars["b_pos"](e_index, vss),
-                             "b_pos_rear_" + std::to_string(tr) + "_" +
-                                 std::to_string(t) + "_" + std::to_string(e) +
-                                 "_" + std::to_string(vss));
+            model->addConstr(vars[Var::Lda](tr, t) - edge_pos.first +
+                                 m2 * (1 - vars[Var::BRear](tr, t, e_index,
+                                                            vss)),
+                             GRB_GREATER_EQUAL, vars[Var::BPos](e_index, vss),
+                             name("b_pos_rear_", tr, "_", t, "_", e, "_", vss));
           }
         }
       }
@@ -372,10 +364,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       }
       for (size_t t = tr2_entry; t < train_interval[tr_list[i]].second; ++t) {
         // lda(tr1, t) >= 0
-        model->addConstr(vars["lda"](tr_list[i], t), GRB_GREATER_EQUAL, 0,
-                         "common_entry_" + std::to_string(tr_list[i]) + "_" +
-                             std::to_string(tr_list[i + 1]) + "_" +
-                             std::to_string(t));
+        model->addConstr(vars[Var::Lda](tr_list[i], t), GRB_GREATER_EQUAL, 0,
+                         name("common_entry_", tr_list[i], "_", tr_list[i + 1],
+                              "_", t));
       }
     }
   }
@@ -392,14 +383,13 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
             " and " + std::to_string(tr_list[i + 1]) + " at common exit");
       }
       const auto& tr1_name =
-          instance.get_train_list().get_train(tr_list[i]).name;
-      const auto& tr1_route_length = instance.route_length(tr1_name);
+          instance->get_train_list().get_train(tr_list[i]).name;
+      const auto& tr1_route_length = instance->route_length(tr1_name);
       for (size_t t = train_interval[tr_list[i]].first; t <= tr2_exit; ++t) {
         // mu(tr1, t) <= tr1_route_length
         model->addConstr(
-            vars["mu"](tr_list[i], t), GRB_LESS_EQUAL, tr1_route_length,
-            "common_exit_" + std::to_string(tr_list[i]) + "_" +
-                std::to_string(tr_list[i + 1]) + "_" + std::to_string(t));
+            vars[Var::Mu](tr_list[i], t), GRB_LESS_EQUAL, tr1_route_length,
+            name("common_exit_", tr_list[i], "_", tr_list[i + 1], "_", t));
       }
     }
   }
@@ -410,37 +400,35 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // For every breakable edge position exactly b_pos if tight
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e            = breakable_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
-      for (const auto tr : instance.trains_on_edge(e, this->fix_routes)) {
-        const auto& tr_name  = instance.get_train_list().get_train(tr).name;
-        const auto  edge_pos = instance.route_edge_pos(tr_name, e);
-        const auto  r_len    = instance.route_length(tr_name);
-        const auto& tr_len   = instance.get_train_list().get_train(tr).length;
+      for (const auto tr : instance->trains_on_edge(e, this->fix_routes)) {
+        const auto& tr_name  = instance->get_train_list().get_train(tr).name;
+        const auto  edge_pos = instance->route_edge_pos(tr_name, e);
+        const auto  r_len    = instance->route_length(tr_name);
+        const auto& tr_len   = instance->get_train_list().get_train(tr).length;
         double      mu_ub    = r_len + tr_len;
         if (this->include_braking_curves) {
           mu_ub += get_max_brakelen(tr);
         }
         for (size_t t = train_interval[tr].first + 2;
              t <= train_interval[tr].second; ++t) {
-          model->addConstr(vars["mu"](tr, t - 1) - edge_pos.first,
+          model->addConstr(vars[Var::Mu](tr, t - 1) - edge_pos.first,
                            GRB_GREATER_EQUAL,
-                           vars["b_pos"](i, vss) - STOP_TOLERANCE -
-                               r_len * (1 - vars["b_tight"](tr, t, i, vss)),
-                           "tight_vss_border_constraint_1_" + tr_name + "_" +
-                               std::to_string(t * dt) + "_" + edge_name + "_" +
-                               std::to_string(vss));
-          model->addConstr(vars["mu"](tr, t - 1) - edge_pos.first,
+                           vars[Var::BPos](i, vss) - STOP_TOLERANCE -
+                               r_len * (1 - vars[Var::BTight](tr, t, i, vss)),
+                           name("tight_vss_border_constraint_1_", tr_name, "_",
+                                t * dt, "_", edge_name, "_", vss));
+          model->addConstr(vars[Var::Mu](tr, t - 1) - edge_pos.first,
                            GRB_LESS_EQUAL,
-                           vars["b_pos"](i, vss) +
-                               mu_ub * (1 - vars["b_tight"](tr, t, i, vss)),
-                           "tight_vss_border_constraint_2_" + tr_name + "_" +
-                               std::to_string(t * dt) + "_" + edge_name + "_" +
-                               std::to_string(vss));
+                           vars[Var::BPos](i, vss) +
+                               mu_ub * (1 - vars[Var::BTight](tr, t, i, vss)),
+                           name("tight_vss_border_constraint_2_", tr_name, "_",
+                                t * dt, "_", edge_name, "_", vss));
         }
       }
     }
@@ -448,38 +436,38 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   // Analog for every edge ending
   for (size_t e = 0; e < num_edges; ++e) {
-    const auto& edge      = instance.n().get_edge(e);
-    const auto& edge_name = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
-    for (const auto tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto& tr_name  = instance.get_train_list().get_train(tr).name;
-      const auto  edge_pos = instance.route_edge_pos(tr_name, e);
-      const auto  r_len    = instance.route_length(tr_name);
+    const auto& edge      = instance->const_n().get_edge(e);
+    const auto& edge_name =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
+    for (const auto tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto& tr_name  = instance->get_train_list().get_train(tr).name;
+      const auto  edge_pos = instance->route_edge_pos(tr_name, e);
+      const auto  r_len    = instance->route_length(tr_name);
       for (size_t t = train_interval[tr].first + 2;
            t <= train_interval[tr].second; ++t) {
-        model->addConstr(vars["mu"](tr, t - 1), GRB_GREATER_EQUAL,
+        model->addConstr(vars[Var::Mu](tr, t - 1), GRB_GREATER_EQUAL,
                          edge_pos.second - STOP_TOLERANCE -
-                             r_len * (1 - vars["e_tight"](tr, t, e)),
-                         "tight_ttd_border_constraint_" + tr_name + "_" +
-                             std::to_string(t * dt) + "_" + edge_name);
+                             r_len * (1 - vars[Var::ETight](tr, t, e)),
+                         name("tight_ttd_border_constraint_", tr_name, "_",
+                              t * dt, "_", edge_name));
       }
     }
   }
 
   // Cannot stop after route end
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_object    = instance.get_train_list().get_train(tr);
+    const auto& tr_object    = instance->get_train_list().get_train(tr);
     const auto& tr_name      = tr_object.name;
-    const auto  r_len        = instance.route_length(tr_name);
+    const auto  r_len        = instance->route_length(tr_name);
     const auto& tr_len       = tr_object.length;
     const auto  max_brakelen = get_max_brakelen(tr);
     for (size_t t = train_interval[tr].first + 2;
          t <= train_interval[tr].second; ++t) {
-      model->addConstr(vars["mu"](tr, t - 1), GRB_LESS_EQUAL,
-                       r_len + (tr_len + max_brakelen) * vars["stopped"](tr, t),
-                       "len_out_tight_if_stopped_" + tr_name + "_" +
-                           std::to_string(t * dt));
+      model->addConstr(vars[Var::Mu](tr, t - 1), GRB_LESS_EQUAL,
+                       r_len + (tr_len + max_brakelen) *
+                                   vars[Var::Stopped](tr, t),
+                       name("len_out_tight_if_stopped_", tr_name, "_", t * dt));
     }
   }
 }
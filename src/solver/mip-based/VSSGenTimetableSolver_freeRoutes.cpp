@@ -1,6 +1,7 @@
 #include "CustomExceptions.hpp"
 #include "MultiArray.hpp"
 #include "gurobi_c++.h"
+#include "solver/mip-based/ModelBatch.hpp"
 #include "solver/mip-based/VSSGenTimetableSolver.hpp"
 
 #include <cmath>
@@ -11,21 +12,24 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     create_free_routes_variables() {
   /**
    * This method creates the variables needed if the routes are not fixed.
+   * Position variables are only created for edges and vertices the train can
+   * reach at the respective time, all others are implicitly 0.
    */
 
-  vars["overlap"] = MultiArray<GRBVar>(num_tr, num_t - 1, num_edges);
-  vars["x_v"]     = MultiArray<GRBVar>(num_tr, num_t, num_vertices);
-  vars["len_in"]  = MultiArray<GRBVar>(num_tr, num_t);
-  vars["x_in"]    = MultiArray<GRBVar>(num_tr, num_t);
-  vars["len_out"] = MultiArray<GRBVar>(num_tr, num_t);
-  vars["x_out"]   = MultiArray<GRBVar>(num_tr, num_t);
-  vars["e_lda"]   = MultiArray<GRBVar>(num_tr, num_t, num_edges);
-  vars["e_mu"]    = MultiArray<GRBVar>(num_tr, num_t, num_edges);
-
-  const auto& train_list = instance.get_train_list();
+  vars[Var::Overlap] = MultiArray<GRBVar>(num_tr, num_t - 1, num_edges);
+  vars[Var::XV]     = MultiArray<GRBVar>(num_tr, num_t, num_vertices);
+  vars[Var::LenIn]  = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::XIn]    = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::LenOut] = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::XOut]   = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::ELda]   = MultiArray<GRBVar>(num_tr, num_t, num_edges);
+  vars[Var::EMu]    = MultiArray<GRBVar>(num_tr, num_t, num_edges);
+
+  VariableBatch batch(*model);
+  const auto&   train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_name = train_list.get_train(tr).name;
-    const auto& tr_len  = instance.get_train_list().get_train(tr_name).length;
+    const auto& tr_len  = instance->get_train_list().get_train(tr_name).length;
     double      len_out_ub = tr_len;
     if (this->include_braking_curves) {
       len_out_ub += get_max_brakelen(tr);
@@ -33,44 +37,42 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
          ++t) {
       for (size_t e = 0; e < num_edges; ++e) {
-        const auto& edge = instance.n().get_edge(e);
+        if (!edge_reachable(tr, t, e)) {
+          continue;
+        }
+        const auto& edge = instance->const_n().get_edge(e);
         const auto& edge_name =
-            "[" + instance.n().get_vertex(edge.source).name + "," +
-            instance.n().get_vertex(edge.target).name + "]";
-        if (t < train_interval[tr].second) {
-          vars["overlap"](tr, t, e) = model->addVar(
-              0, instance.n().get_edge(e).length, 0, GRB_CONTINUOUS,
-              "overlap_" + tr_name + "_" + std::to_string(t * dt) + "_" +
-                  edge_name);
+            "[" + instance->const_n().get_vertex(edge.source).name + "," +
+            instance->const_n().get_vertex(edge.target).name + "]";
+        if (t < train_interval[tr].second && edge_reachable(tr, t + 1, e)) {
+          batch.add(vars[Var::Overlap](tr, t, e), 0, edge.length, 0,
+                    GRB_CONTINUOUS,
+                    name("overlap_", tr_name, "_", t * dt, "_", edge_name));
         }
-        vars["e_lda"](tr, t, e) =
-            model->addVar(0, instance.n().get_edge(e).length, 0, GRB_CONTINUOUS,
-                          "e_lda_" + tr_name + "_" + std::to_string(t * dt) +
-                              "_" + edge_name);
-        vars["e_mu"](tr, t, e) = model->addVar(
-            0, instance.n().get_edge(e).length, 0, GRB_CONTINUOUS,
-            "e_mu_" + tr_name + "_" + std::to_string(t * dt) + "_" + edge_name);
+        batch.add(vars[Var::ELda](tr, t, e), 0, edge.length, 0, GRB_CONTINUOUS,
+                  name("e_lda_", tr_name, "_", t * dt, "_", edge_name));
+        batch.add(vars[Var::EMu](tr, t, e), 0, edge.length, 0, GRB_CONTINUOUS,
+                  name("e_mu_", tr_name, "_", t * dt, "_", edge_name));
       }
       for (size_t v = 0; v < num_vertices; ++v) {
-        const auto& v_name    = instance.n().get_vertex(v).name;
-        vars["x_v"](tr, t, v) = model->addVar(
-            0, 1, 0, GRB_BINARY,
-            "x_v_" + tr_name + "_" + std::to_string(t * dt) + "_" + v_name);
+        if (!vertex_reachable(tr, t, v)) {
+          continue;
+        }
+        const auto& v_name = instance->const_n().get_vertex(v).name;
+        batch.add(vars[Var::XV](tr, t, v), 0, 1, 0, GRB_BINARY,
+                  name("x_v_", tr_name, "_", t * dt, "_", v_name));
       }
-      vars["len_in"](tr, t) =
-          model->addVar(0, tr_len, 0, GRB_CONTINUOUS,
-                        "len_in_" + tr_name + "_" + std::to_string(t * dt));
-      vars["x_in"](tr, t) =
-          model->addVar(0, 1, 0, GRB_BINARY,
-                        "x_in_" + tr_name + "_" + std::to_string(t * dt));
-      vars["len_out"](tr, t) =
-          model->addVar(0, len_out_ub, 0, GRB_CONTINUOUS,
-                        "len_out_" + tr_name + "_" + std::to_string(t * dt));
-      vars["x_out"](tr, t) =
-          model->addVar(0, 1, 0, GRB_BINARY,
-                        "x_out_" + tr_name + "_" + std::to_string(t * dt));
+      batch.add(vars[Var::LenIn](tr, t), 0, tr_len, 0, GRB_CONTINUOUS,
+                name("len_in_", tr_name, "_", t * dt));
+      batch.add(vars[Var::XIn](tr, t), 0, 1, 0, GRB_BINARY,
+                name("x_in_", tr_name, "_", t * dt));
+      batch.add(vars[Var::LenOut](tr, t), 0, len_out_ub, 0, GRB_CONTINUOUS,
+                name("len_out_", tr_name, "_", t * dt));
+      batch.add(vars[Var::XOut](tr, t), 0, 1, 0, GRB_BINARY,
+                name("x_out_", tr_name, "_", t * dt));
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::
@@ -94,127 +96,139 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Creates constraints connected to positioning of trains.
    */
 
-  auto train_list = instance.get_train_list();
+  auto train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_name = train_list.get_train(tr).name;
-    const auto& tr_len  = instance.get_train_list().get_train(tr_name).length;
-    const auto& entry   = instance.get_schedule(tr).get_entry();
-    const auto& exit    = instance.get_schedule(tr).get_exit();
+    const auto& tr_len  = instance->get_train_list().get_train(tr_name).length;
+    const auto& entry   = instance->get_schedule(tr).get_entry();
+    const auto& exit    = instance->get_schedule(tr).get_exit();
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
          ++t) {
       // Train position has the correct length
       // full pos: sum_e (e_mu - e_lda) + len_in + len_out = len + (v(t) +
       // v(t+1))/2 * dt + brakelen (if applicable)
-      GRBLinExpr lhs = vars["len_in"](tr, t) + vars["len_out"](tr, t);
+      GRBLinExpr lhs = vars[Var::LenIn](tr, t) + vars[Var::LenOut](tr, t);
       for (size_t e = 0; e < num_edges; ++e) {
-        lhs += vars["e_mu"](tr, t, e) - vars["e_lda"](tr, t, e);
+        if (edge_reachable(tr, t, e)) {
+          lhs += vars[Var::EMu](tr, t, e) - vars[Var::ELda](tr, t, e);
+        }
       }
       GRBLinExpr rhs =
-          tr_len + (vars["v"](tr, t) + vars["v"](tr, t + 1)) * dt / 2;
+          tr_len + (vars[Var::V](tr, t) + vars[Var::V](tr, t + 1)) * dt / 2;
       if (this->include_braking_curves) {
-        rhs += vars["brakelen"](tr, t);
+        rhs += vars[Var::Brakelen](tr, t);
       }
       model->addConstr(lhs, GRB_EQUAL, rhs,
-                       "train_pos_len_" + tr_name + "_" + std::to_string(t));
+                       name("train_pos_len_", tr_name, "_", t));
 
       // Train position is a simple connected path, i.e.,
       // x_v <= sum_(e in delta_v) x_e
       // x_v >= sum_(e in delta_in_v) x_e
       // x_v >= sum_(e in delta_out_v) x_e
       for (size_t v = 0; v < num_vertices; ++v) {
-        const auto out_edges = instance.n().out_edges(v);
-        const auto in_edges  = instance.n().in_edges(v);
-        lhs                  = vars["x_v"](tr, t, v);
+        if (!vertex_reachable(tr, t, v)) {
+          // All adjacent edges are unreachable as well
+          continue;
+        }
+        const auto out_edges = instance->const_n().out_edges(v);
+        const auto in_edges  = instance->const_n().in_edges(v);
+        lhs                  = vars[Var::XV](tr, t, v);
         GRBLinExpr rhs_in    = 0;
         GRBLinExpr rhs_out   = 0;
         for (const auto& e : out_edges) {
-          rhs_out += vars["x"](tr, t, e);
+          rhs_out += vars[Var::X](tr, t, e);
         }
         for (const auto& e : in_edges) {
-          rhs_in += vars["x"](tr, t, e);
+          rhs_in += vars[Var::X](tr, t, e);
         }
         if (v == exit) {
-          rhs_out += vars["x_out"](tr, t);
+          rhs_out += vars[Var::XOut](tr, t);
         }
         if (v == entry) {
-          rhs_in += vars["x_in"](tr, t);
+          rhs_in += vars[Var::XIn](tr, t);
         }
         model->addConstr(lhs, GRB_LESS_EQUAL, rhs_out + rhs_in,
-                         "train_pos_x_v_" + tr_name + "_" + std::to_string(t) +
-                             "_" + std::to_string(v));
+                         name("train_pos_x_v_", tr_name, "_", t, "_", v));
         model->addConstr(lhs, GRB_GREATER_EQUAL, rhs_out,
-                         "train_pos_x_v_out_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(v));
+                         name("train_pos_x_v_out_", tr_name, "_", t, "_", v));
         model->addConstr(lhs, GRB_GREATER_EQUAL, rhs_in,
-                         "train_pos_x_v_in_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(v));
+                         name("train_pos_x_v_in_", tr_name, "_", t, "_", v));
       }
       // and sum_e x_e = sum_v x_v - 1
       // add x_in and x_out on both lhs and rhs cancel out
       lhs = 0;
       rhs = -1;
       for (size_t e = 0; e < num_edges; ++e) {
-        lhs += vars["x"](tr, t, e);
+        lhs += vars[Var::X](tr, t, e);
       }
       for (size_t v = 0; v < num_vertices; ++v) {
-        rhs += vars["x_v"](tr, t, v);
+        if (vertex_reachable(tr, t, v)) {
+          rhs += vars[Var::XV](tr, t, v);
+        }
       }
       model->addConstr(lhs, GRB_EQUAL, rhs,
-                       "train_pos_simple_connected_path_" + tr_name + "_" +
-                           std::to_string(t));
+                       name("train_pos_simple_connected_path_", tr_name, "_",
+                            t));
 
       // Switches are obeyed, i.e., illegal movements prohibited
       // And train does not go backwards
       for (size_t e1 = 0; e1 < num_edges; ++e1) {
-        const auto& v         = instance.n().get_edge(e1).target;
-        const auto& out_edges = instance.n().out_edges(v);
-        const auto& e_len     = instance.n().get_edge(e1).length;
+        const auto& v         = instance->const_n().get_edge(e1).target;
+        const auto& out_edges = instance->const_n().out_edges(v);
+        const auto& e_len     = instance->const_n().get_edge(e1).length;
         for (const auto& e2 : out_edges) {
+          if (!edge_reachable(tr, t, e2)) {
+            // Both constraints are trivially satisfied
+            continue;
+          }
           if (t < train_interval[tr].second &&
-              instance.n().is_valid_successor(e1, e2)) {
+              instance->const_n().is_valid_successor(e1, e2)) {
+            if (!edge_reachable(tr, t + 1, e1)) {
+              continue;
+            }
             // Prohibit train going backwards
             // x_e1(t+1) <= x_e1(t) + (1-x_e2(t))
-            model->addConstr(vars["x"](tr, t + 1, e1), GRB_LESS_EQUAL,
-                             vars["x"](tr, t, e1) + (1 - vars["x"](tr, t, e2)),
-                             "train_pos_no_backwards_" + tr_name + "_" +
-                                 std::to_string(t) + "_" + std::to_string(e1) +
-                                 "_" + std::to_string(e2));
-          } else if (!instance.n().is_valid_successor(e1, e2)) {
+            model->addConstr(vars[Var::X](tr, t + 1, e1), GRB_LESS_EQUAL,
+                             vars[Var::X](tr, t, e1) +
+                                 (1 - vars[Var::X](tr, t, e2)),
+                             name("train_pos_no_backwards_", tr_name, "_", t,
+                                  "_", e1, "_", e2));
+          } else if (!instance->const_n().is_valid_successor(e1, e2) &&
+                     edge_reachable(tr, t, e1)) {
             // Prohibit illegal movement
             // x_e1 + x_e2 <= 1
             model->addConstr(
-                vars["x"](tr, t, e1) + vars["x"](tr, t, e2), GRB_LESS_EQUAL, 1,
-                "train_pos_switches_" + tr_name + "_" + std::to_string(t) +
-                    "_" + std::to_string(e1) + "_" + std::to_string(e2));
+                vars[Var::X](tr, t, e1) + vars[Var::X](tr, t, e2),
+                GRB_LESS_EQUAL, 1,
+                name("train_pos_switches_", tr_name, "_", t, "_", e1, "_", e2));
           }
         }
 
         // Only going forward on edge
-        if (t < train_interval[tr].second) {
+        if (t < train_interval[tr].second && edge_reachable(tr, t, e1) &&
+            edge_reachable(tr, t + 1, e1)) {
           // e_lda(t) <= e_lda(t+1) + e_len * (1 - x_e(t+1))
           // e_mu(t) <= e_mu(t+1) + e_len * (1 - x_e(t+1))
-          model->addConstr(vars["e_lda"](tr, t, e1), GRB_LESS_EQUAL,
-                           vars["e_lda"](tr, t + 1, e1) +
-                               e_len * (1 - vars["x"](tr, t + 1, e1)),
-                           "train_pos_e_lda_" + tr_name + "_" +
-                               std::to_string(t) + "_" + std::to_string(e1));
-          model->addConstr(vars["e_mu"](tr, t, e1), GRB_LESS_EQUAL,
-                           vars["e_mu"](tr, t + 1, e1) +
-                               e_len * (1 - vars["x"](tr, t + 1, e1)),
-                           "train_pos_e_mu_" + tr_name + "_" +
-                               std::to_string(t) + "_" + std::to_string(e1));
+          model->addConstr(vars[Var::ELda](tr, t, e1), GRB_LESS_EQUAL,
+                           vars[Var::ELda](tr, t + 1, e1) +
+                               e_len * (1 - vars[Var::X](tr, t + 1, e1)),
+                           name("train_pos_e_lda_", tr_name, "_", t, "_", e1));
+          model->addConstr(vars[Var::EMu](tr, t, e1), GRB_LESS_EQUAL,
+                           vars[Var::EMu](tr, t + 1, e1) +
+                               e_len * (1 - vars[Var::X](tr, t + 1, e1)),
+                           name("train_pos_e_mu_", tr_name, "_", t, "_", e1));
         }
       }
       if (t < train_interval[tr].second) {
         // Also for in and out position, i.e.,
         // len_in is decreasing, len_out is increasing
         model->addConstr(
-            vars["len_in"](tr, t + 1), GRB_LESS_EQUAL, vars["len_in"](tr, t),
-            "train_pos_len_in_" + tr_name + "_" + std::to_string(t));
-        model->addConstr(vars["len_out"](tr, t + 1), GRB_GREATER_EQUAL,
-                         vars["len_out"](tr, t),
-                         "train_pos_len_out_" + tr_name + "_" +
-                             std::to_string(t));
+            vars[Var::LenIn](tr, t + 1), GRB_LESS_EQUAL,
+            vars[Var::LenIn](tr, t),
+            name("train_pos_len_in_", tr_name, "_", t));
+        model->addConstr(vars[Var::LenOut](tr, t + 1), GRB_GREATER_EQUAL,
+                         vars[Var::LenOut](tr, t),
+                         name("train_pos_len_out_", tr_name, "_", t));
       }
     }
   }
@@ -227,98 +241,124 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * routes
    */
 
-  const auto train_list = instance.get_train_list();
+  // Overlap variables only exist if the edge is reachable at t and t+1
+  const auto has_overlap = [this](size_t tr, size_t t, size_t e) {
+    return edge_reachable(tr, t, e) && edge_reachable(tr, t + 1, e);
+  };
+
+  const auto train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_name = train_list.get_train(tr).name;
     const auto& tr_len  = train_list.get_train(tr_name).length;
-    const auto& entry   = instance.get_schedule(tr).get_entry();
-    const auto& exit    = instance.get_schedule(tr).get_exit();
+    const auto& entry   = instance->get_schedule(tr).get_entry();
+    const auto& exit    = instance->get_schedule(tr).get_exit();
     for (size_t t = train_interval[tr].first;
          t <= train_interval[tr].second - 1; ++t) {
       // Train cannot be solely on the exit edge
-      GRBLinExpr lhs = vars["x_in"](tr, t);
+      GRBLinExpr lhs = vars[Var::XIn](tr, t);
       for (size_t e = 0; e < num_edges; ++e) {
-        lhs += vars["x"](tr, t, e);
+        lhs += vars[Var::X](tr, t, e);
       }
       // lhs >= 1
       model->addConstr(lhs, GRB_GREATER_EQUAL, 1,
-                       "train_not_left_" + tr_name + "_" +
-                           std::to_string(t * dt));
+                       name("train_not_left_", tr_name, "_", t * dt));
 
       // Correct overlap length
-      lhs = vars["len_in"](tr, t + 1) + vars["len_out"](tr, t);
+      lhs = vars[Var::LenIn](tr, t + 1) + vars[Var::LenOut](tr, t);
       for (size_t e = 0; e < num_edges; ++e) {
-        lhs += vars["overlap"](tr, t, e);
+        if (has_overlap(tr, t, e)) {
+          lhs += vars[Var::Overlap](tr, t, e);
+        }
       }
       GRBLinExpr rhs = tr_len;
       if (this->include_braking_curves) {
-        rhs += vars["brakelen"](tr, t);
+        rhs += vars[Var::Brakelen](tr, t);
       }
       model->addConstr(lhs, GRB_EQUAL, rhs,
-                       "train_pos_overlap_len_" + tr_name + "_" +
-                           std::to_string(t));
+                       name("train_pos_overlap_len_", tr_name, "_", t));
 
       // Determine overlap value per edge
       for (size_t e = 0; e < num_edges; ++e) {
-        const auto& e_v0      = instance.n().get_edge(e).source;
-        const auto& e_v1      = instance.n().get_edge(e).target;
-        const auto& out_edges = instance.n().out_edges(e_v1);
-        const auto& e_len     = instance.n().get_edge(e).length;
+        const auto& e_v0      = instance->const_n().get_edge(e).source;
+        const auto& e_v1      = instance->const_n().get_edge(e).target;
+        const auto& out_edges = instance->const_n().out_edges(e_v1);
+        const auto& e_len     = instance->const_n().get_edge(e).length;
+
+        if (!has_overlap(tr, t, e)) {
+          if (!edge_reachable(tr, t, e) && edge_reachable(tr, t + 1, e)) {
+            // overlap = 0 <= e_mu(t) - e_lda(t+1) reduces to e_lda(t+1) = 0
+            model->addConstr(vars[Var::ELda](tr, t + 1, e), GRB_EQUAL, 0,
+                             name("train_pos_overlap_e_ub_", tr_name, "_", t,
+                                  "_", e));
+          }
+          if (e_v0 == entry && edge_reachable(tr, t, e)) {
+            // len_in <= tr_len * (1 - x_e)
+            model->addConstr(vars[Var::LenIn](tr, t), GRB_LESS_EQUAL,
+                             tr_len * (1 - vars[Var::X](tr, t, e)),
+                             name("train_pos_overlap_at_front_", tr_name, "_",
+                                  t, "_len_in", e));
+          }
+          // All other constraints are trivially satisfied
+          continue;
+        }
 
         // overlap >= e_mu(t) - e_lda(t+1) if e is occupied at t+1, i.e.,
         // overlap_e + e_len * (1 - x_e(t+1)) >= e_mu(t) - e_lda(t+1)
-        model->addConstr(vars["overlap"](tr, t, e) +
-                             e_len * (1 - vars["x"](tr, t + 1, e)),
+        model->addConstr(vars[Var::Overlap](tr, t, e) +
+                             e_len * (1 - vars[Var::X](tr, t + 1, e)),
                          GRB_GREATER_EQUAL,
-                         vars["e_mu"](tr, t, e) - vars["e_lda"](tr, t + 1, e),
-                         "train_pos_overlap_e_lb_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(e));
+                         vars[Var::EMu](tr, t, e) -
+                             vars[Var::ELda](tr, t + 1, e),
+                         name("train_pos_overlap_e_lb_", tr_name, "_", t, "_",
+                              e));
         // overlap <= e_mu(t) - e_lda(t+1)
-        model->addConstr(vars["overlap"](tr, t, e), GRB_LESS_EQUAL,
-                         vars["e_mu"](tr, t, e) - vars["e_lda"](tr, t + 1, e),
-                         "train_pos_overlap_e_ub_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(e));
+        model->addConstr(vars[Var::Overlap](tr, t, e), GRB_LESS_EQUAL,
+                         vars[Var::EMu](tr, t, e) -
+                             vars[Var::ELda](tr, t + 1, e),
+                         name("train_pos_overlap_e_ub_", tr_name, "_", t, "_",
+                              e));
 
         // overlap <= e_len * x_e(t)
         // overlap <= e_len * x_e(t+1)
-        model->addConstr(vars["overlap"](tr, t, e), GRB_LESS_EQUAL,
-                         e_len * vars["x"](tr, t, e),
-                         "train_pos_overlap_e_t_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(e));
-        model->addConstr(vars["overlap"](tr, t, e), GRB_LESS_EQUAL,
-                         e_len * vars["x"](tr, t + 1, e),
-                         "train_pos_overlap_e_tp1_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(e));
+        model->addConstr(vars[Var::Overlap](tr, t, e), GRB_LESS_EQUAL,
+                         e_len * vars[Var::X](tr, t, e),
+                         name("train_pos_overlap_e_t_", tr_name, "_", t, "_",
+                              e));
+        model->addConstr(vars[Var::Overlap](tr, t, e), GRB_LESS_EQUAL,
+                         e_len * vars[Var::X](tr, t + 1, e),
+                         name("train_pos_overlap_e_tp1_", tr_name, "_", t, "_",
+                              e));
 
         // Overlap is only at front
         for (const auto& e2 : out_edges) {
-          if (instance.n().is_valid_successor(e, e2)) {
+          if (instance->const_n().is_valid_successor(e, e2) &&
+              edge_reachable(tr, t, e2)) {
             // overlap_e <= e_len * overlap_e2 + e_len * (1 - x_e2)
-            model->addConstr(vars["overlap"](tr, t, e), GRB_LESS_EQUAL,
-                             e_len * vars["overlap"](tr, t, e2) +
-                                 e_len * (1 - vars["x"](tr, t, e2)),
-                             "train_pos_overlap_at_front_" + tr_name + "_" +
-                                 std::to_string(t) + "_" + std::to_string(e) +
-                                 "_" + std::to_string(e2));
+            GRBLinExpr rhs_front = e_len * (1 - vars[Var::X](tr, t, e2));
+            if (has_overlap(tr, t, e2)) {
+              rhs_front += e_len * vars[Var::Overlap](tr, t, e2);
+            }
+            model->addConstr(vars[Var::Overlap](tr, t, e), GRB_LESS_EQUAL,
+                             rhs_front,
+                             name("train_pos_overlap_at_front_", tr_name, "_",
+                                  t, "_", e, "_", e2));
           }
         }
         if (e_v0 == entry) {
           // len_in <= tr_len * overlap_e + tr_len * (1 - x_e)
-          model->addConstr(vars["len_in"](tr, t), GRB_LESS_EQUAL,
-                           tr_len * vars["overlap"](tr, t, e) +
-                               tr_len * (1 - vars["x"](tr, t, e)),
-                           "train_pos_overlap_at_front_" + tr_name + "_" +
-                               std::to_string(t) + "_len_in" +
-                               std::to_string(e));
+          model->addConstr(vars[Var::LenIn](tr, t), GRB_LESS_EQUAL,
+                           tr_len * vars[Var::Overlap](tr, t, e) +
+                               tr_len * (1 - vars[Var::X](tr, t, e)),
+                           name("train_pos_overlap_at_front_", tr_name, "_", t,
+                                "_len_in", e));
         }
         if (e_v1 == exit) {
           // overlap_e <= e_len * len_out + e_len * (1 - x_out)
-          model->addConstr(vars["overlap"](tr, t, e), GRB_LESS_EQUAL,
-                           e_len * vars["len_out"](tr, t) +
-                               e_len * (1 - vars["x_out"](tr, t)),
-                           "train_pos_overlap_at_front_" + tr_name + "_" +
-                               std::to_string(t) + "_len_out" +
-                               std::to_string(e));
+          model->addConstr(vars[Var::Overlap](tr, t, e), GRB_LESS_EQUAL,
+                           e_len * vars[Var::LenOut](tr, t) +
+                               e_len * (1 - vars[Var::XOut](tr, t)),
+                           name("train_pos_overlap_at_front_", tr_name, "_", t,
+                                "_len_out", e));
         }
       }
     }
@@ -331,24 +371,22 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Boundary conditions in case of no fixed routes
    */
 
-  const auto train_list = instance.get_train_list();
+  const auto train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_name = train_list.get_train(tr).name;
     const auto& tr_len  = train_list.get_train(tr_name).length;
     const auto& t0      = train_interval[tr].first;
     const auto& tn      = train_interval[tr].second;
     // len_in(t0) = tr_len
-    model->addConstr(vars["len_in"](tr, t0), GRB_EQUAL, tr_len,
-                     "train_boundary_len_in_" + tr_name + "_" +
-                         std::to_string(t0));
+    model->addConstr(vars[Var::LenIn](tr, t0), GRB_EQUAL, tr_len,
+                     name("train_boundary_len_in_", tr_name, "_", t0));
     // len_out(tn) = tr_len + brakelen(tn) (if applicable)
     GRBLinExpr rhs = tr_len;
     if (this->include_braking_curves) {
-      rhs += vars["brakelen"](tr, tn);
+      rhs += vars[Var::Brakelen](tr, tn);
     }
-    model->addConstr(vars["len_out"](tr, tn), GRB_EQUAL, rhs,
-                     "train_boundary_len_out_" + tr_name + "_" +
-                         std::to_string(tn));
+    model->addConstr(vars[Var::LenOut](tr, tn), GRB_EQUAL, rhs,
+                     name("train_boundary_len_out_", tr_name, "_", tn));
   }
 }
 
@@ -358,70 +396,73 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Connects trains position and occupation variables if routes are not fixed
    */
 
-  const auto train_list = instance.get_train_list();
+  const auto train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_name = train_list.get_train(tr).name;
-    const auto& entry   = instance.get_schedule(tr).get_entry();
-    const auto& exit    = instance.get_schedule(tr).get_exit();
+    const auto& entry   = instance->get_schedule(tr).get_entry();
+    const auto& exit    = instance->get_schedule(tr).get_exit();
     for (size_t e = 0; e < num_edges; ++e) {
-      const auto& e_v0      = instance.n().get_edge(e).source;
-      const auto& e_v1      = instance.n().get_edge(e).target;
-      const auto& in_edges  = instance.n().in_edges(e_v0);
-      const auto& out_edges = instance.n().out_edges(e_v1);
-      const auto& e_len     = instance.n().get_edge(e).length;
+      const auto& e_v0      = instance->const_n().get_edge(e).source;
+      const auto& e_v1      = instance->const_n().get_edge(e).target;
+      const auto& in_edges  = instance->const_n().in_edges(e_v0);
+      const auto& out_edges = instance->const_n().out_edges(e_v1);
+      const auto& e_len     = instance->const_n().get_edge(e).length;
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
+        if (!edge_reachable(tr, t, e)) {
+          // Implied by the position constraints of the adjacent vertices
+          continue;
+        }
         // e_lda <= e_mu
-        model->addConstr(vars["e_lda"](tr, t, e), GRB_LESS_EQUAL,
-                         vars["e_mu"](tr, t, e),
-                         "train_occupation_free_routes_mu_lda_" + tr_name +
-                             "_" + std::to_string(t) + "_" + std::to_string(e));
+        model->addConstr(vars[Var::ELda](tr, t, e), GRB_LESS_EQUAL,
+                         vars[Var::EMu](tr, t, e),
+                         name("train_occupation_free_routes_mu_lda_", tr_name,
+                              "_", t, "_", e));
         // e_mu <= e_len * x
-        model->addConstr(vars["e_mu"](tr, t, e), GRB_LESS_EQUAL,
-                         e_len * vars["x"](tr, t, e),
-                         "train_occupation_free_routes_mu_x_" + tr_name + "_" +
-                             std::to_string(t) + "_" + std::to_string(e));
+        model->addConstr(vars[Var::EMu](tr, t, e), GRB_LESS_EQUAL,
+                         e_len * vars[Var::X](tr, t, e),
+                         name("train_occupation_free_routes_mu_x_", tr_name,
+                              "_", t, "_", e));
 
         // e_mu = e_len if not last edge, i.e.,
         // e_mu + e_len*(1-x) >= e_len * sum_outedges x
         GRBLinExpr rhs = 0;
         for (const auto& e2 : out_edges) {
-          rhs += vars["x"](tr, t, e2);
+          rhs += vars[Var::X](tr, t, e2);
         }
         if (e_v1 == exit) {
           // exit is an out-edge of the last edge
-          rhs += vars["x_out"](tr, t);
+          rhs += vars[Var::XOut](tr, t);
         }
         rhs *= e_len;
         model->addConstr(
-            vars["e_mu"](tr, t, e) + e_len * (1 - vars["x"](tr, t, e)),
+            vars[Var::EMu](tr, t, e) + e_len * (1 - vars[Var::X](tr, t, e)),
             GRB_GREATER_EQUAL, rhs,
-            "train_occupation_free_routes_mu_1_if_not_last_edge_" + tr_name +
-                "_" + std::to_string(t) + "_" + std::to_string(e));
+            name("train_occupation_free_routes_mu_1_if_not_last_edge_", tr_name,
+                 "_", t, "_", e));
 
         // e_lda = 0 if not first edge, i.e.,
         // e_lda <= e_len * (1 - sum_inedges x) + e_len * (1-x)
-        rhs = 2 - vars["x"](tr, t, e);
+        rhs = 2 - vars[Var::X](tr, t, e);
         for (const auto& e2 : in_edges) {
-          rhs -= vars["x"](tr, t, e2);
+          rhs -= vars[Var::X](tr, t, e2);
         }
         if (e_v0 == entry) {
           // entry is an in-edge of the first edge
-          rhs -= vars["x_in"](tr, t);
+          rhs -= vars[Var::XIn](tr, t);
         }
         rhs *= e_len;
         model->addConstr(
-            vars["e_lda"](tr, t, e), GRB_LESS_EQUAL, rhs,
-            "train_occupation_free_routes_lda_0_if_not_first_edge_" + tr_name +
-                "_" + std::to_string(t) + "_" + std::to_string(e));
+            vars[Var::ELda](tr, t, e), GRB_LESS_EQUAL, rhs,
+            name("train_occupation_free_routes_lda_0_if_not_first_edge_",
+                 tr_name, "_", t, "_", e));
 
         // x = 0 if mu=lda, i.e.,
         // x <= e_mu - e_lda
-        model->addConstr(vars["x"](tr, t, e), GRB_LESS_EQUAL,
-                         vars["e_mu"](tr, t, e) - vars["e_lda"](tr, t, e),
-                         "train_occupation_free_routes_x_0_if_mu_lda_" +
-                             tr_name + "_" + std::to_string(t) + "_" +
-                             std::to_string(e));
+        model->addConstr(vars[Var::X](tr, t, e), GRB_LESS_EQUAL,
+                         vars[Var::EMu](tr, t, e) - vars[Var::ELda](tr, t, e),
+                         name("train_occupation_free_routes_x_0_if_mu_lda_",
+                              tr_name, "_", t, "_", e));
       }
     }
 
@@ -435,25 +476,25 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
          ++t) {
       // x_in = 1 if, and only if, len_in > 0, i.e.,
       // x_in <= len_in, tr_len * x_in >= len_in
-      model->addConstr(vars["x_in"](tr, t), GRB_LESS_EQUAL,
-                       vars["len_in"](tr, t),
-                       "train_occupation_free_routes_x_in_1_only_if_" +
-                           tr_name + "_" + std::to_string(t));
-      model->addConstr(tr_len * vars["x_in"](tr, t), GRB_GREATER_EQUAL,
-                       vars["len_in"](tr, t),
-                       "train_occupation_free_routes_x_in_1_if_" + tr_name +
-                           "_" + std::to_string(t));
+      model->addConstr(vars[Var::XIn](tr, t), GRB_LESS_EQUAL,
+                       vars[Var::LenIn](tr, t),
+                       name("train_occupation_free_routes_x_in_1_only_if_",
+                            tr_name, "_", t));
+      model->addConstr(tr_len * vars[Var::XIn](tr, t), GRB_GREATER_EQUAL,
+                       vars[Var::LenIn](tr, t),
+                       name("train_occupation_free_routes_x_in_1_if_", tr_name,
+                            "_", t));
 
       // x_out = 1 if, and only if, len_out > 0, i.e.,
       // x_out <= len_out, len_out_ub * x_out >= len_out
-      model->addConstr(vars["x_out"](tr, t), GRB_LESS_EQUAL,
-                       vars["len_out"](tr, t),
-                       "train_occupation_free_routes_x_out_1_only_if_" +
-                           tr_name + "_" + std::to_string(t));
-      model->addConstr(len_out_ub * vars["x_out"](tr, t), GRB_GREATER_EQUAL,
-                       vars["len_out"](tr, t),
-                       "train_occupation_free_routes_x_out_1_if_" + tr_name +
-                           "_" + std::to_string(t));
+      model->addConstr(vars[Var::XOut](tr, t), GRB_LESS_EQUAL,
+                       vars[Var::LenOut](tr, t),
+                       name("train_occupation_free_routes_x_out_1_only_if_",
+                            tr_name, "_", t));
+      model->addConstr(len_out_ub * vars[Var::XOut](tr, t), GRB_GREATER_EQUAL,
+                       vars[Var::LenOut](tr, t),
+                       name("train_occupation_free_routes_x_out_1_if_", tr_name,
+                            "_", t));
     }
   }
 }
@@ -464,9 +505,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Impossible positions cut off due to schedule.
    */
 
-  const auto apsp = instance.n().all_edge_pairs_shortest_paths();
+  const auto apsp = instance->const_n().all_edge_pairs_shortest_paths_matrix();
 
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < train_list.size(); ++tr) {
     const auto tr_name = train_list.get_train(tr).name;
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
@@ -487,23 +528,27 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
           max_distance_travelled(tr, t_steps_after, before_after_struct.v_after,
                                  train_list.get_train(tr).deceleration, false);
 
-      // Iterate over all edges
+      // Iterate over all reachable edges
       for (size_t e = 0; e < num_edges; ++e) {
-        const auto& e_len = instance.n().get_edge(e).length;
+        if (!edge_reachable(tr, t, e)) {
+          continue;
+        }
+        const auto& e_len = instance->const_n().get_edge(e).length;
 
         double dist_before = NAN;
         double dist_after  = NAN;
 
         // Constraint inferred from before position
         if (before_after_struct.t_before <= train_interval[tr].first) {
-          const auto e_before =
-              instance.n().out_edges(instance.get_schedule(tr).get_entry())[0];
-          const auto& e_len_before = instance.n().get_edge(e_before).length;
-          dist_before              = apsp[e_before][e] + e_len_before - e_len;
+          const auto e_before = instance->const_n().out_edges(
+              instance->get_schedule(tr).get_entry())[0];
+          const auto& e_len_before =
+              instance->const_n().get_edge(e_before).length;
+          dist_before = apsp(e_before, e) + e_len_before - e_len;
         } else {
           dist_before = INF;
           for (const auto& e_tmp : before_after_struct.edges_before) {
-            const auto tmp_val = apsp[e_tmp][e] - e_len;
+            const auto tmp_val = apsp(e_tmp, e) - e_len;
             if (tmp_val < dist_before) {
               dist_before = tmp_val;
             }
@@ -513,30 +558,30 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         if (dist_travelled_before < dist_before) {
           // Edge cannot be reached, i.e. x = 0
           model->addConstr(
-              vars["x"](tr, t, e), GRB_EQUAL, 0,
-              "train_occupation_free_routes_impossibility_before_var1_" +
-                  tr_name + "_" + std::to_string(t) + "_" + std::to_string(e));
+              vars[Var::X](tr, t, e), GRB_EQUAL, 0,
+              name("train_occupation_free_routes_impossibility_before_var1_",
+                   tr_name, "_", t, "_", e));
         } else if (dist_travelled_before < dist_before + e_len) {
           // Edge can be reached, but not fully, i.e.
           // e_mu <= dist_travelled_before - dist_before
           model->addConstr(
-              vars["e_mu"](tr, t, e), GRB_LESS_EQUAL,
+              vars[Var::EMu](tr, t, e), GRB_LESS_EQUAL,
               dist_travelled_before - dist_before,
-              "train_occupation_free_routes_impossibility_before_var2_" +
-                  tr_name + "_" + std::to_string(t) + "_" + std::to_string(e));
+              name("train_occupation_free_routes_impossibility_before_var2_",
+                   tr_name, "_", t, "_", e));
         }
         // Otherwise no constraint can be inferred
 
         // Constraint inferred from after position
         if (before_after_struct.t_after >= train_interval[tr].second) {
-          const auto e_after =
-              instance.n().in_edges(instance.get_schedule(tr).get_exit())[0];
-          dist_after = apsp[e][e_after];
+          const auto e_after = instance->const_n().in_edges(
+              instance->get_schedule(tr).get_exit())[0];
+          dist_after = apsp(e, e_after);
         } else {
           dist_after = INF;
           for (const auto& e_tmp : before_after_struct.edges_after) {
             const auto tmp_val =
-                apsp[e][e_tmp] - instance.n().get_edge(e_tmp).length;
+                apsp(e, e_tmp) - instance->const_n().get_edge(e_tmp).length;
             if (tmp_val < dist_after) {
               dist_after = tmp_val;
             }
@@ -546,18 +591,18 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         if (dist_travelled_after < dist_after) {
           // Destination is unreachable from edge, hence not possible and x = 0
           model->addConstr(
-              vars["x"](tr, t, e), GRB_EQUAL, 0,
-              "train_occupation_free_routes_impossibility_after_var1_" +
-                  tr_name + "_" + std::to_string(t) + "_" + std::to_string(e));
+              vars[Var::X](tr, t, e), GRB_EQUAL, 0,
+              name("train_occupation_free_routes_impossibility_after_var1_",
+                   tr_name, "_", t, "_", e));
         } else if (dist_travelled_after < dist_after + e_len) {
           // Destination is reachable, but not from full edge, i.e.,
           // e_lda >= (e_len - (dist_travelled_after - dist_after))*x
           model->addConstr(
-              vars["e_lda"](tr, t, e), GRB_GREATER_EQUAL,
+              vars[Var::ELda](tr, t, e), GRB_GREATER_EQUAL,
               (e_len - (dist_travelled_after - dist_after)) *
-                  vars["x"](tr, t, e),
-              "train_occupation_free_routes_impossibility_after_var2_" +
-                  tr_name + "_" + std::to_string(t) + "_" + std::to_string(e));
+                  vars[Var::X](tr, t, e),
+              name("train_occupation_free_routes_impossibility_after_var2_",
+                   tr_name, "_", t, "_", e));
         }
       }
     }
@@ -570,35 +615,37 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * VSS constraints for free routes
    */
 
-  const auto train_list = instance.get_train_list();
+  const auto train_list = instance->get_train_list();
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_name = train_list.get_train(tr).name;
     for (size_t e_index = 0; e_index < breakable_edges.size(); ++e_index) {
       const auto& e            = breakable_edges[e_index];
-      const auto& e_len        = instance.n().get_edge(e).length;
-      const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+      const auto& e_len        = instance->const_n().get_edge(e).length;
+      const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
+        if (!edge_reachable(tr, t, e)) {
+          // b_front and b_rear are 0 if x is
+          continue;
+        }
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
           // e_mu(e) <= b_pos(e_index) + M1 * (1 - b_front(e_index))
           const auto m1 = e_len;
           model->addConstr(
-              vars["e_mu"](tr, t, e), GRB_LESS_EQUAL,
-              vars["b_pos"](e_index, vss) +
-                  m1 * (1 - vars["b_front"](tr, t, e_index, vss)),
-              "train_occupation_free_routes_vss_lda_b_pos_b_front_" + tr_name +
-                  "_" + std::to_string(t) + "_" + std::to_string(e) + "_" +
-                  std::to_string(vss));
+              vars[Var::EMu](tr, t, e), GRB_LESS_EQUAL,
+              vars[Var::BPos](e_index, vss) +
+                  m1 * (1 - vars[Var::BFront](tr, t, e_index, vss)),
+              name("train_occupation_free_routes_vss_lda_b_pos_b_front_",
+                   tr_name, "_", t, "_", e, "_", vss));
           // b_pos(e_index) <= e_lda(e) + M2 * (1 - b_rear(e_index))
-          if (instance.get_train_list().get_train(tr).tim) {
+          if (instance->get_train_list().get_train(tr).tim) {
             const auto m2 = e_len;
             model->addConstr(
-                vars["b_pos"](e_index, vss), GRB_LESS_EQUAL,
-                vars["e_lda"](tr, t, e) +
-                    m2 * (1 - vars["b_rear"](tr, t, e_index, vss)),
-                "train_occupation_free_routes_vss_b_pos_mu_b_rear_" + tr_name +
-                    "_" + std::to_string(t) + "_" + std::to_string(e) + "_" +
-                    std::to_string(vss));
+                vars[Var::BPos](e_index, vss), GRB_LESS_EQUAL,
+                vars[Var::ELda](tr, t, e) +
+                    m2 * (1 - vars[Var::BRear](tr, t, e_index, vss)),
+                name("train_occupation_free_routes_vss_b_pos_mu_b_rear_",
+                     tr_name, "_", t, "_", e, "_", vss));
           }
         }
       }
@@ -631,16 +678,14 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       }
       for (size_t t = tr2_entry; t < train_interval[tr_list[i]].second; ++t) {
         // len_in(tr1, t) = 0 AND x_in(tr1, t) = 0
-        model->addConstr(vars["len_in"](tr_list[i], t), GRB_EQUAL, 0,
-                         "train_occupation_free_routes_common_entry_len_in_" +
-                             std::to_string(tr_list[i]) + "_" +
-                             std::to_string(tr_list[i + 1]) + "_" +
-                             std::to_string(t));
-        model->addConstr(vars["x_in"](tr_list[i], t), GRB_EQUAL, 0,
-                         "train_occupation_free_routes_common_entry_x_in_" +
-                             std::to_string(tr_list[i]) + "_" +
-                             std::to_string(tr_list[i + 1]) + "_" +
-                             std::to_string(t));
+        model->addConstr(
+            vars[Var::LenIn](tr_list[i], t), GRB_EQUAL, 0,
+            name("train_occupation_free_routes_common_entry_len_in_",
+                 tr_list[i], "_", tr_list[i + 1], "_", t));
+        model->addConstr(
+            vars[Var::XIn](tr_list[i], t), GRB_EQUAL, 0,
+            name("train_occupation_free_routes_common_entry_x_in_",
+                 tr_list[i], "_", tr_list[i + 1], "_", t));
       }
     }
   }
@@ -658,16 +703,14 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       }
       for (size_t t = train_interval[tr_list[i]].first; t <= tr2_exit; ++t) {
         // len_out(tr1, t) = 0 AND x_out(tr1, t) = 0
-        model->addConstr(vars["len_out"](tr_list[i], t), GRB_EQUAL, 0,
-                         "train_occupation_free_routes_common_exit_len_out_" +
-                             std::to_string(tr_list[i]) + "_" +
-                             std::to_string(tr_list[i + 1]) + "_" +
-                             std::to_string(t));
-        model->addConstr(vars["x_out"](tr_list[i], t), GRB_EQUAL, 0,
-                         "train_occupation_free_routes_common_exit_x_out_" +
-                             std::to_string(tr_list[i]) + "_" +
-                             std::to_string(tr_list[i + 1]) + "_" +
-                             std::to_string(t));
+        model->addConstr(
+            vars[Var::LenOut](tr_list[i], t), GRB_EQUAL, 0,
+            name("train_occupation_free_routes_common_exit_len_out_",
+                 tr_list[i], "_", tr_list[i + 1], "_", t));
+        model->addConstr(
+            vars[Var::XOut](tr_list[i], t), GRB_EQUAL, 0,
+            name("train_occupation_free_routes_common_exit_x_out_",
+                 tr_list[i], "_", tr_list[i + 1], "_", t));
       }
     }
   }
@@ -678,29 +721,32 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // For every breakable edge position exactly b_pos if tight
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e            = breakable_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     const auto& e_len = edge.length;
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
-      for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-        const auto& tr_name = instance.get_train_list().get_train(tr).name;
+      for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+        const auto& tr_name = instance->get_train_list().get_train(tr).name;
         for (size_t t = train_interval[tr].first + 2;
              t <= train_interval[tr].second; ++t) {
-          model->addConstr(vars["e_mu"](tr, t - 1, e), GRB_GREATER_EQUAL,
-                           vars["b_pos"](i, vss) - STOP_TOLERANCE -
-                               e_len * (1 - vars["b_tight"](tr, t, i, vss)),
-                           "tight_vss_border_constraint_1_" + tr_name + "_" +
-                               std::to_string(t * dt) + "_" + edge_name + "_" +
-                               std::to_string(vss));
-          model->addConstr(vars["e_mu"](tr, t - 1, e), GRB_LESS_EQUAL,
-                           vars["b_pos"](i, vss) +
-                               e_len * (1 - vars["b_tight"](tr, t, i, vss)),
-                           "tight_vss_border_constraint_2_" + tr_name + "_" +
-                               std::to_string(t * dt) + "_" + edge_name + "_" +
-                               std::to_string(vss));
+          // e_mu is 0 if the edge cannot be reached
+          GRBLinExpr e_mu = 0;
+          if (edge_reachable(tr, t - 1, e)) {
+            e_mu = vars[Var::EMu](tr, t - 1, e);
+          }
+          model->addConstr(e_mu, GRB_GREATER_EQUAL,
+                           vars[Var::BPos](i, vss) - STOP_TOLERANCE -
+                               e_len * (1 - vars[Var::BTight](tr, t, i, vss)),
+                           name("tight_vss_border_constraint_1_", tr_name, "_",
+                                t * dt, "_", edge_name, "_", vss));
+          model->addConstr(e_mu, GRB_LESS_EQUAL,
+                           vars[Var::BPos](i, vss) +
+                               e_len * (1 - vars[Var::BTight](tr, t, i, vss)),
+                           name("tight_vss_border_constraint_2_", tr_name, "_",
+                                t * dt, "_", edge_name, "_", vss));
         }
       }
     }
@@ -708,27 +754,31 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   // Analog for every edge ending
   for (size_t e = 0; e < num_edges; ++e) {
-    const auto& edge      = instance.n().get_edge(e);
-    const auto& edge_name = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto& edge      = instance->const_n().get_edge(e);
+    const auto& edge_name =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     const auto& e_len = edge.length;
-    for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto& tr_name = instance->get_train_list().get_train(tr).name;
       for (size_t t = train_interval[tr].first + 2;
            t <= train_interval[tr].second; ++t) {
-        model->addConstr(vars["e_mu"](tr, t - 1, e), GRB_GREATER_EQUAL,
-                         e_len * vars["e_tight"](tr, t, e) - STOP_TOLERANCE,
-                         "tight_ttd_border_constraint_" + tr_name + "_" +
-                             std::to_string(t * dt) + "_" + edge_name);
+        GRBLinExpr e_mu = 0;
+        if (edge_reachable(tr, t - 1, e)) {
+          e_mu = vars[Var::EMu](tr, t - 1, e);
+        }
+        model->addConstr(e_mu, GRB_GREATER_EQUAL,
+                         e_len * vars[Var::ETight](tr, t, e) - STOP_TOLERANCE,
+                         name("tight_ttd_border_constraint_", tr_name, "_",
+                              t * dt, "_", edge_name));
       }
     }
   }
 
   // Fix lenout problem
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
-    const auto& tr_len  = instance.get_train_list().get_train(tr_name).length;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
+    const auto& tr_len  = instance->get_train_list().get_train(tr_name).length;
     const auto& max_brakelen =
         include_braking_curves ? get_max_brakelen(tr) : 0;
     // NOLINTBEGIN(readability-identifier-naming)
@@ -737,10 +787,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     for (size_t t = train_interval[tr].first + 2;
          t <= train_interval[tr].second; ++t) {
       // len_out(t-1) <= M * v(t) with M = (tr_len + max_brakelen) / V_MIN
-      model->addConstr(vars["len_out"](tr, t - 1), GRB_LESS_EQUAL,
-                       M * vars["stopped"](tr, t),
-                       "tight_len_out_constraint_" + tr_name + "_" +
-                           std::to_string(t * dt));
+      model->addConstr(vars[Var::LenOut](tr, t - 1), GRB_LESS_EQUAL,
+                       M * vars[Var::Stopped](tr, t),
+                       name("tight_len_out_constraint_", tr_name, "_", t * dt));
     }
   }
 }
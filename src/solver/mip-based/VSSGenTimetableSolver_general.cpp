@@ -1,6 +1,7 @@
 #include "CustomExceptions.hpp"
 #include "MultiArray.hpp"
 #include "gurobi_c++.h"
+#include "solver/mip-based/ModelBatch.hpp"
 #include "solver/mip-based/VSSGenTimetableSolver.hpp"
 
 #include <chrono>
@@ -20,7 +21,8 @@
 cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
     const instances::VSSGenerationTimetable& instance)
     : GeneralMIPSolver<instances::VSSGenerationTimetable,
-                       instances::SolVSSGenerationTimetable>(instance) {
+                       instances::SolVSSGenerationTimetable,
+                       VSSGenTimetableVariable>(instance) {
   if (plog::get() == nullptr) {
     static plog::ColorConsoleAppender<plog::TxtFormatter> console_appender;
     plog::init(plog::debug, &console_appender);
@@ -29,7 +31,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
 
 cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
     const std::filesystem::path& instance_path) {
-  instance = instances::VSSGenerationTimetable::import_instance(instance_path);
+  instance = CopyOnWrite<instances::VSSGenerationTimetable>(
+      instances::VSSGenerationTimetable::import_instance(instance_path));
   if (plog::get() == nullptr) {
     static plog::ColorConsoleAppender<plog::TxtFormatter> console_appender;
     plog::init(plog::debug, &console_appender);
@@ -38,7 +41,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
 
 cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
     const std::string& instance_path) {
-  instance = instances::VSSGenerationTimetable::import_instance(instance_path);
+  instance = CopyOnWrite<instances::VSSGenerationTimetable>(
+      instances::VSSGenerationTimetable::import_instance(instance_path));
   if (plog::get() == nullptr) {
     static plog::ColorConsoleAppender<plog::TxtFormatter> console_appender;
     plog::init(plog::debug, &console_appender);
@@ -47,7 +51,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
 
 cda_rail::solver::mip_based::VSSGenTimetableSolver::VSSGenTimetableSolver(
     const char* instance_path) {
-  instance = instances::VSSGenerationTimetable::import_instance(instance_path);
+  instance = CopyOnWrite<instances::VSSGenerationTimetable>(
+      instances::VSSGenerationTimetable::import_instance(instance_path));
   if (plog::get() == nullptr) {
     static plog::ColorConsoleAppender<plog::TxtFormatter> console_appender;
     plog::init(plog::debug, &console_appender);
@@ -84,6 +89,9 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::solve(
    * Default: false
    * - use_schedule_cuts: If true, the formulation is strengthened using cuts
    * implied by the schedule. Default: true
+   * - use_reachability_pruning: If true and routes are not fixed, variables and
+   * constraints of positions a train cannot occupy given its schedule are not
+   * created. Default: true
    *
    * @param solver_strategy: Specify information on the algorithm's strategy to
    * use, namely
@@ -123,18 +131,17 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::solve(
                            solution_settings, time_limit, debug_input);
 
   create_variables();
-  set_objective();
+  telemetry.measure("set_objective", [this]() { set_objective(); });
   create_constraints();
 
   set_timeout(time_limit);
 
-  const auto sol_object = optimize(old_instance, time_limit);
+  auto sol_object = optimize(old_instance, time_limit);
+  sol_object->set_telemetry(telemetry);
 
   export_lp_if_applicable(solution_settings);
 
-  if (old_instance.has_value()) {
-    instance = old_instance.value();
-  }
+  instance = old_instance;
 
   export_solution_if_applicable(sol_object, solution_settings);
 
@@ -149,57 +156,56 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Creates general variables that are independent of the fixed route
    */
 
-  vars["v"] = MultiArray<GRBVar>(num_tr, num_t + 1);
-  vars["x"] = MultiArray<GRBVar>(num_tr, num_t, num_edges);
-  vars["x_sec"] =
+  vars[Var::V] = MultiArray<GRBVar>(num_tr, num_t + 1);
+  vars[Var::X] = MultiArray<GRBVar>(num_tr, num_t, num_edges);
+  vars[Var::XSec] =
       MultiArray<GRBVar>(num_tr, num_t, unbreakable_sections.size());
-  vars["y_sec_fwd"] = MultiArray<GRBVar>(num_t, fwd_bwd_sections.size());
-  vars["y_sec_bwd"] = MultiArray<GRBVar>(num_t, fwd_bwd_sections.size());
+  vars[Var::YSecFwd] = MultiArray<GRBVar>(num_t, fwd_bwd_sections.size());
+  vars[Var::YSecBwd] = MultiArray<GRBVar>(num_t, fwd_bwd_sections.size());
 
   if (vss_model.get_only_stop_at_vss()) {
-    vars["stopped"] = MultiArray<GRBVar>(num_tr, num_t);
+    vars[Var::Stopped] = MultiArray<GRBVar>(num_tr, num_t);
   }
 
-  auto train_list = instance.get_train_list();
+  VariableBatch batch(*model);
+  auto          train_list = instance->get_train_list();
   for (size_t i = 0; i < num_tr; ++i) {
-    auto max_speed = instance.get_train_list().get_train(i).max_speed;
+    auto max_speed = instance->get_train_list().get_train(i).max_speed;
     auto tr_name   = train_list.get_train(i).name;
     for (size_t t = train_interval[i].first; t <= train_interval[i].second + 1;
          ++t) {
-      vars["v"](i, t) =
-          model->addVar(0, max_speed, 0, GRB_CONTINUOUS,
-                        "v_" + tr_name + "_" + std::to_string(t * dt));
+      batch.add(vars[Var::V](i, t), 0, max_speed, 0, GRB_CONTINUOUS,
+                name("v_", tr_name, "_", t * dt));
     }
     for (size_t t = train_interval[i].first; t <= train_interval[i].second;
          ++t) {
       for (auto const edge_id :
-           instance.edges_used_by_train(tr_name, fix_routes)) {
-        const auto& edge = instance.n().get_edge(edge_id);
+           instance->edges_used_by_train(tr_name, fix_routes)) {
+        const auto& edge = instance->const_n().get_edge(edge_id);
         const auto& edge_name =
-            "[" + instance.n().get_vertex(edge.source).name + "," +
-            instance.n().get_vertex(edge.target).name + "]";
-        vars["x"](i, t, edge_id) = model->addVar(
-            0, 1, 0, GRB_BINARY,
-            "x_" + tr_name + "_" + std::to_string(t * dt) + "_" + edge_name);
+            "[" + instance->const_n().get_vertex(edge.source).name + "," +
+            instance->const_n().get_vertex(edge.target).name + "]";
+        // Positions that cannot be reached are fixed, but still created since
+        // the general constraints refer to them
+        const double x_ub = edge_reachable(i, t, edge_id) ? 1 : 0;
+        batch.add(vars[Var::X](i, t, edge_id), 0, x_ub, 0, GRB_BINARY,
+                  name("x_", tr_name, "_", t * dt, "_", edge_name));
       }
       for (const auto& sec : unbreakable_section_indices(i)) {
-        vars["x_sec"](i, t, sec) =
-            model->addVar(0, 1, 0, GRB_BINARY,
-                          "x_sec_" + tr_name + "_" + std::to_string(t * dt) +
-                              "_" + std::to_string(sec));
+        batch.add(vars[Var::XSec](i, t, sec), 0, 1, 0, GRB_BINARY,
+                  name("x_sec_", tr_name, "_", t * dt, "_", sec));
       }
     }
   }
   for (size_t t = 0; t < num_t; ++t) {
     for (size_t i = 0; i < fwd_bwd_sections.size(); ++i) {
-      vars["y_sec_fwd"](t, i) = model->addVar(
-          0, 1, 0, GRB_BINARY,
-          "y_sec_fwd_" + std::to_string(t * dt) + "_" + std::to_string(i));
-      vars["y_sec_bwd"](t, i) = model->addVar(
-          0, 1, 0, GRB_BINARY,
-          "y_sec_bwd_" + std::to_string(t * dt) + "_" + std::to_string(i));
+      batch.add(vars[Var::YSecFwd](t, i), 0, 1, 0, GRB_BINARY,
+                name("y_sec_fwd_", t * dt, "_", i));
+      batch.add(vars[Var::YSecBwd](t, i), 0, 1, 0, GRB_BINARY,
+                name("y_sec_bwd_", t * dt, "_", i));
     }
   }
+  batch.submit();
 }
 
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::
@@ -208,12 +214,12 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * Creates variables connected to the VSS decisions of the problem
    */
 
-  vars["b"] = MultiArray<GRBVar>(no_border_vss_vertices.size());
+  vars[Var::B] = MultiArray<GRBVar>(no_border_vss_vertices.size());
 
   for (size_t i = 0; i < no_border_vss_vertices.size(); ++i) {
     const auto& v_name =
-        instance.n().get_vertex(no_border_vss_vertices[i]).name;
-    vars["b"](i) = model->addVar(0, 1, 0, GRB_BINARY, "b_" + v_name);
+        instance->const_n().get_vertex(no_border_vss_vertices[i]).name;
+    vars[Var::B](i) = model->addVar(0, 1, 0, GRB_BINARY, name("b_", v_name));
   }
 }
 
@@ -225,30 +231,30 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   int max_vss = 0;
   for (const auto& e : breakable_edges) {
-    max_vss = std::max(max_vss, instance.n().max_vss_on_edge(e));
+    max_vss = std::max(max_vss, instance->const_n().max_vss_on_edge(e));
   }
 
-  vars["b_pos"] = MultiArray<GRBVar>(num_breakable_sections, max_vss);
-  vars["b_front"] =
+  vars[Var::BPos] = MultiArray<GRBVar>(num_breakable_sections, max_vss);
+  vars[Var::BFront] =
       MultiArray<GRBVar>(num_tr, num_t, num_breakable_sections, max_vss);
-  vars["b_rear"] =
+  vars[Var::BRear] =
       MultiArray<GRBVar>(num_tr, num_t, num_breakable_sections, max_vss);
 
   if (this->vss_model.get_model_type() == vss::ModelType::Inferred) {
-    vars["num_vss_segments"]  = MultiArray<GRBVar>(relevant_edges.size());
-    vars["frac_vss_segments"] = MultiArray<GRBVar>(
+    vars[Var::NumVssSegments]  = MultiArray<GRBVar>(relevant_edges.size());
+    vars[Var::FracVssSegments] = MultiArray<GRBVar>(
         relevant_edges.size(),
         this->vss_model.get_separation_functions().size(), max_vss);
-    vars["edge_type"] =
+    vars[Var::EdgeType] =
         MultiArray<GRBVar>(relevant_edges.size(),
                            this->vss_model.get_separation_functions().size());
-    vars["frac_type"] = MultiArray<GRBVar>(
+    vars[Var::FracType] = MultiArray<GRBVar>(
         relevant_edges.size(),
         this->vss_model.get_separation_functions().size(), max_vss);
   } else if (this->vss_model.get_model_type() == vss::ModelType::Continuous) {
-    vars["b_used"] = MultiArray<GRBVar>(relevant_edges.size(), max_vss);
+    vars[Var::BUsed] = MultiArray<GRBVar>(relevant_edges.size(), max_vss);
   } else if (this->vss_model.get_model_type() == vss::ModelType::InferredAlt) {
-    vars["type_num_vss_segments"] = MultiArray<GRBVar>(
+    vars[Var::TypeNumVssSegments] = MultiArray<GRBVar>(
         relevant_edges.size(),
         this->vss_model.get_separation_functions().size(), max_vss);
   } else {
@@ -258,30 +264,28 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e            = breakable_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
     const auto& edge_len     = edge.length;
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
       const auto& lb = 0;
       const auto& ub = edge_len;
-      vars["b_pos"](i, vss) =
+      vars[Var::BPos](i, vss) =
           model->addVar(lb, ub, 0, GRB_CONTINUOUS,
-                        "b_pos_" + edge_name + "_" + std::to_string(vss));
-      for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
+                        name("b_pos_", edge_name, "_", vss));
+      for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
         for (size_t t = train_interval[tr].first;
              t <= train_interval[tr].second; ++t) {
-          vars["b_front"](tr, t, i, vss) = model->addVar(
+          vars[Var::BFront](tr, t, i, vss) = model->addVar(
               0, 1, 0, GRB_BINARY,
-              "b_front_" + std::to_string(tr) + "_" + std::to_string(t * dt) +
-                  "_" + edge_name + "_" + std::to_string(vss));
-          if (instance.get_train_list().get_train(tr).tim) {
-            vars["b_rear"](tr, t, i, vss) = model->addVar(
+              name("b_front_", tr, "_", t * dt, "_", edge_name, "_", vss));
+          if (instance->get_train_list().get_train(tr).tim) {
+            vars[Var::BRear](tr, t, i, vss) = model->addVar(
                 0, 1, 0, GRB_BINARY,
-                "b_rear_" + std::to_string(tr) + "_" + std::to_string(t * dt) +
-                    "_" + edge_name + "_" + std::to_string(vss));
+                name("b_rear_", tr, "_", t * dt, "_", edge_name, "_", vss));
           }
         }
       }
@@ -290,19 +294,20 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   for (size_t i = 0; i < relevant_edges.size(); ++i) {
     const auto& e            = relevant_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
 
     if (this->vss_model.get_model_type() == vss::ModelType::Inferred) {
-      vars["num_vss_segments"](i) = model->addVar(
-          1, vss_number_e + 1, 0, GRB_INTEGER, "num_vss_segments_" + edge_name);
+      vars[Var::NumVssSegments](i) = model->addVar(
+          1, vss_number_e + 1, 0, GRB_INTEGER, name("num_vss_segments_",
+                                                    edge_name));
 
       if (iterative_vss &&
           vss_number_e + 1 > max_vss_per_edge_in_iteration.at(i)) {
-        vars["num_vss_segments"](i).set(
+        vars[Var::NumVssSegments](i).set(
             GRB_DoubleAttr_UB,
             static_cast<double>(max_vss_per_edge_in_iteration.at(i)) + 1);
       }
@@ -310,29 +315,27 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       for (size_t sep_type = 0;
            sep_type < this->vss_model.get_separation_functions().size();
            ++sep_type) {
-        vars["edge_type"](i, sep_type) = model->addVar(
+        vars[Var::EdgeType](i, sep_type) = model->addVar(
             0, 1, 0, GRB_BINARY,
-            "edge_type_" + edge_name + "_" + std::to_string(sep_type));
+            name("edge_type_", edge_name, "_", sep_type));
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
           const auto& lb                              = 0.0;
           const auto& ub                              = 1.0;
-          vars["frac_vss_segments"](i, sep_type, vss) = model->addVar(
+          vars[Var::FracVssSegments](i, sep_type, vss) = model->addVar(
               lb, ub, 0, GRB_CONTINUOUS,
-              "frac_vss_segments_" + edge_name + "_" +
-                  std::to_string(sep_type) + "_" + std::to_string(vss));
-          vars["frac_type"](i, sep_type, vss) = model->addVar(
+              name("frac_vss_segments_", edge_name, "_", sep_type, "_", vss));
+          vars[Var::FracType](i, sep_type, vss) = model->addVar(
               lb, ub, 0, GRB_CONTINUOUS,
-              "frac_type_" + edge_name + "_" + std::to_string(sep_type) + "_" +
-                  std::to_string(vss));
+              name("frac_type_", edge_name, "_", sep_type, "_", vss));
         }
       }
     } else if (this->vss_model.get_model_type() == vss::ModelType::Continuous) {
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
-        vars["b_used"](i, vss) =
+        vars[Var::BUsed](i, vss) =
             model->addVar(0, 1, 0, GRB_BINARY,
-                          "b_used_" + edge_name + "_" + std::to_string(vss));
+                          name("b_used_", edge_name, "_", vss));
         if (iterative_vss && vss >= max_vss_per_edge_in_iteration.at(i)) {
-          vars["b_used"](i, vss).set(GRB_DoubleAttr_UB, 0);
+          vars[Var::BUsed](i, vss).set(GRB_DoubleAttr_UB, 0);
         }
       }
     } else if (this->vss_model.get_model_type() ==
@@ -341,13 +344,13 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
            sep_type < this->vss_model.get_separation_functions().size();
            ++sep_type) {
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
-          vars["type_num_vss_segments"](i, sep_type, vss) = model->addVar(
+          vars[Var::TypeNumVssSegments](i, sep_type, vss) = model->addVar(
               0, 1, 0, GRB_BINARY,
-              "type_num_vss_segments_" + edge_name + "_" +
-                  std::to_string(sep_type) + "_" + std::to_string(vss));
+              name("type_num_vss_segments_", edge_name, "_", sep_type, "_",
+                   vss));
 
           if (iterative_vss && vss >= max_vss_per_edge_in_iteration.at(i)) {
-            vars["type_num_vss_segments"](i, sep_type, vss)
+            vars[Var::TypeNumVssSegments](i, sep_type, vss)
                 .set(GRB_DoubleAttr_UB, 0);
           }
         }
@@ -360,47 +363,46 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     create_non_discretized_only_stop_at_vss_variables() {
   int max_vss = 0;
   for (const auto& e : breakable_edges) {
-    max_vss = std::max(max_vss, instance.n().max_vss_on_edge(e));
+    max_vss = std::max(max_vss, instance->const_n().max_vss_on_edge(e));
   }
 
-  vars["b_tight"] =
+  vars[Var::BTight] =
       MultiArray<GRBVar>(num_tr, num_t, num_breakable_sections, max_vss);
-  vars["e_tight"] = MultiArray<GRBVar>(num_tr, num_t, num_edges);
+  vars[Var::ETight] = MultiArray<GRBVar>(num_tr, num_t, num_edges);
 
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e            = breakable_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
-      for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-        const auto& tr_name = instance.get_train_list().get_train(tr).name;
+      for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+        const auto& tr_name = instance->get_train_list().get_train(tr).name;
         for (size_t t = train_interval[tr].first + 2;
              t <= train_interval[tr].second; ++t) {
-          vars["b_tight"](tr, t, i, vss) = model->addVar(
+          vars[Var::BTight](tr, t, i, vss) = model->addVar(
               0, 1, 0, GRB_BINARY,
-              "b_tight_" + tr_name + "_" + std::to_string(t * dt) + "_" +
-                  edge_name + "_" + std::to_string(vss));
+              name("b_tight_", tr_name, "_", t * dt, "_", edge_name, "_", vss));
         }
       }
     }
   }
 
   for (size_t e = 0; e < num_edges; ++e) {
-    const auto& edge      = instance.n().get_edge(e);
-    const auto& edge_name = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
-    for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    const auto& edge      = instance->const_n().get_edge(e);
+    const auto& edge_name =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
+    for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto& tr_name = instance->get_train_list().get_train(tr).name;
       for (size_t t = train_interval[tr].first + 2;
            t <= train_interval[tr].second; ++t) {
-        vars["e_tight"](tr, t, e) =
+        vars[Var::ETight](tr, t, e) =
             model->addVar(0, 1, 0, GRB_BINARY,
-                          "e_tight_" + tr_name + "_" + std::to_string(t * dt) +
-                              "_" + edge_name);
+                          name("e_tight_", tr_name, "_", t * dt, "_",
+                               edge_name));
       }
     }
   }
@@ -417,30 +419,30 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::set_objective() {
   objective_expr = 0;
   if (vss_model.get_model_type() == vss::ModelType::Discrete) {
     for (size_t i = 0; i < no_border_vss_vertices.size(); ++i) {
-      objective_expr += vars["b"](i);
+      objective_expr += vars[Var::B](i);
     }
   } else if (vss_model.get_model_type() == vss::ModelType::Continuous) {
     for (size_t i = 0; i < relevant_edges.size(); ++i) {
       const auto& e            = relevant_edges[i];
-      const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+      const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
-        objective_expr += vars["b_used"](i, vss);
+        objective_expr += vars[Var::BUsed](i, vss);
       }
     }
   } else if (vss_model.get_model_type() == vss::ModelType::Inferred) {
     for (size_t i = 0; i < relevant_edges.size(); ++i) {
-      objective_expr += (vars["num_vss_segments"](i) - 1);
+      objective_expr += (vars[Var::NumVssSegments](i) - 1);
     }
   } else if (vss_model.get_model_type() == vss::ModelType::InferredAlt) {
     for (size_t i = 0; i < relevant_edges.size(); ++i) {
       const auto& e            = relevant_edges[i];
-      const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+      const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
         for (size_t sep_type = 0;
              sep_type < this->vss_model.get_separation_functions().size();
              ++sep_type) {
           objective_expr += (static_cast<double>(vss) + 1) *
-                            vars["type_num_vss_segments"](i, sep_type, vss);
+                            vars[Var::TypeNumVssSegments](i, sep_type, vss);
         }
       }
     }
@@ -459,19 +461,19 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   for (const auto& no_border_vss_section : no_border_vss_sections) {
     const auto tr_on_section =
-        instance.trains_in_section(no_border_vss_section);
+        instance->trains_in_section(no_border_vss_section);
     const auto no_border_vss_section_sorted =
-        instance.n().combine_reverse_edges(no_border_vss_section, true);
+        instance->const_n().combine_reverse_edges(no_border_vss_section, true);
     for (size_t i = 0; i < tr_on_section.size(); ++i) {
       const auto& tr1          = tr_on_section[i];
       const auto& tr1_interval = train_interval[tr1];
-      const auto& tr1_name     = instance.get_train_list().get_train(tr1).name;
-      const auto& tr1_route    = instance.get_route(tr1_name);
+      const auto& tr1_name     = instance->get_train_list().get_train(tr1).name;
+      const auto& tr1_route    = instance->get_route(tr1_name);
       for (size_t j = i + 1; j < tr_on_section.size(); ++j) {
         const auto& tr2          = tr_on_section[j];
         const auto& tr2_interval = train_interval[tr2];
-        const auto& tr2_name  = instance.get_train_list().get_train(tr2).name;
-        const auto& tr2_route = instance.get_route(tr2_name);
+        const auto& tr2_name  = instance->get_train_list().get_train(tr2).name;
+        const auto& tr2_route = instance->get_route(tr2_name);
         std::pair<size_t, size_t> const t_interval = {
             std::max(tr1_interval.first, tr2_interval.first),
             std::min(tr1_interval.second, tr2_interval.second)};
@@ -487,36 +489,36 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
               GRBLinExpr lhs_second = 0;
               if (tr1_route.contains_edge(
                       no_border_vss_section_sorted[e1].first)) {
-                lhs -= vars["x"](
+                lhs -= vars[Var::X](
                     tr1, t, no_border_vss_section_sorted[e1].first.value());
-                lhs_first += vars["x"](
+                lhs_first += vars[Var::X](
                     tr1, t, no_border_vss_section_sorted[e1].first.value());
               }
               if (tr1_route.contains_edge(
                       no_border_vss_section_sorted[e1].second)) {
-                lhs -= vars["x"](
+                lhs -= vars[Var::X](
                     tr1, t, no_border_vss_section_sorted[e1].second.value());
-                lhs_second += vars["x"](
+                lhs_second += vars[Var::X](
                     tr1, t, no_border_vss_section_sorted[e1].second.value());
               }
               if (tr2_route.contains_edge(
                       no_border_vss_section_sorted[e2].first)) {
-                lhs -= vars["x"](
+                lhs -= vars[Var::X](
                     tr2, t, no_border_vss_section_sorted[e2].first.value());
-                lhs_first += vars["x"](
+                lhs_first += vars[Var::X](
                     tr2, t, no_border_vss_section_sorted[e2].first.value());
               }
               if (tr2_route.contains_edge(
                       no_border_vss_section_sorted[e2].second)) {
-                lhs -= vars["x"](
+                lhs -= vars[Var::X](
                     tr2, t, no_border_vss_section_sorted[e2].second.value());
-                lhs_second += vars["x"](
+                lhs_second += vars[Var::X](
                     tr2, t, no_border_vss_section_sorted[e2].second.value());
               }
 
               for (size_t e_overlap = std::min(e1, e2);
                    e_overlap < std::max(e1, e2); ++e_overlap) {
-                const auto& v_overlap = instance.n().common_vertex(
+                const auto& v_overlap = instance->const_n().common_vertex(
                     no_border_vss_section_sorted[e_overlap],
                     no_border_vss_section_sorted[e_overlap + 1]);
                 if (!v_overlap.has_value()) {
@@ -533,50 +535,38 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
                       "Vertex not found in no_border_vss_vertices, this should "
                       "not have happened");
                 }
-                lhs += vars["b"](v_overlap_index);
+                lhs += vars[Var::B](v_overlap_index);
               }
 
               model->addConstr(
                   lhs >= 1,
-                  "vss_" + tr1_name + "_" + tr2_name + "_" + std::to_string(t) +
-                      "_" +
-                      std::to_string(
-                          no_border_vss_section_sorted[e1].first.value()) +
-                      "_" +
-                      std::to_string(
-                          no_border_vss_section_sorted[e2].first.value()));
-
-              if ((!instance.get_train_list().get_train(tr1).tim &&
+                  name("vss_", tr1_name, "_", tr2_name, "_", t, "_",
+                       no_border_vss_section_sorted[e1].first.value(), "_",
+                       no_border_vss_section_sorted[e2].first.value()));
+
+              if ((!instance->get_train_list().get_train(tr1).tim &&
                    (e1 > e2)) ||
-                  (!instance.get_train_list().get_train(tr2).tim &&
+                  (!instance->get_train_list().get_train(tr2).tim &&
                    (e2 > e1))) {
                 // lhs_first <= 1
                 model->addConstr(
                     lhs_first <= 1,
-                    "vss_tim_first_" + tr1_name + "_" + tr2_name + "_" +
-                        std::to_string(t) + "_" +
-                        std::to_string(
-                            no_border_vss_section_sorted[e1].first.value()) +
-                        "_" +
-                        std::to_string(
-                            no_border_vss_section_sorted[e2].first.value()) +
-                        "_first");
+                    name("vss_tim_first_", tr1_name, "_", tr2_name, "_", t, "_",
+                         no_border_vss_section_sorted[e1].first.value(), "_",
+                         no_border_vss_section_sorted[e2].first.value(),
+                         "_first"));
               }
-              if ((!instance.get_train_list().get_train(tr2).tim &&
+              if ((!instance->get_train_list().get_train(tr2).tim &&
                    (e1 > e2)) ||
-                  (!instance.get_train_list().get_train(tr1).tim &&
+                  (!instance->get_train_list().get_train(tr1).tim &&
                    (e2 > e1))) {
                 // lhs_second <= 1
                 model->addConstr(
                     lhs_second <= 1,
-                    "vss_tim_second_" + tr1_name + "_" + tr2_name + "_" +
-                        std::to_string(t) + "_" +
-                        std::to_string(
-                            no_border_vss_section_sorted[e1].first.value()) +
-                        "_" +
-                        std::to_string(
-                            no_border_vss_section_sorted[e2].first.value()) +
-                        "_first");
+                    name("vss_tim_second_", tr1_name, "_", tr2_name, "_", t,
+                         "_", no_border_vss_section_sorted[e1].first.value(),
+                         "_", no_border_vss_section_sorted[e2].first.value(),
+                         "_first"));
               }
             }
           }
@@ -596,42 +586,39 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   for (size_t sec_index = 0; sec_index < unbreakable_sections.size();
        ++sec_index) {
     const auto& sec       = unbreakable_sections[sec_index];
-    const auto& tr_on_sec = instance.trains_in_section(sec);
+    const auto& tr_on_sec = instance->trains_in_section(sec);
     // tr is on section if it occupies at least one edge of the section
     for (auto const tr : tr_on_sec) {
       const auto& tr_interval = train_interval[tr];
-      const auto& tr_name     = instance.get_train_list().get_train(tr).name;
-      const auto& tr_route    = instance.get_route(tr_name);
+      const auto& tr_name     = instance->get_train_list().get_train(tr).name;
+      const auto& tr_route    = instance->get_route(tr_name);
       for (size_t t = tr_interval.first; t <= tr_interval.second; ++t) {
         GRBLinExpr lhs   = 0;
         int        count = 0;
         for (auto const e_index : sec) {
           if (tr_route.contains_edge(e_index)) {
-            lhs += vars["x"](tr, t, e_index);
+            lhs += vars[Var::X](tr, t, e_index);
             count++;
           }
         }
-        model->addConstr(lhs >= vars["x_sec"](tr, t, sec_index),
-                         "unbreakable_section_only_" + tr_name + "_" +
-                             std::to_string(t) + "_" +
-                             std::to_string(sec_index));
-        model->addConstr(lhs <= count * vars["x_sec"](tr, t, sec_index),
-                         "unbreakable_section_if_" + tr_name + "_" +
-                             std::to_string(t) + "_" +
-                             std::to_string(sec_index));
+        model->addConstr(lhs >= vars[Var::XSec](tr, t, sec_index),
+                         name("unbreakable_section_only_", tr_name, "_", t, "_",
+                              sec_index));
+        model->addConstr(lhs <= count * vars[Var::XSec](tr, t, sec_index),
+                         name("unbreakable_section_if_", tr_name, "_", t, "_",
+                              sec_index));
       }
     }
 
     for (size_t t = 0; t <= num_t; ++t) {
       const auto tr_to_consider =
-          instance.trains_at_t(static_cast<int>(t) * dt, tr_on_sec);
+          instance->trains_at_t(static_cast<int>(t) * dt, tr_on_sec);
       GRBLinExpr lhs = 0;
       for (auto const tr : tr_to_consider) {
-        lhs += vars["x_sec"](tr, t, sec_index);
+        lhs += vars[Var::XSec](tr, t, sec_index);
       }
-      model->addConstr(lhs <= 1, "unbreakable_section" +
-                                     std::to_string(sec_index) +
-                                     "_at_most_one_" + std::to_string(t));
+      model->addConstr(lhs <= 1, name("unbreakable_section", sec_index,
+                                      "_at_most_one_", t));
     }
   }
 }
@@ -644,31 +631,30 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * - the speed is 0
    */
 
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < train_list.size(); ++tr) {
     const auto  tr_name     = train_list.get_train(tr).name;
-    const auto& tr_schedule = instance.get_schedule(tr_name);
-    const auto& tr_edges = instance.edges_used_by_train(tr, this->fix_routes);
+    const auto& tr_schedule = instance->get_schedule(tr_name);
+    const auto& tr_edges = instance->edges_used_by_train(tr, this->fix_routes);
     for (const auto& tr_stop : tr_schedule.get_stops()) {
       const auto t0 = static_cast<size_t>(tr_stop.arrival() / dt);
       const auto t1 = static_cast<size_t>(
           std::ceil(static_cast<double>(tr_stop.departure()) / dt));
-      const auto& stop_edges = instance.get_station_list()
+      const auto& stop_edges = instance->get_station_list()
                                    .get_station(tr_stop.get_station_name())
                                    .tracks;
       const auto inverse_stop_edges =
-          instance.n().inverse_edges(stop_edges, tr_edges);
+          instance->const_n().inverse_edges(stop_edges, tr_edges);
       for (size_t t = t0 - 1; t <= t1; ++t) {
         if (t >= t0) {
-          model->addConstr(vars["v"](tr, t) == 0, "station_speed_" + tr_name +
-                                                      "_" + std::to_string(t));
+          model->addConstr(vars[Var::V](tr, t) == 0,
+                           name("station_speed_", tr_name, "_", t));
         }
         if (t >= t0 && t < t1) { // because otherwise the front corresponds to
                                  // t1+dt which is allowed outside
           for (auto const e : inverse_stop_edges) {
-            model->addConstr(vars["x"](tr, t, e) == 0,
-                             "station_x_" + tr_name + "_" + std::to_string(t) +
-                                 "_" + std::to_string(e));
+            model->addConstr(vars[Var::X](tr, t, e) == 0,
+                             name("station_x_", tr_name, "_", t, "_", e));
           }
         }
         // At least on station edge must be occupied, this also holds for the
@@ -678,11 +664,10 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
           // If e in tr_edges
           if (std::find(tr_edges.begin(), tr_edges.end(), e) !=
               tr_edges.end()) {
-            lhs += vars["x"](tr, t, e);
+            lhs += vars[Var::X](tr, t, e);
           }
         }
-        model->addConstr(lhs >= 1, "station_occupancy_" + tr_name + "_" +
-                                       std::to_string(t));
+        model->addConstr(lhs >= 1, name("station_occupancy_", tr_name, "_", t));
       }
     }
   }
@@ -695,22 +680,20 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * the trains.
    */
 
-  const auto& train_list = instance.get_train_list();
+  const auto& train_list = instance->get_train_list();
   for (size_t tr = 0; tr < train_list.size(); ++tr) {
     // Iterate over all time steps
     const auto& tr_object = train_list.get_train(tr);
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
          ++t) {
       // v(t+1) - v(t) <= acceleration * dt
-      model->addConstr(vars["v"](tr, t + 1) - vars["v"](tr, t) <=
+      model->addConstr(vars[Var::V](tr, t + 1) - vars[Var::V](tr, t) <=
                            tr_object.acceleration * dt,
-                       "acceleration_" + tr_object.name + "_" +
-                           std::to_string(t));
+                       name("acceleration_", tr_object.name, "_", t));
       // v(t) - v(t+1) <= deceleration * dt
-      model->addConstr(vars["v"](tr, t) - vars["v"](tr, t + 1) <=
+      model->addConstr(vars[Var::V](tr, t) - vars[Var::V](tr, t + 1) <=
                            tr_object.deceleration * dt,
-                       "deceleration_" + tr_object.name + "_" +
-                           std::to_string(t));
+                       name("deceleration_", tr_object.name, "_", t));
     }
   }
 }
@@ -721,15 +704,15 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    * This method creates the variables corresponding to breaking distances.
    */
 
-  vars["brakelen"] = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::Brakelen] = MultiArray<GRBVar>(num_tr, num_t);
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto  max_break_len = get_max_brakelen(tr);
-    const auto& tr_name       = instance.get_train_list().get_train(tr).name;
+    const auto& tr_name       = instance->get_train_list().get_train(tr).name;
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
          ++t) {
-      vars["brakelen"](tr, t) =
+      vars[Var::Brakelen](tr, t) =
           model->addVar(0, max_break_len, 0, GRB_CONTINUOUS,
-                        "brakelen_" + tr_name + "_" + std::to_string(t * dt));
+                        name("brakelen_", tr_name, "_", t * dt));
     }
   }
 }
@@ -748,16 +731,18 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   if (vss_model.get_only_stop_at_vss()) {
     for (size_t tr = 0; tr < num_tr; ++tr) {
-      const auto& tr_speed = instance.get_train_list().get_train(tr).max_speed;
+      const auto& tr_speed = instance->get_train_list().get_train(tr).max_speed;
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
         // v(tr,t) = 0 iff stopped(tr,t) = 0 otherwise v(tr,t) >= V_MIN
         model->addConstr(
-            vars["v"](tr, t), GRB_GREATER_EQUAL, V_MIN * vars["stopped"](tr, t),
-            "v_min_" + std::to_string(tr) + "_" + std::to_string(t * dt));
+            vars[Var::V](tr, t), GRB_GREATER_EQUAL,
+            V_MIN * vars[Var::Stopped](tr, t),
+            name("v_min_", tr, "_", t * dt));
         model->addConstr(
-            vars["v"](tr, t), GRB_LESS_EQUAL, tr_speed * vars["stopped"](tr, t),
-            "v_max_" + std::to_string(tr) + "_" + std::to_string(t * dt));
+            vars[Var::V](tr, t), GRB_LESS_EQUAL,
+            tr_speed * vars[Var::Stopped](tr, t),
+            name("v_max_", tr, "_", t * dt));
       }
     }
   }
@@ -797,25 +782,23 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     for (size_t i = 0; i < relevant_edges.size(); ++i) {
       const auto& e               = relevant_edges[i];
       const auto& e_index         = breakable_edge_indices[e];
-      const auto  vss_number_e    = instance.n().max_vss_on_edge(e);
-      const auto& e_len           = instance.n().get_edge(e).length;
-      const auto& min_block_len_e = instance.n().get_edge(e).min_block_length;
+      const auto  vss_number_e    = instance->const_n().max_vss_on_edge(e);
+      const auto& e_len           = instance->const_n().get_edge(e).length;
+      const auto& min_block_len_e =
+          instance->const_n().get_edge(e).min_block_length;
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
-        model->addConstr(e_len * vars["b_used"](i, vss), GRB_GREATER_EQUAL,
-                         vars["b_pos"](e_index, vss),
-                         "b_used_" + std::to_string(e) + "_" +
-                             std::to_string(vss));
-        model->addConstr(vars["b_pos"](e_index, vss), GRB_GREATER_EQUAL,
-                         vars["b_used"](i, vss) * min_block_len_e,
-                         "b_used_min_value_if_used_" + std::to_string(e) + "_" +
-                             std::to_string(vss));
+        model->addConstr(e_len * vars[Var::BUsed](i, vss), GRB_GREATER_EQUAL,
+                         vars[Var::BPos](e_index, vss),
+                         name("b_used_", e, "_", vss));
+        model->addConstr(vars[Var::BPos](e_index, vss), GRB_GREATER_EQUAL,
+                         vars[Var::BUsed](i, vss) * min_block_len_e,
+                         name("b_used_min_value_if_used_", e, "_", vss));
         // Also remove redundant solutions
         if (vss < vss_number_e - 1) {
-          model->addConstr(vars["b_pos"](e_index, vss), GRB_GREATER_EQUAL,
-                           vars["b_pos"](e_index, vss + 1) +
-                               vars["b_used"](i, vss + 1) * min_block_len_e,
-                           "b_used_decreasing_" + std::to_string(e) + "_" +
-                               std::to_string(vss));
+          model->addConstr(vars[Var::BPos](e_index, vss), GRB_GREATER_EQUAL,
+                           vars[Var::BPos](e_index, vss + 1) +
+                               vars[Var::BUsed](i, vss + 1) * min_block_len_e,
+                           name("b_used_decreasing_", e, "_", vss));
         }
       }
     }
@@ -827,22 +810,23 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       continue;
     }
     const auto vss_number_e =
-        instance.n().max_vss_on_edge(e_pair.first.value());
-    if (instance.n().max_vss_on_edge(e_pair.second.value()) != vss_number_e) {
+        instance->const_n().max_vss_on_edge(e_pair.first.value());
+    if (instance->const_n().max_vss_on_edge(e_pair.second.value()) !=
+        vss_number_e) {
       throw exceptions::ConsistencyException(
           "VSS number of edges " + std::to_string(e_pair.first.value()) +
           " and " + std::to_string(e_pair.second.value()) + " do not match");
     }
-    const auto& e_len = instance.n().get_edge(e_pair.first.value()).length;
+    const auto& e_len =
+        instance->const_n().get_edge(e_pair.first.value()).length;
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
       model->addConstr(
-          vars["b_pos"](breakable_edge_indices[e_pair.first.value()], vss) +
-              vars["b_pos"](breakable_edge_indices[e_pair.second.value()], vss),
+          vars[Var::BPos](breakable_edge_indices[e_pair.first.value()], vss) +
+              vars[Var::BPos](breakable_edge_indices[e_pair.second.value()],
+                              vss),
           GRB_EQUAL, e_len,
-          "b_pos_reverse_" + std::to_string(e_pair.first.value()) + "_" +
-              std::to_string(vss) + "_" +
-              std::to_string(e_pair.second.value()) + "_" +
-              std::to_string(vss));
+          name("b_pos_reverse_", e_pair.first.value(), "_", vss, "_",
+               e_pair.second.value(), "_", vss));
     }
   }
 }
@@ -856,24 +840,20 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // Border only usable by a train if it is on the edge
   for (size_t e_index = 0; e_index < breakable_edges.size(); ++e_index) {
     const auto& e = breakable_edges[e_index];
-    for (const auto& tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto vss_number_e = instance.n().max_vss_on_edge(e);
+    for (const auto& tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto vss_number_e = instance->const_n().max_vss_on_edge(e);
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
           // x(tr,t,e) >= b_front(tr,t,e_index,vss)
-          model->addConstr(vars["x"](tr, t, e), GRB_GREATER_EQUAL,
-                           vars["b_front"](tr, t, e_index, vss),
-                           "x_b_front_" + std::to_string(tr) + "_" +
-                               std::to_string(t) + "_" + std::to_string(e) +
-                               "_" + std::to_string(vss));
+          model->addConstr(vars[Var::X](tr, t, e), GRB_GREATER_EQUAL,
+                           vars[Var::BFront](tr, t, e_index, vss),
+                           name("x_b_front_", tr, "_", t, "_", e, "_", vss));
           // x(tr,t,e) >= b_rear(tr,t,e_index,vss)
-          if (instance.get_train_list().get_train(tr).tim) {
-            model->addConstr(vars["x"](tr, t, e), GRB_GREATER_EQUAL,
-                             vars["b_rear"](tr, t, e_index, vss),
-                             "x_b_rear_" + std::to_string(tr) + "_" +
-                                 std::to_string(t) + "_" + std::to_string(e) +
-                                 "_" + std::to_string(vss));
+          if (instance->get_train_list().get_train(tr).tim) {
+            model->addConstr(vars[Var::X](tr, t, e), GRB_GREATER_EQUAL,
+                             vars[Var::BRear](tr, t, e_index, vss),
+                             name("x_b_rear_", tr, "_", t, "_", e, "_", vss));
           }
         }
       }
@@ -883,8 +863,8 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // Correct number of borders
   for (size_t e_index = 0; e_index < breakable_edges.size(); ++e_index) {
     const auto& e            = breakable_edges[e_index];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& tr_on_e      = instance.trains_on_edge(e, this->fix_routes);
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& tr_on_e      = instance->trains_on_edge(e, this->fix_routes);
     for (size_t t = 0; t < num_t; ++t) {
       // sum_(tr,vss) b_front(tr, t, e_index, vss) >= sum_(tr) x(tr, t, e) - 1
       // sum_(tr,vss) b_rear(tr, t, e_index, vss) >= sum_(tr) x(tr, t, e) - 1
@@ -893,28 +873,27 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       GRBLinExpr rhs               = -1;
       bool       create_constraint = false;
       for (const auto& tr :
-           instance.trains_at_t(static_cast<int>(t) * dt, tr_on_e)) {
+           instance->trains_at_t(static_cast<int>(t) * dt, tr_on_e)) {
         create_constraint = true;
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
-          lhs_front += vars["b_front"](tr, t, e_index, vss);
-          if (instance.get_train_list().get_train(tr).tim) {
-            lhs_rear += vars["b_rear"](tr, t, e_index, vss);
+          lhs_front += vars[Var::BFront](tr, t, e_index, vss);
+          if (instance->get_train_list().get_train(tr).tim) {
+            lhs_rear += vars[Var::BRear](tr, t, e_index, vss);
           }
         }
-        rhs += vars["x"](tr, t, e);
+        rhs += vars[Var::X](tr, t, e);
       }
       if (create_constraint) {
         model->addConstr(lhs_front, GRB_GREATER_EQUAL, rhs,
-                         "b_front_correct_number_" + std::to_string(t) + "_" +
-                             std::to_string(e) + "_" + std::to_string(e_index));
+                         name("b_front_correct_number_", t, "_", e, "_",
+                              e_index));
         model->addConstr(lhs_rear, GRB_GREATER_EQUAL, rhs,
-                         "b_rear_correct_number_" + std::to_string(t) + "_" +
-                             std::to_string(e) + "_" + std::to_string(e_index));
+                         name("b_rear_correct_number_", t, "_", e, "_",
+                              e_index));
         // lhs_front = lhs_rear
         model->addConstr(lhs_front, GRB_EQUAL, lhs_rear,
-                         "b_front_rear_correct_number_equal_" +
-                             std::to_string(t) + "_" + std::to_string(e) + "_" +
-                             std::to_string(e_index));
+                         name("b_front_rear_correct_number_equal_", t, "_", e,
+                              "_", e_index));
       }
     }
   }
@@ -927,30 +906,29 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       // sum_(e,vss) b_rear(tr, t, e_index, vss) <= 1
       GRBLinExpr lhs_front = 0;
       GRBLinExpr lhs_rear  = 0;
-      for (const auto& e : instance.edges_used_by_train(tr, this->fix_routes)) {
+      for (const auto& e :
+           instance->edges_used_by_train(tr, this->fix_routes)) {
         const auto& e_index      = breakable_edge_indices[e];
-        const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+        const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
-          lhs_front += vars["b_front"](tr, t, e_index, vss);
-          if (instance.get_train_list().get_train(tr).tim) {
-            lhs_rear += vars["b_rear"](tr, t, e_index, vss);
+          lhs_front += vars[Var::BFront](tr, t, e_index, vss);
+          if (instance->get_train_list().get_train(tr).tim) {
+            lhs_rear += vars[Var::BRear](tr, t, e_index, vss);
           }
         }
       }
       model->addConstr(lhs_front, GRB_LESS_EQUAL, 1,
-                       "b_front_at_most_one_" + std::to_string(tr) + "_" +
-                           std::to_string(t));
+                       name("b_front_at_most_one_", tr, "_", t));
       model->addConstr(lhs_rear, GRB_LESS_EQUAL, 1,
-                       "b_rear_at_most_one_" + std::to_string(tr) + "_" +
-                           std::to_string(t));
+                       name("b_rear_at_most_one_", tr, "_", t));
     }
   }
 
   // A border must be both front and rear or nothing
   for (size_t e_index = 0; e_index < breakable_edges.size(); ++e_index) {
     const auto& e            = breakable_edges[e_index];
-    const auto  tr_on_e      = instance.trains_on_edge(e, this->fix_routes);
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+    const auto  tr_on_e      = instance->trains_on_edge(e, this->fix_routes);
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
     for (size_t t = 0; t < num_t; ++t) {
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
         // sum_tr b_front(tr, t, e_index, vss) = sum_tr b_rear(tr, t, e_index,
@@ -958,18 +936,16 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         GRBLinExpr lhs = 0;
         GRBLinExpr rhs = 0;
         for (const auto& tr :
-             instance.trains_at_t(static_cast<int>(t) * dt, tr_on_e)) {
-          lhs += vars["b_front"](tr, t, e_index, vss);
-          if (instance.get_train_list().get_train(tr).tim) {
-            rhs += vars["b_rear"](tr, t, e_index, vss);
+             instance->trains_at_t(static_cast<int>(t) * dt, tr_on_e)) {
+          lhs += vars[Var::BFront](tr, t, e_index, vss);
+          if (instance->get_train_list().get_train(tr).tim) {
+            rhs += vars[Var::BRear](tr, t, e_index, vss);
           }
         }
         model->addConstr(lhs, GRB_EQUAL, rhs,
-                         "b_front_rear_" + std::to_string(t) + "_" +
-                             std::to_string(e) + "_" + std::to_string(vss));
+                         name("b_front_rear_", t, "_", e, "_", vss));
         model->addConstr(rhs, GRB_LESS_EQUAL, 1,
-                         "b_front_rear_limit_" + std::to_string(t) + "_" +
-                             std::to_string(e) + "_" + std::to_string(vss));
+                         name("b_front_rear_limit_", t, "_", e, "_", vss));
       }
     }
   }
@@ -977,15 +953,16 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // A border is only usable if the VSS is used
   for (size_t e_index = 0; e_index < breakable_edges.size(); ++e_index) {
     const auto& e = breakable_edges[e_index];
-    for (const auto& tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto vss_number_e = instance.n().max_vss_on_edge(e);
+    for (const auto& tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto vss_number_e = instance->const_n().max_vss_on_edge(e);
       // Get index of e in relevant_edges array
       const auto find_index =
           std::find(relevant_edges.begin(), relevant_edges.end(), e);
       auto e_index_relevant = find_index - relevant_edges.begin();
       // If edge not found check reverse edge
       if (find_index == relevant_edges.end()) {
-        const auto reverse_e = instance.n().get_reverse_edge_index(e).value();
+        const auto reverse_e =
+            instance->const_n().get_reverse_edge_index(e).value();
         const auto find_index_reverse =
             std::find(relevant_edges.begin(), relevant_edges.end(), reverse_e);
         if (find_index_reverse == relevant_edges.end()) {
@@ -1001,41 +978,37 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         for (size_t vss = 0; vss < vss_number_e; ++vss) {
           if (vss_model.get_model_type() == vss::ModelType::Continuous) {
             // b_front(tr, t, e_index, vss) <= b_used(e_index_relevant, vss)
-            model->addConstr(vars["b_front"](tr, t, e_index, vss),
+            model->addConstr(vars[Var::BFront](tr, t, e_index, vss),
                              GRB_LESS_EQUAL,
-                             vars["b_used"](e_index_relevant, vss),
-                             "b_front_b_used_" + std::to_string(tr) + "_" +
-                                 std::to_string(t) + "_" + std::to_string(e) +
-                                 "_" + std::to_string(vss));
+                             vars[Var::BUsed](e_index_relevant, vss),
+                             name("b_front_b_used_", tr, "_", t, "_", e, "_",
+                                  vss));
             // b_rear(tr, t, e_index, vss) <= b_used(e_index_relevant, vss)
-            if (instance.get_train_list().get_train(tr).tim) {
-              model->addConstr(vars["b_rear"](tr, t, e_index, vss),
+            if (instance->get_train_list().get_train(tr).tim) {
+              model->addConstr(vars[Var::BRear](tr, t, e_index, vss),
                                GRB_LESS_EQUAL,
-                               vars["b_used"](e_index_relevant, vss),
-                               "b_rear_b_used_" + std::to_string(tr) + "_" +
-                                   std::to_string(t) + "_" + std::to_string(e) +
-                                   "_" + std::to_string(vss));
+                               vars[Var::BUsed](e_index_relevant, vss),
+                               name("b_rear_b_used_", tr, "_", t, "_", e, "_",
+                                    vss));
             }
           } else if (vss_model.get_model_type() == vss::ModelType::Inferred) {
             // b_front(tr, t, e_index, vss) <=
             // (num_vss_segments(e_index_relevant) - 1) / (vss + 1)
-            model->addConstr(vars["b_front"](tr, t, e_index, vss),
+            model->addConstr(vars[Var::BFront](tr, t, e_index, vss),
                              GRB_LESS_EQUAL,
-                             (vars["num_vss_segments"](e_index_relevant) - 1) /
+                             (vars[Var::NumVssSegments](e_index_relevant) - 1) /
                                  (static_cast<double>(vss) + 1),
-                             "b_front_num_vss_segments_" + std::to_string(tr) +
-                                 "_" + std::to_string(t) + "_" +
-                                 std::to_string(e) + "_" + std::to_string(vss));
+                             name("b_front_num_vss_segments_", tr, "_", t, "_",
+                                  e, "_", vss));
             // b_rear(tr, t, e_index, vss) <=
             // (num_vss_segments(e_index_relevant) - 1) / (vss + 1)
-            if (instance.get_train_list().get_train(tr).tim) {
+            if (instance->get_train_list().get_train(tr).tim) {
               model->addConstr(
-                  vars["b_rear"](tr, t, e_index, vss), GRB_LESS_EQUAL,
-                  (vars["num_vss_segments"](e_index_relevant) - 1) /
+                  vars[Var::BRear](tr, t, e_index, vss), GRB_LESS_EQUAL,
+                  (vars[Var::NumVssSegments](e_index_relevant) - 1) /
                       (static_cast<double>(vss) + 1),
-                  "b_rear_num_vss_segments_" + std::to_string(tr) + "_" +
-                      std::to_string(t) + "_" + std::to_string(e) + "_" +
-                      std::to_string(vss));
+                  name("b_rear_num_vss_segments_", tr, "_", t, "_", e, "_",
+                       vss));
             }
           } else if (vss_model.get_model_type() ==
                      vss::ModelType::InferredAlt) {
@@ -1046,23 +1019,21 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
                  sep_type_index < vss_model.get_separation_functions().size();
                  ++sep_type_index) {
               for (size_t vss2 = 0; vss2 <= vss; ++vss2) {
-                rhs += vars["type_num_vss_segments"](e_index_relevant,
+                rhs += vars[Var::TypeNumVssSegments](e_index_relevant,
                                                      sep_type_index, vss2);
               }
             }
-            model->addConstr(vars["b_front"](tr, t, e_index, vss),
+            model->addConstr(vars[Var::BFront](tr, t, e_index, vss),
                              GRB_LESS_EQUAL, rhs,
-                             "b_front_num_vss_segments_" + std::to_string(tr) +
-                                 "_" + std::to_string(t) + "_" +
-                                 std::to_string(e) + "_" + std::to_string(vss));
+                             name("b_front_num_vss_segments_", tr, "_", t, "_",
+                                  e, "_", vss));
             // b_rear(tr, t, e_index, vss) <= sum
             // type_num_vss_segments(e_index_relevant, *, <= vss)
-            if (instance.get_train_list().get_train(tr).tim) {
+            if (instance->get_train_list().get_train(tr).tim) {
               model->addConstr(
-                  vars["b_rear"](tr, t, e_index, vss), GRB_LESS_EQUAL, rhs,
-                  "b_rear_num_vss_segments_" + std::to_string(tr) + "_" +
-                      std::to_string(t) + "_" + std::to_string(e) + "_" +
-                      std::to_string(vss));
+                  vars[Var::BRear](tr, t, e_index, vss), GRB_LESS_EQUAL, rhs,
+                  name("b_rear_num_vss_segments_", tr, "_", t, "_", e, "_",
+                       vss));
             }
           }
         }
@@ -1072,22 +1043,22 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   // At most one non-tim train can be on any breakable edge
   for (const auto& e : breakable_edges) {
-    const auto  tr_on_e = instance.trains_on_edge(e, this->fix_routes);
-    const auto& edge    = instance.n().get_edge(e);
-    const auto& v0      = instance.n().get_vertex(edge.source);
-    const auto& v1      = instance.n().get_vertex(edge.target);
+    const auto  tr_on_e = instance->trains_on_edge(e, this->fix_routes);
+    const auto& edge    = instance->const_n().get_edge(e);
+    const auto& v0      = instance->const_n().get_vertex(edge.source);
+    const auto& v1      = instance->const_n().get_vertex(edge.target);
     const auto  e_name  = "[" + v0.name + "," + v1.name + "]";
     for (size_t t = 0; t < num_t; ++t) {
       GRBLinExpr lhs = 0;
       for (const auto& tr :
-           instance.trains_at_t(static_cast<int>(t) * dt, tr_on_e)) {
-        if (!instance.get_train_list().get_train(tr).tim) {
-          lhs += vars["x"](tr, t, e);
+           instance->trains_at_t(static_cast<int>(t) * dt, tr_on_e)) {
+        if (!instance->get_train_list().get_train(tr).tim) {
+          lhs += vars[Var::X](tr, t, e);
         }
       }
       model->addConstr(lhs, GRB_LESS_EQUAL, 1,
-                       "non_tim_train_on_edge_" + e_name + "_" +
-                           std::to_string(static_cast<int>(t) * dt));
+                       name("non_tim_train_on_edge_", e_name, "_",
+                            static_cast<int>(t) * dt));
     }
   }
 }
@@ -1096,13 +1067,13 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     create_non_discretized_fraction_constraints() {
   for (size_t i = 0; i < relevant_edges.size(); ++i) {
     const auto& e            = relevant_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     const auto& breakable_e_index = breakable_edge_indices.at(e);
-    const auto& e_len             = instance.n().get_edge(e).length;
+    const auto& e_len             = instance->const_n().get_edge(e).length;
 
     if (vss_model.get_model_type() == vss::ModelType::Inferred) {
       // sum edge_type(i,*) = 1
@@ -1111,7 +1082,7 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       for (size_t sep_type_index = 0;
            sep_type_index < vss_model.get_separation_functions().size();
            ++sep_type_index) {
-        lhs_sum_edge_type += vars["edge_type"](i, sep_type_index);
+        lhs_sum_edge_type += vars[Var::EdgeType](i, sep_type_index);
         add_constraint_sum_edge_type = true;
         const auto& sep_func =
             vss_model.get_separation_functions().at(sep_type_index);
@@ -1125,16 +1096,16 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
             ypts[x] = sep_func(vss, x + 1);
           }
           model->addGenConstrPWL(
-              vars["num_vss_segments"](i),
-              vars["frac_vss_segments"](i, sep_type_index, vss),
+              vars[Var::NumVssSegments](i),
+              vars[Var::FracVssSegments](i, sep_type_index, vss),
               vss_number_e + 1, xpts.get(), ypts.get(),
-              "frac_vss_segments_value_constraint_" + edge_name + "_" +
-                  std::to_string(sep_type_index) + "_" + std::to_string(vss));
+              name("frac_vss_segments_value_constraint_", edge_name, "_",
+                   sep_type_index, "_", vss));
         }
       }
       if (add_constraint_sum_edge_type) {
         model->addConstr(lhs_sum_edge_type, GRB_EQUAL, 1,
-                         "sum_edge_type_" + edge_name);
+                         name("sum_edge_type_", edge_name));
       }
 
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
@@ -1144,7 +1115,7 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         for (size_t sep_type_index = 0;
              sep_type_index < vss_model.get_separation_functions().size();
              ++sep_type_index) {
-          lhs += vars["frac_type"](i, sep_type_index, vss);
+          lhs += vars[Var::FracType](i, sep_type_index, vss);
 
           // Make sure that frac_type(i, sep_type_index, vss) =
           // frac_vss_segments(i, sep_type_index, vss) * edge_type(i,
@@ -1153,35 +1124,35 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
           const double ub = 1;
           // frac_type = 0 if edge_type = 0
           model->addConstr(
-              lb * vars["edge_type"](i, sep_type_index), GRB_LESS_EQUAL,
-              vars["frac_type"](i, sep_type_index, vss),
-              "frac_type_0_lb_" + edge_name + "_" +
-                  std::to_string(sep_type_index) + "_" + std::to_string(vss));
+              lb * vars[Var::EdgeType](i, sep_type_index), GRB_LESS_EQUAL,
+              vars[Var::FracType](i, sep_type_index, vss),
+              name("frac_type_0_lb_", edge_name, "_", sep_type_index, "_",
+                   vss));
           model->addConstr(
-              vars["frac_type"](i, sep_type_index, vss), GRB_LESS_EQUAL,
-              ub * vars["edge_type"](i, sep_type_index),
-              "frac_type_0_ub_" + edge_name + "_" +
-                  std::to_string(sep_type_index) + "_" + std::to_string(vss));
+              vars[Var::FracType](i, sep_type_index, vss), GRB_LESS_EQUAL,
+              ub * vars[Var::EdgeType](i, sep_type_index),
+              name("frac_type_0_ub_", edge_name, "_", sep_type_index, "_",
+                   vss));
           // frac_type = frac_vss_segments if edge_type = 1
           model->addConstr(
-              (lb - ub) * (1 - vars["edge_type"](i, sep_type_index)),
+              (lb - ub) * (1 - vars[Var::EdgeType](i, sep_type_index)),
               GRB_LESS_EQUAL,
-              vars["frac_type"](i, sep_type_index, vss) -
-                  vars["frac_vss_segments"](i, sep_type_index, vss),
-              "frac_type_prod_lb_" + edge_name + "_" +
-                  std::to_string(sep_type_index) + "_" + std::to_string(vss));
+              vars[Var::FracType](i, sep_type_index, vss) -
+                  vars[Var::FracVssSegments](i, sep_type_index, vss),
+              name("frac_type_prod_lb_", edge_name, "_", sep_type_index, "_",
+                   vss));
           model->addConstr(
-              vars["frac_type"](i, sep_type_index, vss) -
-                  vars["frac_vss_segments"](i, sep_type_index, vss),
+              vars[Var::FracType](i, sep_type_index, vss) -
+                  vars[Var::FracVssSegments](i, sep_type_index, vss),
               GRB_LESS_EQUAL,
-              (ub - lb) * (1 - vars["edge_type"](i, sep_type_index)),
-              "frac_type_prod_ub_" + edge_name + "_" +
-                  std::to_string(sep_type_index) + "_" + std::to_string(vss));
+              (ub - lb) * (1 - vars[Var::EdgeType](i, sep_type_index)),
+              name("frac_type_prod_ub_", edge_name, "_", sep_type_index, "_",
+                   vss));
         }
         lhs *= e_len;
-        model->addConstr(lhs, GRB_EQUAL, vars["b_pos"](breakable_e_index, vss),
-                         "b_pos_limited_" + edge_name + "_" +
-                             std::to_string(vss));
+        model->addConstr(
+            lhs, GRB_EQUAL, vars[Var::BPos](breakable_e_index, vss),
+            name("b_pos_limited_", edge_name, "_", vss));
       }
     }
   }
@@ -1195,13 +1166,13 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   for (size_t i = 0; i < relevant_edges.size(); ++i) {
     const auto& e            = relevant_edges[i];
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
-    const auto& edge         = instance.n().get_edge(e);
-    const auto& edge_name    = "[" + instance.n().get_vertex(edge.source).name +
-                            "," + instance.n().get_vertex(edge.target).name +
-                            "]";
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge         = instance->const_n().get_edge(e);
+    const auto& edge_name    =
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     const auto& breakable_e_index = breakable_edge_indices.at(e);
-    const auto& e_len             = instance.n().get_edge(e).length;
+    const auto& e_len             = instance->const_n().get_edge(e).length;
 
     // Only choose one edge type and number per edge
     GRBLinExpr lhs_sum_edge_type = 0;
@@ -1210,11 +1181,11 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
          ++sep_type_index) {
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
         lhs_sum_edge_type +=
-            vars["type_num_vss_segments"](i, sep_type_index, vss);
+            vars[Var::TypeNumVssSegments](i, sep_type_index, vss);
       }
     }
     model->addConstr(lhs_sum_edge_type, GRB_LESS_EQUAL, 1,
-                     "sum_edge_vss_type_" + edge_name);
+                     name("sum_edge_vss_type_", edge_name));
 
     // Set b_pos accordingly
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
@@ -1225,13 +1196,12 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
         const auto& sep_func =
             vss_model.get_separation_functions().at(sep_type_index);
         for (size_t num_vss = 1; num_vss <= vss_number_e; ++num_vss) {
-          rhs += vars["type_num_vss_segments"](i, sep_type_index, num_vss - 1) *
+          rhs += vars[Var::TypeNumVssSegments](i, sep_type_index, num_vss - 1) *
                  e_len * sep_func(vss, num_vss + 1);
         }
       }
-      model->addConstr(vars["b_pos"](breakable_e_index, vss), GRB_EQUAL, rhs,
-                       "b_pos_alt_limited_" + edge_name + "_" +
-                           std::to_string(vss));
+      model->addConstr(vars[Var::BPos](breakable_e_index, vss), GRB_EQUAL, rhs,
+                       name("b_pos_alt_limited_", edge_name, "_", vss));
     }
   }
 }
@@ -1244,9 +1214,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // break_len(tr, t) = v(tr, t+1)^2 / (2*tr_deceleration)
   for (size_t tr = 0; tr < num_tr; ++tr) {
     const auto& tr_deceleration =
-        instance.get_train_list().get_train(tr).deceleration;
+        instance->get_train_list().get_train(tr).deceleration;
     const auto& tr_max_speed =
-        instance.get_train_list().get_train(tr).max_speed;
+        instance->get_train_list().get_train(tr).max_speed;
     if (this->use_pwl) {
       const int n = std::ceil(
           tr_max_speed / (2 * std::sqrt(2 * tr_deceleration * ABS_PWL_ERROR)));
@@ -1260,19 +1230,19 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
       }
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
-        model->addGenConstrPWL(vars["v"](tr, t + 1), vars["brakelen"](tr, t),
-                               n + 1, xpts.get(), ypts.get(),
-                               "brakelen_" + std::to_string(tr) + "_" +
-                                   std::to_string(t));
+        model->addGenConstrPWL(
+            vars[Var::V](tr, t + 1), vars[Var::Brakelen](tr, t), n + 1,
+            xpts.get(), ypts.get(),
+            name("brakelen_", tr, "_", t));
       }
     } else {
       for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
            ++t) {
-        model->addQConstr(vars["brakelen"](tr, t), GRB_EQUAL,
-                          (1 / (2 * tr_deceleration)) * vars["v"](tr, t + 1) *
-                              vars["v"](tr, t + 1),
-                          "brakelen_" + std::to_string(tr) + "_" +
-                              std::to_string(t));
+        model->addQConstr(vars[Var::Brakelen](tr, t), GRB_EQUAL,
+                          (1 / (2 * tr_deceleration)) *
+                              vars[Var::V](tr, t + 1) *
+                              vars[Var::V](tr, t + 1),
+                          name("brakelen_", tr, "_", t));
       }
     }
   }
@@ -1285,27 +1255,26 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    */
 
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_speed = instance.get_train_list().get_train(tr).max_speed;
-    for (const auto e : instance.edges_used_by_train(tr, this->fix_routes)) {
-      const auto& max_speed = instance.n().get_edge(e).max_speed;
+    const auto& tr_speed = instance->get_train_list().get_train(tr).max_speed;
+    for (const auto e : instance->edges_used_by_train(tr, this->fix_routes)) {
+      const auto& max_speed = instance->const_n().get_edge(e).max_speed;
       if (max_speed < tr_speed) {
         for (size_t t = train_interval[tr].first;
              t <= train_interval[tr].second; ++t) {
           // v(tr,t+1) <= max_speed + (tr_speed - max_speed) * (1 - x(tr,t,e))
           model->addConstr(
-              vars["v"](tr, t + 1), GRB_LESS_EQUAL,
-              max_speed + (tr_speed - max_speed) * (1 - vars["x"](tr, t, e)),
-              "v_max_speed_" + std::to_string(tr) + "_" +
-                  std::to_string((t + 1) * dt) + "_" + std::to_string(e));
+              vars[Var::V](tr, t + 1), GRB_LESS_EQUAL,
+              max_speed + (tr_speed - max_speed) * (1 - vars[Var::X](tr, t, e)),
+              name("v_max_speed_", tr, "_", (t + 1) * dt, "_", e));
           // If brakelens are included the speed is reduced before entering an
           // edge, otherwise also include v(tr,t) <= max_speed + (tr_speed -
           // max_speed) * (1 - x(tr,t,e))
           if (!this->include_braking_curves) {
             model->addConstr(
-                vars["v"](tr, t), GRB_LESS_EQUAL,
-                max_speed + (tr_speed - max_speed) * (1 - vars["x"](tr, t, e)),
-                "v_max_speed2_" + std::to_string(tr) + "_" +
-                    std::to_string(t * dt) + "_" + std::to_string(e));
+                vars[Var::V](tr, t), GRB_LESS_EQUAL,
+                max_speed +
+                    (tr_speed - max_speed) * (1 - vars[Var::X](tr, t, e)),
+                name("v_max_speed2_", tr, "_", t * dt, "_", e));
           }
         }
       }
@@ -1323,45 +1292,41 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   // Connect y_sec and x
   for (size_t t = 0; t < num_t; ++t) {
-    const auto tr_at_t = instance.trains_at_t(static_cast<int>(t) * dt);
+    const auto tr_at_t = instance->trains_at_t(static_cast<int>(t) * dt);
     for (size_t i = 0; i < fwd_bwd_sections.size(); ++i) {
       // y_sec_fwd(t,i) >= x(tr, t, e) for all e in fwd_bwd_sections[i].first
       // and applicable trains y_sec_fwd(t,i) <= sum x(tr, t, e)
       GRBLinExpr rhs = 0;
       for (const auto& e : fwd_bwd_sections[i].first) {
         const auto tr_on_edge =
-            instance.trains_on_edge(e, this->fix_routes, tr_at_t);
+            instance->trains_on_edge(e, this->fix_routes, tr_at_t);
         for (const auto& tr : tr_on_edge) {
-          rhs += vars["x"](tr, t, e);
-          model->addConstr(vars["y_sec_fwd"](t, i), GRB_GREATER_EQUAL,
-                           vars["x"](tr, t, e),
-                           "y_sec_fwd_linker_1_" + std::to_string(t) + "_" +
-                               std::to_string(i) + "_" + std::to_string(tr) +
-                               "_" + std::to_string(e));
+          rhs += vars[Var::X](tr, t, e);
+          model->addConstr(vars[Var::YSecFwd](t, i), GRB_GREATER_EQUAL,
+                           vars[Var::X](tr, t, e),
+                           name("y_sec_fwd_linker_1_", t, "_", i, "_", tr, "_",
+                                e));
         }
       }
-      model->addConstr(vars["y_sec_fwd"](t, i), GRB_LESS_EQUAL, rhs,
-                       "y_sec_fwd_linker_2_" + std::to_string(t) + "_" +
-                           std::to_string(i));
+      model->addConstr(vars[Var::YSecFwd](t, i), GRB_LESS_EQUAL, rhs,
+                       name("y_sec_fwd_linker_2_", t, "_", i));
 
       // y_sec_bwd(t,i) >= x(tr, t, e) for all e in fwd_bwd_sections[i].second
       // and applicable trains y_sec_bwd(t,i) <= sum x(tr, t, e)
       rhs = 0;
       for (const auto& e : fwd_bwd_sections[i].second) {
         const auto tr_on_edge =
-            instance.trains_on_edge(e, this->fix_routes, tr_at_t);
+            instance->trains_on_edge(e, this->fix_routes, tr_at_t);
         for (const auto& tr : tr_on_edge) {
-          rhs += vars["x"](tr, t, e);
-          model->addConstr(vars["y_sec_bwd"](t, i), GRB_GREATER_EQUAL,
-                           vars["x"](tr, t, e),
-                           "y_sec_bwd_linker_1_" + std::to_string(t) + "_" +
-                               std::to_string(i) + "_" + std::to_string(tr) +
-                               "_" + std::to_string(e));
+          rhs += vars[Var::X](tr, t, e);
+          model->addConstr(vars[Var::YSecBwd](t, i), GRB_GREATER_EQUAL,
+                           vars[Var::X](tr, t, e),
+                           name("y_sec_bwd_linker_1_", t, "_", i, "_", tr, "_",
+                                e));
         }
       }
-      model->addConstr(vars["y_sec_bwd"](t, i), GRB_LESS_EQUAL, rhs,
-                       "y_sec_bwd_linker_2_" + std::to_string(t) + "_" +
-                           std::to_string(i));
+      model->addConstr(vars[Var::YSecBwd](t, i), GRB_LESS_EQUAL, rhs,
+                       name("y_sec_bwd_linker_2_", t, "_", i));
     }
   }
 
@@ -1370,8 +1335,9 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     for (size_t i = 0; i < fwd_bwd_sections.size(); ++i) {
       // y_sec_fwd(t,i) + y_sec_bwd(t, i) <= 1
       model->addConstr(
-          vars["y_sec_fwd"](t, i) + vars["y_sec_bwd"](t, i), GRB_LESS_EQUAL, 1,
-          "y_sec_fwd_bwd_" + std::to_string(t) + "_" + std::to_string(i));
+          vars[Var::YSecFwd](t, i) + vars[Var::YSecBwd](t, i),
+          GRB_LESS_EQUAL, 1,
+          name("y_sec_fwd_bwd_", t, "_", i));
     }
   }
 }
@@ -1396,7 +1362,7 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
    */
   for (const auto& vss_section : no_border_vss_sections) {
     const auto vss_section_sorted =
-        instance.n().combine_reverse_edges(vss_section, true);
+        instance->const_n().combine_reverse_edges(vss_section, true);
     bool fwd_found = false;
     bool bwd_found = false;
     for (size_t i = 0;
@@ -1444,8 +1410,8 @@ double cda_rail::solver::mip_based::VSSGenTimetableSolver::get_max_brakelen(
    * Returns the maximum braking distance of a train.
    */
   const auto& tr_deceleration =
-      instance.get_train_list().get_train(tr).deceleration;
-  const auto& tr_max_speed = instance.get_train_list().get_train(tr).max_speed;
+      instance->get_train_list().get_train(tr).deceleration;
+  const auto& tr_max_speed = instance->get_train_list().get_train(tr).max_speed;
   return tr_max_speed * tr_max_speed / (2 * tr_deceleration);
 }
 
@@ -1454,31 +1420,32 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   /**
    * General boundary conditions, i.e., speed
    */
-  auto train_list = instance.get_train_list();
+  auto train_list = instance->get_train_list();
   for (size_t i = 0; i < num_tr; ++i) {
     auto tr_name       = train_list.get_train(i).name;
-    auto initial_speed = instance.get_schedule(tr_name).get_v_0();
-    auto final_speed   = instance.get_schedule(tr_name).get_v_n();
+    auto initial_speed = instance->get_schedule(tr_name).get_v_0();
+    auto final_speed   = instance->get_schedule(tr_name).get_v_n();
     // initial_speed: v(train_interval[i].first) = initial_speed
-    model->addConstr(vars["v"](i, train_interval[i].first) == initial_speed,
-                     "initial_speed_" + tr_name);
+    model->addConstr(vars[Var::V](i, train_interval[i].first) == initial_speed,
+                     name("initial_speed_", tr_name));
     // final_speed: v(train_interval[i].second) = final_speed
-    model->addConstr(vars["v"](i, train_interval[i].second + 1) == final_speed,
-                     "final_speed_" + tr_name);
+    model->addConstr(vars[Var::V](i, train_interval[i].second + 1) ==
+                         final_speed,
+                     name("final_speed_", tr_name));
   }
 }
 
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     create_only_stop_at_vss_variables() {
-  vars["stopped"] = MultiArray<GRBVar>(num_tr, num_t);
+  vars[Var::Stopped] = MultiArray<GRBVar>(num_tr, num_t);
 
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
     for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
          ++t) {
-      vars["stopped"](tr, t) =
+      vars[Var::Stopped](tr, t) =
           model->addVar(0, 1, 0, GRB_BINARY,
-                        "stopped_" + tr_name + "_" + std::to_string(t * dt));
+                        name("stopped_", tr_name, "_", t * dt));
     }
   }
 
@@ -1495,23 +1462,23 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
     create_non_discretized_general_only_stop_at_vss_constraints() {
   // At most one b_tight can be true per train and time
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
     for (size_t t = train_interval[tr].first + 2;
          t <= train_interval[tr].second; ++t) {
       GRBLinExpr lhs = 0;
-      for (const auto& e : instance.edges_used_by_train(tr, this->fix_routes)) {
-        if (!instance.const_n().get_edge(e).breakable) {
+      for (const auto& e :
+           instance->edges_used_by_train(tr, this->fix_routes)) {
+        if (!instance->const_n().get_edge(e).breakable) {
           continue;
         }
-        const auto& vss_e     = instance.const_n().max_vss_on_edge(e);
+        const auto& vss_e     = instance->const_n().max_vss_on_edge(e);
         const auto& e_b_index = breakable_edge_indices.at(e);
         for (size_t vss = 0; vss < vss_e; ++vss) {
-          lhs += vars["b_tight"](tr, t, e_b_index, vss);
+          lhs += vars[Var::BTight](tr, t, e_b_index, vss);
         }
       }
       model->addConstr(lhs, GRB_LESS_EQUAL, 1,
-                       "b_tight_max_one_" + tr_name + "_" +
-                           std::to_string(t * dt));
+                       name("b_tight_max_one_", tr_name, "_", t * dt));
     }
   }
 
@@ -1519,22 +1486,22 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // and time
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e     = breakable_edges[i];
-    const auto& vss_e = instance.const_n().max_vss_on_edge(e);
-    const auto& edge  = instance.const_n().get_edge(e);
+    const auto& vss_e = instance->const_n().max_vss_on_edge(e);
+    const auto& edge  = instance->const_n().get_edge(e);
     const auto& edge_name =
-        "[" + instance.const_n().get_vertex(edge.source).name + "," +
-        instance.const_n().get_vertex(edge.target).name + "]";
-    for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto& tr_name = instance.get_train_list().get_train(tr).name;
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
+    for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto& tr_name = instance->get_train_list().get_train(tr).name;
       for (size_t t = train_interval[tr].first + 2;
            t <= train_interval[tr].second; ++t) {
-        GRBLinExpr lhs = vars["e_tight"](tr, t, e);
+        GRBLinExpr lhs = vars[Var::ETight](tr, t, e);
         for (size_t vss = 0; vss < vss_e; ++vss) {
-          lhs += vars["b_tight"](tr, t, i, vss);
+          lhs += vars[Var::BTight](tr, t, i, vss);
         }
         model->addConstr(lhs, GRB_LESS_EQUAL, 1,
-                         "b_tight_e_tight_max_one_" + tr_name + "_" +
-                             std::to_string(t * dt) + "_" + edge_name);
+                         name("b_tight_e_tight_max_one_", tr_name, "_", t * dt,
+                              "_", edge_name));
       }
     }
   }
@@ -1542,31 +1509,31 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // On every edge at least one b_tight or e_tight must be one if train is
   // present and speed is 0 per train, time, and edge
   for (size_t e = 0; e < num_edges; ++e) {
-    const auto& edge = instance.const_n().get_edge(e);
+    const auto& edge = instance->const_n().get_edge(e);
     const auto& edge_name =
-        "[" + instance.const_n().get_vertex(edge.source).name + "," +
-        instance.const_n().get_vertex(edge.target).name + "]";
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
     std::optional<size_t> breakable_e_index;
     std::optional<size_t> vss_e;
     if (edge.breakable) {
       breakable_e_index = breakable_edge_indices.at(e);
-      vss_e             = instance.const_n().max_vss_on_edge(e);
+      vss_e             = instance->const_n().max_vss_on_edge(e);
     }
 
-    for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto& tr_name = instance->get_train_list().get_train(tr).name;
       for (size_t t = train_interval[tr].first + 2;
            t <= train_interval[tr].second; ++t) {
-        GRBLinExpr lhs = vars["e_tight"](tr, t, e);
+        GRBLinExpr lhs = vars[Var::ETight](tr, t, e);
         if (breakable_e_index.has_value()) {
           for (size_t vss = 0; vss < vss_e.value(); ++vss) {
-            lhs += vars["b_tight"](tr, t, breakable_e_index.value(), vss);
+            lhs += vars[Var::BTight](tr, t, breakable_e_index.value(), vss);
           }
         }
         model->addConstr(lhs, GRB_GREATER_EQUAL,
-                         vars["x"](tr, t - 1, e) - vars["stopped"](tr, t),
-                         "b_tight_e_tight_min_one_" + tr_name + "_" +
-                             std::to_string(t * dt) + "_" + edge_name);
+                         vars[Var::X](tr, t - 1, e) - vars[Var::Stopped](tr, t),
+                         name("b_tight_e_tight_min_one_", tr_name, "_", t * dt,
+                              "_", edge_name));
       }
     }
   }
@@ -1574,20 +1541,20 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // On every edge that is not breakable and does not end with a border at least
   // one out edge has to be used if it is used and v = 0
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
     const auto& edge_used_tr =
-        instance.edges_used_by_train(tr, this->fix_routes);
+        instance->edges_used_by_train(tr, this->fix_routes);
     for (size_t e : edge_used_tr) {
-      const auto& edge = instance.const_n().get_edge(e);
+      const auto& edge = instance->const_n().get_edge(e);
       const auto& edge_name =
-          "[" + instance.const_n().get_vertex(edge.source).name + "," +
-          instance.const_n().get_vertex(edge.target).name + "]";
-      if (edge.breakable || instance.const_n().get_vertex(edge.target).type !=
+          "[" + instance->const_n().get_vertex(edge.source).name + "," +
+          instance->const_n().get_vertex(edge.target).name + "]";
+      if (edge.breakable || instance->const_n().get_vertex(edge.target).type !=
                                 VertexType::NoBorder) {
         continue;
       }
 
-      const auto&         delta_out = instance.const_n().get_successors(e);
+      const auto&         delta_out = instance->const_n().get_successors(e);
       std::vector<size_t> delta_out_tr;
       for (const auto& e_out : delta_out) {
         if (std::find(edge_used_tr.begin(), edge_used_tr.end(), e_out) !=
@@ -1600,12 +1567,12 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
            t <= train_interval[tr].second; ++t) {
         GRBLinExpr lhs = 0;
         for (const auto& e_out : delta_out_tr) {
-          lhs += vars["x"](tr, t - 1, e_out);
+          lhs += vars[Var::X](tr, t - 1, e_out);
         }
         model->addConstr(lhs, GRB_GREATER_EQUAL,
-                         vars["x"](tr, t - 1, e) - vars["stopped"](tr, t),
-                         "no_stop_on_non-border_edge_ending_" + tr_name + "_" +
-                             std::to_string(t * dt) + "_" + edge_name);
+                         vars[Var::X](tr, t - 1, e) - vars[Var::Stopped](tr, t),
+                         name("no_stop_on_non-border_edge_ending_", tr_name,
+                              "_", t * dt, "_", edge_name));
       }
     }
   }
@@ -1613,26 +1580,25 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // b cannot be tight if it is not front. If v = 0 then it has to be
   for (size_t i = 0; i < breakable_edges.size(); ++i) {
     const auto& e    = breakable_edges[i];
-    const auto& edge = instance.const_n().get_edge(e);
+    const auto& edge = instance->const_n().get_edge(e);
     const auto& edge_name =
-        "[" + instance.const_n().get_vertex(edge.source).name + "," +
-        instance.const_n().get_vertex(edge.target).name + "]";
-    const auto& vss_e = instance.const_n().max_vss_on_edge(e);
-    for (size_t tr : instance.trains_on_edge(e, this->fix_routes)) {
-      const auto& tr_name = instance.get_train_list().get_train(tr).name;
+        "[" + instance->const_n().get_vertex(edge.source).name + "," +
+        instance->const_n().get_vertex(edge.target).name + "]";
+    const auto& vss_e = instance->const_n().max_vss_on_edge(e);
+    for (size_t tr : instance->trains_on_edge(e, this->fix_routes)) {
+      const auto& tr_name = instance->get_train_list().get_train(tr).name;
       for (size_t t = train_interval[tr].first + 2;
            t <= train_interval[tr].second; ++t) {
         for (size_t vss = 0; vss < vss_e; ++vss) {
-          model->addConstr(vars["b_tight"](tr, t, i, vss), GRB_LESS_EQUAL,
-                           vars["b_front"](tr, t, i, vss),
-                           "b_tight_not_front_1_" + tr_name + "_" +
-                               std::to_string(t * dt) + "_" + edge_name + "_" +
-                               std::to_string(vss));
+          model->addConstr(vars[Var::BTight](tr, t, i, vss), GRB_LESS_EQUAL,
+                           vars[Var::BFront](tr, t, i, vss),
+                           name("b_tight_not_front_1_", tr_name, "_", t * dt,
+                                "_", edge_name, "_", vss));
           model->addConstr(
-              vars["b_tight"](tr, t, i, vss), GRB_GREATER_EQUAL,
-              vars["b_front"](tr, t, i, vss) - vars["stopped"](tr, t),
-              "b_tight_not_front_2_" + tr_name + "_" + std::to_string(t * dt) +
-                  "_" + edge_name + "_" + std::to_string(vss));
+              vars[Var::BTight](tr, t, i, vss), GRB_GREATER_EQUAL,
+              vars[Var::BFront](tr, t, i, vss) - vars[Var::Stopped](tr, t),
+              name("b_tight_not_front_2_", tr_name, "_", t * dt, "_", edge_name,
+                   "_", vss));
         }
       }
     }
@@ -1640,81 +1606,95 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::
 
   // At least any one tight if speed is 0
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    const auto& tr_name = instance.get_train_list().get_train(tr).name;
+    const auto& tr_name = instance->get_train_list().get_train(tr).name;
     const auto& edge_used_tr =
-        instance.edges_used_by_train(tr, this->fix_routes);
+        instance->edges_used_by_train(tr, this->fix_routes);
     for (size_t t = train_interval[tr].first + 2;
          t <= train_interval[tr].second; ++t) {
       GRBLinExpr lhs = 0;
       for (size_t e : edge_used_tr) {
-        lhs += vars["e_tight"](tr, t, e);
-        const auto& edge = instance.const_n().get_edge(e);
+        lhs += vars[Var::ETight](tr, t, e);
+        const auto& edge = instance->const_n().get_edge(e);
         if (!edge.breakable) {
           continue;
         }
-        const auto& vss_e = instance.const_n().max_vss_on_edge(e);
+        const auto& vss_e = instance->const_n().max_vss_on_edge(e);
         for (size_t vss = 0; vss < vss_e; ++vss) {
-          lhs += vars["b_tight"](tr, t, breakable_edge_indices.at(e), vss);
+          lhs += vars[Var::BTight](tr, t, breakable_edge_indices.at(e), vss);
         }
       }
-      model->addConstr(lhs, GRB_GREATER_EQUAL, 1 - vars["stopped"](tr, t),
-                       "at_least_one_tight_if_stopped_" + tr_name + "_" +
-                           std::to_string(t * dt));
+      model->addConstr(lhs, GRB_GREATER_EQUAL, 1 - vars[Var::Stopped](tr, t),
+                       name("at_least_one_tight_if_stopped_", tr_name, "_",
+                            t * dt));
     }
   }
 }
 
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::create_variables() {
   PLOGD << "Create general variables";
-  create_general_variables();
+  telemetry.measure("create_general_variables",
+                    [this]() { create_general_variables(); });
   if (this->fix_routes) {
     PLOGD << "Create fixed routes variables";
-    create_fixed_routes_variables();
+    telemetry.measure("create_fixed_routes_variables",
+                      [this]() { create_fixed_routes_variables(); });
   } else {
     PLOGD << "Create free routes variables";
-    create_free_routes_variables();
+    telemetry.measure("create_free_routes_variables",
+                      [this]() { create_free_routes_variables(); });
   }
   if (this->vss_model.get_model_type() == vss::ModelType::Discrete) {
     PLOGD << "Create discretized VSS variables";
-    create_discretized_variables();
+    telemetry.measure("create_discretized_variables",
+                      [this]() { create_discretized_variables(); });
   } else {
     PLOGD << "Create non-discretized VSS variables";
-    create_non_discretized_variables();
+    telemetry.measure("create_non_discretized_variables",
+                      [this]() { create_non_discretized_variables(); });
   }
   if (this->include_braking_curves) {
     PLOGD << "Create braking distance variables";
-    create_brakelen_variables();
+    telemetry.measure("create_brakelen_variables",
+                      [this]() { create_brakelen_variables(); });
   }
   if (vss_model.get_only_stop_at_vss()) {
     PLOGD << "Create only stop at VSS variables";
-    create_only_stop_at_vss_variables();
+    telemetry.measure("create_only_stop_at_vss_variables",
+                      [this]() { create_only_stop_at_vss_variables(); });
   }
 }
 
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::create_constraints() {
   PLOGD << "Create general constraints";
-  create_general_constraints();
+  telemetry.measure("create_general_constraints",
+                    [this]() { create_general_constraints(); });
   if (this->fix_routes) {
     PLOGD << "Create fixed routes constraints";
-    create_fixed_routes_constraints();
+    telemetry.measure("create_fixed_routes_constraints",
+                      [this]() { create_fixed_routes_constraints(); });
   } else {
     PLOGD << "Create free routes constraints";
-    create_free_routes_constraints();
+    telemetry.measure("create_free_routes_constraints",
+                      [this]() { create_free_routes_constraints(); });
   }
   if (this->vss_model.get_model_type() == vss::ModelType::Discrete) {
     PLOGD << "Create discretized VSS constraints";
-    create_discretized_constraints();
+    telemetry.measure("create_discretized_constraints",
+                      [this]() { create_discretized_constraints(); });
   } else {
     PLOGD << "Create non-discretized VSS constraints";
-    create_non_discretized_constraints();
+    telemetry.measure("create_non_discretized_constraints",
+                      [this]() { create_non_discretized_constraints(); });
   }
   if (this->include_train_dynamics) {
     PLOGD << "Create train dynamic constraints";
-    create_acceleration_constraints();
+    telemetry.measure("create_acceleration_constraints",
+                      [this]() { create_acceleration_constraints(); });
   }
   if (this->include_braking_curves) {
     PLOGD << "Create braking distance constraints";
-    create_brakelen_constraints();
+    telemetry.measure("create_brakelen_constraints",
+                      [this]() { create_brakelen_constraints(); });
   }
 }
 
@@ -1,8 +1,11 @@
 #include "CustomExceptions.hpp"
 #include "solver/mip-based/VSSGenTimetableSolver.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <plog/Log.h>
+#include <string>
 #include <unordered_map>
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
@@ -18,8 +21,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::unbreakable_section_indices(
    */
 
   std::vector<size_t> indices;
-  const auto& tr_name  = instance.get_train_list().get_train(train_index).name;
-  const auto& tr_route = instance.get_route(tr_name).get_edges();
+  const auto& tr_name  = instance->get_train_list().get_train(train_index).name;
+  const auto& tr_route = instance->get_route(tr_name).get_edges();
   for (size_t i = 0; i < unbreakable_sections.size(); ++i) {
     bool edge_found = false;
     // If unbreakable_section[i] (of type vector) and tr_route (of type vector)
@@ -56,9 +59,9 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::
   // Initialize struct
   TemporaryImpossibilityStruct s;
 
-  const auto& train_list  = instance.get_train_list();
+  const auto& train_list  = instance->get_train_list();
   const auto  tr_name     = train_list.get_train(tr).name;
-  const auto& tr_schedule = instance.get_schedule(tr_name);
+  const auto& tr_schedule = instance->get_schedule(tr_name);
 
   s.to_use   = true;
   s.t_before = train_interval[tr].first;
@@ -76,14 +79,14 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::
     }
     if (t0 < t && t0 > s.t_before) {
       s.t_before     = t0;
-      s.edges_before = instance.get_station_list()
+      s.edges_before = instance->get_station_list()
                            .get_station(tr_stop.get_station_name())
                            .tracks;
       s.v_before = 0;
     }
     if (t1 > t && t1 < s.t_after) {
       s.t_after     = t1;
-      s.edges_after = instance.get_station_list()
+      s.edges_after = instance->get_station_list()
                           .get_station(tr_stop.get_station_name())
                           .tracks;
       s.v_after = 0;
@@ -97,7 +100,7 @@ double
 cda_rail::solver::mip_based::VSSGenTimetableSolver::max_distance_travelled(
     const size_t& tr, const size_t& time_steps, const double& v0,
     const double& a_max, const bool& braking_distance) const {
-  const auto& train_object = instance.get_train_list().get_train(tr);
+  const auto& train_object = instance->get_train_list().get_train(tr);
   const auto& v_max        = train_object.max_speed;
   const auto  time_diff    = static_cast<int>(time_steps) * dt;
   double      ret_val      = 0;
@@ -123,6 +126,90 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::max_distance_travelled(
   return ret_val;
 }
 
+void cda_rail::solver::mip_based::VSSGenTimetableSolver::
+    calculate_reachable_edges() {
+  /**
+   * Calculates for every train and time step the edges and vertices the train
+   * can occupy, i.e., which can be reached from the entry vertex since t_0 and
+   * from which the exit vertex can be reached until t_n. The bounds are the
+   * same as the ones of the impossibility cuts, disregarding stops. Variables
+   * and constraints of positions outside of this set are not created if
+   * routes are not fixed.
+   */
+
+  const auto apsp = instance->const_n().all_edge_pairs_shortest_paths_matrix();
+
+  const auto& train_list = instance->get_train_list();
+
+  reachable_edges.assign(num_tr, {});
+  reachable_vertices.assign(num_tr, {});
+  for (size_t tr = 0; tr < num_tr; ++tr) {
+    const auto& train        = train_list.get_train(tr);
+    const auto& schedule     = instance->get_schedule(tr);
+    const auto& entry        = schedule.get_entry();
+    const auto& exit         = schedule.get_exit();
+    const auto  e_before     = instance->const_n().out_edges(entry)[0];
+    const auto  e_after      = instance->const_n().in_edges(exit)[0];
+    const auto& e_len_before = instance->const_n().get_edge(e_before).length;
+    reachable_edges[tr].assign(num_t, std::vector<bool>(num_edges, false));
+    reachable_vertices[tr].assign(num_t,
+                                  std::vector<bool>(num_vertices, false));
+
+    for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
+         ++t) {
+      const auto dist_travelled_before = max_distance_travelled(
+          tr, t - train_interval[tr].first + 1, schedule.get_v_0(),
+          train.acceleration, this->include_braking_curves);
+      const auto dist_travelled_after = max_distance_travelled(
+          tr, train_interval[tr].second + 1 - t, schedule.get_v_n(),
+          train.deceleration, false);
+
+      for (size_t e = 0; e < num_edges; ++e) {
+        const auto& edge = instance->const_n().get_edge(e);
+        // Distance to the start of e and from the end of e
+        const auto dist_before = apsp(e_before, e) + e_len_before - edge.length;
+        const auto dist_after  = apsp(e, e_after);
+        if (dist_travelled_before < dist_before ||
+            dist_travelled_after < dist_after) {
+          continue;
+        }
+        reachable_edges[tr][t][e]              = true;
+        reachable_vertices[tr][t][edge.source] = true;
+        reachable_vertices[tr][t][edge.target] = true;
+      }
+      // Entry and exit are connected to the train's position outside of the
+      // network
+      reachable_vertices[tr][t][entry] = true;
+      reachable_vertices[tr][t][exit]  = true;
+    }
+  }
+
+  size_t num_positions = 0;
+  size_t num_reachable = 0;
+  for (size_t tr = 0; tr < num_tr; ++tr) {
+    for (size_t t = train_interval[tr].first; t <= train_interval[tr].second;
+         ++t) {
+      num_positions += num_edges;
+      num_reachable += static_cast<size_t>(
+          std::count(reachable_edges[tr][t].begin(),
+                     reachable_edges[tr][t].end(), true));
+    }
+  }
+  PLOGI << "Reachability pruning removes " << num_positions - num_reachable
+        << " of " << num_positions << " train positions on edges";
+}
+
+bool cda_rail::solver::mip_based::VSSGenTimetableSolver::edge_reachable(
+    size_t tr, size_t t, size_t e) const {
+  // Every edge is reachable if no reachability has been calculated
+  return reachable_edges.empty() || reachable_edges.at(tr).at(t).at(e);
+}
+
+bool cda_rail::solver::mip_based::VSSGenTimetableSolver::vertex_reachable(
+    size_t tr, size_t t, size_t v) const {
+  return reachable_vertices.empty() || reachable_vertices.at(tr).at(t).at(v);
+}
+
 std::pair<std::vector<std::vector<size_t>>, std::vector<std::vector<size_t>>>
 cda_rail::solver::mip_based::VSSGenTimetableSolver::common_entry_exit_vertices()
     const {
@@ -144,8 +231,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::common_entry_exit_vertices()
   std::unordered_map<size_t, std::vector<size_t>> exit_vertices;
 
   for (size_t tr = 0; tr < num_tr; ++tr) {
-    entry_vertices[instance.get_schedule(tr).get_entry()].push_back(tr);
-    exit_vertices[instance.get_schedule(tr).get_exit()].push_back(tr);
+    entry_vertices[instance->get_schedule(tr).get_entry()].push_back(tr);
+    exit_vertices[instance->get_schedule(tr).get_exit()].push_back(tr);
   }
 
   for (auto& [_, tr_list] : entry_vertices) {
@@ -183,6 +270,7 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::cleanup() {
   include_train_dynamics    = false;
   use_pwl                   = false;
   use_schedule_cuts         = false;
+  use_reachability_pruning  = false;
   export_option             = ExportOption::NoExport;
   iterative_vss             = false;
   optimality_strategy       = OptimalityStrategy::Optimal;
@@ -194,13 +282,15 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::cleanup() {
   max_vss_per_edge_in_iteration.clear();
   breakable_edge_indices.clear();
   fwd_bwd_sections.clear();
+  reachable_edges.clear();
+  reachable_vertices.clear();
   GeneralMIPSolver::cleanup();
 }
 
 bool cda_rail::solver::mip_based::VSSGenTimetableSolver::update_vss(
     size_t relevant_edge_index, double obj_ub, GRBLinExpr& cut_expr) {
   const auto& e            = relevant_edges.at(relevant_edge_index);
-  const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+  const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
   const auto& current_vss_number_e =
       max_vss_per_edge_in_iteration.at(relevant_edge_index);
 
@@ -235,41 +325,42 @@ bool cda_rail::solver::mip_based::VSSGenTimetableSolver::update_vss(
 void cda_rail::solver::mip_based::VSSGenTimetableSolver::update_max_vss_on_edge(
     size_t relevant_edge_index, size_t new_max_vss, GRBLinExpr& cut_expr) {
   const auto& e            = relevant_edges.at(relevant_edge_index);
-  const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+  const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
   const auto  old_max_vss =
       max_vss_per_edge_in_iteration.at(relevant_edge_index);
   max_vss_per_edge_in_iteration[relevant_edge_index] = new_max_vss;
 
   IF_PLOG(plog::debug) {
-    const auto& u =
-        instance.n().get_vertex(instance.n().get_edge(e).source).name;
-    const auto& v =
-        instance.n().get_vertex(instance.n().get_edge(e).target).name;
+    const auto& u = instance->const_n()
+                        .get_vertex(instance->const_n().get_edge(e).source)
+                        .name;
+    const auto& v = instance->const_n()
+                        .get_vertex(instance->const_n().get_edge(e).target)
+                        .name;
     PLOGD << "Update possible VSS on edge " << u << " -> " << v << " from "
           << old_max_vss << " to " << new_max_vss;
   }
 
   if (this->vss_model.get_model_type() == vss::ModelType::Inferred) {
-    vars.at("num_vss_segments")(relevant_edge_index)
+    vars.at(Var::NumVssSegments)(relevant_edge_index)
         .set(GRB_DoubleAttr_UB, static_cast<double>(new_max_vss) + 1);
     if (this->iterative_include_cuts_tmp && new_max_vss > old_max_vss) {
       const auto b =
           model->addVar(0, 1, 0, GRB_BINARY,
-                        "binary_cut_" + std::to_string(relevant_edge_index) +
-                            "_" + std::to_string(old_max_vss));
+                        name("binary_cut_", relevant_edge_index, "_",
+                             old_max_vss));
       // b = 1 iff num_vss_segments(relevant_edge_index) >= old_max_vss + 1
-      model->addConstr(vars.at("num_vss_segments")(relevant_edge_index) -
+      model->addConstr(vars.at(Var::NumVssSegments)(relevant_edge_index) -
                                static_cast<double>(old_max_vss) <=
                            (vss_number_e + 1) * b,
-                       "binary_cut_relation_" +
-                           std::to_string(relevant_edge_index) + "_" +
-                           std::to_string(old_max_vss) + "_1");
+                       name("binary_cut_relation_", relevant_edge_index, "_",
+                            old_max_vss, "_1"));
       model->addConstr(
           static_cast<double>(old_max_vss + 1) -
-                  vars.at("num_vss_segments")(relevant_edge_index) <=
+                  vars.at(Var::NumVssSegments)(relevant_edge_index) <=
               (vss_number_e) * (1 - b),
-          "binary_cut_relation_" + std::to_string(relevant_edge_index) + "_" +
-              std::to_string(old_max_vss) + "_2");
+          name("binary_cut_relation_", relevant_edge_index, "_", old_max_vss,
+               "_2"));
       cut_expr += b;
       PLOGD << "Add binary_cut_" << relevant_edge_index << "_" << old_max_vss
             << "to cut_expr";
@@ -277,11 +368,11 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::update_max_vss_on_edge(
   }
   if (this->vss_model.get_model_type() == vss::ModelType::Continuous) {
     for (size_t vss = 0; vss < vss_number_e; ++vss) {
-      vars.at("b_used")(relevant_edge_index, vss)
+      vars.at(Var::BUsed)(relevant_edge_index, vss)
           .set(GRB_DoubleAttr_UB, static_cast<double>(vss < new_max_vss));
     }
     if (this->iterative_include_cuts_tmp && new_max_vss > old_max_vss) {
-      cut_expr += vars.at("b_used")(relevant_edge_index, old_max_vss);
+      cut_expr += vars.at(Var::BUsed)(relevant_edge_index, old_max_vss);
       PLOGD << "Add b_used(" << relevant_edge_index << "," << old_max_vss
             << ") to cut_expr";
     }
@@ -291,11 +382,11 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::update_max_vss_on_edge(
          sep_type < this->vss_model.get_separation_functions().size();
          ++sep_type) {
       for (size_t vss = 0; vss < vss_number_e; ++vss) {
-        vars.at("type_num_vss_segments")(relevant_edge_index, sep_type, vss)
+        vars.at(Var::TypeNumVssSegments)(relevant_edge_index, sep_type, vss)
             .set(GRB_DoubleAttr_UB, static_cast<double>(vss < new_max_vss));
       }
       if (this->iterative_include_cuts_tmp && new_max_vss > old_max_vss) {
-        cut_expr += vars.at("type_num_vss_segments")(relevant_edge_index,
+        cut_expr += vars.at(Var::TypeNumVssSegments)(relevant_edge_index,
                                                      sep_type, old_max_vss);
         PLOGD << "Add type_num_vss_segments(" << relevant_edge_index << ","
               << sep_type << "," << old_max_vss << ") to cut_expr";
@@ -304,7 +395,7 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::update_max_vss_on_edge(
   }
 }
 
-std::optional<cda_rail::instances::VSSGenerationTimetable>
+cda_rail::CopyOnWrite<cda_rail::instances::VSSGenerationTimetable>
 cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
     const cda_rail::solver::mip_based::ModelDetail&      model_detail,
     const cda_rail::solver::mip_based::ModelSettings&    model_settings,
@@ -323,7 +414,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
         "Model type and separation types/functions are not consistent.");
   }
 
-  if (!instance.n().is_consistent_for_transformation()) {
+  if (!instance->const_n().is_consistent_for_transformation()) {
     PLOGE << "Instance is not consistent for transformation.";
     throw exceptions::ConsistencyException();
   }
@@ -336,6 +427,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
   this->include_braking_curves    = model_detail.braking_curves;
   this->use_pwl                   = model_settings.use_pwl;
   this->use_schedule_cuts         = model_settings.use_schedule_cuts;
+  this->use_reachability_pruning  = model_settings.use_reachability_pruning;
   this->iterative_vss             = solver_strategy.iterative_approach;
   this->optimality_strategy       = solver_strategy.optimality_strategy;
   this->iterative_update_strategy = solver_strategy.update_strategy;
@@ -344,6 +436,8 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
   this->iterative_include_cuts    = solver_strategy.include_cuts;
   this->postprocess               = solution_settings.postprocess;
   this->export_option             = solution_settings.export_option;
+  this->set_use_names(solution_settings.anonymous_model,
+                      solution_settings.export_option);
 
   if (this->iterative_vss) {
     // Iterative optimization strategy
@@ -362,54 +456,69 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
     }
   }
 
-  if (this->fix_routes && !instance.has_route_for_every_train()) {
+  if (this->fix_routes && !instance->has_route_for_every_train()) {
     PLOGE << "Instance does not have a route for every train";
     throw exceptions::ConsistencyException(
         "Instance does not have a route for every train");
   }
 
-  std::optional<instances::VSSGenerationTimetable> old_instance;
+  // Shares the instance, the discretization below works on a copy
+  const auto old_instance = instance;
   if (this->vss_model.get_model_type() == vss::ModelType::Discrete) {
     // Discretize graph model
     PLOGI << "Preprocessing graph...";
-    old_instance = instance;
-    instance.discretize(this->vss_model.get_separation_functions().front());
+    const auto& sep_func = this->vss_model.get_separation_functions().front();
+    // The discretized instance can only be reused for the same separation
+    // function, which is only comparable for plain function pointers
+    const auto* sep_func_ptr = sep_func.target<double (*)(size_t, size_t)>();
+    const auto  key =
+        sep_func_ptr == nullptr
+             ? std::string()
+             : "discretize_" +
+                  std::to_string(reinterpret_cast<uintptr_t>(*sep_func_ptr));
+    telemetry.measure("discretize", [this, &key, &sep_func]() {
+      preprocess_instance(key,
+                          [&sep_func](instances::VSSGenerationTimetable& inst) {
+                            inst.discretize(sep_func);
+                          });
+    });
     PLOGI << "Preprocessing graph... DONE";
   }
 
   PLOGI << "Creating model...";
   PLOGD << "Initialize other relevant variables";
 
-  num_t = static_cast<size_t>(instance.max_t() / dt);
-  if (instance.max_t() % dt != 0) {
+  num_t = static_cast<size_t>(instance->max_t() / dt);
+  if (instance->max_t() % dt != 0) {
     num_t += 1;
   }
 
-  num_tr       = instance.get_train_list().size();
-  num_edges    = instance.n().number_of_edges();
-  num_vertices = instance.n().number_of_vertices();
+  num_tr       = instance->get_train_list().size();
+  num_edges    = instance->const_n().number_of_edges();
+  num_vertices = instance->const_n().number_of_vertices();
 
-  unbreakable_sections = instance.n().unbreakable_sections();
+  unbreakable_sections = instance->const_n().unbreakable_sections();
 
   if (this->vss_model.get_model_type() == vss::ModelType::Discrete) {
     // Sections of discretized graph
-    no_border_vss_sections = instance.n().no_border_vss_sections();
+    no_border_vss_sections = instance->const_n().no_border_vss_sections();
     num_breakable_sections = no_border_vss_sections.size();
     no_border_vss_vertices =
-        instance.n().get_vertices_by_type(VertexType::NoBorderVSS);
+        instance->const_n().get_vertices_by_type(VertexType::NoBorderVSS);
   } else {
     // Sections of non-discretized graph
-    breakable_edges = instance.n().breakable_edges();
+    breakable_edges = instance->const_n().breakable_edges();
     for (size_t i = 0; i < breakable_edges.size(); ++i) {
       breakable_edge_indices[breakable_edges[i]] = i;
     }
-    breakable_edges_pairs = instance.n().combine_reverse_edges(breakable_edges);
+    breakable_edges_pairs =
+        instance->const_n().combine_reverse_edges(breakable_edges);
     num_breakable_sections = breakable_edges.size();
-    relevant_edges         = instance.n().relevant_breakable_edges();
+    relevant_edges         = instance->const_n().relevant_breakable_edges();
   }
 
   for (size_t i = 0; i < num_tr; ++i) {
-    train_interval.emplace_back(instance.time_index_interval(i, dt, false));
+    train_interval.emplace_back(instance->time_index_interval(i, dt, false));
   }
 
   if (iterative_vss && vss_model.get_model_type() == vss::ModelType::Discrete) {
@@ -421,7 +530,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
   max_vss_per_edge_in_iteration.resize(relevant_edges.size(), 0);
   for (size_t i = 0; i < relevant_edges.size(); ++i) {
     const auto& e            = relevant_edges.at(i);
-    const auto  vss_number_e = instance.n().max_vss_on_edge(e);
+    const auto  vss_number_e = instance->const_n().max_vss_on_edge(e);
     if (iterative_vss) {
       if (iterative_update_strategy == UpdateStrategy::Fixed) {
         max_vss_per_edge_in_iteration[i] = std::min(
@@ -443,6 +552,12 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::initialize_variables(
   // Sections on which trains can collide face-to-face
   calculate_fwd_bwd_sections();
 
+  if (!this->fix_routes && this->use_reachability_pruning) {
+    // Positions trains can occupy at all, only needed for free routes
+    telemetry.measure("reachability",
+                      [this]() { calculate_reachable_edges(); });
+  }
+
   // Return unchanged instance for cleaning step
   return old_instance;
 }
@@ -483,8 +598,8 @@ void cda_rail::solver::mip_based::VSSGenTimetableSolver::set_timeout(
 
 std::optional<cda_rail::instances::SolVSSGenerationTimetable>
 cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
-    const std::optional<instances::VSSGenerationTimetable>& old_instance,
-    int                                                     time_limit) {
+    const CopyOnWrite<instances::VSSGenerationTimetable>& old_instance,
+    int                                                   time_limit) {
   /**
    * This function contains the optimization process
    */
@@ -494,7 +609,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
 
   double obj_ub = 1.0;
   for (const auto& e : relevant_edges) {
-    obj_ub += instance.const_n().max_vss_on_edge(e);
+    obj_ub += instance->const_n().max_vss_on_edge(e);
   }
   double obj_lb           = 0;
   size_t iteration_number = 0;
@@ -502,6 +617,12 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
   std::vector<GRBConstr> iterative_cuts;
   this->iterative_include_cuts_tmp = this->iterative_include_cuts;
 
+  const auto extract = [this, &old_instance]() {
+    return telemetry.measure("extract_solution", [this, &old_instance]() {
+      return extract_solution(postprocess, !iterative_vss, old_instance);
+    });
+  };
+
   while (reoptimize) {
     reoptimize = false;
 
@@ -512,7 +633,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
     }
 
     // Optimize the (possibly restricted) model
-    this->model->optimize();
+    telemetry.measure("optimize", [this]() { this->model->optimize(); });
     iteration_number += 1;
 
     if (model->get(GRB_IntAttr_SolCount) >= 1) {
@@ -521,14 +642,13 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
       const auto obj_tmp = model->get(GRB_DoubleAttr_ObjVal);
       if (obj_tmp < obj_ub) {
         obj_ub = obj_tmp;
-        sol_object =
-            extract_solution(postprocess, !iterative_vss, old_instance);
+        sol_object = extract();
         this->iterative_include_cuts_tmp = false;
       }
     }
 
     if (!sol_object.has_value()) {
-      sol_object = extract_solution(postprocess, !iterative_vss, old_instance);
+      sol_object = extract();
     }
 
     if (iterative_vss) {
@@ -539,8 +659,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
           PLOGD << "However, use previous obtained solution";
           break;
         }
-        sol_object =
-            extract_solution(postprocess, !iterative_vss, old_instance);
+        sol_object = extract();
         break;
       }
 
@@ -549,7 +668,7 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
         if (static_cast<double>(max_vss_per_edge_in_iteration.at(i)) + 1 <
                 obj_lb_tmp &&
             max_vss_per_edge_in_iteration.at(i) <
-                instance.const_n().max_vss_on_edge(relevant_edges.at(i))) {
+                instance->const_n().max_vss_on_edge(relevant_edges.at(i))) {
           obj_lb_tmp =
               static_cast<double>(max_vss_per_edge_in_iteration.at(i)) + 1;
         }
@@ -585,18 +704,16 @@ cda_rail::solver::mip_based::VSSGenTimetableSolver::optimize(
       }
 
       model->addConstr(objective_expr, GRB_GREATER_EQUAL, obj_lb,
-                       "obj_lb_" + std::to_string(obj_lb) + "_" +
-                           std::to_string(iteration_number));
+                       name("obj_lb_", obj_lb, "_", iteration_number));
       model->addConstr(objective_expr, GRB_LESS_EQUAL, obj_ub,
-                       "obj_ub_" + std::to_string(obj_ub) + "_" +
-                           std::to_string(iteration_number));
+                       name("obj_ub_", obj_ub, "_", iteration_number));
       PLOGD << "Added constraint: obj >= " << obj_lb;
       PLOGD << "Added constraint: obj <= " << obj_ub;
 
       if (this->iterative_include_cuts_tmp) {
         iterative_cuts.push_back(
             model->addConstr(cut_expr, GRB_GREATER_EQUAL, 1,
-                             "cut_" + std::to_string(iteration_number)));
+                             name("cut_", iteration_number)));
         model->reset(1);
         PLOGD << "Added constraint: cut_expr >= 1";
       } else {
@@ -1,9 +1,12 @@
 #include <cstdlib>
 #define TEST_FRIENDS true
 
+#include "CustomExceptions.hpp"
 #include "probleminstances/GeneralPerformanceOptimizationInstance.hpp"
 #include "probleminstances/VSSGenerationTimetable.hpp"
 #include "solver/mip-based/GenPOMovingBlockMIPSolver.hpp"
+#include "solver/mip-based/GurobiEnvironmentPool.hpp"
+#include "solver/mip-based/ModelBatch.hpp"
 
 #include "gtest/gtest.h"
 #include <filesystem>
@@ -830,6 +833,98 @@ TEST(GenPOMovingBlockMIPSolver, PrivateFillFunctions) {
   EXPECT_APPROX_EQ(vel_data_new_2_v8.at(0), 10);
 }
 
+TEST(GenPOMovingBlockMIPSolver, VariableRegistry) {
+  using cda_rail::solver::mip_based::GenPOMovingBlockVariable;
+  cda_rail::solver::mip_based::VariableRegistry<GenPOMovingBlockVariable> vars;
+
+  EXPECT_EQ(cda_rail::solver::mip_based::variable_name(
+                GenPOMovingBlockVariable::TFrontArrival),
+            "t_front_arrival");
+  EXPECT_EQ(cda_rail::solver::mip_based::variable_name(
+                GenPOMovingBlockVariable::ReverseOrder),
+            "reverse_order");
+
+  // X has a fixed rank and is only accessed by a compile-time family
+  vars.get<GenPOMovingBlockVariable::X>() =
+      cda_rail::FixedRankMultiArray<GRBVar, 2>(2, 3);
+  vars[GenPOMovingBlockVariable::Y] =
+      cda_rail::MultiArray<GRBVar>::sparse(2, 3, 4, 4);
+
+  EXPECT_EQ(vars.get<GenPOMovingBlockVariable::X>().get_shape()[1], 3);
+  EXPECT_TRUE(vars.at(GenPOMovingBlockVariable::Y).is_sparse());
+  EXPECT_THROW((void)vars[GenPOMovingBlockVariable::X], std::invalid_argument);
+  EXPECT_THROW((void)vars.at("x"), std::invalid_argument);
+
+  // Every family can be visited by a runtime value
+  size_t dimensions = 0;
+  vars.visit(GenPOMovingBlockVariable::X,
+             [&](const auto& array) { dimensions = array.size(); });
+  EXPECT_EQ(dimensions, 6);
+  vars.visit(GenPOMovingBlockVariable::Y,
+             [&](const auto& array) { dimensions = array.dimensions(); });
+  EXPECT_EQ(dimensions, 4);
+
+  // Name-based lookup returns the same families
+  EXPECT_EQ(&vars.at("y"), &vars.at(GenPOMovingBlockVariable::Y));
+  EXPECT_EQ(&vars.at("order"), &vars.at(GenPOMovingBlockVariable::Order));
+  EXPECT_THROW((void)vars.at("unknown"), std::out_of_range);
+
+  vars.clear();
+  EXPECT_EQ(vars.at(GenPOMovingBlockVariable::Y).dimensions(), 0);
+  EXPECT_EQ(vars.get<GenPOMovingBlockVariable::X>().size(), 0);
+}
+
+TEST(GenPOMovingBlockMIPSolver, ConstraintBatch) {
+  const auto env =
+      cda_rail::solver::mip_based::GurobiEnvironmentPool::get().acquire();
+  GRBModel   model(*env);
+  const auto x = model.addVar(0, 10, 0, GRB_CONTINUOUS, "x");
+  const auto y = model.addVar(0, 10, 0, GRB_CONTINUOUS, "y");
+
+  // Submitted automatically after three rows
+  cda_rail::solver::mip_based::ConstraintBatch batch(model, 3);
+  batch.add(x + 2 * y + 1, GRB_LESS_EQUAL, y + 5, "c0");
+  batch.add(x, GRB_GREATER_EQUAL, 0.5 * y, "c1");
+  EXPECT_EQ(batch.size(), 2);
+  EXPECT_EQ(batch.number_of_terms(), 4);
+  batch.add(3 * x, GRB_EQUAL, 6, "c2");
+  EXPECT_EQ(batch.size(), 0);
+  EXPECT_EQ(batch.number_of_terms(), 0);
+  batch.add(x + y, GRB_LESS_EQUAL, 2 * x + 3, "c3");
+  batch.submit();
+  EXPECT_EQ(batch.size(), 0);
+  model.update();
+
+  EXPECT_EQ(model.get(GRB_IntAttr_NumConstrs), 4);
+
+  // x + y <= 4
+  const auto c0 = model.getConstrByName("c0");
+  EXPECT_EQ(c0.get(GRB_CharAttr_Sense), GRB_LESS_EQUAL);
+  EXPECT_DOUBLE_EQ(c0.get(GRB_DoubleAttr_RHS), 4);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c0, x), 1);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c0, y), 1);
+
+  // x - 0.5 y >= 0
+  const auto c1 = model.getConstrByName("c1");
+  EXPECT_EQ(c1.get(GRB_CharAttr_Sense), GRB_GREATER_EQUAL);
+  EXPECT_DOUBLE_EQ(c1.get(GRB_DoubleAttr_RHS), 0);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c1, x), 1);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c1, y), -0.5);
+
+  // 3 x = 6
+  const auto c2 = model.getConstrByName("c2");
+  EXPECT_EQ(c2.get(GRB_CharAttr_Sense), GRB_EQUAL);
+  EXPECT_DOUBLE_EQ(c2.get(GRB_DoubleAttr_RHS), 6);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c2, x), 3);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c2, y), 0);
+
+  // -x + y <= 3
+  const auto c3 = model.getConstrByName("c3");
+  EXPECT_DOUBLE_EQ(c3.get(GRB_DoubleAttr_RHS), 3);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c3, x), -1);
+  EXPECT_DOUBLE_EQ(model.getCoeff(c3, y), 1);
+}
+
 TEST(GenPOMovingBlockMIPSolver, Default1) {
   const std::vector<std::string> paths{"HighSpeedTrack2Trains",
                                        "HighSpeedTrack5Trains"};
@@ -855,6 +950,366 @@ TEST(GenPOMovingBlockMIPSolver, Default1) {
   }
 }
 
+TEST(GenPOMovingBlockMIPSolver, AnonymousModel) {
+  const std::vector<std::string> paths{"HighSpeedTrack2Trains",
+                                       "SimpleNetwork"};
+
+  for (const auto& p : paths) {
+    const std::string instance_path = "./example-networks/" + p + "/";
+    const auto        instance_before_parse =
+        cda_rail::instances::VSSGenerationTimetable(instance_path);
+    const auto instance =
+        cda_rail::instances::GeneralPerformanceOptimizationInstance::
+            cast_from_vss_generation(instance_before_parse);
+
+    cda_rail::solver::mip_based::SolutionSettingsMovingBlock settings;
+    settings.anonymous_model = true;
+
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+    const auto sol = solver.solve({}, {}, settings, -1, false);
+
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_named(
+        instance);
+    const auto sol_named = solver_named.solve();
+
+    EXPECT_TRUE(sol.has_solution())
+        << "No solution found for instance " << instance_path;
+    EXPECT_EQ(sol.get_status(), sol_named.get_status())
+        << "Solution status differs for instance " << instance_path;
+    EXPECT_EQ(sol.get_obj(), sol_named.get_obj())
+        << "Objective value differs for instance " << instance_path;
+
+    check_last_train_pos(instance_before_parse, sol, instance_path);
+  }
+}
+
+TEST(GenPOMovingBlockMIPSolver, LazyCutPool) {
+  const std::vector<std::string> paths{"HighSpeedTrack2Trains",
+                                       "SimpleNetwork"};
+
+  for (const auto& p : paths) {
+    const std::string instance_path = "./example-networks/" + p + "/";
+    const auto        instance_before_parse =
+        cda_rail::instances::VSSGenerationTimetable(instance_path);
+    const auto instance =
+        cda_rail::instances::GeneralPerformanceOptimizationInstance::
+            cast_from_vss_generation(instance_before_parse);
+
+    cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy_no_pool;
+    strategy_no_pool.use_lazy_cut_pool = false;
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_no_pool(
+        instance);
+    const auto sol_no_pool =
+        solver_no_pool.solve({}, strategy_no_pool, {}, -1, false);
+
+    // Solve twice with the same solver, so that the second solve starts with
+    // the cuts of the first one as static constraints
+    cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy;
+    strategy.lazy_cut_promotion_threshold = 1;
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+    const auto sol_first  = solver.solve({}, strategy, {}, -1, false);
+    const auto sol_second = solver.solve({}, strategy, {}, -1, false);
+
+    for (const auto& sol : {sol_first, sol_second}) {
+      EXPECT_TRUE(sol.has_solution())
+          << "No solution found for instance " << instance_path;
+      EXPECT_EQ(sol.get_status(), sol_no_pool.get_status())
+          << "Solution status differs for instance " << instance_path;
+      EXPECT_EQ(sol.get_obj(), sol_no_pool.get_obj())
+          << "Objective value differs for instance " << instance_path;
+      check_last_train_pos(instance_before_parse, sol, instance_path);
+    }
+
+    // Widening a time window changes the big-M values of the cuts, hence, the
+    // pooled cuts must not be transferred, neither to a new nor to a reused
+    // model
+    const auto t_n_range = instance.get_schedule(size_t{0}).get_t_n_range();
+    const std::pair<int, int> wide_t_n_range{t_n_range.first,
+                                             t_n_range.second + 60};
+    auto                      instance_wide = instance;
+    instance_wide.editable_schedule(size_t{0}).set_t_n_range(wide_t_n_range);
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_wide(
+        instance_wide);
+    const auto sol_wide =
+        solver_wide.solve({}, strategy_no_pool, {}, -1, false);
+
+    solver.set_t_n_range(size_t{0}, wide_t_n_range);
+    const auto sol_pool_wide = solver.solve({}, strategy, {}, -1, false);
+
+    cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy_persistent =
+        strategy;
+    strategy_persistent.persistent_model = true;
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_persistent(
+        instance);
+    solver_persistent.set_t_n_range(size_t{0}, wide_t_n_range);
+    const auto sol_persistent_first =
+        solver_persistent.solve({}, strategy_persistent, {}, -1, false);
+    solver_persistent.set_t_n_range(size_t{0}, t_n_range);
+    const auto sol_persistent_narrow =
+        solver_persistent.solve({}, strategy_persistent, {}, -1, false);
+    solver_persistent.set_t_n_range(size_t{0}, wide_t_n_range);
+    const auto sol_persistent_wide =
+        solver_persistent.solve({}, strategy_persistent, {}, -1, false);
+
+    EXPECT_EQ(sol_persistent_narrow.get_obj(), sol_no_pool.get_obj())
+        << "Objective value differs for instance " << instance_path;
+    for (const auto& sol :
+         {sol_pool_wide, sol_persistent_first, sol_persistent_wide}) {
+      EXPECT_TRUE(sol.has_solution())
+          << "No solution found for instance " << instance_path;
+      EXPECT_EQ(sol.get_status(), sol_wide.get_status())
+          << "Solution status differs for instance " << instance_path;
+      EXPECT_EQ(sol.get_obj(), sol_wide.get_obj())
+          << "Objective value differs for instance " << instance_path;
+    }
+  }
+}
+
+TEST(GenPOMovingBlockMIPSolver, LazySeparationThreads) {
+  const std::vector<std::string> paths{"HighSpeedTrack2Trains",
+                                       "SimpleNetwork"};
+
+  for (const auto& p : paths) {
+    const std::string instance_path = "./example-networks/" + p + "/";
+    const auto        instance_before_parse =
+        cda_rail::instances::VSSGenerationTimetable(instance_path);
+    const auto instance =
+        cda_rail::instances::GeneralPerformanceOptimizationInstance::
+            cast_from_vss_generation(instance_before_parse);
+
+    for (const auto& selection_strategy :
+         {cda_rail::solver::mip_based::LazyConstraintSelectionStrategy::
+              OnlyViolated,
+          cda_rail::solver::mip_based::LazyConstraintSelectionStrategy::
+              OnlyFirstFound}) {
+      cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy_seq;
+      strategy_seq.lazy_constraint_selection_strategy = selection_strategy;
+      strategy_seq.lazy_separation_threads            = 1;
+      cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_seq(
+          instance);
+      const auto sol_seq = solver_seq.solve({}, strategy_seq, {}, -1, false);
+
+      cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy_par =
+          strategy_seq;
+      strategy_par.lazy_separation_threads = 4;
+      cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_par(
+          instance);
+      const auto sol_par = solver_par.solve({}, strategy_par, {}, -1, false);
+
+      EXPECT_TRUE(sol_par.has_solution())
+          << "No solution found for instance " << instance_path;
+      EXPECT_EQ(sol_par.get_status(), sol_seq.get_status())
+          << "Solution status differs for instance " << instance_path;
+      EXPECT_EQ(sol_par.get_obj(), sol_seq.get_obj())
+          << "Objective value differs for instance " << instance_path;
+      check_last_train_pos(instance_before_parse, sol_par, instance_path);
+    }
+  }
+}
+
+TEST(GenPOMovingBlockMIPSolver, LazyCallbackProfile) {
+  cda_rail::solver::mip_based::LazyCallbackProfile profile;
+  profile.record_phase(cda_rail::solver::mip_based::LazyCallbackPhase::Routes,
+                       0.5);
+  profile.record_phase(cda_rail::solver::mip_based::LazyCallbackPhase::Routes,
+                       1.5);
+  const auto result = profile.measure(
+      cda_rail::solver::mip_based::LazyCallbackPhase::Velocities,
+      []() { return 42; });
+  EXPECT_EQ(result, 42);
+
+  const auto& routes = profile.get_phase(
+      cda_rail::solver::mip_based::LazyCallbackPhase::Routes);
+  EXPECT_EQ(routes.calls, 2);
+  EXPECT_DOUBLE_EQ(routes.total_seconds, 2.0);
+  EXPECT_DOUBLE_EQ(routes.max_seconds, 1.5);
+  EXPECT_EQ(profile
+                .get_phase(cda_rail::solver::mip_based::LazyCallbackPhase::
+                               Velocities)
+                .calls,
+            1);
+
+  const cda_rail::solver::mip_based::LazyCutSignature signature{
+      cda_rail::solver::mip_based::LazyCutType::SimplifiedEdgeHeadway,
+      {1, 0, 3},
+      {}};
+  profile.record_cuts(signature, true, false, 1);
+  profile.record_cuts(signature, false, true, 0);
+  profile.record_cuts(signature, true, true, 1);
+
+  const auto& cuts = profile.get_cut_type(
+      cda_rail::solver::mip_based::LazyCutType::SimplifiedEdgeHeadway);
+  EXPECT_EQ(cuts.checked, 3);
+  EXPECT_EQ(cuts.violated, 2);
+  EXPECT_EQ(cuts.duplicates, 2);
+  EXPECT_EQ(cuts.cuts, 2);
+  EXPECT_EQ(profile.get_train_pair_violations(1, 0), 2);
+  EXPECT_EQ(profile.get_train_pair_violations(0, 1), 0);
+
+  const auto j = profile.to_json({"tr1", "tr2"});
+  EXPECT_EQ(j["phases"]["routes"]["calls"], 2);
+  EXPECT_EQ(j["cuts"]["simplified_edge_headway"]["duplicates"], 2);
+  ASSERT_EQ(j["train_pairs"].size(), 1);
+  EXPECT_EQ(j["train_pairs"][0]["train"], "tr2");
+  EXPECT_EQ(j["train_pairs"][0]["other_train"], "tr1");
+  EXPECT_EQ(j["train_pairs"][0]["violations"], 2);
+
+  profile.clear();
+  EXPECT_EQ(profile
+                .get_phase(
+                    cda_rail::solver::mip_based::LazyCallbackPhase::Routes)
+                .calls,
+            0);
+  EXPECT_EQ(profile.get_train_pair_violations(1, 0), 0);
+}
+
+TEST(GenPOMovingBlockMIPSolver, LazyCallbackProfileExport) {
+  const std::string instance_path = "./example-networks/SimpleNetwork/";
+  const auto        instance_before_parse =
+      cda_rail::instances::VSSGenerationTimetable(instance_path);
+  const auto instance =
+      cda_rail::instances::GeneralPerformanceOptimizationInstance::
+          cast_from_vss_generation(instance_before_parse);
+
+  std::filesystem::remove_all("tmp_profile_folder");
+
+  cda_rail::solver::mip_based::SolutionSettingsMovingBlock settings;
+  settings.name                         = "profile";
+  settings.path                         = "tmp_profile_folder";
+  settings.export_lazy_callback_profile = true;
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+  const auto sol = solver.solve({}, {}, settings, -1, false);
+
+  EXPECT_TRUE(sol.has_solution());
+  const auto& profile = solver.get_lazy_callback_profile();
+  const auto& callback_phase = profile.get_phase(
+      cda_rail::solver::mip_based::LazyCallbackPhase::Callback);
+  EXPECT_GT(callback_phase.calls, 0);
+  EXPECT_EQ(profile
+                .get_phase(cda_rail::solver::mip_based::LazyCallbackPhase::
+                               SolutionQuery)
+                .calls,
+            callback_phase.calls);
+  EXPECT_GE(callback_phase.max_seconds, 0);
+  EXPECT_TRUE(std::filesystem::exists(
+      "tmp_profile_folder/profile/lazy_callback_profile.json"));
+
+  // The telemetry of the solve is attached to the solution
+  for (const auto& phase :
+       {"discretize_stops", "create_timing_variables",
+        "create_general_path_constraints", "fix_small_coefficients",
+        "optimize", "extract_solution"}) {
+    EXPECT_TRUE(sol.get_telemetry().has_phase(phase)) << phase;
+  }
+  EXPECT_EQ(sol.get_telemetry().get_phases().size(),
+            solver.get_telemetry().get_phases().size());
+
+  std::filesystem::remove_all("tmp_profile_folder");
+}
+
+TEST(GenPOMovingBlockMIPSolver, PersistentModel) {
+  const std::string instance_path = "./example-networks/SimpleStation/";
+  const auto        instance_before_parse =
+      cda_rail::instances::VSSGenerationTimetable(instance_path);
+  const auto instance =
+      cda_rail::instances::GeneralPerformanceOptimizationInstance::
+          cast_from_vss_generation(instance_before_parse);
+
+  cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy;
+  strategy.persistent_model = true;
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+  const auto sol1 = solver.solve({}, strategy, {}, -1, false);
+  EXPECT_TRUE(sol1.has_solution());
+  EXPECT_TRUE(solver.has_persistent_model());
+  EXPECT_TRUE(sol1.get_telemetry().has_phase("create_timing_variables"));
+
+  // Changing weights and time windows updates the model
+  const auto& t_0_range = instance.get_schedule(0).get_t_0_range();
+  const auto& t_n_range = instance.get_schedule(0).get_t_n_range();
+  solver.set_train_weight(0, 2);
+  solver.set_t_0_range(0, t_0_range);
+  solver.set_t_n_range(0, t_n_range);
+  const auto sol2 = solver.solve({}, strategy, {}, -1, false);
+  EXPECT_TRUE(sol2.has_solution());
+  EXPECT_TRUE(sol2.get_telemetry().has_phase("update_persistent_model"));
+  EXPECT_FALSE(sol2.get_telemetry().has_phase("create_timing_variables"));
+  EXPECT_DOUBLE_EQ(sol2.get_instance().get_train_weight(size_t{0}), 2);
+  EXPECT_DOUBLE_EQ(sol1.get_instance().get_train_weight(size_t{0}), 1);
+
+  // The result equals the one of a model built from scratch
+  auto modified_instance = instance;
+  modified_instance.set_train_weight(size_t{0}, 2);
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_new(
+      modified_instance);
+  const auto sol_new = solver_new.solve({}, {}, {}, -1, false);
+  EXPECT_EQ(sol2.get_status(), sol_new.get_status());
+  EXPECT_DOUBLE_EQ(sol2.get_obj(), sol_new.get_obj());
+
+  // Extending a time window requires a new model
+  solver.set_t_n_range(0, {t_n_range.first, t_n_range.second + 10});
+  const auto sol3 = solver.solve({}, strategy, {}, -1, false);
+  EXPECT_TRUE(sol3.has_solution());
+  EXPECT_TRUE(sol3.get_telemetry().has_phase("create_timing_variables"));
+  EXPECT_FALSE(sol3.get_telemetry().has_phase("update_persistent_model"));
+
+  // Other modifications of the instance require a new model
+  solver.editable_instance().set_lambda(0.5);
+  const auto sol4 = solver.solve({}, strategy, {}, -1, false);
+  EXPECT_TRUE(sol4.get_telemetry().has_phase("create_timing_variables"));
+
+  // So do different model details
+  cda_rail::solver::mip_based::ModelDetail model_detail;
+  model_detail.max_velocity_delta = 2;
+  const auto sol5 = solver.solve(model_detail, strategy, {}, -1, false);
+  EXPECT_TRUE(sol5.get_telemetry().has_phase("create_timing_variables"));
+
+  // Without persistent model, the model is discarded after solving
+  const auto sol6 = solver.solve(model_detail, {}, {}, -1, false);
+  EXPECT_TRUE(sol6.get_telemetry().has_phase("create_timing_variables"));
+  EXPECT_FALSE(solver.has_persistent_model());
+}
+
+TEST(GenPOMovingBlockMIPSolver, SharedEnvironment) {
+  const std::string instance_path = "./example-networks/SimpleStation/";
+  const auto        instance =
+      cda_rail::instances::GeneralPerformanceOptimizationInstance::
+          cast_from_vss_generation(
+              cda_rail::instances::VSSGenerationTimetable(instance_path));
+
+  auto& pool = cda_rail::solver::mip_based::GurobiEnvironmentPool::get();
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver1(instance);
+  solver1.set_use_shared_environment(true);
+  const auto sol1 = solver1.solve({}, {}, {}, -1, false);
+  EXPECT_TRUE(sol1.has_solution());
+  const auto num_environments = pool.size();
+  EXPECT_GE(num_environments, 1);
+  EXPECT_GE(pool.idle(), 1);
+
+  // The environment is reused by other solvers
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver2(instance);
+  solver2.set_use_shared_environment(true);
+  const auto sol2 = solver2.solve({}, {}, {}, -1, false);
+  EXPECT_TRUE(sol2.has_solution());
+  EXPECT_EQ(pool.size(), num_environments);
+  EXPECT_DOUBLE_EQ(sol1.get_obj(), sol2.get_obj());
+
+  // Environments in use are not handed out twice
+  {
+    const auto env1 = pool.acquire();
+    const auto env2 = pool.acquire();
+    EXPECT_NE(env1.get(), env2.get());
+  }
+  EXPECT_GE(pool.idle(), 2);
+
+  // Parameters are fixed once environments have been used
+  EXPECT_THROW(pool.configure({}),
+               cda_rail::exceptions::InvalidInputException);
+
+  pool.clear();
+  EXPECT_EQ(pool.idle(), 0);
+  EXPECT_EQ(pool.size(), 0);
+}
+
 TEST(GenPOMovingBlockMIPSolver, Default2) {
   const std::vector<std::string> paths{"SimpleStation", "SingleTrack",
                                        "SingleTrackWithStation"};
@@ -1192,6 +1647,75 @@ TEST(GenPOMovingBlockMIPSolver, NoLazy3) {
   }
 }
 
+TEST(GenPOMovingBlockMIPSolver, TimeWindowBounds) {
+  const std::string instance_path = "./example-networks/SimpleNetwork/";
+  const auto        instance_before_parse =
+      cda_rail::instances::VSSGenerationTimetable(instance_path);
+  const auto instance =
+      cda_rail::instances::GeneralPerformanceOptimizationInstance::
+          cast_from_vss_generation(instance_before_parse);
+
+  // Tightened bounds do not cut off optimal solutions, neither with nor
+  // without lazy constraints
+  for (const bool use_lazy : {false, true}) {
+    cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+    const auto sol = solver.solve({}, {use_lazy}, {}, 250);
+
+    EXPECT_TRUE(sol.get_telemetry().has_phase("set_time_window_bounds"));
+    EXPECT_EQ(sol.get_status(), cda_rail::SolutionStatus::Optimal);
+    EXPECT_EQ(sol.get_obj(), 0);
+    check_last_train_pos(instance_before_parse, sol, instance_path);
+  }
+
+  // Bounds are updated with the time windows of a persistent model
+  cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy;
+  strategy.persistent_model = true;
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+  const auto sol1 = solver.solve({}, strategy, {}, -1, false);
+  EXPECT_EQ(sol1.get_status(), cda_rail::SolutionStatus::Optimal);
+  const auto& t_0_range = instance.get_schedule(0).get_t_0_range();
+  solver.set_t_0_range(0, {t_0_range.first + 10, t_0_range.second + 10});
+  const auto sol2 = solver.solve({}, strategy, {}, -1, false);
+  EXPECT_TRUE(sol2.get_telemetry().has_phase("update_persistent_model"));
+
+  auto modified_instance = instance;
+  modified_instance.editable_schedule(0).set_t_0_range(
+      {t_0_range.first + 10, t_0_range.second + 10});
+  cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver_new(
+      modified_instance);
+  const auto sol_new = solver_new.solve({}, {}, {}, -1, false);
+  EXPECT_EQ(sol2.get_status(), sol_new.get_status());
+  if (sol_new.has_solution()) {
+    EXPECT_NEAR(sol2.get_obj(), sol_new.get_obj(), 1e-4);
+  }
+}
+
+TEST(GenPOMovingBlockMIPSolver, EOMTableThreads) {
+  const std::string instance_path = "./example-networks/SimpleStation/";
+  const auto        instance_before_parse =
+      cda_rail::instances::VSSGenerationTimetable(instance_path);
+  const auto instance =
+      cda_rail::instances::GeneralPerformanceOptimizationInstance::
+          cast_from_vss_generation(instance_before_parse);
+
+  // The tabulated EOM values do not depend on the number of threads used to
+  // compute them, both for the full and the lazy model
+  for (const bool use_lazy : {false, true}) {
+    for (const size_t threads : {1, 0, 2}) {
+      cda_rail::solver::mip_based::SolverStrategyMovingBlock strategy;
+      strategy.use_lazy_constraints = use_lazy;
+      strategy.eom_table_threads    = threads;
+      cda_rail::solver::mip_based::GenPOMovingBlockMIPSolver solver(instance);
+      const auto sol = solver.solve({}, strategy, {}, 250, false);
+
+      EXPECT_TRUE(sol.get_telemetry().has_phase("fill_eom_table"));
+      EXPECT_EQ(sol.get_status(), cda_rail::SolutionStatus::Optimal);
+      EXPECT_EQ(sol.get_obj(), 0);
+      check_last_train_pos(instance_before_parse, sol, instance_path);
+    }
+  }
+}
+
 TEST(GenPOMovingBlockMIPSolver, NoLazySimplified1) {
   const std::vector<std::string> paths{"SimpleStation"};
 
@@ -1418,6 +1942,8 @@ TEST(GenPOMovingBlockMIPSolver, SimpleStationExportOptions) {
       std::filesystem::exists("tmp2folder/tmp2file/solution/train_pos.json"));
   EXPECT_TRUE(
       std::filesystem::exists("tmp2folder/tmp2file/solution/train_speed.json"));
+  EXPECT_TRUE(
+      std::filesystem::exists("tmp2folder/tmp2file/solution/telemetry.json"));
   // Expect folders .../instance/network and .../instance/timetable to not exist
   EXPECT_FALSE(std::filesystem::exists("tmp2folder/tmp2file/instance/network"));
   EXPECT_FALSE(
@@ -1,3 +1,4 @@
+#include "CopyOnWrite.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "EOMHelper.hpp"
@@ -6,6 +7,8 @@
 #include "probleminstances/GeneralPerformanceOptimizationInstance.hpp"
 
 #include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
 #include <tuple>
 #include <utility>
 
@@ -276,6 +279,113 @@ TEST(GeneralPerformanceOptimizationInstances,
               station1_tracks.end());
 }
 
+TEST(GeneralPerformanceOptimizationInstances,
+     GeneralPerformanceOptimizationInstanceBinarySnapshot) {
+  const cda_rail::instances::GeneralPerformanceOptimizationInstance instance(
+      "./example-networks-gen-po/GeneralSimpleNetwork5Trains/");
+
+  instance.export_instance_binary("./tmp/test-general-instance.bin");
+  const auto instance_read = cda_rail::instances::
+      GeneralPerformanceOptimizationInstance::import_instance_binary(
+          "./tmp/test-general-instance.bin");
+
+  // The example instance does not specify routes
+  EXPECT_TRUE(instance_read.check_consistency(false));
+
+  // Network
+  const auto& network      = instance.const_n();
+  const auto& network_read = instance_read.const_n();
+  EXPECT_EQ(network_read.number_of_vertices(), network.number_of_vertices());
+  EXPECT_EQ(network_read.number_of_edges(), network.number_of_edges());
+  for (size_t v = 0; v < network.number_of_vertices(); ++v) {
+    EXPECT_EQ(network_read.get_vertex(v).name, network.get_vertex(v).name);
+    EXPECT_EQ(network_read.get_vertex(v).type, network.get_vertex(v).type);
+    EXPECT_EQ(network_read.get_vertex(v).headway,
+              network.get_vertex(v).headway);
+    EXPECT_EQ(network_read.get_vertex_index(network.get_vertex(v).name), v);
+  }
+  for (size_t e = 0; e < network.number_of_edges(); ++e) {
+    const auto& edge      = network.get_edge(e);
+    const auto& edge_read = network_read.get_edge(e);
+    EXPECT_EQ(edge_read.source, edge.source);
+    EXPECT_EQ(edge_read.target, edge.target);
+    EXPECT_EQ(edge_read.length, edge.length);
+    EXPECT_EQ(edge_read.max_speed, edge.max_speed);
+    EXPECT_EQ(edge_read.breakable, edge.breakable);
+    EXPECT_EQ(edge_read.min_block_length, edge.min_block_length);
+    EXPECT_EQ(edge_read.min_stop_block_length, edge.min_stop_block_length);
+    EXPECT_EQ(network_read.get_successors(e), network.get_successors(e));
+    EXPECT_EQ(network_read.get_edge_index(edge.source, edge.target), e);
+  }
+
+  // Trains, schedules and problem data
+  const auto& trains = instance.get_train_list();
+  EXPECT_EQ(instance_read.get_train_list().size(), trains.size());
+  for (size_t tr = 0; tr < trains.size(); ++tr) {
+    const auto& train      = trains.get_train(tr);
+    const auto& train_read = instance_read.get_train_list().get_train(tr);
+    EXPECT_EQ(train_read.name, train.name);
+    EXPECT_EQ(train_read.length, train.length);
+    EXPECT_EQ(train_read.max_speed, train.max_speed);
+    EXPECT_EQ(train_read.acceleration, train.acceleration);
+    EXPECT_EQ(train_read.deceleration, train.deceleration);
+    EXPECT_EQ(train_read.tim, train.tim);
+
+    const auto& schedule      = instance.get_schedule(tr);
+    const auto& schedule_read = instance_read.get_schedule(tr);
+    EXPECT_EQ(schedule_read.get_t_0_range(), schedule.get_t_0_range());
+    EXPECT_EQ(schedule_read.get_v_0(), schedule.get_v_0());
+    EXPECT_EQ(schedule_read.get_entry(), schedule.get_entry());
+    EXPECT_EQ(schedule_read.get_t_n_range(), schedule.get_t_n_range());
+    EXPECT_EQ(schedule_read.get_v_n(), schedule.get_v_n());
+    EXPECT_EQ(schedule_read.get_exit(), schedule.get_exit());
+    ASSERT_EQ(schedule_read.get_stops().size(), schedule.get_stops().size());
+    for (size_t i = 0; i < schedule.get_stops().size(); ++i) {
+      const auto& stop      = schedule.get_stops().at(i);
+      const auto& stop_read = schedule_read.get_stops().at(i);
+      EXPECT_EQ(stop_read.get_station_name(), stop.get_station_name());
+      EXPECT_EQ(stop_read.get_begin_range(), stop.get_begin_range());
+      EXPECT_EQ(stop_read.get_end_range(), stop.get_end_range());
+      EXPECT_EQ(stop_read.get_min_stopping_time(),
+                stop.get_min_stopping_time());
+    }
+  }
+  EXPECT_EQ(instance_read.get_train_weights(), instance.get_train_weights());
+  EXPECT_EQ(instance_read.get_train_optional(), instance.get_train_optional());
+  EXPECT_EQ(instance_read.get_lambda(), instance.get_lambda());
+
+  // Stations and routes
+  EXPECT_EQ(instance_read.get_station_list().size(),
+            instance.get_station_list().size());
+  for (const auto& [name, station] : instance.get_station_list()) {
+    EXPECT_EQ(instance_read.get_station_list().get_station(name).tracks,
+              station.tracks);
+  }
+  EXPECT_EQ(instance_read.get_routes().size(), instance.get_routes().size());
+  for (const auto& [name, route] : instance.get_routes()) {
+    EXPECT_EQ(instance_read.get_route(name).get_edges(), route.get_edges());
+  }
+
+  // Corrupted snapshots are rejected
+  {
+    std::fstream file("./tmp/test-general-instance.bin",
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(-1, std::ios::end);
+    const auto last_byte = static_cast<char>(file.get());
+    file.seekp(-1, std::ios::end);
+    file.put(static_cast<char>(last_byte ^ 0x1));
+  }
+  EXPECT_THROW(cda_rail::instances::GeneralPerformanceOptimizationInstance::
+                   import_instance_binary("./tmp/test-general-instance.bin"),
+               cda_rail::exceptions::ImportException);
+  EXPECT_THROW(
+      cda_rail::instances::VSSGenerationTimetable::import_instance_binary(
+          "./tmp/test-general-instance.bin"),
+      cda_rail::exceptions::ImportException);
+
+  std::filesystem::remove_all("./tmp");
+}
+
 TEST(GeneralPerformanceOptimizationInstances,
      SolGeneralPerformanceOptimizationInstanceConsistency) {
   instances::GeneralPerformanceOptimizationInstance instance;
@@ -774,6 +884,33 @@ TEST(GeneralPerformanceOptimizationInstances,
   EXPECT_FALSE(sol2_read.get_instance().has_route("tr2"));
 }
 
+TEST(GeneralPerformanceOptimizationInstances, SolutionSharesInstance) {
+  const CopyOnWrite<instances::GeneralPerformanceOptimizationInstance> instance(
+      instances::GeneralPerformanceOptimizationInstance(
+          "./example-networks-gen-po/GeneralSimpleNetworkB3Trains/"));
+
+  // Solutions share the instance instead of copying it
+  instances::SolGeneralPerformanceOptimizationInstance<
+      instances::GeneralPerformanceOptimizationInstance>
+      sol1(instance);
+  const instances::SolGeneralPerformanceOptimizationInstance<
+      instances::GeneralPerformanceOptimizationInstance>
+      sol2(instance);
+  EXPECT_EQ(&sol1.get_instance(), &instance.get());
+  EXPECT_EQ(&sol2.get_instance(), &instance.get());
+
+  // Modifying the routes of one solution does not affect the others
+  const auto entry = instance->get_schedule("Train0_0").get_entry();
+  sol1.add_empty_route("Train0_0");
+  sol1.push_back_edge_to_route("Train0_0",
+                               instance->const_n().out_edges(entry)[0]);
+  EXPECT_NE(&sol1.get_instance(), &instance.get());
+  EXPECT_TRUE(sol1.get_instance().has_route("Train0_0"));
+  EXPECT_FALSE(instance->has_route("Train0_0"));
+  EXPECT_FALSE(sol2.get_instance().has_route("Train0_0"));
+  EXPECT_EQ(&sol2.get_instance(), &instance.get());
+}
+
 TEST(GeneralPerformanceOptimizationInstances, DiscretizationOfStops1) {
   // Create instance members
   Network network("./example-networks/SimpleStation/network/");
@@ -492,6 +492,38 @@ TEST(Solver, OvertakeFreeContinuous) {
   EXPECT_EQ(obj_val_braking.get_mip_obj(), 14);
 }
 
+TEST(Solver, OvertakeFreeContinuousReachability) {
+  cda_rail::solver::mip_based::VSSGenTimetableSolver solver(
+      "./example-networks/Overtake/");
+
+  std::filesystem::remove_all("tmp_reachability");
+
+  // Both models only differ in the reachability pruning
+  const auto obj_val_pruned = solver.solve(
+      {15, false, true, false}, {cda_rail::vss::Model(), false, true, true},
+      {},
+      {false, cda_rail::ExportOption::ExportLP, "pruned", "tmp_reachability"},
+      120);
+  const auto obj_val_full = solver.solve(
+      {15, false, true, false}, {cda_rail::vss::Model(), false, true, false},
+      {}, {false, cda_rail::ExportOption::ExportLP, "full", "tmp_reachability"},
+      120);
+
+  EXPECT_EQ(obj_val_pruned.get_status(), cda_rail::SolutionStatus::Optimal);
+  EXPECT_EQ(obj_val_full.get_status(), cda_rail::SolutionStatus::Optimal);
+  EXPECT_EQ(obj_val_pruned.get_obj(), 8);
+  EXPECT_EQ(obj_val_full.get_obj(), 8);
+
+  EXPECT_TRUE(obj_val_pruned.get_telemetry().has_phase("reachability"));
+  EXPECT_FALSE(obj_val_full.get_telemetry().has_phase("reachability"));
+
+  std::error_code ec;
+  EXPECT_LT(std::filesystem::file_size("tmp_reachability/pruned.mps", ec),
+            std::filesystem::file_size("tmp_reachability/full.mps", ec));
+
+  std::filesystem::remove_all("tmp_reachability");
+}
+
 TEST(Solver, Stammstrecke4FixedContinuous) {
   cda_rail::solver::mip_based::VSSGenTimetableSolver solver(
       "./example-networks/Stammstrecke4Trains/");
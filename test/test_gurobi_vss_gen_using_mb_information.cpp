@@ -1,10 +1,14 @@
+#define TEST_FRIENDS true
+
 #include "VSSModel.hpp"
 #include "solver/mip-based/VSSGenTimetableSolver.hpp"
 
 #include "gtest/gtest.h"
 #include <filesystem>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 TEST(VSSGenMBInfoSolver, Default1) {
   cda_rail::solver::mip_based::VSSGenTimetableSolverWithMovingBlockInformation
@@ -148,3 +152,98 @@ TEST(VSSGenMBInfoSolver, Default10) {
   EXPECT_EQ(sol.get_obj(), 17);
   EXPECT_EQ(sol.get_mip_obj(), 17);
 }
+
+TEST(VSSGenMBInfoSolver, WarmStart) {
+  const std::vector<std::string> paths{"SimpleStation",
+                                       "HighSpeedTrack2Trains"};
+
+  for (const auto& p : paths) {
+    cda_rail::solver::mip_based::
+        VSSGenTimetableSolverWithMovingBlockInformation solver(
+            "./example-networks-mb-solutions/" + p + "/");
+    cda_rail::solver::mip_based::ModelDetailMBInformation model_detail;
+    model_detail.use_as_warm_start = true;
+
+    const auto sol = solver.solve(model_detail);
+
+    EXPECT_TRUE(sol.get_telemetry().has_phase("set_moving_block_start"));
+    EXPECT_TRUE(sol.has_solution());
+    EXPECT_EQ(sol.get_status(), cda_rail::SolutionStatus::Optimal);
+
+    // The start does not restrict the model, hence, the optimal value equals
+    // the one of the unrestricted solver
+    cda_rail::solver::mip_based::VSSGenTimetableSolver solver_unrestricted(
+        solver.get_instance());
+    const auto sol_unrestricted =
+        solver_unrestricted.solve(cda_rail::solver::mip_based::ModelDetail{});
+
+    EXPECT_EQ(sol_unrestricted.get_status(),
+              cda_rail::SolutionStatus::Optimal);
+    EXPECT_EQ(sol.get_obj(), sol_unrestricted.get_obj());
+  }
+}
+
+TEST(VSSGenMBInfoSolver, WarmStartTimeShare) {
+  cda_rail::solver::mip_based::VSSGenTimetableSolverWithMovingBlockInformation
+      solver("./example-networks-mb-solutions/SimpleStation/");
+  cda_rail::solver::mip_based::ModelDetailMBInformation model_detail;
+  model_detail.use_as_warm_start     = true;
+  model_detail.warm_start_time_share = 0.1;
+
+  const auto sol = solver.solve(model_detail, {}, {}, {}, 60);
+
+  EXPECT_TRUE(sol.get_telemetry().has_phase("set_moving_block_start"));
+  EXPECT_TRUE(sol.has_solution());
+  EXPECT_EQ(sol.get_status(), cda_rail::SolutionStatus::Optimal);
+
+  model_detail.warm_start_time_share = 0;
+  EXPECT_THROW(solver.solve(model_detail),
+               cda_rail::exceptions::InvalidInputException);
+  model_detail.warm_start_time_share = 1.5;
+  EXPECT_THROW(solver.solve(model_detail),
+               cda_rail::exceptions::InvalidInputException);
+  model_detail.warm_start_time_share = 0.25;
+  model_detail.warm_start_max_time   = 0;
+  EXPECT_THROW(solver.solve(model_detail),
+               cda_rail::exceptions::InvalidInputException);
+}
+
+TEST(VSSGenMBInfoSolver, WarmStartHints) {
+  // The hints on approximate positions only restrict the start solution and
+  // are not kept for the unrestricted model
+  cda_rail::solver::mip_based::VSSGenTimetableSolverWithMovingBlockInformation
+      solver("./example-networks-mb-solutions/SimpleStation/");
+  const cda_rail::solver::mip_based::ModelDetailMBInformation model_detail;
+  const auto old_instance = solver.initialize_variables(
+      {model_detail.delta_t, true, model_detail.train_dynamics,
+       model_detail.braking_curves},
+      {}, {}, {}, -1, false);
+  solver.hint_approximate_positions = true;
+  solver.create_variables();
+  solver.set_objective();
+  solver.create_constraints();
+  solver.model->update();
+  const int num_constrs = solver.model->get(GRB_IntAttr_NumConstrs);
+
+  const auto number_of_hints = [&solver]() {
+    solver.model->update();
+    const int                       num_vars =
+        solver.model->get(GRB_IntAttr_NumVars);
+    const std::unique_ptr<GRBVar[]> model_vars(solver.model->getVars());
+    int                             ret_val = 0;
+    for (int i = 0; i < num_vars; ++i) {
+      if (model_vars[i].get(GRB_DoubleAttr_VarHintVal) != GRB_UNDEFINED) {
+        ++ret_val;
+      }
+    }
+    return ret_val;
+  };
+
+  solver.set_moving_block_start(60);
+  EXPECT_EQ(solver.model->get(GRB_IntAttr_NumConstrs), num_constrs);
+  EXPECT_EQ(number_of_hints(), 0);
+
+  // The same model is hinted if the information is included directly
+  solver.hint_approximate_positions_constraints();
+  EXPECT_GT(number_of_hints(), 0);
+}
@@ -1,12 +1,18 @@
+#include "CopyOnWrite.hpp"
 #include "CustomExceptions.hpp"
 #include "Definitions.hpp"
 #include "EOMHelper.hpp"
+#include "SolverTelemetry.hpp"
+#include "ThreadPool.hpp"
 #include "VSSModel.hpp"
 
 #include "gtest/gtest.h"
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 #define EXPECT_APPROX_EQ(a, b)                                                 \
   EXPECT_TRUE(std::abs((a) - (b)) < 1e-6) << (a) << " !=(approx.) " << (b)
@@ -288,6 +294,145 @@ TEST(Exceptions, Content) {
   EXPECT_EQ(std::string(e21.what()), "Schedule S21 does not exist.");
 }
 
+TEST(Helper, SolverTelemetry) {
+  cda_rail::SolverTelemetry telemetry;
+  EXPECT_TRUE(telemetry.empty());
+
+  telemetry.record("build", 1.5, 1.0, 1024);
+  telemetry.record("optimize", 2.0, 4.0, -512);
+  telemetry.record("build", 0.5, 0.25, 1024);
+  const auto result = telemetry.measure("extract", []() { return 7; });
+  EXPECT_EQ(result, 7);
+
+  ASSERT_EQ(telemetry.get_phases().size(), 3);
+  EXPECT_EQ(telemetry.get_phases().at(0).name, "build");
+  EXPECT_EQ(telemetry.get_phases().at(1).name, "optimize");
+  EXPECT_EQ(telemetry.get_phases().at(2).name, "extract");
+
+  const auto& build = telemetry.get_phase("build");
+  EXPECT_EQ(build.calls, 2);
+  EXPECT_DOUBLE_EQ(build.wall_seconds, 2.0);
+  EXPECT_DOUBLE_EQ(build.cpu_seconds, 1.25);
+  EXPECT_EQ(build.rss_delta_bytes, 2048);
+  EXPECT_EQ(telemetry.get_phase("optimize").rss_delta_bytes, -512);
+  EXPECT_EQ(telemetry.get_phase("extract").calls, 1);
+  EXPECT_GE(telemetry.get_phase("extract").wall_seconds, 0);
+  EXPECT_GE(telemetry.total_wall_seconds(), 4.0);
+  EXPECT_TRUE(telemetry.has_phase("optimize"));
+  EXPECT_FALSE(telemetry.has_phase("discretize"));
+  EXPECT_THROW(telemetry.get_phase("discretize"),
+               cda_rail::exceptions::InvalidInputException);
+
+  const auto j = telemetry.to_json();
+  ASSERT_EQ(j.size(), 3);
+  EXPECT_EQ(j[0]["name"], "build");
+  EXPECT_EQ(j[0]["calls"], 2);
+  EXPECT_EQ(j[1]["rss_delta_bytes"], -512);
+
+  EXPECT_GE(cda_rail::process_cpu_seconds(), 0);
+  const auto rss_bytes = cda_rail::process_rss_bytes();
+  EXPECT_GE(rss_bytes, 0);
+  EXPECT_GE(cda_rail::process_peak_rss_bytes(), rss_bytes);
+
+  telemetry.clear();
+  EXPECT_TRUE(telemetry.empty());
+}
+
+TEST(Helper, CopyOnWrite) {
+  const cda_rail::CopyOnWrite<std::vector<int>> v1(std::vector<int>{1, 2, 3});
+  EXPECT_EQ(v1.use_count(), 1);
+  EXPECT_EQ(v1->size(), 3);
+
+  // Copies share the value
+  auto v2 = v1;
+  EXPECT_TRUE(v2.shares_with(v1));
+  EXPECT_EQ(v1.use_count(), 2);
+  EXPECT_EQ(&v1.get(), &v2.get());
+
+  // Modifying a shared value creates a private copy
+  v2.edit().push_back(4);
+  EXPECT_FALSE(v2.shares_with(v1));
+  EXPECT_EQ(v1.use_count(), 1);
+  EXPECT_EQ(*v1, std::vector<int>({1, 2, 3}));
+  EXPECT_EQ(*v2, std::vector<int>({1, 2, 3, 4}));
+
+  // A value that is not shared is modified in place
+  const auto* v2_address = &v2.get();
+  v2.edit().push_back(5);
+  EXPECT_EQ(&v2.get(), v2_address);
+  EXPECT_EQ(v2->size(), 5);
+
+  // Values shared as const are never modified in place
+  const auto shared_value =
+      std::make_shared<const std::vector<int>>(std::vector<int>{6});
+  cda_rail::CopyOnWrite<std::vector<int>> v3(shared_value);
+  EXPECT_EQ(v3.share(), shared_value);
+  v3.edit().push_back(7);
+  EXPECT_EQ(*shared_value, std::vector<int>({6}));
+  EXPECT_EQ(*v3, std::vector<int>({6, 7}));
+}
+
+TEST(Helper, ThreadPool) {
+  EXPECT_EQ(cda_rail::resolve_num_threads(4, 2), 2);
+  EXPECT_EQ(cda_rail::resolve_num_threads(4, 0), 1);
+  EXPECT_GE(cda_rail::resolve_num_threads(0, 100), 1);
+
+  cda_rail::ThreadPool pool(4);
+  EXPECT_EQ(pool.size(), 4);
+
+  // The workers are reused by every loop
+  for (size_t loop = 0; loop < 20; ++loop) {
+    std::vector<size_t> values(1000, 0);
+    std::atomic<bool>   valid_worker(true);
+    pool.parallel_for(values.size(), [&](size_t i, size_t worker) {
+      values.at(i) = i + loop;
+      if (worker >= pool.size()) {
+        valid_worker = false;
+      }
+    });
+    EXPECT_TRUE(valid_worker);
+    for (size_t i = 0; i < values.size(); ++i) {
+      EXPECT_EQ(values.at(i), i + loop);
+    }
+  }
+
+  // All indices are processed and the exception of the smallest index is
+  // rethrown
+  std::atomic<size_t> processed(0);
+  try {
+    pool.parallel_for(100, [&processed](size_t i, size_t /*worker*/) {
+      processed++;
+      if (i % 10 == 3) {
+        throw std::runtime_error(std::to_string(i));
+      }
+    });
+    ADD_FAILURE() << "No exception thrown";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()), "3");
+  }
+  EXPECT_EQ(processed, 100);
+
+  // The pool is still usable after an exception
+  std::atomic<size_t> sum(0);
+  pool.parallel_for(10, [&sum](size_t i, size_t /*worker*/) { sum += i; });
+  EXPECT_EQ(sum, 45);
+
+  std::vector<size_t> values(50, 0);
+  cda_rail::parallel_for(values.size(), 0,
+                         [&values](size_t i, size_t /*worker*/) {
+                           values.at(i) = 2 * i;
+                         });
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values.at(i), 2 * i);
+  }
+  EXPECT_THROW(cda_rail::parallel_for(
+                   5, 1,
+                   [](size_t /*i*/, size_t /*worker*/) {
+                     throw std::runtime_error("sequential");
+                   }),
+               std::runtime_error);
+}
+
 TEST(Helper, EoMMinimalTravelTime1) {
   // Start at speed 10,
   // accelerate at rate 2 for 5 seconds until maximal speed 20 is reached,
@@ -927,6 +1072,84 @@ TEST(Helper, EoMMaximalTravelTimeStopping) {
       cda_rail::max_travel_time_to_end(10, 5, 1, 1, 2, 40, 40, true), 0);
 }
 
+TEST(Helper, EoMBatch) {
+  // Batch evaluation agrees with the scalar functions on a grid of inputs
+  cda_rail::EOMBatch               batch;
+  std::vector<std::vector<double>> inputs;
+  for (const double v_1 : {0.0, 5.0, 10.0, 20.0}) {
+    for (const double v_2 : {0.0, 5.0, 10.0, 20.0}) {
+      for (const double a : {0.5, 2.0}) {
+        for (const double d : {0.5, 2.0}) {
+          for (const double s : {1.0, 50.0, 500.0}) {
+            for (const double x_rel : {0.0, 0.3, 1.0}) {
+              if (!cda_rail::possible_by_eom(v_1, v_2, a, d, s)) {
+                continue;
+              }
+              batch.add(v_1, v_2, 25, a, d, s, x_rel * s);
+              inputs.push_back({v_1, v_2, 25, a, d, s, x_rel * s});
+            }
+          }
+        }
+      }
+    }
+  }
+  EXPECT_EQ(batch.size(), inputs.size());
+  EXPECT_FALSE(batch.empty());
+
+  const auto min_from_start       = batch.min_travel_time_from_start();
+  const auto min_to_end           = batch.min_travel_time_to_end();
+  const auto max_from_start       = batch.max_travel_time_from_start(false);
+  const auto max_to_end           = batch.max_travel_time_to_end(false);
+  const auto max_from_start_stops = batch.max_travel_time_from_start(true);
+  const auto max_to_end_stops     = batch.max_travel_time_to_end(true);
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const auto& in = inputs.at(i);
+    EXPECT_DOUBLE_EQ(min_from_start.at(i),
+                     cda_rail::min_travel_time_from_start(
+                         in[0], in[1], in[2], in[3], in[4], in[5], in[6]));
+    EXPECT_DOUBLE_EQ(min_to_end.at(i),
+                     cda_rail::min_travel_time_to_end(in[0], in[1], in[2],
+                                                      in[3], in[4], in[5],
+                                                      in[6]));
+    EXPECT_DOUBLE_EQ(max_from_start.at(i),
+                     cda_rail::max_travel_time_from_start(
+                         in[0], in[1], in[2], in[3], in[4], in[5], in[6],
+                         false));
+    EXPECT_DOUBLE_EQ(max_to_end.at(i),
+                     cda_rail::max_travel_time_to_end(in[0], in[1], in[2],
+                                                      in[3], in[4], in[5],
+                                                      in[6], false));
+    EXPECT_DOUBLE_EQ(max_from_start_stops.at(i),
+                     cda_rail::max_travel_time_from_start(
+                         in[0], in[1], in[2], in[3], in[4], in[5], in[6],
+                         true));
+    EXPECT_DOUBLE_EQ(max_to_end_stops.at(i),
+                     cda_rail::max_travel_time_to_end(in[0], in[1], in[2],
+                                                      in[3], in[4], in[5],
+                                                      in[6], true));
+  }
+
+  // Inputs are validated when added
+  EXPECT_THROW(batch.add(-1, 5, 25, 1, 1, 50, 0),
+               cda_rail::exceptions::ConsistencyException);
+  EXPECT_THROW(batch.add(5, 5, 25, 1, 1, 50, 60),
+               cda_rail::exceptions::ConsistencyException);
+  EXPECT_THROW(batch.add(0, 20, 25, 1, 1, 50),
+               cda_rail::exceptions::ConsistencyException);
+  EXPECT_EQ(batch.size(), inputs.size());
+
+  // Speed bounds are checked per batch
+  cda_rail::EOMBatch invalid_speed_batch;
+  invalid_speed_batch.add(10, 5, 8, 1, 1, 50);
+  EXPECT_THROW(invalid_speed_batch.min_travel_time_from_start(),
+               cda_rail::exceptions::ConsistencyException);
+  EXPECT_NO_THROW(invalid_speed_batch.max_travel_time_from_start(false));
+
+  batch.clear();
+  EXPECT_TRUE(batch.empty());
+  EXPECT_TRUE(batch.min_travel_time_from_start().empty());
+}
+
 TEST(Helper, EoMMinimalTimePushMA) {
   // Start at speed 10 with a = 2 and d = 1
   // Current braking distance is 10*10/2 = 50
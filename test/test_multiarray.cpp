@@ -38,3 +38,137 @@ TEST(Functionality, MultiArray) {
   EXPECT_THROW(a1(0, 2, 0), std::out_of_range);
   EXPECT_THROW(a1(0, 0, 3), std::out_of_range);
 }
+
+TEST(Functionality, SparseMultiArray) {
+  auto a1 = cda_rail::MultiArray<size_t>::sparse(100, 200, 300);
+
+  EXPECT_TRUE(a1.is_sparse());
+  EXPECT_EQ(a1.size(), 6000000);
+  EXPECT_EQ(a1.stored_elements(), 0);
+  EXPECT_EQ(a1.dimensions(), 3);
+  EXPECT_EQ(a1.get_shape(), std::vector<size_t>({100, 200, 300}));
+
+  a1(1, 2, 3)    = 5;
+  a1(99, 199, 0) = 7;
+
+  EXPECT_EQ(a1.stored_elements(), 2);
+  EXPECT_EQ(a1.at(1, 2, 3), 5);
+  EXPECT_EQ(a1.at(99, 199, 0), 7);
+  EXPECT_TRUE(a1.contains(1, 2, 3));
+  EXPECT_FALSE(a1.contains(3, 2, 1));
+
+  // Reading a missing element via at does not create it
+  EXPECT_EQ(a1.at(3, 2, 1), 0);
+  EXPECT_EQ(a1.stored_elements(), 2);
+
+  EXPECT_THROW(a1(0, 0), std::invalid_argument);
+  EXPECT_THROW(a1.at(100, 0, 0), std::out_of_range);
+  EXPECT_THROW(a1(0, 0, 300), std::out_of_range);
+
+  cda_rail::MultiArray<size_t> a2(2, 3);
+  EXPECT_FALSE(a2.is_sparse());
+  EXPECT_EQ(a2.stored_elements(), 6);
+  EXPECT_TRUE(a2.contains(1, 2));
+}
+
+TEST(Functionality, MultiArrayTransform) {
+  cda_rail::MultiArray<int> a1(2, 3);
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      a1(i, j) = static_cast<int>(3 * i + j);
+    }
+  }
+  const auto a2 = a1.transform<double>([](int x) { return 0.5 * x; });
+  EXPECT_FALSE(a2.is_sparse());
+  EXPECT_EQ(a2.get_shape(), a1.get_shape());
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_DOUBLE_EQ(a2.at(i, j), 0.5 * static_cast<double>(3 * i + j));
+    }
+  }
+
+  auto a3      = cda_rail::MultiArray<int>::sparse(10, 20, 30);
+  a3(1, 2, 3)  = 4;
+  a3(9, 19, 0) = -2;
+  const auto a4 =
+      a3.transform<size_t>([](int x) { return static_cast<size_t>(x * x); });
+  EXPECT_TRUE(a4.is_sparse());
+  EXPECT_EQ(a4.get_shape(), a3.get_shape());
+  EXPECT_EQ(a4.stored_elements(), 2);
+  EXPECT_EQ(a4.at(1, 2, 3), 16);
+  EXPECT_EQ(a4.at(9, 19, 0), 4);
+  EXPECT_FALSE(a4.contains(0, 0, 0));
+  EXPECT_EQ(a4.at(0, 0, 0), 0);
+}
+
+TEST(Functionality, FixedRankMultiArray) {
+  cda_rail::FixedRankMultiArray<size_t, 3> a1(1, 2, 3);
+
+  for (size_t i = 0; i < 1; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      for (size_t k = 0; k < 3; ++k) {
+        a1(i, j, k) = 6 * i + 3 * j + k;
+      }
+    }
+  }
+  for (size_t i = 0; i < 1; ++i) {
+    for (size_t j = 0; j < 2; ++j) {
+      for (size_t k = 0; k < 3; ++k) {
+        EXPECT_EQ(a1.at(i, j, k), 6 * i + 3 * j + k);
+      }
+    }
+  }
+
+  EXPECT_EQ(a1.size(), 6);
+  EXPECT_EQ(a1.stored_elements(), 6);
+  EXPECT_EQ(decltype(a1)::dimensions(), 3);
+  EXPECT_EQ(a1.get_shape()[2], 3);
+  EXPECT_FALSE(a1.is_sparse());
+
+  EXPECT_THROW(a1(1, 0, 0), std::out_of_range);
+  EXPECT_THROW(a1(0, 2, 0), std::out_of_range);
+  EXPECT_THROW(a1(0, 0, 3), std::out_of_range);
+
+  auto a2 = cda_rail::FixedRankMultiArray<int, 2>::sparse(1000, 1000);
+  EXPECT_TRUE(a2.is_sparse());
+  EXPECT_EQ(a2.size(), 1000000);
+  a2(999, 5) = -1;
+  EXPECT_EQ(a2.stored_elements(), 1);
+  EXPECT_EQ(a2.at(999, 5), -1);
+  EXPECT_EQ(a2.at(5, 999), 0);
+  EXPECT_FALSE(a2.contains(5, 999));
+}
+
+TEST(Functionality, FixedRankMultiArrayConversion) {
+  cda_rail::FixedRankMultiArray<int, 2> a1(2, 3);
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      a1(i, j) = static_cast<int>(3 * i + j);
+    }
+  }
+
+  const auto a2 = a1.transform<double>([](int x) { return 0.5 * x; });
+  EXPECT_EQ(decltype(a2)::dimensions(), 2);
+  EXPECT_EQ(a2.get_shape()[0], 2);
+  EXPECT_EQ(a2.get_shape()[1], 3);
+  EXPECT_DOUBLE_EQ(a2.at(1, 2), 2.5);
+
+  const auto a3 = a1.to_multi_array();
+  EXPECT_EQ(a3.dimensions(), 2);
+  EXPECT_EQ(a3.size(), 6);
+  EXPECT_FALSE(a3.is_sparse());
+  for (size_t i = 0; i < 2; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_EQ(a3.at(i, j), a1.at(i, j));
+    }
+  }
+  EXPECT_THROW(a3.at(2, 0), std::out_of_range);
+
+  auto a4 = cda_rail::FixedRankMultiArray<int, 3>::sparse(10, 10, 10);
+  a4(1, 2, 3) = 7;
+  const auto a5 = a4.to_multi_array();
+  EXPECT_TRUE(a5.is_sparse());
+  EXPECT_EQ(a5.stored_elements(), 1);
+  EXPECT_EQ(a5.at(1, 2, 3), 7);
+  EXPECT_EQ(a5.at(3, 2, 1), 0);
+}
@@ -402,6 +402,45 @@ TEST(Functionality, VSSGenerationTimetableInstanceImport3) {
   check_instance_import(instance);
 }
 
+TEST(Functionality, VSSGenerationTimetableBinarySnapshot) {
+  const auto instance =
+      cda_rail::instances::VSSGenerationTimetable::import_instance(
+          "./example-networks/SimpleStation/");
+
+  instance.export_instance_binary("./tmp/test-instance.bin");
+  const auto instance_read =
+      cda_rail::instances::VSSGenerationTimetable::import_instance_binary(
+          "./tmp/test-instance.bin");
+  std::filesystem::remove_all("./tmp");
+
+  check_instance_import(instance_read);
+}
+
+TEST(Functionality, VSSGenerationTimetableBinarySnapshotDiscretized) {
+  auto instance = cda_rail::instances::VSSGenerationTimetable::import_instance(
+      "./example-networks/SimpleStation/");
+  instance.discretize();
+
+  instance.export_instance_binary("./tmp/test-instance-discretized.bin");
+  const auto instance_read =
+      cda_rail::instances::VSSGenerationTimetable::import_instance_binary(
+          "./tmp/test-instance-discretized.bin");
+  std::filesystem::remove_all("./tmp");
+
+  // The mapping to the original edges is kept
+  const auto& network      = instance.const_n();
+  const auto& network_read = instance_read.const_n();
+  ASSERT_EQ(network_read.number_of_edges(), network.number_of_edges());
+  size_t num_transformed = 0;
+  for (size_t e = 0; e < network.number_of_edges(); ++e) {
+    EXPECT_EQ(network_read.get_old_edge(e), network.get_old_edge(e));
+    if (network.get_old_edge(e).first != e) {
+      num_transformed++;
+    }
+  }
+  EXPECT_GT(num_transformed, 0);
+}
+
 TEST(Functionality, VSSGenerationTimetableExport) {
   cda_rail::instances::VSSGenerationTimetable instance;
 
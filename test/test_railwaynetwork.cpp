@@ -8,6 +8,10 @@
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <optional>
 
 using json = nlohmann::json;
@@ -845,6 +849,142 @@ TEST(Functionality, NetworkBackwardPathsFromEdge) {
   EXPECT_EQ(backward_paths_5.size(), 0);
 }
 
+TEST(Functionality, NetworkPathsCache) {
+  cda_rail::Network network;
+
+  const auto v_0 = network.add_vertex("v0", cda_rail::VertexType::NoBorder);
+  const auto v_1 = network.add_vertex("v1", cda_rail::VertexType::NoBorder);
+  const auto v_2 = network.add_vertex("v2", cda_rail::VertexType::NoBorder);
+  const auto v_3 = network.add_vertex("v3", cda_rail::VertexType::NoBorder);
+
+  const auto e_0_1 = network.add_edge(v_0, v_1, 100, 10);
+  const auto e_1_2 = network.add_edge(v_1, v_2, 50, 10);
+  const auto e_1_3 = network.add_edge(v_1, v_3, 80, 10);
+  network.add_successor(e_0_1, e_1_2);
+
+  const std::vector<std::vector<size_t>> expected_0 = {{e_0_1, e_1_2}};
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120),
+            expected_0);
+  // Repeated queries are answered identically
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120),
+            expected_0);
+  // and answered from one cache entry
+  EXPECT_EQ(network.number_of_cached_route_queries(), 1);
+  // The order of the edge filter does not matter
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120, {},
+                                                           {e_1_2, e_0_1}),
+            expected_0);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120, {},
+                                                           {e_0_1, e_1_2}),
+            expected_0);
+  EXPECT_TRUE(
+      network.all_paths_of_length_starting_in_vertex(v_0, 120, {}, {e_1_2})
+          .empty());
+
+  // Modifications of the network invalidate cached routes
+  network.add_successor(e_0_1, e_1_3);
+  const std::vector<std::vector<size_t>> expected_1 = {{e_0_1, e_1_2},
+                                                       {e_0_1, e_1_3}};
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120),
+            expected_1);
+
+  network.change_edge_length(e_0_1, 150);
+  const std::vector<std::vector<size_t>> expected_2 = {{e_0_1}};
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120),
+            expected_2);
+
+  // Copies of the network answer queries independently
+  auto network_copy = network;
+  network_copy.change_edge_length(e_0_1, 100);
+  EXPECT_EQ(network_copy.all_paths_of_length_starting_in_vertex(v_0, 120),
+            expected_1);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 120),
+            expected_2);
+}
+
+TEST(Functionality, NetworkPathsCacheBuckets) {
+  cda_rail::Network network;
+
+  const auto v_0 = network.add_vertex("v0", cda_rail::VertexType::NoBorder);
+  const auto v_1 = network.add_vertex("v1", cda_rail::VertexType::NoBorder);
+  const auto v_2 = network.add_vertex("v2", cda_rail::VertexType::NoBorder);
+  const auto v_3 = network.add_vertex("v3", cda_rail::VertexType::NoBorder);
+  const auto v_4 = network.add_vertex("v4", cda_rail::VertexType::NoBorder);
+
+  // v_2 is a dead end, v_3 leads on to v_4
+  const auto e_0_1 = network.add_edge(v_0, v_1, 100, 10);
+  const auto e_1_2 = network.add_edge(v_1, v_2, 10, 10);
+  const auto e_1_3 = network.add_edge(v_1, v_3, 15, 10);
+  const auto e_3_4 = network.add_edge(v_3, v_4, 100, 10);
+  network.add_successor(e_0_1, e_1_2);
+  network.add_successor(e_0_1, e_1_3);
+  network.add_successor(e_1_3, e_3_4);
+
+  // Lengths within one bucket share a single cache entry, even though the
+  // routes differ
+  const std::vector<std::vector<size_t>> expected_105 = {{e_0_1, e_1_2},
+                                                         {e_0_1, e_1_3}};
+  const std::vector<std::vector<size_t>> expected_112 = {{e_0_1, e_1_3}};
+  const std::vector<std::vector<size_t>> expected_140 = {
+      {e_0_1, e_1_3, e_3_4}};
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 140),
+            expected_140);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 105),
+            expected_105);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 112),
+            expected_112);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 101),
+            expected_105);
+  EXPECT_EQ(network.number_of_cached_route_queries(), 1);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 300).size(),
+            0);
+  EXPECT_EQ(network.number_of_cached_route_queries(), 2);
+
+  // The exit node ends routes independent of the length
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 140, v_3),
+            expected_112);
+
+  // The number of cached queries is bounded
+  for (size_t i = 1; i <= 5000; ++i) {
+    EXPECT_LE(network
+                  .all_paths_of_length_starting_in_vertex(
+                      v_0, 50.0 * static_cast<double>(i))
+                  .size(),
+              1);
+  }
+  EXPECT_EQ(network.number_of_cached_route_queries(), 4096);
+  EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v_0, 140),
+            expected_140);
+
+  // Derived routes equal the ones of a recursive enumeration
+  std::function<void(std::vector<std::vector<size_t>>&, std::vector<size_t>&,
+                     double)>
+      enumerate = [&](std::vector<std::vector<size_t>>& routes,
+                      std::vector<size_t>& route, double remaining_length) {
+        const auto& e_len = network.get_edge(route.back()).length;
+        if (e_len >= remaining_length) {
+          routes.push_back(route);
+          return;
+        }
+        for (const auto& e_next : network.get_successors(route.back())) {
+          route.push_back(e_next);
+          enumerate(routes, route, remaining_length - e_len);
+          route.pop_back();
+        }
+      };
+  for (double len = 1; len <= 250; len += 1.5) {
+    for (const auto& v : {v_0, v_1, v_3}) {
+      std::vector<std::vector<size_t>> expected;
+      for (const auto& e : network.out_edges(v)) {
+        std::vector<size_t> route = {e};
+        enumerate(expected, route, len);
+      }
+      EXPECT_EQ(network.all_paths_of_length_starting_in_vertex(v, len),
+                expected);
+    }
+  }
+}
+
 TEST(Functionality, NetworkSections) {
   cda_rail::Network network;
 
@@ -1373,6 +1513,189 @@ TEST(Functionality, WriteNetwork) {
   }
 }
 
+TEST(Functionality, ReadNetworkGraphMLStreaming) {
+  // Comments, entities, CDATA sections, self-closing elements and single
+  // quotes are handled by the streaming reader
+  std::filesystem::create_directories("./tmp/streaming-network");
+  {
+    std::ofstream file("./tmp/streaming-network/tracks.graphml");
+    file << R"(<?xml version='1.0' encoding='utf-8'?>
+<graphml xmlns="http://graphml.graphdrawing.org/xmlns">
+  <!-- <node id="commented"> -->
+  <key id="d0" for="node" attr.name="type" attr.type="long"/>
+  <key id="d1" for="node" attr.name="headway" attr.type="double"/>
+  <key id='d2' for='edge' attr.name='length' attr.type='double'/>
+  <key id="d3" for="edge" attr.name="max_speed" attr.type="double"/>
+  <key id="d4" for="edge" attr.name="breakable" attr.type="boolean"/>
+  <key id="d5" for="edge" attr.name="min_block_length" attr.type="double"/>
+  <graph edgedefault="directed">
+    <node id="v&amp;0"><data key="d0">2</data><data key="d1"> 5.5 </data></node>
+    <node id="v&#49;"><data key="d0"><![CDATA[1]]></data></node>
+    <edge source="v&amp;0" target="v1">
+      <data key="d2">100</data>
+      <data key="d3">10</data>
+      <data key="d4">True</data>
+      <data key="d5">10</data>
+    </edge>
+    <edge source="v1" target="v&amp;0"><data key="d2">100</data><data
+      key="d3">10</data><data key="d4">false</data><data key="d5">1</data>
+    </edge>
+  </graph>
+</graphml>)";
+  }
+  {
+    std::ofstream file("./tmp/streaming-network/successors_cpp.json");
+    file << "{}" << std::endl;
+  }
+
+  const cda_rail::Network network("./tmp/streaming-network");
+  std::filesystem::remove_all("./tmp");
+
+  EXPECT_EQ(network.number_of_vertices(), 2);
+  EXPECT_EQ(network.number_of_edges(), 2);
+
+  const auto v0 = network.get_vertex_index("v&0");
+  const auto v1 = network.get_vertex_index("v1");
+  EXPECT_EQ(network.get_vertex(v0).type, cda_rail::VertexType::TTD);
+  EXPECT_EQ(network.get_vertex(v0).headway, 5.5);
+  EXPECT_EQ(network.get_vertex(v1).type, cda_rail::VertexType::VSS);
+  EXPECT_EQ(network.get_vertex(v1).headway, 0);
+
+  const auto& e_0_1 = network.get_edge(v0, v1);
+  EXPECT_EQ(e_0_1.length, 100);
+  EXPECT_EQ(e_0_1.max_speed, 10);
+  EXPECT_TRUE(e_0_1.breakable);
+  EXPECT_EQ(e_0_1.min_block_length, 10);
+  EXPECT_EQ(e_0_1.min_stop_block_length, 100);
+  EXPECT_FALSE(network.get_edge(v1, v0).breakable);
+  EXPECT_EQ(network.out_edges(v0), std::vector<size_t>({0}));
+  EXPECT_EQ(network.in_edges(v0), std::vector<size_t>({1}));
+}
+
+TEST(Functionality, ReadNetworkGraphMLFirstText) {
+  // As for tinyxml2, only the first text of a data element is its value
+  std::filesystem::create_directories("./tmp/first-text-network");
+  {
+    std::ofstream file("./tmp/first-text-network/tracks.graphml");
+    file << R"(<?xml version='1.0' encoding='utf-8'?>
+<graphml xmlns="http://graphml.graphdrawing.org/xmlns">
+  <key id="d0" for="node" attr.name="type" attr.type="long"/>
+  <key id="d2" for="edge" attr.name="length" attr.type="double"/>
+  <key id="d3" for="edge" attr.name="max_speed" attr.type="double"/>
+  <key id="d4" for="edge" attr.name="breakable" attr.type="boolean"/>
+  <key id="d5" for="edge" attr.name="min_block_length" attr.type="double"/>
+  <graph edgedefault="directed">
+    <node id="v0"><data key="d0">2</data></node>
+    <node id="v1"><data key="d0">2<!-- 3 -->3</data></node>
+    <edge source="v0" target="v1">
+      <data key="d2">100<unit>5</unit>7</data>
+      <data key="d3">1<![CDATA[0]]></data>
+      <data key="d4">  <![CDATA[true]]>  </data>
+      <data key="d5">10</data>
+    </edge>
+  </graph>
+</graphml>)";
+  }
+  {
+    std::ofstream file("./tmp/first-text-network/successors_cpp.json");
+    file << "{}" << std::endl;
+  }
+
+  const cda_rail::Network network("./tmp/first-text-network");
+  std::filesystem::remove_all("./tmp");
+
+  EXPECT_EQ(network.get_vertex("v1").type, cda_rail::VertexType::TTD);
+  const auto& edge = network.get_edge("v0", "v1");
+  EXPECT_EQ(edge.length, 100);
+  EXPECT_EQ(edge.max_speed, 1);
+  EXPECT_TRUE(edge.breakable);
+}
+
+TEST(Functionality, ReadNetworkGraphMLMalformed) {
+  const std::string keys =
+      R"(<key id="d0" for="node" attr.name="type" attr.type="long"/>
+  <key id="d2" for="edge" attr.name="length" attr.type="double"/>
+  <key id="d3" for="edge" attr.name="max_speed" attr.type="double"/>
+  <key id="d4" for="edge" attr.name="breakable" attr.type="boolean"/>
+  <key id="d5" for="edge" attr.name="min_block_length" attr.type="double"/>
+)";
+  const std::vector<std::string> malformed_files = {
+      // Unterminated attribute value
+      "<graphml>" + keys + R"(<graph edgedefault="directed"><node id="v0)",
+      // Unterminated elements
+      "<graphml>" + keys +
+          R"(<graph edgedefault="directed"><node id="v0"><data key="d0">2)",
+      "<graphml>" + keys + R"(<graph edgedefault="directed"></graph>)",
+      // Mismatched end tags
+      "<graphml>" + keys +
+          R"(<graph edgedefault="directed"><node id="v0"><data key="d0">2)"
+          R"(</node></data></graph></graphml>)",
+      "<graphml>" + keys +
+          R"(<graph edgedefault="directed"></graph></graphml )",
+      // Unterminated comment and tag
+      "<graphml>" + keys + R"(<!-- <graph edgedefault="directed">)",
+      "<graphml>" + keys + R"(<graph edgedefault="directed")",
+      // No graph
+      "<graphml>" + keys + "</graphml>",
+      // Wrong root
+      "<graph>" + keys + R"(<graph edgedefault="directed"></graph></graph>)"};
+
+  for (const auto& content : malformed_files) {
+    std::filesystem::create_directories("./tmp/malformed-network");
+    {
+      std::ofstream file("./tmp/malformed-network/tracks.graphml");
+      file << content;
+    }
+    {
+      std::ofstream file("./tmp/malformed-network/successors_cpp.json");
+      file << "{}" << std::endl;
+    }
+    EXPECT_THROW(cda_rail::Network("./tmp/malformed-network"),
+                 cda_rail::exceptions::ImportException)
+        << content;
+    std::filesystem::remove_all("./tmp");
+  }
+}
+
+TEST(Functionality, ReadNetworkGraphMLDocumentType) {
+  // Files with a document type declaration are read using tinyxml2
+  std::filesystem::create_directories("./tmp/doctype-network");
+  {
+    std::ofstream file("./tmp/doctype-network/tracks.graphml");
+    file << R"(<?xml version='1.0' encoding='utf-8'?>
+<!DOCTYPE graphml>
+<graphml xmlns="http://graphml.graphdrawing.org/xmlns">
+  <key id="d0" for="node" attr.name="type" attr.type="long"/>
+  <key id="d2" for="edge" attr.name="length" attr.type="double"/>
+  <key id="d3" for="edge" attr.name="max_speed" attr.type="double"/>
+  <key id="d4" for="edge" attr.name="breakable" attr.type="boolean"/>
+  <key id="d5" for="edge" attr.name="min_block_length" attr.type="double"/>
+  <graph edgedefault="directed">
+    <node id="v0"><data key="d0">2</data></node>
+    <node id="v1"><data key="d0">1</data></node>
+    <edge source="v0" target="v1">
+      <data key="d2">100</data>
+      <data key="d3">10</data>
+      <data key="d4">true</data>
+      <data key="d5">10</data>
+    </edge>
+  </graph>
+</graphml>)";
+  }
+  {
+    std::ofstream file("./tmp/doctype-network/successors_cpp.json");
+    file << "{}" << std::endl;
+  }
+
+  const cda_rail::Network network("./tmp/doctype-network");
+  std::filesystem::remove_all("./tmp");
+
+  EXPECT_EQ(network.number_of_vertices(), 2);
+  EXPECT_EQ(network.number_of_edges(), 1);
+  EXPECT_EQ(network.get_vertex("v1").type, cda_rail::VertexType::VSS);
+  EXPECT_EQ(network.get_edge("v0", "v1").length, 100);
+}
+
 TEST(Functionality, NetworkEdgeSeparation) {
   cda_rail::Network network;
   // Add vertices
@@ -2252,6 +2575,113 @@ TEST(Functionality, NetworkEdgeSeparationReverse) {
   EXPECT_EQ(network.get_old_edge("v1_v2_0", "v1"), expected_pair);
 }
 
+TEST(Functionality, NetworkAdjacencyIndex) {
+  cda_rail::Network network;
+  network.add_vertex("v0", cda_rail::VertexType::TTD);
+  network.add_vertex("v1", cda_rail::VertexType::TTD);
+  network.add_vertex("v2", cda_rail::VertexType::TTD);
+  network.add_vertex("v3", cda_rail::VertexType::TTD);
+
+  const auto v0_v1 = network.add_edge("v0", "v1", 100, 100, false);
+  const auto v1_v2 = network.add_edge("v1", "v2", 40, 100, true, 10);
+  const auto v2_v3 = network.add_edge("v2", "v3", 100, 100, false);
+  const auto v2_v1 = network.add_edge("v2", "v1", 40, 100, true, 10);
+  const auto v1_v0 = network.add_edge("v1", "v0", 100, 100, false);
+
+  network.add_successor(v0_v1, v1_v2);
+  network.add_successor(v1_v2, v2_v3);
+  network.add_successor(v2_v1, v1_v0);
+
+  const auto out_v1 = network.out_edges_span(network.get_vertex_index("v1"));
+  EXPECT_EQ(std::vector<size_t>(out_v1.begin(), out_v1.end()),
+            std::vector<size_t>({v1_v2, v1_v0}));
+  const auto in_v1 = network.in_edges_span(network.get_vertex_index("v1"));
+  EXPECT_EQ(std::vector<size_t>(in_v1.begin(), in_v1.end()),
+            std::vector<size_t>({v0_v1, v2_v1}));
+  EXPECT_TRUE(network.in_edges_span(network.get_vertex_index("v0")).size() ==
+              1);
+  EXPECT_THROW(network.out_edges_span(4),
+               cda_rail::exceptions::VertexNotExistentException);
+  EXPECT_THROW(network.in_edges_span(4),
+               cda_rail::exceptions::VertexNotExistentException);
+
+  // Separating edges moves the source of the original edges. The index has to
+  // coincide with a full scan over all edges afterwards.
+  network.discretize();
+  EXPECT_GT(network.number_of_vertices(), 4);
+
+  for (size_t v = 0; v < network.number_of_vertices(); ++v) {
+    std::vector<size_t> expected_out;
+    std::vector<size_t> expected_in;
+    for (size_t e = 0; e < network.number_of_edges(); ++e) {
+      if (network.get_edge(e).source == v) {
+        expected_out.push_back(e);
+      }
+      if (network.get_edge(e).target == v) {
+        expected_in.push_back(e);
+      }
+    }
+    const auto out_span = network.out_edges_span(v);
+    const auto in_span  = network.in_edges_span(v);
+    EXPECT_EQ(std::vector<size_t>(out_span.begin(), out_span.end()),
+              expected_out);
+    EXPECT_EQ(std::vector<size_t>(in_span.begin(), in_span.end()),
+              expected_in);
+    EXPECT_EQ(network.out_edges(v), expected_out);
+    EXPECT_EQ(network.in_edges(v), expected_in);
+  }
+
+  // The adjacency index is part of the value semantics of the network
+  const cda_rail::Network network_copy = network;
+  for (size_t v = 0; v < network.number_of_vertices(); ++v) {
+    EXPECT_EQ(network_copy.out_edges(v), network.out_edges(v));
+    EXPECT_EQ(network_copy.in_edges(v), network.in_edges(v));
+  }
+}
+
+TEST(Functionality, NetworkEdgeLookup) {
+  cda_rail::Network network;
+  network.add_vertex("v0", cda_rail::VertexType::TTD);
+  network.add_vertex("v1", cda_rail::VertexType::TTD);
+  network.add_vertex("v2", cda_rail::VertexType::TTD);
+
+  const auto v0_v1 = network.add_edge("v0", "v1", 100, 100, true, 10);
+  const auto v1_v2 = network.add_edge("v1", "v2", 50, 100, false);
+  const auto v1_v0 = network.add_edge("v1", "v0", 100, 100, true, 10);
+
+  EXPECT_EQ(network.get_edge_index(0, 1), v0_v1);
+  EXPECT_EQ(network.get_edge_index(1, 2), v1_v2);
+  EXPECT_EQ(network.get_edge_index(1, 0), v1_v0);
+  EXPECT_FALSE(network.has_edge(2, 1));
+  EXPECT_THROW(network.get_edge_index(2, 1),
+               cda_rail::exceptions::EdgeNotExistentException);
+  EXPECT_THROW(network.get_edge(0, 2),
+               cda_rail::exceptions::EdgeNotExistentException);
+  EXPECT_THROW(network.add_edge("v0", "v1", 10, 10),
+               cda_rail::exceptions::InvalidInputException);
+
+  // The original edge indices now belong to the last (respectively first)
+  // part of the separated edges
+  network.separate_edge(v0_v1, &cda_rail::vss::functions::uniform);
+  EXPECT_FALSE(network.has_edge("v0", "v1"));
+  EXPECT_FALSE(network.has_edge("v1", "v0"));
+  for (size_t e = 0; e < network.number_of_edges(); ++e) {
+    const auto& edge = network.get_edge(e);
+    EXPECT_TRUE(network.has_edge(edge.source, edge.target));
+    EXPECT_EQ(network.get_edge_index(edge.source, edge.target), e);
+    EXPECT_EQ(&network.get_edge(edge.source, edge.target), &edge);
+  }
+  EXPECT_EQ(network.get_edge(v0_v1).target, 1);
+  EXPECT_EQ(network.get_edge(v1_v0).target, 0);
+
+  // Renaming vertices keeps the lookup by name consistent
+  network.change_vertex_name("v1", "v1_new");
+  EXPECT_EQ(network.get_edge_index("v1_new", "v2"), v1_v2);
+  EXPECT_TRUE(network.has_edge("v1_new", "v2"));
+  EXPECT_THROW(network.get_edge_index("v1", "v2"),
+               cda_rail::exceptions::VertexNotExistentException);
+}
+
 TEST(Functionality, NetworkVerticesByType) {
   cda_rail::Network network;
   // Add vertices of each type NoBorder (1x), TTD (2x), VSS (3x), NoBorderVSS
@@ -2803,6 +3233,86 @@ TEST(Functionality, ShortestPaths) {
   EXPECT_EQ(shortest_paths_4_path, std::vector<size_t>({v1_v2}));
 }
 
+TEST(Functionality, ShortestPathsMatrix) {
+  cda_rail::Network network;
+  network.add_vertex("v00", cda_rail::VertexType::TTD);
+  network.add_vertex("v01", cda_rail::VertexType::TTD);
+  network.add_vertex("v1", cda_rail::VertexType::TTD);
+  network.add_vertex("v2", cda_rail::VertexType::TTD);
+  network.add_vertex("v3", cda_rail::VertexType::TTD);
+
+  const auto v00_v1 = network.add_edge("v00", "v1", 100, 100, false);
+  const auto v01_v1 = network.add_edge("v01", "v1", 150, 100, false);
+  const auto v1_v2  = network.add_edge("v1", "v2", 44, 100, true, 10);
+  const auto v2_v3  = network.add_edge("v2", "v3", 100, 100, false);
+  const auto v1_v00 = network.add_edge("v1", "v00", 100, 100, false);
+  const auto v1_v01 = network.add_edge("v1", "v01", 150, 100, false);
+  const auto v2_v1  = network.add_edge("v2", "v1", 44, 100, true, 10);
+  const auto v3_v2  = network.add_edge("v3", "v2", 100, 100, false);
+
+  network.add_successor(v00_v1, v1_v2);
+  network.add_successor(v01_v1, v1_v2);
+  network.add_successor(v1_v2, v2_v3);
+  network.add_successor(v3_v2, v2_v1);
+  network.add_successor(v2_v1, v1_v00);
+  network.add_successor(v2_v1, v1_v01);
+
+  network.discretize();
+  const auto n = network.number_of_edges();
+
+  // Reference values using Floyd-Warshall on the successor graph
+  std::vector<std::vector<double>> expected(
+      n, std::vector<double>(n, cda_rail::INF));
+  for (size_t u = 0; u < n; ++u) {
+    for (size_t v = 0; v < n; ++v) {
+      if (u == v) {
+        expected[u][v] = 0;
+      } else if (network.is_valid_successor(u, v)) {
+        expected[u][v] = network.get_edge(v).length;
+      }
+    }
+  }
+  for (size_t k = 0; k < n; ++k) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        expected[i][j] =
+            std::min(expected[i][j], expected[i][k] + expected[k][j]);
+      }
+    }
+  }
+
+  EXPECT_EQ(network.all_edge_pairs_shortest_paths(), expected);
+
+  for (const size_t num_threads : {1, 3, 0}) {
+    const auto matrix =
+        network.all_edge_pairs_shortest_paths_matrix(num_threads);
+    const auto compact =
+        network.all_edge_pairs_shortest_paths_matrix_compact(num_threads);
+    EXPECT_EQ(matrix.size(), n);
+    EXPECT_EQ(compact.size(), n);
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matrix.row(i).data()) % 64,
+                0);
+      for (size_t j = 0; j < n; ++j) {
+        EXPECT_EQ(matrix(i, j), expected[i][j]);
+        if (expected[i][j] >= cda_rail::INF) {
+          EXPECT_EQ(compact(i, j),
+                    cda_rail::DistanceMatrix<float>::unreachable());
+        } else {
+          EXPECT_NEAR(compact(i, j), expected[i][j], 1e-3);
+        }
+      }
+    }
+    EXPECT_THROW(static_cast<void>(matrix.at(n, 0)), std::out_of_range);
+  }
+
+  // v00 -> v1 -> v2 -> v3 has length 44 + 100 after the first edge
+  EXPECT_EQ(network.all_edge_pairs_shortest_paths_matrix()(v00_v1, v2_v3),
+            144);
+  EXPECT_EQ(network.all_edge_pairs_shortest_paths_matrix()(v2_v3, v00_v1),
+            cda_rail::INF);
+}
+
 TEST(Functionality, ReadTrains) {
   auto trains = cda_rail::TrainList::import_trains(
       "./example-networks/SimpleStation/timetable/");